@@ -2210,7 +2210,9 @@ DOIP_LOCAL FUNC(void, DOIP_CODE) DoIP_TxTcpQueue_AddGenNack(
  *  DoIP_TxTcpQueue_AddRoutingActivationRes()
  *********************************************************************************************************************/
 /*! \brief          Adds a DoIP TCP Routing Activation Response message to Tx TCP queue.
- *  \details        -
+ *  \details        Releases the routing activation handler as soon as the final response is prepared so that
+ *                  routing activation requests of other testers can be processed without waiting for the response
+ *                  to be copied by SoAd.
  *  \param[in]      QueueIdx          Index of the first free element in the Tx TCP queue.
  *                                    [range: QueueIdx < DoIP_GetSizeOfTxTcpMgt() &&
                                               QueueIdx < (DoIP_GetSizeOfTxTcpMgtEndIdxOfConnectionTcp(ConnectionTcpIdx) -
@@ -9440,6 +9442,7 @@ DOIP_LOCAL FUNC(void, DOIP_CODE) DoIP_TxTcpQueue_AddGenNack(
  *
  *
  *
+ *
  */
 DOIP_LOCAL FUNC(void, DOIP_CODE) DoIP_TxTcpQueue_AddRoutingActivationRes(
   DoIP_SizeOfTxTcpMgtType QueueIdx,
@@ -9511,6 +9514,15 @@ DOIP_LOCAL FUNC(void, DOIP_CODE) DoIP_TxTcpQueue_AddRoutingActivationRes(
   DoIP_SetTxHdrBufLenOfTxTcpMgtDyn(txTcpMgtIdx, bufIdx);                                                               /* SBSW_DOIP_TxTcpMgt */
   msg->SduLength = bufIdx;                                                                                             /* SBSW_DOIP_PARAM_VALID_POINTER_WRITE */
   msg->SduDataPtr = txHdrBufPtr;                                                                                       /* SBSW_DOIP_PARAM_VALID_POINTER_WRITE */
+
+  /* #80 Release routing activation handler if response of the routing activation handled on this connection is
+   *     prepared completely and confirmation is not pending. In case of confirmation a routing activation response
+   *     is sent even if routing activation is not finished. */
+  if ( (DoIP_GetConnectionTcpIdxOfRoutActivHandler(0u) == ConnectionTcpIdx) &&
+       (DoIP_GetActivStateOfConnectionTcpDyn(ConnectionTcpIdx) != DOIP_ROUT_ACTIV_STATE_CONF_PENDING) )
+  {
+    DoIP_SetConnectionTcpIdxOfRoutActivHandler(0u, DoIP_GetSizeOfConnectionTcp());                                     /* SBSW_DOIP_RoutActivHandler */
+  }
 } /* DoIP_TxTcpQueue_AddRoutingActivationRes() */
 
 /**********************************************************************************************************************
@@ -9887,10 +9899,7 @@ DOIP_LOCAL FUNC(BufReq_ReturnType, DOIP_CODE) DoIP_TxTcpQueue_Copy(
  *
  *
  *
- *
- *
  */
-/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
 DOIP_LOCAL FUNC(BufReq_ReturnType, DOIP_CODE) DoIP_TxTcpQueue_CopyHeader(
   DoIP_SizeOfTxTcpMgtType QueueIdx,
   DoIP_SizeOfConnectionTcpType ConnectionTcpIdx,
@@ -9903,7 +9912,6 @@ DOIP_LOCAL FUNC(BufReq_ReturnType, DOIP_CODE) DoIP_TxTcpQueue_CopyHeader(
   const DoIP_SizeOfTxTcpMgtType txTcpMgtIdx = (DoIP_SizeOfTxTcpMgtType)(
     DoIP_GetTxTcpMgtStartIdxOfConnectionTcp(ConnectionTcpIdx) + QueueIdx);
   const DoIP_TxHdrBufLenOfTxTcpMgtDynType txHdrBufLen = DoIP_GetTxHdrBufLenOfTxTcpMgtDyn(txTcpMgtIdx);
-  const DoIP_SizeOfConnectionTcpType connectionTcpIdx = DoIP_GetConnectionTcpIdxOfRoutActivHandler(0u);
   DoIP_TxBytesCopiedOfConnectionTcpDynType txBytesCopied = DoIP_GetTxBytesCopiedOfConnectionTcpDyn(ConnectionTcpIdx);
   const DoIP_TxHdrBufType *txHdrBufPtr = DoIP_GetAddrTxHdrBuf(DoIP_GetTxHdrBufStartIdxOfTxTcpMgt(txTcpMgtIdx));
 
@@ -9922,22 +9930,9 @@ DOIP_LOCAL FUNC(BufReq_ReturnType, DOIP_CODE) DoIP_TxTcpQueue_CopyHeader(
       txBytesCopied += PduInfoPtr->SduLength;
       DoIP_SetTxBytesCopiedOfConnectionTcpDyn(ConnectionTcpIdx, txBytesCopied);                                        /* SBSW_DOIP_PARAM_VALID_INDEX_AND_CSL02 */
 
-      /* #40 Check if header was copied completely. */
+      /* #40 Indicate if header was copied completely. */
       if ( txBytesCopied == txHdrBufLen )
       {
-        uint16 hdrTypeField;
-
-        IPBASE_GET_UINT16(&txHdrBufPtr[DOIP_GEN_HDR_TYPE_IDX], 0u, hdrTypeField);                                      /* SBSW_DOIP_PARAM_CONST_POINTER_FORWARD */
-
-        /* #50 Check if Routing Activation Response shall be sent while confirmation is not pending. In case of
-         *     confirmation a Routing Activation Response might be sent even if Routing Activation is not finished. */
-        if ( (hdrTypeField == DOIP_HDR_TYPE_ROUT_ACTIV_RES) && (connectionTcpIdx != DoIP_GetSizeOfConnectionTcp()) &&
-             (DoIP_GetActivStateOfConnectionTcpDyn(connectionTcpIdx) != DOIP_ROUT_ACTIV_STATE_CONF_PENDING) )
-        {
-          /* #60 Release Routing Activation Handler. */
-          DoIP_SetConnectionTcpIdxOfRoutActivHandler(0u, DoIP_GetSizeOfConnectionTcp());                               /* SBSW_DOIP_RoutActivHandler */
-        }
-
         *HdrCopied = TRUE;                                                                                             /* SBSW_DOIP_PARAM_VALID_POINTER_WRITE */
       }
     }
@@ -17406,9 +17401,9 @@ FUNC(void, DOIP_CODE) DoIP_DhcpEvent(
                           is possible to use DoIP_GetConnectionTcpIdxOfRoutActivHandler() to check if the other valeus
                           are valid, too.
                           These indexes are set to DoIP_GetSizeOfXyz() in context of DoIP_SoConModeChg() or if the
-                          routing activation response could be activated and sent successfully in context of
-                          DoIP_SoAdTpCopyTxData() (--> DoIP_TxTcpQueue_CopyHeader()) or if routing activation is
-                          pending and during succssfully retry in DoIP_MainFunction()
+                          routing activation response has been added to the Tx TCP queue in context of
+                          DoIP_TxTcp_Transmit() (--> DoIP_TxTcpQueue_AddRoutingActivationRes()) or if routing
+                          activation is pending and during succssfully retry in DoIP_MainFunction()
                           (--> DoIP_RxTcpRout_HandleRetryRoutingActivationAuthAndConf()).
 
   \ID SBSW_DOIP_TxTcpMgt
@@ -777,7 +777,7 @@ DOIPINT_LOCAL_INLINE FUNC(DoIPInt_MsgHndl_RetType, DOIPINT_CODE) DoIPInt_DiagMsg
   const DoIPInt_SizeOfDiagMsgCfgType diagMsgCfgIdx = DoIPInt_GetDiagMsgCfgIdxOfConnection(ConnectionIdx);
   uint8                              offset = DoIPInt_GetRxOffsetParseOfDiagMsgCfgDyn(diagMsgCfgIdx);
   DoIPInt_SizeOfDiagMsgParseBufType  parseBufStartIdx = DoIPInt_GetDiagMsgParseBufStartIdxOfDiagMsgCfg(diagMsgCfgIdx);
-  uint32                             parseLength = (uint32)DoIPInt_GetEventMaxUserDataLength() +
+  uint32                             parseLength = DoIPInt_Event_GetMaxUserDataLength() +
     DOIPINT_DIAG_DATA_HDR_LEN;
   DoIPInt_SizeOfDiagMsgParseBufType  parseBufLength = DoIPInt_GetDiagMsgParseBufEndIdxOfDiagMsgCfg(diagMsgCfgIdx) -
     parseBufStartIdx;
@@ -978,6 +978,29 @@ FUNC(DoIPInt_MsgHndl_RetType, DOIPINT_CODE) DoIPInt_Event_Report(
   return retVal;
 } /* DoIPInt_Event_Report() */
 
+/**********************************************************************************************************************
+ *  DoIPInt_Event_GetMaxUserDataLength()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(uint32, DOIPINT_CODE) DoIPInt_Event_GetMaxUserDataLength(void)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 maxUserDataLength = 0u;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Return the configured maximum user data length in case an event callback is configured. */
+  if ( DoIPInt_HasEventCbk() )
+  {
+    maxUserDataLength = (uint32)DoIPInt_GetEventMaxUserDataLength();
+  }
+
+  return maxUserDataLength;
+} /* DoIPInt_Event_GetMaxUserDataLength() */
+
 # define DOIPINT_STOP_SEC_CODE
 # include "DoIPInt_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
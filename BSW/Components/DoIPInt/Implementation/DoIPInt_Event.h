@@ -113,6 +113,20 @@ FUNC(DoIPInt_MsgHndl_RetType, DOIPINT_CODE) DoIPInt_Event_Report(
   DoIPInt_SizeOfConnectionType ConnectionIdx,
   DoIPInt_InternalEventType Event);
 
+/**********************************************************************************************************************
+ *  DoIPInt_Event_GetMaxUserDataLength()
+ *********************************************************************************************************************/
+/*! \brief        Returns the length of user data that has to be buffered on reception to be reported with events.
+ *  \details      User data is only forwarded to the event callback. Without an event callback no user data has to be
+ *                buffered so that received user data can be forwarded directly from the lower layer buffer.
+ *  \return       Maximum length of user data forwarded with events.
+ *  \pre          -
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *********************************************************************************************************************/
+FUNC(uint32, DOIPINT_CODE) DoIPInt_Event_GetMaxUserDataLength(void);
+
 #  define DOIPINT_STOP_SEC_CODE
 #  include "DoIPInt_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -932,7 +932,7 @@ DOIPINT_LOCAL_INLINE FUNC(DoIPInt_MsgHndl_RetType, DOIPINT_CODE) DoIPInt_LightHd
   /* ----- Local Variables ---------------------------------------------- */
   DoIPInt_SizeOfLightHdrCfgType lightHdrCfgIdx = DoIPInt_GetLightHdrCfgIdxOfConnection(ConnectionIdx);
   const uint32                  payloadLength = DOIPINT_LIGHTHDR_RX_GET_PARSED_PAYLOAD_LENGTH(ConnectionIdx);
-  const uint32                  parseLength = DOIPINT_MIN(DoIPInt_GetEventMaxUserDataLength(), payloadLength);
+  const uint32                  parseLength = DOIPINT_MIN(DoIPInt_Event_GetMaxUserDataLength(), payloadLength);
   DoIPInt_MsgHndl_RetType       retVal = DOIPINT_MSG_HANDLER_PENDING;
 
   /* ----- Implementation ----------------------------------------------- */
@@ -484,7 +484,7 @@ DOIPINT_LOCAL_INLINE FUNC(DoIPInt_MsgHndl_RetType, DOIPINT_CODE) DoIPInt_OemSpec
       DoIPInt_GetOemPayloadRxBufConfigIdxOfOemSpecificCfgDyn(oemSpecificCfgIdx);
     const DoIPInt_SizeOfOemPayloadRxBufType       oemRxBufStartIdx =
       DoIPInt_GetOemPayloadRxBufStartIdxOfOemPayloadRxBufConfig(oemRxBufCfgIdx);
-    const uint32                                  eventLen = DOIPINT_MIN(DoIPInt_GetEventMaxUserDataLength(),
+    const uint32                                  eventLen = DOIPINT_MIN(DoIPInt_Event_GetMaxUserDataLength(),
       PayloadLength);
 
     /* PRQA S 314 2 */ /* MD_MSR_VStdLibCopy */
@@ -812,7 +812,7 @@ FUNC(void, DOIPINT_CODE) DoIPInt_OemSpecific_RxGetParsedData(
     DoIPInt_GetOemPayloadRxBufConfigIdxOfOemSpecificCfgDyn(oemSpecificCfgIdx);
   const DoIPInt_SizeOfOemPayloadRxBufType       oemRxBufStartIdx =
     DoIPInt_GetOemPayloadRxBufStartIdxOfOemPayloadRxBufConfig(oemRxBufCfgIdx);
-  const uint32                                  oemBufLen = DOIPINT_MIN(DoIPInt_GetEventMaxUserDataLength(),
+  const uint32                                  oemBufLen = DOIPINT_MIN(DoIPInt_Event_GetMaxUserDataLength(),
     DoIPInt_GetLengthOfOemPayloadRxBufConfigDyn(oemRxBufCfgIdx));
   uint32                                        lengthToCopy = 0u;
 
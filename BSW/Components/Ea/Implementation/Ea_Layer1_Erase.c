@@ -26,6 +26,7 @@
  *********************************************************************************************************************/
 
 #include "Ea_Layer1_Erase.h"
+#include "Ea_Layer2_InstanceFinder.h"
 
 #include "Ea_TaskManager.h"
 #include "Ea_EepCoordinator.h"
@@ -234,6 +235,11 @@ FUNC(Std_ReturnType, EA_PUBLIC_CODE) EaEr_StartJob(void)
     {
       EaEr_ComponentParameter.EaEr_Status = MEMIF_BUSY;
       EaEr_ComponentParameter.EaEr_JobResult = MEMIF_JOB_PENDING;
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+      /* #30 Entire dataset is erased, thus it is removed from RAM index */
+      EaIf_RemoveFromIndex();
+#endif
     }
   }
   else
@@ -40,6 +40,12 @@
 
 #define EA_INSTANCE_FINDER_LAYER EA_LAYER_TWO_INDEX
 
+#if (EA_INSTANCE_INDEX == STD_ON)
+# if (EA_INSTANCE_INDEX_SIZE == 0u)
+#  error "EA_INSTANCE_INDEX_SIZE must not be zero, if EA_INSTANCE_INDEX is enabled"
+# endif
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  *********************************************************************************************************************/
@@ -63,6 +69,15 @@ typedef struct
   EaIf_StateType EaIf_StateMachine;
 } EaIf_ComponentParameterType;
 
+#if (EA_INSTANCE_INDEX == STD_ON)
+typedef struct
+{
+  Ea_AddressType DatasetStartAddress;
+  EaIh_InstanceType Instance;
+  boolean IsValid;
+} EaIf_IndexEntryType;
+#endif
+
 
 /**********************************************************************************************************************
  *  LOCAL DATA PROTOTYPES
@@ -74,6 +89,10 @@ EA_LOCAL P2VAR(EaIh_InstanceType, AUTOMATIC, EA_APPL_DATA) EaIf_Instance;
 
 EA_LOCAL VAR(EaIh_InstanceType, EA_APPL_DATA) EaIf_InstancePrev;
 
+#if (EA_INSTANCE_INDEX == STD_ON)
+EA_LOCAL VAR(EaIf_IndexEntryType, EA_APPL_DATA) EaIf_Index[EA_INSTANCE_INDEX_SIZE];
+#endif
+
 #define EA_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "Ea_MemMap.h"     /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -167,6 +186,35 @@ EA_LOCAL FUNC(void, EA_PRIVATE_CODE) EaIf_ProcessExamineInstanceState(void);
  */
 EA_LOCAL FUNC(void, EA_PRIVATE_CODE) EaIf_ProcessStateMachine(void);
 
+#if (EA_INSTANCE_INDEX == STD_ON)
+/**********************************************************************************************************************
+ EaIf_GetIndexEntry()
+ **********************************************************************************************************************/
+/*!
+ * \brief      Returns index of RAM index entry of current dataset
+ * \details    Maps start address of currently processed dataset to an entry of RAM index
+ * \return     Index of entry in range [0, EA_INSTANCE_INDEX_SIZE - 1]
+ * \pre        -
+ * \context    TASK
+ * \reentrant  FALSE
+ */
+EA_LOCAL FUNC(uint16, EA_PRIVATE_CODE) EaIf_GetIndexEntry(void);
+
+/**********************************************************************************************************************
+ EaIf_LookupIndex()
+ **********************************************************************************************************************/
+/*!
+ * \brief      Looks up most recent instance of current dataset in RAM index
+ * \details    If RAM index contains current dataset, its most recent instance is copied to EaIf_Instance
+ * \return     TRUE: Instance was found in RAM index
+ * \return     FALSE: Current dataset is not contained in RAM index
+ * \pre        EaIf_Instance is initialized
+ * \context    TASK
+ * \reentrant  FALSE
+ */
+EA_LOCAL FUNC(boolean, EA_PRIVATE_CODE) EaIf_LookupIndex(void);
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTIONS
  *********************************************************************************************************************/
@@ -254,8 +302,59 @@ EA_LOCAL FUNC(void, EA_PRIVATE_CODE) EaIf_FinishJob(MemIf_JobResultType JobResul
   EaIf_ComponentParameter.EaIf_JobResult = JobResult;
   EaIf_ComponentParameter.EaIf_Status = MEMIF_IDLE;
   EaIf_ComponentParameter.EaIf_StateMachine = EA_IF_STATE_IDLE;
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+  /* #20 Most recent instance is stored to RAM index, subsequent searches in this dataset need no EEPROM access */
+  if (JobResult == MEMIF_JOB_OK)
+  {
+    EaIf_UpdateIndex(EaIf_Instance); /* SBSW_EA_43 */
+  }
+#endif
+}
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+/**********************************************************************************************************************
+ EaIf_GetIndexEntry()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+EA_LOCAL FUNC(uint16, EA_PRIVATE_CODE) EaIf_GetIndexEntry(void)
+{
+  Ea_AddressType datasetStartAddress = EaDh_GetDatasetStartAddress();
+
+  /* #10 Dataset start addresses are aligned, thus upper address bits are folded in to spread entries */
+  return (uint16) ((datasetStartAddress ^ (datasetStartAddress >> 5u)) % (Ea_AddressType) EA_INSTANCE_INDEX_SIZE);
 }
 
+/**********************************************************************************************************************
+ EaIf_LookupIndex()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+EA_LOCAL FUNC(boolean, EA_PRIVATE_CODE) EaIf_LookupIndex(void)
+{
+  boolean retVal = FALSE;
+  uint16 entry = EaIf_GetIndexEntry();
+
+  /* #10 Entry is only used if it belongs to current dataset, it might be occupied by another dataset */
+  if ((EaIf_Index[entry].IsValid == TRUE) &&
+      (EaIf_Index[entry].DatasetStartAddress == EaDh_GetDatasetStartAddress()))
+  {
+    *EaIf_Instance = EaIf_Index[entry].Instance; /* SBSW_EA_43 */
+    retVal = TRUE;
+  }
+
+  return retVal;
+}
+#endif
+
 /**********************************************************************************************************************
  EaIf_ProcessIdleState()
  **********************************************************************************************************************/
@@ -400,6 +499,18 @@ FUNC(void, EA_PUBLIC_CODE) EaIf_Init(void)
 
   EaIh_InitInstance(&EaIf_InstancePrev); /* SBSW_EA_44 */
 
+#if (EA_INSTANCE_INDEX == STD_ON)
+  {
+    uint16 entry;
+
+    /* #10 RAM index is empty after initialization, it is built up lazily by InstanceFinder jobs */
+    for (entry = 0u; entry < EA_INSTANCE_INDEX_SIZE; entry++)
+    {
+      EaIf_Index[entry].IsValid = FALSE; /* SBSW_EA_47 */
+    }
+  }
+#endif
+
   EaIf_ComponentParameter.EaIf_StateMachine = EA_IF_STATE_IDLE;
 }
 
@@ -454,6 +565,14 @@ FUNC(Std_ReturnType, EA_PUBLIC_CODE) EaIf_StartJob(EaIh_InstanceVarPointerType I
       EaIf_ComponentParameter.EaIf_JobResult = MEMIF_JOB_PENDING;
 
       EaIf_Instance = Instance;
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+      /* #30 Most recent instance is known from RAM index, thus job is finished without reading management bytes */
+      if (EaIf_LookupIndex() == TRUE)
+      {
+        EaIf_FinishJob(MEMIF_JOB_OK);
+      }
+#endif
     }
   }
   else
@@ -493,6 +612,40 @@ FUNC(void, EA_PUBLIC_CODE) EaIf_Cancel(void)
   EaIf_FinishJob(MEMIF_JOB_CANCELED);
 }
 
+#if (EA_INSTANCE_INDEX == STD_ON)
+/**********************************************************************************************************************
+ *  EaIf_UpdateIndex()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, EA_PUBLIC_CODE) EaIf_UpdateIndex(EaIh_InstanceConstPointerType Instance)
+{
+  uint16 entry = EaIf_GetIndexEntry();
+
+  /* #10 Entry is overwritten, a previously stored dataset with same entry is displaced */
+  EaIf_Index[entry].DatasetStartAddress = EaDh_GetDatasetStartAddress(); /* SBSW_EA_47 */
+  EaIf_Index[entry].Instance = *Instance; /* SBSW_EA_47 */
+  EaIf_Index[entry].IsValid = TRUE; /* SBSW_EA_47 */
+}
+
+/**********************************************************************************************************************
+ *  EaIf_RemoveFromIndex()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, EA_PUBLIC_CODE) EaIf_RemoveFromIndex(void)
+{
+  /* #10 Entry is invalidated regardless of the dataset it belongs to, a displaced dataset is simply searched again */
+  EaIf_Index[EaIf_GetIndexEntry()].IsValid = FALSE; /* SBSW_EA_47 */
+}
+#endif
+
 #define EA_STOP_SEC_CODE
 #include "Ea_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -539,5 +692,10 @@ FUNC(void, EA_PUBLIC_CODE) EaIf_Cancel(void)
                    EaIh_InstanceVarPointerType
       \COUNTERMEASURE \N Instance parameter is passed to function via input parameter, thus caller ensures
                          that parameter referenced by pointer is valid.
+    \ID SBSW_EA_47
+      \DESCRIPTION Array write access of EaIf_Index
+      \COUNTERMEASURE \N The index is either a loop counter limited by EA_INSTANCE_INDEX_SIZE or is calculated by
+                         EaIf_GetIndexEntry(), which returns a value modulo EA_INSTANCE_INDEX_SIZE. Thus array access is
+                         always in bounds.
 SBSW_JUSTIFICATION_END */
 
@@ -31,6 +31,21 @@
 # include "Ea.h"
 # include "Ea_InstanceHandler.h"
 
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/* RAM index of most recent instances. Each entry holds the search result of one dataset, thus management bytes of a
+ * dataset are only read once after initialization, as long as its entry is not displaced by another dataset. */
+# ifndef EA_INSTANCE_INDEX /* COV_EA_COMPATIBILITY */
+#  define EA_INSTANCE_INDEX                STD_OFF
+# endif
+
+/* Number of entries of the RAM index. Datasets are mapped to entries by their start address. */
+# ifndef EA_INSTANCE_INDEX_SIZE /* COV_EA_COMPATIBILITY */
+#  define EA_INSTANCE_INDEX_SIZE           (32u)
+# endif
+
 
 /**********************************************************************************************************************
  *  GLOBAL FUNCTION PROTOTYPES
@@ -122,6 +137,39 @@ FUNC(void, EA_PUBLIC_CODE) EaIf_Execute(void);
  */
 FUNC(void, EA_PUBLIC_CODE) EaIf_Cancel(void);
 
+# if (EA_INSTANCE_INDEX == STD_ON)
+/**********************************************************************************************************************
+ *  EaIf_UpdateIndex()
+ *********************************************************************************************************************/
+/*!
+ * \brief      Stores most recent instance of current dataset to RAM index
+ * \details    Stores passed instance object as most recent instance of currently processed dataset to RAM index.
+ *             Subsequent InstanceFinder jobs of this dataset are finished without reading management bytes.
+ * \param[in]  Instance
+ * \pre        Instance object reflects the content of EEPROM.
+ * \context    TASK
+ * \reentrant  FALSE
+ * \synchronous TRUE
+ * \config     EA_INSTANCE_INDEX == STD_ON
+ */
+FUNC(void, EA_PUBLIC_CODE) EaIf_UpdateIndex(EaIh_InstanceConstPointerType Instance);
+
+/**********************************************************************************************************************
+ *  EaIf_RemoveFromIndex()
+ *********************************************************************************************************************/
+/*!
+ * \brief      Removes current dataset from RAM index
+ * \details    Has to be called before the content of currently processed dataset is modified in EEPROM. Next
+ *             InstanceFinder job of this dataset will read management bytes again.
+ * \pre        -
+ * \context    TASK
+ * \reentrant  FALSE
+ * \synchronous TRUE
+ * \config     EA_INSTANCE_INDEX == STD_ON
+ */
+FUNC(void, EA_PUBLIC_CODE) EaIf_RemoveFromIndex(void);
+# endif
+
 # define EA_STOP_SEC_CODE
 # include "Ea_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -27,6 +27,7 @@
  *********************************************************************************************************************/
 
 #include "Ea_Layer2_InvalidateInstance.h"
+#include "Ea_Layer2_InstanceFinder.h"
 
 #include "Ea_TaskManager.h"
 #include "Ea_EepCoordinator.h"
@@ -375,6 +376,11 @@ FUNC(Std_ReturnType, EA_PUBLIC_CODE) EaInvInst_StartJob(EaIh_InstanceType Instan
       EaInvInst_ComponentParameter.EaInvInst_JobResult = MEMIF_JOB_PENDING;
 
       EaInvInst_Instance = Instance;
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+      /* #30 Dataset is modified, next InstanceFinder job has to evaluate management bytes again */
+      EaIf_RemoveFromIndex();
+#endif
     }
   }
   else
@@ -28,6 +28,7 @@
  *********************************************************************************************************************/
 
 #include "Ea_Layer2_WriteInstance.h"
+#include "Ea_Layer2_InstanceFinder.h"
 
 #include "Ea_TaskManager.h"
 #include "Ea_EepCoordinator.h"
@@ -254,6 +255,14 @@ EA_LOCAL FUNC(void, EA_PRIVATE_CODE) EaWrInst_FinishJob(MemIf_JobResultType JobR
   EaWrInst_ComponentParameter.EaWrInst_JobResult = JobResult;
   EaWrInst_ComponentParameter.EaWrInst_Status = MEMIF_IDLE;
   EaWrInst_ComponentParameter.EaWrInst_StateMachine = EA_WRINST_STATE_IDLE;
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+  /* #30 Successfully written instance is the most recent instance of the dataset */
+  if (JobResult == MEMIF_JOB_OK)
+  {
+    EaIf_UpdateIndex(&EaWrInst_Instance); /* SBSW_EA_64 */
+  }
+#endif
 }
 
 /**********************************************************************************************************************
@@ -651,6 +660,11 @@ FUNC(Std_ReturnType, EA_PUBLIC_CODE) EaWrInst_StartJob(EaIh_InstanceType Instanc
 
       EaWrInst_Instance = Instance;
       EaWrInst_UserJobParameter = UserJobParameter;
+
+#if (EA_INSTANCE_INDEX == STD_ON)
+      /* #30 Dataset is modified, RAM index entry is not reliable until job finished successfully */
+      EaIf_RemoveFromIndex();
+#endif
     }
   }
   else
@@ -383,6 +383,11 @@ FUNC(void, ETHIF_CODE) EthIf_GetVersionInfo(
      \ACCEPT TX
      \REASON [MSR_COV_COMPATIBILITY]
 
+   \ID COV_ETHIF_COMPATIBILITY
+     \ACCEPT TX
+     \REASON [MSR_COV_COMPATIBILITY] The default definition is used unless the integrator maps the callout to a function
+             of an upper layer.
+
    \ID COV_ETHIF_UNIT_TEST
      \ACCEPT TX
      \REASON Function definitions are only removed for unit testing with Ceedling due to mock generation.
@@ -786,6 +786,8 @@ FUNC(void, ETHIF_CODE) EthIf_MainFunctionRx( void ) /* PRQA S 6080 */ /* MD_MSR_
       EthIf_SetEthCtrlRxFrameCnt(ethCtrlIdx, EthIf_GetMaxFrameRxPerEthCtrl());                                          /* SBSW_ETHIF_COMMON_CSL03 */
     }
 
+    ETHIF_RX_BURST_BEGIN_CALLOUT();
+
     /* #30 Poll for frames to be received until no more frames are available
      *     or the maximum count of frames per Ethernet controller is reached */
     do
@@ -821,6 +823,8 @@ FUNC(void, ETHIF_CODE) EthIf_MainFunctionRx( void ) /* PRQA S 6080 */ /* MD_MSR_
       }
     }
     while ( moreFramesPresent == TRUE ); /* more frames available for reception? */
+
+    ETHIF_RX_BURST_END_CALLOUT();
   }
 #endif /* ETHIF_ENABLE_RX_INTERRUPT */
 } /* EthIf_MainFunctionRx() */
@@ -79,6 +79,17 @@
 /**********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
  *********************************************************************************************************************/
+/* Callouts invoked before and after each receive polling run of EthIf_MainFunctionRx(). They allow an upper layer to
+ * process the frames of a run as one batch, e.g. by mapping them to TcpIp_RxBurstBegin() and TcpIp_RxBurstEnd().
+ * Only receive polling is covered: with ETHIF_ENABLE_RX_INTERRUPT the frames are indicated by the driver one by one and
+ * the callouts are not invoked. */
+# if !defined (ETHIF_RX_BURST_BEGIN_CALLOUT)                                                                            /* COV_ETHIF_COMPATIBILITY */
+#  define ETHIF_RX_BURST_BEGIN_CALLOUT()
+# endif
+
+# if !defined (ETHIF_RX_BURST_END_CALLOUT)                                                                              /* COV_ETHIF_COMPATIBILITY */
+#  define ETHIF_RX_BURST_END_CALLOUT()
+# endif
 
 /**********************************************************************************************************************
  *  GLOBAL DATA TYPES AND STRUCTURES
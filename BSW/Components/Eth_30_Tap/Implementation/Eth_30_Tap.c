@@ -0,0 +1,1518 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  Eth_30_Tap.c
+ *        \brief  Ethernet driver for Linux TAP devices and AF_PACKET sockets
+ *
+ *      \details  Implementation of the Eth_30_Tap driver.
+ *                TAP backend: frames are exchanged with a TAP device by non-blocking read()/write().
+ *                PACKET_MMAP backend: an AF_PACKET socket bound to a network interface with TPACKET_V2 Rx and Tx
+ *                rings mapped into the process. Received frames are indicated directly out of the Rx ring; frames
+ *                to be transmitted are copied from the Tx buffer into the Tx ring and the kernel is kicked once per
+ *                frame with a non-blocking send().
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Refer to the module's header file.
+ *********************************************************************************************************************/
+
+#define ETH_30_TAP_SOURCE
+
+/* PRQA S 0602, 0603 EOF */ /* MD_Eth_30_Tap_HostApi */
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <linux/if_tun.h>
+
+#include "Eth_30_Tap.h"
+#include "EthIf_Cbk.h"
+#include "SchM_Eth_30_Tap.h"
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+# include "Det.h"
+#endif
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define ETH_30_TAP_HDR_LEN                        (14u)
+#define ETH_30_TAP_HDR_TYPE_OFFSET                (12u)
+#define ETH_30_TAP_MAX_PAYLOAD_LEN                (ETH_30_TAP_MAX_FRAME_LEN - ETH_30_TAP_HDR_LEN)
+
+/* Size of one TPACKET_V2 ring frame: tpacket2_hdr, sockaddr_ll and the Ethernet frame fit into 2 KiB. */
+#define ETH_30_TAP_RING_FRAME_SIZE                (2048u)
+/* Offset of the Ethernet frame in a ring frame: TPACKET_ALIGN(TPACKET2_HDRLEN), sizeof() can not be evaluated by #if */
+#define ETH_30_TAP_RING_FRAME_HDR_LEN             (64u)
+
+#define ETH_30_TAP_INVALID_FD                     (-1)
+
+/* States of a Tx buffer */
+#define ETH_30_TAP_TX_BUF_FREE                    (0u)
+#define ETH_30_TAP_TX_BUF_PROVIDED                (1u)
+#define ETH_30_TAP_TX_BUF_WAIT_CONF               (2u)
+
+#if ((ETH_30_TAP_RING_FRAME_HDR_LEN + ETH_30_TAP_MAX_FRAME_LEN) > ETH_30_TAP_RING_FRAME_SIZE)
+# error "Eth_30_Tap: ETH_30_TAP_MAX_FRAME_LEN exceeds the ring frame size"
+#endif
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ *********************************************************************************************************************/
+#if !defined (ETH_30_TAP_LOCAL)                                                                                         /* COV_ETH_30_TAP_COMPATIBILITY */
+# define ETH_30_TAP_LOCAL                                             static
+#endif
+
+#if !defined (ETH_30_TAP_LOCAL_INLINE)                                                                                  /* COV_ETH_30_TAP_COMPATIBILITY */
+# define ETH_30_TAP_LOCAL_INLINE                                      LOCAL_INLINE
+#endif
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+/*! Runtime data of one controller. */
+typedef struct
+{
+  uint8   TxBuf[ETH_30_TAP_TX_BUF_NUM][ETH_30_TAP_MAX_FRAME_LEN];      /*!< Tx buffers, payload starts behind the header */
+  uint8   RxBuf[ETH_30_TAP_MAX_FRAME_LEN];                              /*!< Rx buffer of the TAP backend */
+  uint8   TxBufState[ETH_30_TAP_TX_BUF_NUM];                            /*!< ETH_30_TAP_TX_BUF_* */
+  Std_ReturnType TxBufResult[ETH_30_TAP_TX_BUF_NUM];                    /*!< Result reported in Tx confirmation */
+  uint8   PhysAddr[ETH_30_TAP_PHYS_ADDR_LEN];                           /*!< Current MAC address */
+  uint8   FilterAddr[ETH_30_TAP_PHYS_ADDR_FILTER_NUM][ETH_30_TAP_PHYS_ADDR_LEN]; /*!< Additional accepted addresses */
+  uint8   FilterCnt;                                                    /*!< Number of used FilterAddr entries */
+  boolean IsPromiscuous;                                                /*!< All frames are accepted */
+  boolean IsInitialized;                                                /*!< Host device opened */
+  Eth_ModeType Mode;                                                    /*!< Controller mode */
+  uint8   TxBufSearchPos;                                               /*!< Start index of next free buffer search */
+  int     Fd;                                                           /*!< TAP device or AF_PACKET socket */
+  P2VAR(uint8, AUTOMATIC, ETH_30_TAP_VAR_NO_INIT) Ring;                /*!< Mapped Rx ring followed by Tx ring */
+  uint32  RingSize;                                                     /*!< Size of one ring in bytes */
+  uint16  RxRingFrames;                                                 /*!< Number of Rx ring frames */
+  uint16  TxRingFrames;                                                 /*!< Number of Tx ring frames */
+  uint16  RxRingPos;                                                    /*!< Next Rx ring frame to be checked */
+  uint16  TxRingPos;                                                    /*!< Next Tx ring frame to be filled */
+} Eth_30_Tap_CtrlDataType;
+
+/**********************************************************************************************************************
+ *  LOCAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+#define ETH_30_TAP_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/*! Configuration passed to Eth_30_Tap_Init(); NULL_PTR while the driver is not initialized. */
+ETH_30_TAP_LOCAL P2CONST(Eth_30_Tap_ConfigType, ETH_30_TAP_VAR_CLEARED, ETH_30_TAP_CONST) Eth_30_Tap_ConfigPtr;
+
+/*! Runtime data of all controllers. */
+ETH_30_TAP_LOCAL VAR(Eth_30_Tap_CtrlDataType, ETH_30_TAP_VAR_CLEARED) Eth_30_Tap_CtrlData[ETH_30_TAP_MAX_CTRLS];
+
+#define ETH_30_TAP_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#define ETH_30_TAP_START_SEC_CONST_8
+#include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+ETH_30_TAP_LOCAL CONST(uint8, ETH_30_TAP_CONST) Eth_30_Tap_BroadcastAddr[ETH_30_TAP_PHYS_ADDR_LEN] =
+{
+  0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu
+};
+
+#define ETH_30_TAP_STOP_SEC_CONST_8
+#include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+#define ETH_30_TAP_START_SEC_CODE
+#include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_CloseCtrl
+ *********************************************************************************************************************/
+/*! \brief          Releases the host resources of a controller
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_CloseCtrl(
+  P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_OpenTap
+ *********************************************************************************************************************/
+/*! \brief          Creates or attaches the TAP device of a controller
+ *  \param[in]      ctrlCfg   Configuration of the controller
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \return         E_OK     TAP device opened in non-blocking mode
+ *  \return         E_NOT_OK TAP device could not be opened
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_OpenTap(
+  P2CONST(Eth_30_Tap_CtrlConfigType, AUTOMATIC, ETH_30_TAP_CONST) ctrlCfg,
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_OpenPacketMmap
+ *********************************************************************************************************************/
+/*! \brief          Opens the AF_PACKET socket of a controller and maps its Rx and Tx rings
+ *  \param[in]      ctrlCfg   Configuration of the controller
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \return         E_OK     Socket bound to the interface and rings mapped
+ *  \return         E_NOT_OK Socket or rings could not be set up
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_OpenPacketMmap(
+  P2CONST(Eth_30_Tap_CtrlConfigType, AUTOMATIC, ETH_30_TAP_CONST) ctrlCfg,
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetRingFrame
+ *********************************************************************************************************************/
+/*! \brief          Returns the header of a ring frame
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \param[in]      ringOffset  0 for the Rx ring, RingSize for the Tx ring
+ *  \param[in]      frameIdx  Index of the frame within the ring
+ *  \return         Header of the ring frame
+ *  \pre            Rings are mapped
+ *  \context        TASK
+ *  \reentrant      TRUE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL_INLINE FUNC(struct tpacket2_hdr*, ETH_30_TAP_CODE) Eth_30_Tap_GetRingFrame(
+  P2CONST(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+          uint32                                                      ringOffset,
+          uint16                                                      frameIdx);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_IsFrameAccepted
+ *********************************************************************************************************************/
+/*! \brief          Applies the reception filter to the destination address of a received frame
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \param[in]      dstAddr   Destination MAC address of the frame
+ *  \return         TRUE frame is accepted, FALSE otherwise
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      TRUE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(boolean, ETH_30_TAP_CODE) Eth_30_Tap_IsFrameAccepted(
+  P2CONST(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+  P2CONST(uint8,                   AUTOMATIC, ETH_30_TAP_VAR_CLEARED) dstAddr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_IndicateFrame
+ *********************************************************************************************************************/
+/*! \brief          Filters a received frame and passes it to EthIf
+ *  \param[in]      CtrlIdx   Index of the controller
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \param[in]      frame     Received frame starting with the Ethernet header
+ *  \param[in]      frameLen  Length of the frame
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_IndicateFrame(
+          uint8                                                       CtrlIdx,
+  P2CONST(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+  P2CONST(uint8,                   AUTOMATIC, ETH_30_TAP_VAR_CLEARED) frame,
+          uint32                                                      frameLen);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_SendFrame
+ *********************************************************************************************************************/
+/*! \brief          Hands a complete frame to the host device
+ *  \param[in]      ctrlData  Runtime data of the controller
+ *  \param[in]      frame     Frame starting with the Ethernet header
+ *  \param[in]      frameLen  Length of the frame
+ *  \return         E_OK     Frame accepted by the host device
+ *  \return         E_NOT_OK Host device busy (Tx ring full) or error
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_SendFrame(
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+  P2CONST(uint8,                   AUTOMATIC, ETH_30_TAP_VAR_CLEARED) frame,
+          uint16                                                      frameLen);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_InternalTransmit
+ *********************************************************************************************************************/
+/*! \brief          Common implementation of Eth_30_Tap_Transmit() and Eth_30_Tap_VTransmit()
+ *  \param[in]      CtrlIdx         Index of the controller
+ *  \param[in]      BufIdx          Index of the Tx buffer
+ *  \param[in]      FrameType       EtherType
+ *  \param[in]      TxConfirmation  TRUE: confirm transmission in Eth_30_Tap_TxConfirmation()
+ *  \param[in]      LenByte         Payload length, 0 releases the buffer
+ *  \param[in]      DstPhysAddrPtr  Destination MAC address
+ *  \param[in]      SrcPhysAddrPtr  Source MAC address
+ *  \param[in]      sid             Service ID for DET reporting
+ *  \return         E_OK     Frame transmitted or buffer released
+ *  \return         E_NOT_OK Invalid buffer or host device error
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE for different buffers
+ *********************************************************************************************************************/
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_InternalTransmit(
+          uint8                                    CtrlIdx,
+          uint8                                    BufIdx,
+          Eth_FrameType                            FrameType,
+          boolean                                  TxConfirmation,
+          uint16                                   LenByte,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) DstPhysAddrPtr,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) SrcPhysAddrPtr,
+          uint8                                    sid);
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_CloseCtrl
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_CloseCtrl(
+  P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData)
+{
+  /* #10 Unmap the rings and close the host device */
+  if( ctrlData->Ring != NULL_PTR )
+  {
+    (void)munmap(ctrlData->Ring, (size_t)ctrlData->RingSize * 2u);
+    ctrlData->Ring = NULL_PTR;                                                                                          /* SBSW_ETH_30_TAP_CTRL_DATA */
+  }
+  if( ctrlData->IsInitialized == TRUE )
+  {
+    (void)close(ctrlData->Fd);
+  }
+  ctrlData->Fd = ETH_30_TAP_INVALID_FD;                                                                                 /* SBSW_ETH_30_TAP_CTRL_DATA */
+  ctrlData->IsInitialized = FALSE;                                                                                      /* SBSW_ETH_30_TAP_CTRL_DATA */
+  ctrlData->Mode = ETH_MODE_DOWN;                                                                                       /* SBSW_ETH_30_TAP_CTRL_DATA */
+} /* Eth_30_Tap_CloseCtrl() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_OpenTap
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_OpenTap(
+  P2CONST(Eth_30_Tap_CtrlConfigType, AUTOMATIC, ETH_30_TAP_CONST) ctrlCfg,
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  int fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
+
+  if( fd >= 0 )
+  {
+    struct ifreq ifr;
+
+    /* #10 Create the TAP device (or attach to an existing persistent one) without packet information header */
+    (void)memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = (short)(IFF_TAP | IFF_NO_PI);
+    (void)strncpy(ifr.ifr_name, ctrlCfg->IfName, IFNAMSIZ - 1u);
+
+    if( ioctl(fd, TUNSETIFF, &ifr) == 0 )
+    {
+      ctrlData->Fd = fd;                                                                                                /* SBSW_ETH_30_TAP_CTRL_DATA */
+      retVal = E_OK;
+    }
+    else
+    {
+      (void)close(fd);
+    }
+  }
+
+  return retVal;
+} /* Eth_30_Tap_OpenTap() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_OpenPacketMmap
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_OpenPacketMmap(
+  P2CONST(Eth_30_Tap_CtrlConfigType, AUTOMATIC, ETH_30_TAP_CONST) ctrlCfg,
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  int fd = socket(AF_PACKET, SOCK_RAW, (int)htons(ETH_P_ALL));
+
+  if( fd >= 0 )
+  {
+    const uint32 pageSize = (uint32)sysconf(_SC_PAGESIZE);
+    const uint32 blockSize = (pageSize > ETH_30_TAP_RING_FRAME_SIZE) ? pageSize : ETH_30_TAP_RING_FRAME_SIZE;
+    const uint32 framesPerBlock = blockSize / ETH_30_TAP_RING_FRAME_SIZE;
+    /* Both rings get the same size so that the Tx ring directly follows the Rx ring in the mapping */
+    const uint32 ringFrames = (ctrlCfg->RxRingFrames > ctrlCfg->TxRingFrames) ? ctrlCfg->RxRingFrames : ctrlCfg->TxRingFrames;
+    const uint32 blockNr = (ringFrames + framesPerBlock - 1u) / framesPerBlock;
+    int version = TPACKET_V2;
+    struct tpacket_req req;
+    struct sockaddr_ll addr;
+
+    req.tp_block_size = blockSize;
+    req.tp_block_nr = blockNr;
+    req.tp_frame_size = ETH_30_TAP_RING_FRAME_SIZE;
+    req.tp_frame_nr = blockNr * framesPerBlock;
+
+    (void)memset(&addr, 0, sizeof(addr));
+    addr.sll_family = AF_PACKET;
+    addr.sll_protocol = htons(ETH_P_ALL);
+    addr.sll_ifindex = (int)if_nametoindex(ctrlCfg->IfName);
+
+    /* #10 Request TPACKET_V2 Rx and Tx rings of equal size and map them with one mmap() call */
+    if(    (addr.sll_ifindex != 0)
+        && (blockNr > 0u)
+        && (setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version, sizeof(version)) == 0)
+        && (setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) == 0)
+        && (setsockopt(fd, SOL_PACKET, PACKET_TX_RING, &req, sizeof(req)) == 0) )
+    {
+      const uint32 ringSize = blockSize * blockNr;
+      void *ring = mmap(NULL, (size_t)ringSize * 2u, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+      /* #20 Bind the socket to the interface after the rings exist, so no frame bypasses the Rx ring */
+      if( ring != MAP_FAILED )
+      {
+        if( bind(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0 )                                                      /* PRQA S 0310 */ /* MD_Eth_30_Tap_HostApi */
+        {
+          ctrlData->Fd = fd;                                                                                            /* SBSW_ETH_30_TAP_CTRL_DATA */
+          ctrlData->Ring = (P2VAR(uint8, AUTOMATIC, ETH_30_TAP_VAR_NO_INIT))ring;                                      /* SBSW_ETH_30_TAP_CTRL_DATA */ /* PRQA S 0316 */ /* MD_Eth_30_Tap_HostApi */
+          ctrlData->RingSize = ringSize;                                                                                /* SBSW_ETH_30_TAP_CTRL_DATA */
+          ctrlData->RxRingFrames = (uint16)req.tp_frame_nr;                                                             /* SBSW_ETH_30_TAP_CTRL_DATA */
+          ctrlData->TxRingFrames = (uint16)req.tp_frame_nr;                                                             /* SBSW_ETH_30_TAP_CTRL_DATA */
+          retVal = E_OK;
+        }
+        else
+        {
+          (void)munmap(ring, (size_t)ringSize * 2u);
+        }
+      }
+    }
+
+    if( retVal != E_OK )
+    {
+      (void)close(fd);
+    }
+  }
+
+  return retVal;
+} /* Eth_30_Tap_OpenPacketMmap() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetRingFrame
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+ETH_30_TAP_LOCAL_INLINE FUNC(struct tpacket2_hdr*, ETH_30_TAP_CODE) Eth_30_Tap_GetRingFrame(
+  P2CONST(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+          uint32                                                      ringOffset,
+          uint16                                                      frameIdx)
+{
+  /* Frame size divides the block size, so frames are contiguous across blocks */
+  return (struct tpacket2_hdr*)&ctrlData->Ring[ringOffset + ((uint32)frameIdx * ETH_30_TAP_RING_FRAME_SIZE)];      /* PRQA S 0310, 3305 */ /* MD_Eth_30_Tap_HostApi */
+} /* Eth_30_Tap_GetRingFrame() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_IsFrameAccepted
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(boolean, ETH_30_TAP_CODE) Eth_30_Tap_IsFrameAccepted(
+  P2CONST(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+  P2CONST(uint8,                   AUTOMATIC, ETH_30_TAP_VAR_CLEARED) dstAddr)
+{
+  boolean isAccepted = FALSE;
+
+  /* #10 Accept all frames in promiscuous mode, broadcasts and frames addressed to the controller */
+  if(    (ctrlData->IsPromiscuous == TRUE)
+      || (memcmp(dstAddr, Eth_30_Tap_BroadcastAddr, ETH_30_TAP_PHYS_ADDR_LEN) == 0)
+      || (memcmp(dstAddr, ctrlData->PhysAddr, ETH_30_TAP_PHYS_ADDR_LEN) == 0) )
+  {
+    isAccepted = TRUE;
+  }
+  /* #20 Otherwise accept frames addressed to one of the filter addresses */
+  else
+  {
+    uint8_least filterIdx;
+
+    for( filterIdx = 0u; filterIdx < ctrlData->FilterCnt; filterIdx++ )
+    {
+      if( memcmp(dstAddr, ctrlData->FilterAddr[filterIdx], ETH_30_TAP_PHYS_ADDR_LEN) == 0 )
+      {
+        isAccepted = TRUE;
+        break;
+      }
+    }
+  }
+
+  return isAccepted;
+} /* Eth_30_Tap_IsFrameAccepted() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_IndicateFrame
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_IndicateFrame(
+          uint8                                                       CtrlIdx,
+  P2CONST(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+  P2CONST(uint8,                   AUTOMATIC, ETH_30_TAP_VAR_CLEARED) frame,
+          uint32                                                      frameLen)
+{
+  /* #10 Drop runt and oversized frames and frames not passing the reception filter */
+  if(    (frameLen >= ETH_30_TAP_HDR_LEN)
+      && (frameLen <= ETH_30_TAP_MAX_FRAME_LEN)
+      && (Eth_30_Tap_IsFrameAccepted(ctrlData, frame) == TRUE) )                                                        /* SBSW_ETH_30_TAP_RX_FRAME */
+  {
+    const Eth_FrameType frameType = (Eth_FrameType)(((uint16)frame[ETH_30_TAP_HDR_TYPE_OFFSET] << 8u)
+                                                  | (uint16)frame[ETH_30_TAP_HDR_TYPE_OFFSET + 1u]);
+    const boolean isBroadcast = (boolean)(memcmp(frame, Eth_30_Tap_BroadcastAddr, ETH_30_TAP_PHYS_ADDR_LEN) == 0);
+
+    /* #20 Indicate the payload; the Ethernet header stays accessible in front of it */
+    EthIf_RxIndication(CtrlIdx,
+                       frameType,
+                       isBroadcast,
+                       &frame[ETH_30_TAP_PHYS_ADDR_LEN],
+                       (P2CONST(Eth_DataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED))&frame[ETH_30_TAP_HDR_LEN],  /* PRQA S 0310 */ /* MD_Eth_30_Tap_HostApi */
+                       (uint16)(frameLen - ETH_30_TAP_HDR_LEN));                                                        /* SBSW_ETH_30_TAP_RX_FRAME */
+  }
+} /* Eth_30_Tap_IndicateFrame() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_SendFrame
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_SendFrame(
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData,
+  P2CONST(uint8,                   AUTOMATIC, ETH_30_TAP_VAR_CLEARED) frame,
+          uint16                                                      frameLen)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+
+  /* #10 PACKET_MMAP backend: copy the frame into the next Tx ring frame and kick the kernel.
+   *     The kernel processes the Tx ring strictly in order, therefore frames are copied into the ring on transmission
+   *     instead of handing out ring frames as Tx buffers which EthIf may release in any order. */
+  if( ctrlData->Ring != NULL_PTR )
+  {
+    struct tpacket2_hdr *hdr = Eth_30_Tap_GetRingFrame(ctrlData, ctrlData->RingSize, ctrlData->TxRingPos);             /* SBSW_ETH_30_TAP_CTRL_DATA */
+
+    if( (hdr->tp_status == TP_STATUS_AVAILABLE) || (hdr->tp_status == TP_STATUS_WRONG_FORMAT) )
+    {
+      /* PRQA S 0488 1 */ /* MD_Eth_30_Tap_HostApi */
+      (void)memcpy(((uint8*)hdr) + (TPACKET2_HDRLEN - sizeof(struct sockaddr_ll)), frame, frameLen);                  /* PRQA S 0310 */ /* MD_Eth_30_Tap_HostApi */
+      hdr->tp_len = frameLen;
+      __sync_synchronize();
+      hdr->tp_status = TP_STATUS_SEND_REQUEST;
+
+      /* Frames queued in the ring are not lost if the kick fails transiently (e.g. ENOBUFS); the next kick sends them */
+      if( (send(ctrlData->Fd, NULL, 0, MSG_DONTWAIT) >= 0) || (errno == EAGAIN) || (errno == ENOBUFS) )
+      {
+        ctrlData->TxRingPos = (uint16)((ctrlData->TxRingPos + 1u) % ctrlData->TxRingFrames);                            /* SBSW_ETH_30_TAP_CTRL_DATA */
+        retVal = E_OK;
+      }
+      /* #15 Otherwise take the frame back out of the ring unless the kernel already processed it, so that a frame
+       *     reported as failed is not sent by a later kick. The ring position is reused for the next frame. */
+      else if( hdr->tp_status == TP_STATUS_SEND_REQUEST )
+      {
+        hdr->tp_status = TP_STATUS_AVAILABLE;
+      }
+      else
+      {
+        /* The kernel already took the frame out of the ring before the kick failed */
+        ctrlData->TxRingPos = (uint16)((ctrlData->TxRingPos + 1u) % ctrlData->TxRingFrames);                            /* SBSW_ETH_30_TAP_CTRL_DATA */
+        retVal = E_OK;
+      }
+    }
+  }
+  /* #20 TAP backend: write the frame to the TAP device */
+  else
+  {
+    if( write(ctrlData->Fd, frame, frameLen) == (ssize_t)frameLen )
+    {
+      retVal = E_OK;
+    }
+  }
+
+  return retVal;
+} /* Eth_30_Tap_SendFrame() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_InternalTransmit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+ETH_30_TAP_LOCAL FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_InternalTransmit(                                     /* PRQA S 6060 */ /* MD_MSR_STPAR */
+          uint8                                    CtrlIdx,
+          uint8                                    BufIdx,
+          Eth_FrameType                            FrameType,
+          boolean                                  TxConfirmation,
+          uint16                                   LenByte,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) DstPhysAddrPtr,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) SrcPhysAddrPtr,
+          uint8                                    sid)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( BufIdx >= ETH_30_TAP_TX_BUF_NUM )
+  {
+    errorId = ETH_30_TAP_E_INV_PARAM;
+  }
+  else if( LenByte > ETH_30_TAP_MAX_PAYLOAD_LEN )
+  {
+    errorId = ETH_30_TAP_E_INV_PARAM;
+  }
+  else if( (LenByte != 0u) && ((DstPhysAddrPtr == NULL_PTR) || (SrcPhysAddrPtr == NULL_PTR)) )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+
+    if( ctrlData->TxBufState[BufIdx] != ETH_30_TAP_TX_BUF_PROVIDED )
+    {
+      errorId = ETH_30_TAP_E_INV_PARAM;
+    }
+    /* #20 Length 0: release the buffer without transmission */
+    else if( LenByte == 0u )
+    {
+      ctrlData->TxBufState[BufIdx] = ETH_30_TAP_TX_BUF_FREE;                                                            /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      retVal = E_OK;
+    }
+    else
+    {
+      P2VAR(uint8, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) frame = ctrlData->TxBuf[BufIdx];
+
+      /* #30 Complete the Ethernet header in front of the payload and hand the frame to the host device */
+      (void)memcpy(&frame[0], DstPhysAddrPtr, ETH_30_TAP_PHYS_ADDR_LEN);                                               /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      (void)memcpy(&frame[ETH_30_TAP_PHYS_ADDR_LEN], SrcPhysAddrPtr, ETH_30_TAP_PHYS_ADDR_LEN);                        /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      frame[ETH_30_TAP_HDR_TYPE_OFFSET] = (uint8)(FrameType >> 8u);                                                     /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      frame[ETH_30_TAP_HDR_TYPE_OFFSET + 1u] = (uint8)FrameType;                                                        /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+
+      SchM_Enter_Eth_30_Tap_ETH_30_TAP_EXCLUSIVE_AREA_0();
+      if( ctrlData->Mode == ETH_MODE_ACTIVE )
+      {
+        retVal = Eth_30_Tap_SendFrame(ctrlData, frame, (uint16)(LenByte + ETH_30_TAP_HDR_LEN));                         /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      }
+
+      /* #40 Keep the buffer until Eth_30_Tap_TxConfirmation() if a confirmation was requested and the frame was sent */
+      if( (retVal == E_OK) && (TxConfirmation == TRUE) )
+      {
+        ctrlData->TxBufResult[BufIdx] = E_OK;                                                                           /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+        ctrlData->TxBufState[BufIdx] = ETH_30_TAP_TX_BUF_WAIT_CONF;                                                     /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      }
+      else
+      {
+        ctrlData->TxBufState[BufIdx] = ETH_30_TAP_TX_BUF_FREE;                                                          /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+      }
+      SchM_Exit_Eth_30_Tap_ETH_30_TAP_EXCLUSIVE_AREA_0();
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, sid, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+  ETH_30_TAP_DUMMY_STATEMENT(sid);     /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+
+  return retVal;
+} /* Eth_30_Tap_InternalTransmit() */
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_Init
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_Init(
+  P2CONST(Eth_30_Tap_ConfigType, AUTOMATIC, ETH_30_TAP_CONST) CfgPtr)
+{
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( CfgPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else if( CfgPtr->CtrlNum > ETH_30_TAP_MAX_CTRLS )
+  {
+    errorId = ETH_30_TAP_E_INV_PARAM;
+  }
+  else
+#endif
+  {
+    uint8_least ctrlIdx;
+
+    /* #20 Close controllers of a previous initialization and reset all runtime data */
+    for( ctrlIdx = 0u; ctrlIdx < ETH_30_TAP_MAX_CTRLS; ctrlIdx++ )
+    {
+      if( Eth_30_Tap_ConfigPtr != NULL_PTR )
+      {
+        Eth_30_Tap_CloseCtrl(&Eth_30_Tap_CtrlData[ctrlIdx]);                                                            /* SBSW_ETH_30_TAP_CTRL_DATA */
+      }
+      Eth_30_Tap_CtrlData[ctrlIdx].Fd = ETH_30_TAP_INVALID_FD;                                                          /* SBSW_ETH_30_TAP_CTRL_DATA */
+      Eth_30_Tap_CtrlData[ctrlIdx].Ring = NULL_PTR;                                                                     /* SBSW_ETH_30_TAP_CTRL_DATA */
+      Eth_30_Tap_CtrlData[ctrlIdx].IsInitialized = FALSE;                                                               /* SBSW_ETH_30_TAP_CTRL_DATA */
+      Eth_30_Tap_CtrlData[ctrlIdx].Mode = ETH_MODE_DOWN;                                                                /* SBSW_ETH_30_TAP_CTRL_DATA */
+    }
+
+    Eth_30_Tap_ConfigPtr = CfgPtr;
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_INIT, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+} /* Eth_30_Tap_Init() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_ControllerInit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_ControllerInit(
+  uint8 CtrlIdx,
+  uint8 CfgIdx)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else
+#endif
+  {
+    P2CONST(Eth_30_Tap_CtrlConfigType, AUTOMATIC, ETH_30_TAP_CONST) ctrlCfg = &Eth_30_Tap_ConfigPtr->CtrlConfig[CtrlIdx];
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+
+    /* #20 Reset the controller and release all Tx buffers */
+    Eth_30_Tap_CloseCtrl(ctrlData);                                                                                     /* SBSW_ETH_30_TAP_CTRL_DATA */
+    (void)memset(ctrlData->TxBufState, ETH_30_TAP_TX_BUF_FREE, sizeof(ctrlData->TxBufState));                          /* SBSW_ETH_30_TAP_CTRL_DATA */
+    (void)memcpy(ctrlData->PhysAddr, ctrlCfg->PhysAddr, ETH_30_TAP_PHYS_ADDR_LEN);                                      /* SBSW_ETH_30_TAP_CTRL_DATA */
+    ctrlData->FilterCnt = 0u;                                                                                           /* SBSW_ETH_30_TAP_CTRL_DATA */
+    ctrlData->IsPromiscuous = FALSE;                                                                                    /* SBSW_ETH_30_TAP_CTRL_DATA */
+    ctrlData->TxBufSearchPos = 0u;                                                                                      /* SBSW_ETH_30_TAP_CTRL_DATA */
+    ctrlData->RxRingPos = 0u;                                                                                           /* SBSW_ETH_30_TAP_CTRL_DATA */
+    ctrlData->TxRingPos = 0u;                                                                                           /* SBSW_ETH_30_TAP_CTRL_DATA */
+
+    /* #30 Open the host device of the configured backend */
+    if( ctrlCfg->Backend == ETH_30_TAP_BACKEND_PACKET_MMAP )
+    {
+      retVal = Eth_30_Tap_OpenPacketMmap(ctrlCfg, ctrlData);                                                            /* SBSW_ETH_30_TAP_CTRL_DATA */
+    }
+    else
+    {
+      retVal = Eth_30_Tap_OpenTap(ctrlCfg, ctrlData);                                                                   /* SBSW_ETH_30_TAP_CTRL_DATA */
+    }
+
+    if( retVal == E_OK )
+    {
+      ctrlData->IsInitialized = TRUE;                                                                                   /* SBSW_ETH_30_TAP_CTRL_DATA */
+    }
+    else
+    {
+      errorId = ETH_30_TAP_E_ACCESS;
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_CONTROLLER_INIT, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+  ETH_30_TAP_DUMMY_STATEMENT(CfgIdx);  /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+
+  return retVal;
+} /* Eth_30_Tap_ControllerInit() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_SetControllerMode
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_SetControllerMode(
+  uint8        CtrlIdx,
+  Eth_ModeType CtrlMode)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( (CtrlMode != ETH_MODE_DOWN) && (CtrlMode != ETH_MODE_ACTIVE) )
+  {
+    errorId = ETH_30_TAP_E_INV_MODE;
+  }
+  else
+#endif
+  {
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+
+    if( ctrlData->IsInitialized == TRUE )
+    {
+      SchM_Enter_Eth_30_Tap_ETH_30_TAP_EXCLUSIVE_AREA_0();
+      /* #20 Going down releases all Tx buffers, pending confirmations are discarded */
+      if( CtrlMode == ETH_MODE_DOWN )
+      {
+        (void)memset(ctrlData->TxBufState, ETH_30_TAP_TX_BUF_FREE, sizeof(ctrlData->TxBufState));                      /* SBSW_ETH_30_TAP_CTRL_DATA */
+      }
+      ctrlData->Mode = CtrlMode;                                                                                        /* SBSW_ETH_30_TAP_CTRL_DATA */
+      SchM_Exit_Eth_30_Tap_ETH_30_TAP_EXCLUSIVE_AREA_0();
+      retVal = E_OK;
+    }
+    else
+    {
+      errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_SET_CONTROLLER_MODE, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+
+  return retVal;
+} /* Eth_30_Tap_SetControllerMode() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetControllerMode
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_GetControllerMode(
+        uint8                                           CtrlIdx,
+  P2VAR(Eth_ModeType, AUTOMATIC, ETH_30_TAP_APPL_VAR) CtrlModePtr)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( CtrlModePtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+    /* #20 Return the mode of an initialized controller */
+    if( Eth_30_Tap_CtrlData[CtrlIdx].IsInitialized == TRUE )
+    {
+      *CtrlModePtr = Eth_30_Tap_CtrlData[CtrlIdx].Mode;                                                                 /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+      retVal = E_OK;
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_GET_CONTROLLER_MODE, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+
+  return retVal;
+} /* Eth_30_Tap_GetControllerMode() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetPhysAddr
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_GetPhysAddr(
+        uint8                                    CtrlIdx,
+  P2VAR(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr)
+{
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( PhysAddrPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+    /* #20 Copy the current MAC address */
+    (void)memcpy(PhysAddrPtr, Eth_30_Tap_CtrlData[CtrlIdx].PhysAddr, ETH_30_TAP_PHYS_ADDR_LEN);                         /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_GET_PHYS_ADDR, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+} /* Eth_30_Tap_GetPhysAddr() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_SetPhysAddr
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_SetPhysAddr(
+          uint8                                    CtrlIdx,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr)
+{
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( PhysAddrPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+    /* #20 Store the new MAC address */
+    (void)memcpy(Eth_30_Tap_CtrlData[CtrlIdx].PhysAddr, PhysAddrPtr, ETH_30_TAP_PHYS_ADDR_LEN);                         /* SBSW_ETH_30_TAP_CTRL_DATA */
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_SET_PHYS_ADDR, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+} /* Eth_30_Tap_SetPhysAddr() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_UpdatePhysAddrFilter
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_UpdatePhysAddrFilter(
+          uint8                                    CtrlIdx,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr,
+          Eth_FilterActionType                     Action)
+{
+  Std_ReturnType retVal = E_NOT_OK;
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( PhysAddrPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else if( (Action != ETH_ADD_TO_FILTER) && (Action != ETH_REMOVE_FROM_FILTER) )
+  {
+    errorId = ETH_30_TAP_E_INV_PARAM;
+  }
+  else
+#endif
+  {
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+    uint8_least filterIdx;
+
+    /* #20 Broadcast address: add enables promiscuous mode, remove resets the filter */
+    if( memcmp(PhysAddrPtr, Eth_30_Tap_BroadcastAddr, ETH_30_TAP_PHYS_ADDR_LEN) == 0 )
+    {
+      ctrlData->IsPromiscuous = (boolean)(Action == ETH_ADD_TO_FILTER);                                                 /* SBSW_ETH_30_TAP_CTRL_DATA */
+      if( Action == ETH_REMOVE_FROM_FILTER )
+      {
+        ctrlData->FilterCnt = 0u;                                                                                       /* SBSW_ETH_30_TAP_CTRL_DATA */
+      }
+      retVal = E_OK;
+    }
+    else
+    {
+      /* #30 Look up the address in the filter table */
+      for( filterIdx = 0u; filterIdx < ctrlData->FilterCnt; filterIdx++ )
+      {
+        if( memcmp(PhysAddrPtr, ctrlData->FilterAddr[filterIdx], ETH_30_TAP_PHYS_ADDR_LEN) == 0 )
+        {
+          break;
+        }
+      }
+
+      /* #40 Add: append an unknown address if space is left; adding a known address succeeds without change */
+      if( Action == ETH_ADD_TO_FILTER )
+      {
+        if( filterIdx < ctrlData->FilterCnt )
+        {
+          retVal = E_OK;
+        }
+        else if( ctrlData->FilterCnt < ETH_30_TAP_PHYS_ADDR_FILTER_NUM )
+        {
+          (void)memcpy(ctrlData->FilterAddr[ctrlData->FilterCnt], PhysAddrPtr, ETH_30_TAP_PHYS_ADDR_LEN);               /* SBSW_ETH_30_TAP_CTRL_DATA */
+          ctrlData->FilterCnt++;                                                                                        /* SBSW_ETH_30_TAP_CTRL_DATA */
+          retVal = E_OK;
+        }
+        else
+        {
+          /* filter table full */
+        }
+      }
+      /* #50 Remove: replace the entry by the last one */
+      else if( filterIdx < ctrlData->FilterCnt )
+      {
+        ctrlData->FilterCnt--;                                                                                          /* SBSW_ETH_30_TAP_CTRL_DATA */
+        (void)memcpy(ctrlData->FilterAddr[filterIdx], ctrlData->FilterAddr[ctrlData->FilterCnt], ETH_30_TAP_PHYS_ADDR_LEN); /* SBSW_ETH_30_TAP_CTRL_DATA */
+        retVal = E_OK;
+      }
+      else
+      {
+        /* address not found */
+      }
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_UPDATE_PHYS_ADDR_FILTER, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+
+  return retVal;
+} /* Eth_30_Tap_UpdatePhysAddrFilter() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_ProvideTxBuffer
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(BufReq_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_ProvideTxBuffer(
+        uint8                                                                        CtrlIdx,
+  P2VAR(uint8,                                        AUTOMATIC, ETH_30_TAP_APPL_VAR) BufIdxPtr,
+  P2VAR(P2VAR(Eth_DataType, AUTOMATIC, ETH_30_TAP_APPL_VAR), AUTOMATIC, ETH_30_TAP_APPL_VAR) BufPtr,
+  P2VAR(uint16,                                       AUTOMATIC, ETH_30_TAP_APPL_VAR) LenBytePtr)
+{
+  BufReq_ReturnType retVal = BUFREQ_E_NOT_OK;
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( (BufIdxPtr == NULL_PTR) || (BufPtr == NULL_PTR) || (LenBytePtr == NULL_PTR) )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+
+    if( ctrlData->Mode != ETH_MODE_ACTIVE )
+    {
+      /* controller not active */
+    }
+    /* #20 Report the maximum payload length if the requested length can not be served */
+    else if( (*LenBytePtr) > ETH_30_TAP_MAX_PAYLOAD_LEN )
+    {
+      *LenBytePtr = ETH_30_TAP_MAX_PAYLOAD_LEN;                                                                         /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+      retVal = BUFREQ_E_OVFL;
+    }
+    else
+    {
+      uint8_least searchCnt;
+      uint8_least bufIdx = ctrlData->TxBufSearchPos;
+
+      retVal = BUFREQ_E_BUSY;
+
+      /* #30 Search a free buffer round robin, starting behind the last provided one */
+      SchM_Enter_Eth_30_Tap_ETH_30_TAP_EXCLUSIVE_AREA_0();
+      for( searchCnt = 0u; searchCnt < ETH_30_TAP_TX_BUF_NUM; searchCnt++ )
+      {
+        if( ctrlData->TxBufState[bufIdx] == ETH_30_TAP_TX_BUF_FREE )
+        {
+          ctrlData->TxBufState[bufIdx] = ETH_30_TAP_TX_BUF_PROVIDED;                                                    /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+          ctrlData->TxBufSearchPos = (uint8)((bufIdx + 1u) % ETH_30_TAP_TX_BUF_NUM);                                   /* SBSW_ETH_30_TAP_CTRL_DATA */
+          *BufIdxPtr = (uint8)bufIdx;                                                                                   /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+          /* PRQA S 0310 1 */ /* MD_Eth_30_Tap_HostApi */
+          *BufPtr = (P2VAR(Eth_DataType, AUTOMATIC, ETH_30_TAP_APPL_VAR))&ctrlData->TxBuf[bufIdx][ETH_30_TAP_HDR_LEN];  /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+          retVal = BUFREQ_OK;
+          break;
+        }
+        bufIdx = (bufIdx + 1u) % ETH_30_TAP_TX_BUF_NUM;
+      }
+      SchM_Exit_Eth_30_Tap_ETH_30_TAP_EXCLUSIVE_AREA_0();
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_PROVIDE_TX_BUFFER, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+
+  return retVal;
+} /* Eth_30_Tap_ProvideTxBuffer() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_Transmit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_Transmit(
+          uint8                                    CtrlIdx,
+          uint8                                    BufIdx,
+          Eth_FrameType                            FrameType,
+          boolean                                  TxConfirmation,
+          uint16                                   LenByte,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr)
+{
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) srcPhysAddrPtr = NULL_PTR;
+
+  /* #10 Transmit with the controller's own MAC address as source address */
+  if( CtrlIdx < ETH_30_TAP_MAX_CTRLS )
+  {
+    srcPhysAddrPtr = Eth_30_Tap_CtrlData[CtrlIdx].PhysAddr;
+  }
+
+  return Eth_30_Tap_InternalTransmit(CtrlIdx, BufIdx, FrameType, TxConfirmation, LenByte,
+                                     PhysAddrPtr, srcPhysAddrPtr, ETH_30_TAP_SID_TRANSMIT);                             /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+} /* Eth_30_Tap_Transmit() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_VTransmit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_VTransmit(
+          uint8                                    CtrlIdx,
+          uint8                                    BufIdx,
+          Eth_FrameType                            FrameType,
+          boolean                                  TxConfirmation,
+          uint16                                   LenByte,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) DstPhysAddrPtr,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) SrcPhysAddrPtr)
+{
+  /* #10 Transmit with the given source MAC address */
+  return Eth_30_Tap_InternalTransmit(CtrlIdx, BufIdx, FrameType, TxConfirmation, LenByte,
+                                     DstPhysAddrPtr, SrcPhysAddrPtr, ETH_30_TAP_SID_VTRANSMIT);                         /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+} /* Eth_30_Tap_VTransmit() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_Receive
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_Receive(
+        uint8                                               CtrlIdx,
+  P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_30_TAP_APPL_VAR) RxStatusPtr)
+{
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else if( RxStatusPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+
+    *RxStatusPtr = ETH_NOT_RECEIVED;                                                                                    /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+
+    if( ctrlData->Mode != ETH_MODE_ACTIVE )
+    {
+      /* controller not active */
+    }
+    /* #20 PACKET_MMAP backend: indicate the frame directly out of the Rx ring and return the ring frame to the kernel */
+    else if( ctrlData->Ring != NULL_PTR )
+    {
+      struct tpacket2_hdr *hdr = Eth_30_Tap_GetRingFrame(ctrlData, 0u, ctrlData->RxRingPos);                           /* SBSW_ETH_30_TAP_CTRL_DATA */
+
+      if( (hdr->tp_status & TP_STATUS_USER) != 0u )
+      {
+        P2CONST(uint8, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ringFrame = (P2CONST(uint8, AUTOMATIC, ETH_30_TAP_VAR_CLEARED))hdr; /* PRQA S 0310 */ /* MD_Eth_30_Tap_HostApi */
+        /* PRQA S 0310 1 */ /* MD_Eth_30_Tap_HostApi */
+        const struct sockaddr_ll *sll = (const struct sockaddr_ll*)&ringFrame[TPACKET_ALIGN(sizeof(struct tpacket2_hdr))];
+
+        __sync_synchronize();
+        /* Frames sent by this socket are looped back by the kernel, they are not indicated */
+        if( sll->sll_pkttype != PACKET_OUTGOING )
+        {
+          Eth_30_Tap_IndicateFrame(CtrlIdx, ctrlData, &ringFrame[hdr->tp_mac], hdr->tp_snaplen);                       /* SBSW_ETH_30_TAP_RX_FRAME */
+        }
+        __sync_synchronize();
+        hdr->tp_status = TP_STATUS_KERNEL;
+        ctrlData->RxRingPos = (uint16)((ctrlData->RxRingPos + 1u) % ctrlData->RxRingFrames);                            /* SBSW_ETH_30_TAP_CTRL_DATA */
+
+        hdr = Eth_30_Tap_GetRingFrame(ctrlData, 0u, ctrlData->RxRingPos);                                               /* SBSW_ETH_30_TAP_CTRL_DATA */
+        *RxStatusPtr = ((hdr->tp_status & TP_STATUS_USER) != 0u) ? ETH_RECEIVED_MORE_DATA_AVAILABLE : ETH_RECEIVED;     /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+      }
+    }
+    /* #30 TAP backend: read one frame. More data is assumed after every received frame, the next call reports
+     *     ETH_NOT_RECEIVED when the device is drained. This saves an additional poll() per frame. */
+    else
+    {
+      const ssize_t rxLen = read(ctrlData->Fd, ctrlData->RxBuf, sizeof(ctrlData->RxBuf));
+
+      if( rxLen > 0 )
+      {
+        Eth_30_Tap_IndicateFrame(CtrlIdx, ctrlData, ctrlData->RxBuf, (uint32)rxLen);                                   /* SBSW_ETH_30_TAP_RX_FRAME */
+        *RxStatusPtr = ETH_RECEIVED_MORE_DATA_AVAILABLE;                                                                /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+      }
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_RECEIVE, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+} /* Eth_30_Tap_Receive() */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_TxConfirmation
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_TxConfirmation(
+  uint8 CtrlIdx)
+{
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( Eth_30_Tap_ConfigPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_NOT_INITIALIZED;
+  }
+  else if( CtrlIdx >= Eth_30_Tap_ConfigPtr->CtrlNum )
+  {
+    errorId = ETH_30_TAP_E_INV_CTRL_IDX;
+  }
+  else
+#endif
+  {
+    P2VAR(Eth_30_Tap_CtrlDataType, AUTOMATIC, ETH_30_TAP_VAR_CLEARED) ctrlData = &Eth_30_Tap_CtrlData[CtrlIdx];
+    uint8_least bufIdx;
+
+    /* #20 Frames are handed over to the host device synchronously: confirm all frames waiting for confirmation.
+     *     The buffer is released before the confirmation so EthIf users can request it again from the callback. */
+    for( bufIdx = 0u; bufIdx < ETH_30_TAP_TX_BUF_NUM; bufIdx++ )
+    {
+      if( ctrlData->TxBufState[bufIdx] == ETH_30_TAP_TX_BUF_WAIT_CONF )
+      {
+        ctrlData->TxBufState[bufIdx] = ETH_30_TAP_TX_BUF_FREE;                                                          /* SBSW_ETH_30_TAP_TX_BUF_IDX */
+#if (ETHIF_ENABLE_AUTOSAR_FORWARD_COMPATIBILITY == STD_ON)
+        EthIf_TxConfirmation(CtrlIdx, (Eth_BufIdxType)bufIdx, ctrlData->TxBufResult[bufIdx]);
+#else
+        EthIf_TxConfirmation(CtrlIdx, (uint8)bufIdx);
+#endif
+      }
+    }
+  }
+
+#if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_TX_CONFIRMATION, errorId);
+  }
+#else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+#endif
+} /* Eth_30_Tap_TxConfirmation() */
+
+#if (ETH_30_TAP_VERSION_INFO_API == STD_ON)
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetVersionInfo
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_GetVersionInfo(
+  P2VAR(Std_VersionInfoType, AUTOMATIC, ETH_30_TAP_APPL_VAR) VersionInfoPtr)
+{
+  uint8 errorId = ETH_30_TAP_E_NO_ERROR;
+
+# if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  /* #10 Check plausibility of input parameters */
+  if( VersionInfoPtr == NULL_PTR )
+  {
+    errorId = ETH_30_TAP_E_PARAM_POINTER;
+  }
+  else
+# endif
+  {
+    /* #20 Return the version information */
+    VersionInfoPtr->vendorID = ETH_30_TAP_VENDOR_ID;                                                                    /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+    VersionInfoPtr->moduleID = ETH_30_TAP_MODULE_ID;                                                                    /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+    VersionInfoPtr->sw_major_version = ETH_30_TAP_SW_MAJOR_VERSION;                                                     /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+    VersionInfoPtr->sw_minor_version = ETH_30_TAP_SW_MINOR_VERSION;                                                     /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+    VersionInfoPtr->sw_patch_version = ETH_30_TAP_SW_PATCH_VERSION;                                                     /* SBSW_ETH_30_TAP_PUB_PARAM_PTR */
+  }
+
+# if (ETH_30_TAP_DEV_ERROR_DETECT == STD_ON)
+  if( errorId != ETH_30_TAP_E_NO_ERROR )
+  {
+    (void)Det_ReportError(ETH_30_TAP_MODULE_ID, ETH_30_TAP_INSTANCE_ID_DET, ETH_30_TAP_SID_GET_VERSION_INFO, errorId);
+  }
+# else
+  ETH_30_TAP_DUMMY_STATEMENT(errorId); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */
+# endif
+} /* Eth_30_Tap_GetVersionInfo() */
+#endif /* ETH_30_TAP_VERSION_INFO_API */
+
+#define ETH_30_TAP_STOP_SEC_CODE
+#include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Justification for module-specific MISRA deviations:
+ MD_Eth_30_Tap_HostApi:
+   Reason:     The driver uses the Linux socket, TAP and PACKET_MMAP interfaces, which require casts between socket
+               address types and access to kernel defined ring frame layouts.
+   Risk:       None, the layouts are defined by the Linux kernel ABI.
+   Prevention: Covered by code review.
+*/
+
+/* SBSW_JUSTIFICATION_BEGIN
+
+\ID SBSW_ETH_30_TAP_CTRL_DATA
+ \DESCRIPTION Access to the runtime data of a controller. The controller index is checked against the configured number
+              of controllers, which is checked against ETH_30_TAP_MAX_CTRLS in Eth_30_Tap_Init().
+ \COUNTERMEASURE \R Controller index is checked by DET; the ring offset and position are limited by the ring size.
+
+\ID SBSW_ETH_30_TAP_TX_BUF_IDX
+ \DESCRIPTION Access to a Tx buffer of a controller. The buffer index is checked against ETH_30_TAP_TX_BUF_NUM and the
+              payload length against ETH_30_TAP_MAX_PAYLOAD_LEN before the buffer is accessed.
+ \COUNTERMEASURE \R Buffer index and length are checked by DET.
+
+\ID SBSW_ETH_30_TAP_PUB_PARAM_PTR
+ \DESCRIPTION Write access to a pointer passed by the caller.
+ \COUNTERMEASURE \N The caller ensures the validity of the pointer, NULL_PTR is checked by DET.
+
+\ID SBSW_ETH_30_TAP_RX_FRAME
+ \DESCRIPTION A received frame is passed to a local function or EthIf. The frame length is limited by the size of the
+              Rx buffer (TAP backend) or the ring frame (PACKET_MMAP backend).
+ \COUNTERMEASURE \N The kernel never writes more than the buffer/ring frame size.
+
+SBSW_JUSTIFICATION_END */
+
+/**********************************************************************************************************************
+ *  END OF FILE: Eth_30_Tap.c
+ *********************************************************************************************************************/
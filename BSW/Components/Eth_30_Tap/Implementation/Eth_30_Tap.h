@@ -0,0 +1,341 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  Eth_30_Tap.h
+ *        \brief  Ethernet driver for Linux TAP devices and AF_PACKET sockets
+ *
+ *      \details  Host driver that binds EthIf to a Linux TAP device or to a network interface via an AF_PACKET socket
+ *                with memory mapped Rx and Tx rings. It allows running the Ethernet stack (TcpIp, SoAd, DoIP, Sd)
+ *                as a Linux process and exercising it with standard Linux networking tools.
+ *                The driver provides the API EthIf expects from an Ethernet controller driver; it is polled by
+ *                EthIf (Eth_30_Tap_Receive(), Eth_30_Tap_TxConfirmation()) and does not use interrupts.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Version   Date        Author      Change Id     Description
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  01.00.00  2026-10-19  -           -             created: TAP and AF_PACKET (TPACKET_V2 ring) backends
+ *********************************************************************************************************************/
+
+#if !defined (ETH_30_TAP_H)
+# define ETH_30_TAP_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+# include "Eth_30_Tap_Types.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* Vendor and module identification */
+# define ETH_30_TAP_VENDOR_ID                                         (30u)
+# define ETH_30_TAP_MODULE_ID                                         (88u)
+
+/* ----- Component version information ----- */
+# define ETH_30_TAP_SW_MAJOR_VERSION                                  (1u)
+# define ETH_30_TAP_SW_MINOR_VERSION                                  (0u)
+# define ETH_30_TAP_SW_PATCH_VERSION                                  (0u)
+
+# define ETH_30_TAP_INSTANCE_ID_DET                                   (0x00u)
+
+/* ----- API service IDs ----- */
+# define ETH_30_TAP_SID_INIT                                          (0x01u)
+# define ETH_30_TAP_SID_CONTROLLER_INIT                               (0x02u)
+# define ETH_30_TAP_SID_SET_CONTROLLER_MODE                           (0x03u)
+# define ETH_30_TAP_SID_GET_CONTROLLER_MODE                           (0x04u)
+# define ETH_30_TAP_SID_GET_PHYS_ADDR                                 (0x08u)
+# define ETH_30_TAP_SID_PROVIDE_TX_BUFFER                             (0x09u)
+# define ETH_30_TAP_SID_TRANSMIT                                      (0x0Au)
+# define ETH_30_TAP_SID_RECEIVE                                       (0x0Bu)
+# define ETH_30_TAP_SID_TX_CONFIRMATION                               (0x0Cu)
+# define ETH_30_TAP_SID_GET_VERSION_INFO                              (0x0Du)
+# define ETH_30_TAP_SID_UPDATE_PHYS_ADDR_FILTER                       (0x12u)
+# define ETH_30_TAP_SID_SET_PHYS_ADDR                                 (0x13u)
+# define ETH_30_TAP_SID_VTRANSMIT                                     (0x80u)
+
+/* ----- Error codes ----- */
+# define ETH_30_TAP_E_NO_ERROR                                        (0x00u) /*!< no error occurred */
+# define ETH_30_TAP_E_INV_CTRL_IDX                                    (0x01u) /*!< invalid controller index */
+# define ETH_30_TAP_E_NOT_INITIALIZED                                 (0x02u) /*!< driver or controller not initialized */
+# define ETH_30_TAP_E_PARAM_POINTER                                   (0x03u) /*!< invalid pointer in parameter list */
+# define ETH_30_TAP_E_INV_PARAM                                       (0x04u) /*!< invalid parameter */
+# define ETH_30_TAP_E_INV_MODE                                        (0x05u) /*!< invalid controller mode */
+# define ETH_30_TAP_E_ACCESS                                          (0x06u) /*!< host network device could not be accessed */
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+# define ETH_30_TAP_START_SEC_CODE
+# include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_Init
+ *********************************************************************************************************************/
+/*! \brief          Initializes the driver
+ *  \details        Stores the configuration and resets all controllers to uninitialized state. Host devices are
+ *                  opened by Eth_30_Tap_ControllerInit().
+ *  \param[in]      CfgPtr  Driver configuration; must stay valid while the driver is used
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_Init(
+  P2CONST(Eth_30_Tap_ConfigType, AUTOMATIC, ETH_30_TAP_CONST) CfgPtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_ControllerInit
+ *********************************************************************************************************************/
+/*! \brief          Initializes a controller
+ *  \details        Opens the TAP device or AF_PACKET socket of the controller and, for the AF_PACKET backend, sets up
+ *                  the memory mapped Rx and Tx rings. An already opened controller is reset.
+ *  \param[in]      CtrlIdx  Index of the controller
+ *  \param[in]      CfgIdx   Index of the configuration (unused, only one configuration per controller)
+ *  \return         E_OK     Controller initialized
+ *  \return         E_NOT_OK Host device could not be opened (e.g. missing CAP_NET_ADMIN/CAP_NET_RAW)
+ *  \pre            Eth_30_Tap_Init() was called
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_ControllerInit(
+  uint8 CtrlIdx,
+  uint8 CfgIdx);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_SetControllerMode
+ *********************************************************************************************************************/
+/*! \brief          Enables or disables frame reception and transmission of a controller
+ *  \details        Disabling releases all Tx buffers and discards frames that were received in the meantime.
+ *  \param[in]      CtrlIdx   Index of the controller
+ *  \param[in]      CtrlMode  ETH_MODE_DOWN or ETH_MODE_ACTIVE
+ *  \return         E_OK     Mode changed
+ *  \return         E_NOT_OK Controller not initialized
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_SetControllerMode(
+  uint8        CtrlIdx,
+  Eth_ModeType CtrlMode);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetControllerMode
+ *********************************************************************************************************************/
+/*! \brief          Returns the mode of a controller
+ *  \param[in]      CtrlIdx      Index of the controller
+ *  \param[out]     CtrlModePtr  Current mode
+ *  \return         E_OK     Mode returned
+ *  \return         E_NOT_OK Controller not initialized
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_GetControllerMode(
+        uint8                                           CtrlIdx,
+  P2VAR(Eth_ModeType, AUTOMATIC, ETH_30_TAP_APPL_VAR) CtrlModePtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetPhysAddr
+ *********************************************************************************************************************/
+/*! \brief          Returns the MAC address of a controller
+ *  \param[in]      CtrlIdx      Index of the controller
+ *  \param[out]     PhysAddrPtr  Buffer of 6 bytes receiving the MAC address
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_GetPhysAddr(
+        uint8                                    CtrlIdx,
+  P2VAR(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_SetPhysAddr
+ *********************************************************************************************************************/
+/*! \brief          Changes the MAC address of a controller
+ *  \details        The address is used as source address of transmitted frames and for the reception filter.
+ *  \param[in]      CtrlIdx      Index of the controller
+ *  \param[in]      PhysAddrPtr  New MAC address (6 bytes)
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_SetPhysAddr(
+          uint8                                    CtrlIdx,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_UpdatePhysAddrFilter
+ *********************************************************************************************************************/
+/*! \brief          Adds a MAC address to or removes it from the reception filter
+ *  \details        Adding the broadcast address enables promiscuous reception, removing it resets the filter to the
+ *                  controller's own address and broadcast.
+ *  \param[in]      CtrlIdx      Index of the controller
+ *  \param[in]      PhysAddrPtr  MAC address (6 bytes)
+ *  \param[in]      Action       ETH_ADD_TO_FILTER or ETH_REMOVE_FROM_FILTER
+ *  \return         E_OK     Filter updated
+ *  \return         E_NOT_OK Filter table full or address not found
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_UpdatePhysAddrFilter(
+          uint8                                    CtrlIdx,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr,
+          Eth_FilterActionType                     Action);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_ProvideTxBuffer
+ *********************************************************************************************************************/
+/*! \brief          Provides a Tx buffer
+ *  \details        The returned buffer starts behind the Ethernet header, which is added by Eth_30_Tap_Transmit().
+ *  \param[in]      CtrlIdx     Index of the controller
+ *  \param[out]     BufIdxPtr   Index of the provided buffer
+ *  \param[out]     BufPtr      Payload location of the provided buffer
+ *  \param[in,out]  LenBytePtr  in: requested payload length, out: payload length of the buffer, or the maximum
+ *                              payload length if the request can not be served
+ *  \return         BUFREQ_OK        Buffer provided
+ *  \return         BUFREQ_E_BUSY    All buffers in use
+ *  \return         BUFREQ_E_OVFL    Requested length too large
+ *  \return         BUFREQ_E_NOT_OK  Controller not active
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE for different controllers
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(BufReq_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_ProvideTxBuffer(
+        uint8                                                                        CtrlIdx,
+  P2VAR(uint8,                                        AUTOMATIC, ETH_30_TAP_APPL_VAR) BufIdxPtr,
+  P2VAR(P2VAR(Eth_DataType, AUTOMATIC, ETH_30_TAP_APPL_VAR), AUTOMATIC, ETH_30_TAP_APPL_VAR) BufPtr,
+  P2VAR(uint16,                                       AUTOMATIC, ETH_30_TAP_APPL_VAR) LenBytePtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_Transmit
+ *********************************************************************************************************************/
+/*! \brief          Transmits a frame
+ *  \details        Adds the Ethernet header and hands the frame to the host device. A length of 0 releases the
+ *                  buffer without transmission.
+ *  \param[in]      CtrlIdx         Index of the controller
+ *  \param[in]      BufIdx          Index of the buffer provided by Eth_30_Tap_ProvideTxBuffer()
+ *  \param[in]      FrameType       EtherType
+ *  \param[in]      TxConfirmation  TRUE: confirm transmission in Eth_30_Tap_TxConfirmation()
+ *  \param[in]      LenByte         Payload length
+ *  \param[in]      PhysAddrPtr     Destination MAC address
+ *  \return         E_OK     Frame transmitted or buffer released
+ *  \return         E_NOT_OK Invalid buffer or host device error; the buffer is released
+ *  \pre            Buffer was provided by Eth_30_Tap_ProvideTxBuffer()
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE for different buffers
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_Transmit(
+          uint8                                    CtrlIdx,
+          uint8                                    BufIdx,
+          Eth_FrameType                            FrameType,
+          boolean                                  TxConfirmation,
+          uint16                                   LenByte,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) PhysAddrPtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_VTransmit
+ *********************************************************************************************************************/
+/*! \brief          Transmits a frame with a given source MAC address
+ *  \details        Same as Eth_30_Tap_Transmit() but uses SrcPhysAddrPtr instead of the controller's MAC address.
+ *  \param[in]      CtrlIdx         Index of the controller
+ *  \param[in]      BufIdx          Index of the buffer provided by Eth_30_Tap_ProvideTxBuffer()
+ *  \param[in]      FrameType       EtherType
+ *  \param[in]      TxConfirmation  TRUE: confirm transmission in Eth_30_Tap_TxConfirmation()
+ *  \param[in]      LenByte         Payload length
+ *  \param[in]      DstPhysAddrPtr  Destination MAC address
+ *  \param[in]      SrcPhysAddrPtr  Source MAC address
+ *  \return         E_OK     Frame transmitted or buffer released
+ *  \return         E_NOT_OK Invalid buffer or host device error; the buffer is released
+ *  \pre            Buffer was provided by Eth_30_Tap_ProvideTxBuffer()
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE for different buffers
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, ETH_30_TAP_CODE) Eth_30_Tap_VTransmit(
+          uint8                                    CtrlIdx,
+          uint8                                    BufIdx,
+          Eth_FrameType                            FrameType,
+          boolean                                  TxConfirmation,
+          uint16                                   LenByte,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) DstPhysAddrPtr,
+  P2CONST(uint8, AUTOMATIC, ETH_30_TAP_APPL_VAR) SrcPhysAddrPtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_Receive
+ *********************************************************************************************************************/
+/*! \brief          Polls the host device for one received frame
+ *  \details        Frames passing the reception filter are indicated by EthIf_RxIndication(). With the AF_PACKET
+ *                  backend the indicated payload resides in the Rx ring and is returned to the kernel afterwards.
+ *  \param[in]      CtrlIdx       Index of the controller
+ *  \param[out]     RxStatusPtr   ETH_NOT_RECEIVED, ETH_RECEIVED or ETH_RECEIVED_MORE_DATA_AVAILABLE
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_Receive(
+        uint8                                               CtrlIdx,
+  P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_30_TAP_APPL_VAR) RxStatusPtr);
+
+/**********************************************************************************************************************
+ *  Eth_30_Tap_TxConfirmation
+ *********************************************************************************************************************/
+/*! \brief          Confirms transmitted frames
+ *  \details        Calls EthIf_TxConfirmation() for every frame transmitted with confirmation request and releases
+ *                  its buffer.
+ *  \param[in]      CtrlIdx  Index of the controller
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_TxConfirmation(
+  uint8 CtrlIdx);
+
+# if (ETH_30_TAP_VERSION_INFO_API == STD_ON)
+/**********************************************************************************************************************
+ *  Eth_30_Tap_GetVersionInfo
+ *********************************************************************************************************************/
+/*! \brief          Returns the version information of the driver
+ *  \param[out]     VersionInfoPtr  Version information
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *  \config         ETH_30_TAP_VERSION_INFO_API
+ *********************************************************************************************************************/
+FUNC(void, ETH_30_TAP_CODE) Eth_30_Tap_GetVersionInfo(
+  P2VAR(Std_VersionInfoType, AUTOMATIC, ETH_30_TAP_APPL_VAR) VersionInfoPtr);
+# endif /* ETH_30_TAP_VERSION_INFO_API */
+
+# define ETH_30_TAP_STOP_SEC_CODE
+# include "Eth_30_Tap_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* ETH_30_TAP_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: Eth_30_Tap.h
+ *********************************************************************************************************************/
@@ -0,0 +1,108 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2024 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  Eth_30_Tap_Types.h
+ *        \brief  Ethernet driver for Linux TAP devices and AF_PACKET sockets - type definitions
+ *
+ *      \details  Configuration parameters and data types of the Eth_30_Tap driver.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Refer to the module's header file.
+ *********************************************************************************************************************/
+
+#if !defined (ETH_30_TAP_TYPES_H)
+# define ETH_30_TAP_TYPES_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+# include "ComStack_Types.h"
+# include "Eth_GeneralTypes.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* ----- Configuration parameters -----
+ * There is no generator for this driver. All parameters can be overridden by preprocessor defines of the build. */
+# if !defined (ETH_30_TAP_DEV_ERROR_DETECT)                                                                             /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_DEV_ERROR_DETECT                                 STD_ON
+# endif
+
+# if !defined (ETH_30_TAP_VERSION_INFO_API)                                                                             /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_VERSION_INFO_API                                 STD_ON
+# endif
+
+/*! Maximum number of controllers handled by the driver. */
+# if !defined (ETH_30_TAP_MAX_CTRLS)                                                                                    /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_MAX_CTRLS                                        (2u)
+# endif
+
+/*! Number of Tx buffers per controller; limited to 255 because EthIf handles buffer indices as uint8. */
+# if !defined (ETH_30_TAP_TX_BUF_NUM)                                                                                   /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_TX_BUF_NUM                                       (32u)
+# endif
+
+/*! Maximum Ethernet frame length including the Ethernet header and excluding the FCS. */
+# if !defined (ETH_30_TAP_MAX_FRAME_LEN)                                                                                /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_MAX_FRAME_LEN                                    (1518u)
+# endif
+
+/*! Number of multicast addresses that can be added to the reception filter of a controller. */
+# if !defined (ETH_30_TAP_PHYS_ADDR_FILTER_NUM)                                                                         /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_PHYS_ADDR_FILTER_NUM                             (8u)
+# endif
+
+# if !defined (ETH_30_TAP_DUMMY_STATEMENT)                                                                             /* COV_ETH_30_TAP_COMPATIBILITY */
+#  define ETH_30_TAP_DUMMY_STATEMENT(v)                               (void)(v)
+# endif
+
+# if (ETH_30_TAP_TX_BUF_NUM > 255u)
+#  error "Eth_30_Tap: ETH_30_TAP_TX_BUF_NUM must not exceed 255"
+# endif
+
+/* ----- Backends ----- */
+# define ETH_30_TAP_BACKEND_TAP                                       (0u) /*!< TAP device, frames exchanged by read()/write() */
+# define ETH_30_TAP_BACKEND_PACKET_MMAP                               (1u) /*!< AF_PACKET socket with mmap'ed TPACKET_V2 Rx/Tx rings */
+
+# define ETH_30_TAP_PHYS_ADDR_LEN                                     (6u)
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+/*! Configuration of one controller. */
+typedef struct
+{
+  P2CONST(char, TYPEDEF, ETH_30_TAP_CONST) IfName;      /*!< Name of the TAP device to create/attach, or of the network
+                                                             interface the AF_PACKET socket is bound to */
+  uint8  Backend;                                        /*!< ETH_30_TAP_BACKEND_TAP or ETH_30_TAP_BACKEND_PACKET_MMAP */
+  uint8  PhysAddr[ETH_30_TAP_PHYS_ADDR_LEN];             /*!< Initial MAC address of the controller */
+  uint16 RxRingFrames;                                   /*!< Number of Rx ring frames (PACKET_MMAP only) */
+  uint16 TxRingFrames;                                   /*!< Number of Tx ring frames (PACKET_MMAP only) */
+} Eth_30_Tap_CtrlConfigType;
+
+/*! Configuration of the driver passed to Eth_30_Tap_Init(). */
+typedef struct
+{
+  P2CONST(Eth_30_Tap_CtrlConfigType, TYPEDEF, ETH_30_TAP_CONST) CtrlConfig; /*!< Controller configurations */
+  uint8 CtrlNum;                                                            /*!< Number of controller configurations */
+} Eth_30_Tap_ConfigType;
+
+#endif /* ETH_30_TAP_TYPES_H */
+
+/**********************************************************************************************************************
+ *  END OF FILE: Eth_30_Tap_Types.h
+ *********************************************************************************************************************/
@@ -0,0 +1,78 @@
+############################################################################### 
+# File Name  : Eth_30_Tap_cfg.mak 
+# Description: Configuration makefile 
+#------------------------------------------------------------------------------
+# COPYRIGHT
+#------------------------------------------------------------------------------
+# Copyright (c) 2024 by Vector Informatik GmbH.  All rights reserved.
+#------------------------------------------------------------------------------
+# REVISION HISTORY
+#------------------------------------------------------------------------------
+# Refer to the Eth_30_Tap_rules.mak file.
+############################################################################### 
+
+##############################################################
+# ETH_30_TAP_CONFIG_PATH: (not used for Vector)
+# The Variable ETH_30_TAP_CONFIG_PATH is optional. It allows the
+# configuration of the directory, where you can also find the
+# generated source files. Generally they should be in the
+# directory $(PROJECT_ROOT)\source\networks.
+# But if the application should run on several hardware
+# targets, then different Ethernet driver configurations of different
+# directories will be necessary. Therefor the variable
+# ETH_30_TAP_CONFIG_PATH should be used.
+#
+# For example:
+# ETH_30_TAP_CONFIG_PATH = $(PROJECT_ROOT)\source\network\v850
+# ETH_30_TAP_CONFIG_PATH = $(PROJECT_ROOT)\source\network\st10
+# ETH_30_TAP_CONFIG_PATH = $(PROJECT_ROOT)\source\network\v850
+#
+
+#ETH_30_TAP_CONFIG_PATH =
+
+
+##############################################################
+# ETH_30_TAP_DRIVER_MODE:  (not used for Vector)
+# Not relevant for module ETH_30_TAP, leave it as it is.
+#
+# For example:
+# ETH_30_TAP_DRIVER_MODE = singlechannel/multichannel
+#
+
+#ETH_30_TAP_DRIVER_MODE = singlechannel
+
+
+###############################################################
+# REQUIRED
+#
+# No Other resources are required to write a Configuration
+# Makefile.
+#
+###############################################################
+
+
+###############################################################
+# PROVIDE
+#
+# A Configuration Makefile does not provide resources for other
+# basic software bundles or the base_make package
+#
+###############################################################
+
+
+###############################################################
+# REGISTRY
+#
+# Like the Provide-Section this block is empty.
+#
+###############################################################
+
+
+###############################################################
+# SPECIFIC
+#
+# All variables in the _cfg makefile are "Specific" variables,
+# because they should only be used in the *_check.mak,
+# *_defs.mak and *_rules.mak Makefiles of the same basic
+# software bundle.
+###############################################################
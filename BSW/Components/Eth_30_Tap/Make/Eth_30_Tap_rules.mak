@@ -0,0 +1,89 @@
+############################################################################### 
+# File Name  : Eth_30_Tap_rules.mak 
+# Description: Rules makefile 
+#------------------------------------------------------------------------------
+# COPYRIGHT
+#------------------------------------------------------------------------------
+# Copyright (c) 2024 by Vector Informatik GmbH.  All rights reserved.
+#------------------------------------------------------------------------------
+# REVISION HISTORY
+#------------------------------------------------------------------------------
+# Version   Date        Author  Description
+#------------------------------------------------------------------------------
+# 1.00.00   2026-10-19  -       Created
+#------------------------------------------------------------------------------
+# TemplateVersion = 1.02
+###############################################################################
+
+
+###############################################################
+# REGISTRY
+#
+
+LIBRARIES_TO_BUILD      += Eth_30_Tap
+Eth_30_Tap_FILES        = Eth_30_Tap$(BSW_SRC_DIR)\Eth_30_Tap.c
+
+CC_FILES_TO_BUILD       += Eth_30_Tap$(BSW_SRC_DIR)\Eth_30_Tap.c
+CPP_FILES_TO_BUILD      +=
+ASM_FILES_TO_BUILD      +=
+
+#LIBRARIES_LINK_ONLY     += (not yet supported)
+#OBJECTS_LINK_ONLY       += (not yet supported)
+
+#-------------------------------------------------------------------------------------------------
+#only define new dirs, OBJ, LIB, LOG were created automaticly
+#-------------------------------------------------------------------------------------------------
+DIRECTORIES_TO_CREATE   +=
+
+#DEPEND_GCC_OPTS         += (not yet supported)
+
+GENERATED_SOURCE_FILES  +=
+
+COMMON_SOURCE_FILES     +=
+
+#-------------------------------------------------------------------------------------------------
+# <project>.dep & <projekt>.lnk & <project>.bin and.....
+# all in err\ & obj\ & lst\ & lib\ & log\ will be deleted by clean-rule automaticly
+# so in this clean-rule it is only necessary to define additional files which
+# were not delete automaticly.
+# e.g.: $(<PATH>)\can_test.c
+#-------------------------------------------------------------------------------------------------
+MAKE_CLEAN_RULES        +=
+#MAKE_GENERATE_RULES     +=
+#MAKE_COMPILER_RULES     +=
+#MAKE_DEBUG_RULES        +=
+#MAKE_CONFIG_RULES       +=
+#MAKE_ADD_RULES          +=
+
+
+###############################################################
+# REQUIRED   (defined in BaseMake (global.Makefile.target.make...))
+#
+# SSC_ROOT		(required)
+# PROJECT_ROOT	(required)
+#
+# LIB_OUTPUT_PATH	(optional)
+# OBJ_OUTPUT_PATH	(optional)
+#
+# OBJ_FILE_SUFFIX
+# LIB_FILE_SUFFIX
+#
+###############################################################
+
+
+###############################################################
+# PROVIDE   this Section can be used to define own additional rules
+#
+###############################################################
+
+
+###############################################################
+# SPECIFIC
+#
+# There are no rules defined for the Specific part of the
+# Rules-Makefile. Each author is free to create temporary
+# variables or to use other resources of GNU-MAKE
+#
+###############################################################
+
+
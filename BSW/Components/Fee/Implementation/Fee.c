@@ -32,6 +32,7 @@
 #include "Fee_InitEx.h"
 #include "Fee_Int.h" /* PRQA S 3313 */ /*MD_FEE_18.1_MissingStructDefinition */
 #include "Fee_Cbk.h"
+#include "Fee_LookUpTable.h"
 
 /**********************************************************************************************************************
  *  VERSION CHECK
@@ -360,6 +361,84 @@ FEE_LOCAL_FUNC(void) Fee_InternalForceSectorSwitch(Fee_Bool forceFblMode);
 FEE_LOCAL_FUNC(void) Fee_InternalSyncLookUpTable(void);
 #endif
 
+
+#if (FEE_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ * Fee_InternalGetReadBatchPosition
+ *********************************************************************************************************************/
+/*! \brief      Returns the position of a block within its partition, used to order batched reads
+ *  \details    If LookUpTable is enabled for block's partition, the address of block's most recent chunk is
+ *              returned; otherwise the block number, which roughly corresponds to configured block order.
+ *  \param[in]  block               Block config and dataset index of a checked block number
+ *  \param[in]  blockNumber         Block number as requested
+ *  \return     position within partition
+ *  \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ *  \pre        Module is initialized
+ *  \context    TASK
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+FEE_LOCAL_FUNC(uint32) Fee_InternalGetReadBatchPosition(Fee_BlockCfgDatasetPair block, uint16 blockNumber);
+
+
+/**********************************************************************************************************************
+ * Fee_InternalIsReadBatchJobBehind
+ *********************************************************************************************************************/
+/*! \brief      Checks whether a block is located behind the given position
+ *  \details    Blocks are ordered by partition first, then by Fee_InternalGetReadBatchPosition.
+ *  \param[in]  blockNumber         Block number of the element to be checked
+ *  \param[in]  partitionIndex      Partition of reference position
+ *  \param[in]  position            Reference position within partition
+ *  \return     TRUE                Block is located behind reference position
+ *  \return     FALSE               Otherwise
+ *  \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ *  \pre        Module is initialized
+ *  \context    TASK
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+FEE_LOCAL_FUNC(Fee_Bool) Fee_InternalIsReadBatchJobBehind(uint16 blockNumber, uint8 partitionIndex, uint32 position);
+
+
+/**********************************************************************************************************************
+ * Fee_InternalSortReadBatch
+ *********************************************************************************************************************/
+/*! \brief      Sorts a vector of read requests in ascending physical order
+ *  \details    Sorts a vector of read requests in ascending physical order
+ *  \param[in,out] jobs             Vector of checked read requests
+ *  \param[in]  numberOfJobs        Number of elements
+ *  \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ *  \pre        Module is initialized
+ *  \context    TASK
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+FEE_LOCAL_FUNC(void) Fee_InternalSortReadBatch(MemIf_ReadBatchJobPtrType jobs, uint16 numberOfJobs);
+
+
+/**********************************************************************************************************************
+ * Fee_InternalSetReadBatchJobParams
+ *********************************************************************************************************************/
+/*! \brief      Sets job parameters to read current element of active batch
+ *  \details    Sets job parameters to read current element of active batch
+ *  \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ *  \pre        A batch is active; caller has entered exclusive area
+ *  \context    TASK
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+FEE_LOCAL_FUNC(void) Fee_InternalSetReadBatchJobParams(void);
+
+
+/**********************************************************************************************************************
+ * Fee_InternalCancelReadBatch
+ *********************************************************************************************************************/
+/*! \brief      Closes an active batch
+ *  \details    All elements not processed so far are marked as canceled.
+ *  \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ *  \pre        Caller has entered exclusive area
+ *  \context    TASK
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+FEE_LOCAL_FUNC(void) Fee_InternalCancelReadBatch(void);
+#endif
+
 /******************************************************************************
  *  INTERNAL FUNCTIONS
  *****************************************************************************/
@@ -698,6 +777,12 @@ FUNC(void, FEE_API_CODE) Fee_InitEx(Fee_ConfigRefType ConfigPtr)
          * This, in turn, can only happen when a job completes                       */
         Fee_Globals_t.SectorSwitchData_t.partitionId_s8 = -1;
 
+#if (FEE_READ_BATCH_API == STD_ON)
+        Fee_Globals_t.ReadBatch_t.Jobs_pt = NULL_PTR;
+        Fee_Globals_t.ReadBatch_t.NumberOfJobs = 0u;
+        Fee_Globals_t.ReadBatch_t.CurrentJob = 0u;
+#endif
+
         Fee_Globals_t.WritesSuspended_bl = FALSE;
 
         Fee_FsmReset(&Fee_Globals_t); /* SBSW_FEE_Func_passParamByReference */
@@ -792,6 +877,87 @@ FUNC(Std_ReturnType, FEE_API_CODE) Fee_Read(uint16 BlockNumber, uint16 BlockOffs
 } /* End of Fee_Read() */
 
 
+#if (FEE_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ * Fee_ReadBatch
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, FEE_API_CODE) Fee_ReadBatch(MemIf_ReadBatchJobPtrType Jobs, uint16 NumberOfJobs)
+{
+    Fee_DetErrorCodeType errCode = Fee_DetChkParamPointer(Jobs); /* PRQA S 0315 */ /* MD_FEE_1.1_Cast_pointer_to_void */ /* SBSW_FEE_ReadBatchJobs */
+    uint16 jobIdx;
+
+    /* #10 Check each element the same way as Fee_Read does */
+    for(jobIdx = 0u; (jobIdx < NumberOfJobs) && (errCode == FEE_E_NO_ERROR); jobIdx++) /* COV_FEE_ERR_DETECT_OFF */
+    {
+        Fee_BlockCfgDatasetPair block;
+        errCode = Fee_DetChkParamPointer(Jobs[jobIdx].DataBufferPtr); /* PRQA S 0315 */ /* MD_FEE_1.1_Cast_pointer_to_void */ /* SBSW_FEE_ReadBatchJobs */
+        if(errCode == FEE_E_NO_ERROR) /* COV_FEE_ERR_DETECT_OFF */
+        {
+            errCode = Fee_getBlockCfgFromBlockNumber_Checked(&block, Jobs[jobIdx].BlockNumber); /* SBSW_FEE_PointerWrite_refParam */ /* SBSW_FEE_ReadBatchJobs */
+            if(errCode == FEE_E_NO_ERROR) /* COV_FEE_ERR_DETECT_OFF */
+            {
+                errCode = Fee_DetChkParamsOffsetLength(block.config, Jobs[jobIdx].BlockOffset, Jobs[jobIdx].Length); /* SBSW_FEE_getBlockCfgFromBlockNumber */ /* SBSW_FEE_ReadBatchJobs */
+            }
+        }
+    }
+
+    /* #20 An empty vector is always rejected; there is nothing that could be finished */
+    if((errCode == FEE_E_NO_ERROR) && (NumberOfJobs > 0u))
+    {
+        Fee_GlobalSuspend();
+
+        errCode = Fee_ChkNotBusy();
+
+        /* #30 Vector is modified only if the request is accepted; a rejected vector is left unchanged */
+        if(errCode == FEE_E_NO_ERROR) /* COV_FEE_ERR_DETECT_OFF */
+        {
+            /* #40 Order elements by partition and physical location, and mark them pending */
+            Fee_InternalSortReadBatch(Jobs, NumberOfJobs); /* SBSW_FEE_ReadBatchJobs */
+
+            for(jobIdx = 0u; jobIdx < NumberOfJobs; jobIdx++)
+            {
+                Jobs[jobIdx].JobResult = MEMIF_JOB_PENDING; /* SBSW_FEE_ReadBatchJobs */
+            }
+
+            /* #50 Request reading of first element; MainFunction continues with remaining ones */
+            Fee_Globals_t.ReadBatch_t.Jobs_pt = Jobs;
+            Fee_Globals_t.ReadBatch_t.NumberOfJobs = NumberOfJobs;
+            Fee_Globals_t.ReadBatch_t.CurrentJob = 0u;
+
+            Fee_InternalSetReadBatchJobParams();
+
+            Fee_Globals_t.FeeModuleStatus_t = MEMIF_BUSY;
+            Fee_Globals_t.FeeJobResult_t = MEMIF_JOB_PENDING;
+        }
+
+        Fee_GlobalRestore();
+
+        Fee_SignalNeedProcessing();
+    }
+    else if(errCode == FEE_E_NO_ERROR) /* COV_FEE_ERR_DETECT_OFF */
+    {
+        errCode = FEE_E_PARAM_LENGTH_OFFSET;
+    }
+    else
+    {
+        /* DET error is reported below */
+    }
+
+    return Fee_ErrorCode2ReturnType(errCode, FEE_SID_READ_BATCH);
+} /* End of Fee_ReadBatch() */
+#endif
+
+
 /**********************************************************************************************************************
  * Fee_Write
  *********************************************************************************************************************/
@@ -882,6 +1048,10 @@ FUNC(void, FEE_API_CODE) Fee_Cancel(void)
         Fee_Globals_t.JobParams.requestedJob = FEE_JOB_NONE; 
         Fee_Globals_t.ApiFlags.cancelReq = TRUE;
 
+#if (FEE_READ_BATCH_API == STD_ON)
+        Fee_InternalCancelReadBatch();
+#endif
+
         Fee_GlobalRestore();
 
         Fee_SignalNeedProcessing();
@@ -1586,6 +1756,189 @@ FEE_INLINE_FUNC(Fee_DetErrorCodeType) Fee_InternalInitWriteRequest(enum Fee_tagR
     return retVal;
 }
 
+
+#if (FEE_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ * Fee_InternalGetReadBatchPosition
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FEE_LOCAL_FUNC(uint32) Fee_InternalGetReadBatchPosition(Fee_BlockCfgDatasetPair block, uint16 blockNumber)
+{
+    uint32 retVal = blockNumber;
+#if (FEE_LOOKUPTABLE_MODE == STD_ON)
+    const Fee_PartitionRefType partition = Fee_Partition_getFromConfigById(Fee_Globals_t.Config_pt, (uint8)block.config->PartitionIndex); /* SBSW_FEE_GlobalConfigPointer */ /* SBSW_FEE_getBlockCfgFromBlockNumber */
+
+    /* #10 Use address of block's most recent chunk, if partition's LookUpTable knows it */
+    if(Fee_Lut_IsLutEnabled(partition) == FEE_TRUE) /* PRQA S 1881 */  /* MD_FEE_10.4_compare_FeeBool_to_enum */ /* SBSW_FEE_PartitionConfig */
+    {
+        retVal = Fee_Lut_GetChunkAddressOfBlock(partition, block.config, block.dataIndex); /* SBSW_FEE_PartitionConfig */
+    }
+#else
+    FEE_DUMMY_STATEMENT(block);
+#endif
+
+    return retVal;
+}
+
+
+/**********************************************************************************************************************
+ * Fee_InternalIsReadBatchJobBehind
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FEE_LOCAL_FUNC(Fee_Bool) Fee_InternalIsReadBatchJobBehind(uint16 blockNumber, uint8 partitionIndex, uint32 position)
+{
+    const Fee_BlockCfgDatasetPair block = Fee_getBlockCfgFromBlockNumber(blockNumber);
+    const uint8 blockPartitionIndex = (uint8)block.config->PartitionIndex; /* SBSW_FEE_getBlockCfgFromBlockNumber */
+    Fee_Bool retVal = FEE_FALSE; /* PRQA S 4423 */ /* MD_FEE_10.3_essentially_enum_type */
+
+    /* #10 Partition order has precedence, position within partition decides otherwise */
+    if((blockPartitionIndex > partitionIndex) ||
+       ((blockPartitionIndex == partitionIndex) && (Fee_InternalGetReadBatchPosition(block, blockNumber) > position)))
+    {
+        retVal = FEE_TRUE; /* PRQA S 4423 */ /* MD_FEE_10.3_essentially_enum_type */
+    }
+
+    return retVal;
+}
+
+
+/**********************************************************************************************************************
+ * Fee_InternalSortReadBatch
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FEE_LOCAL_FUNC(void) Fee_InternalSortReadBatch(MemIf_ReadBatchJobPtrType jobs, uint16 numberOfJobs)
+{
+    uint16 jobIdx;
+
+    /* #10 Insertion sort: vectors are short, and usually (almost) sorted by block number already */
+    for(jobIdx = 1u; jobIdx < numberOfJobs; jobIdx++)
+    {
+        const MemIf_ReadBatchJobType job = jobs[jobIdx];
+        const Fee_BlockCfgDatasetPair block = Fee_getBlockCfgFromBlockNumber(job.BlockNumber);
+        const uint8 partitionIndex = (uint8)block.config->PartitionIndex; /* SBSW_FEE_getBlockCfgFromBlockNumber */
+        const uint32 position = Fee_InternalGetReadBatchPosition(block, job.BlockNumber);
+        uint16 insertIdx = jobIdx;
+
+        /* #20 Shift all preceding elements located behind current one by one element */
+        while((insertIdx > 0u) && (Fee_InternalIsReadBatchJobBehind(jobs[insertIdx - 1u].BlockNumber, partitionIndex, position) == FEE_TRUE)) /* PRQA S 1881 */  /* MD_FEE_10.4_compare_FeeBool_to_enum */
+        {
+            jobs[insertIdx] = jobs[insertIdx - 1u]; /* SBSW_FEE_ReadBatchJobs */
+            insertIdx--;
+        }
+
+        jobs[insertIdx] = job; /* SBSW_FEE_ReadBatchJobs */
+    }
+}
+
+
+/**********************************************************************************************************************
+ * Fee_InternalSetReadBatchJobParams
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FEE_LOCAL_FUNC(void) Fee_InternalSetReadBatchJobParams(void)
+{
+    const MemIf_ReadBatchJobType job = Fee_Globals_t.ReadBatch_t.Jobs_pt[Fee_Globals_t.ReadBatch_t.CurrentJob];
+    const Fee_BlockCfgDatasetPair block = Fee_getBlockCfgFromBlockNumber(job.BlockNumber);
+
+    /* #10 Same parameters as set by Fee_Read, elements have already been checked */
+    Fee_Globals_t.JobParams.params.blockJob.add.read.readBuffer = job.DataBufferPtr;
+    Fee_Globals_t.JobParams.params.blockJob.add.read.offset = job.BlockOffset;
+    Fee_Globals_t.JobParams.params.blockJob.add.read.length = job.Length;
+    Fee_Globals_t.JobParams.params.blockJob.blockRef = block;
+
+    Fee_Globals_t.JobParams.partitionId = (sint8)(block.config->PartitionIndex); /* SBSW_FEE_getBlockCfgFromBlockNumber */
+    Fee_Globals_t.JobParams.requestedJob = FEE_JOB_READ;
+}
+
+
+/**********************************************************************************************************************
+ * Fee_InternalCancelReadBatch
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FEE_LOCAL_FUNC(void) Fee_InternalCancelReadBatch(void)
+{
+    if(Fee_Globals_t.ReadBatch_t.Jobs_pt != NULL_PTR)
+    {
+        uint16 jobIdx;
+
+        /* #10 Mark all elements not finished so far as canceled */
+        for(jobIdx = Fee_Globals_t.ReadBatch_t.CurrentJob; jobIdx < Fee_Globals_t.ReadBatch_t.NumberOfJobs; jobIdx++)
+        {
+            Fee_Globals_t.ReadBatch_t.Jobs_pt[jobIdx].JobResult = MEMIF_JOB_CANCELED; /* SBSW_FEE_ReadBatchJobs */
+        }
+
+        Fee_Globals_t.ReadBatch_t.Jobs_pt = NULL_PTR;
+    }
+}
+
+
+/**********************************************************************************************************************
+ * Fee_InternalContinueReadBatch
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FEE_INTERN_FUNC(Fee_Bool) Fee_InternalContinueReadBatch(void)
+{
+    Fee_Bool retVal = FEE_FALSE; /* PRQA S 4423 */ /* MD_FEE_10.3_essentially_enum_type */
+
+    Fee_GlobalSuspend();
+
+    /* #10 Batch might have been canceled meanwhile */
+    if(Fee_Globals_t.ReadBatch_t.Jobs_pt != NULL_PTR)
+    {
+        /* #20 Store result of finished element */
+        Fee_Globals_t.ReadBatch_t.Jobs_pt[Fee_Globals_t.ReadBatch_t.CurrentJob].JobResult = Fee_Globals_t.FeeJobResult_t; /* SBSW_FEE_ReadBatchJobs */
+        Fee_Globals_t.ReadBatch_t.CurrentJob++;
+
+        /* #30 Request next element; Fee remains BUSY */
+        if(Fee_Globals_t.ReadBatch_t.CurrentJob < Fee_Globals_t.ReadBatch_t.NumberOfJobs)
+        {
+            Fee_InternalSetReadBatchJobParams();
+            Fee_Globals_t.FeeJobResult_t = MEMIF_JOB_PENDING;
+            retVal = FEE_TRUE; /* PRQA S 4423 */ /* MD_FEE_10.3_essentially_enum_type */
+        }
+        /* #40 Otherwise close batch; elements' results are authoritative */
+        else
+        {
+            Fee_Globals_t.ReadBatch_t.Jobs_pt = NULL_PTR;
+            Fee_Globals_t.FeeJobResult_t = MEMIF_JOB_OK;
+        }
+    }
+
+    Fee_GlobalRestore();
+
+    return retVal;
+}
+#endif
+
 #define FEE_STOP_SEC_CODE
 #include "MemMap.h"      /* PRQA S 5087 */ /* MD_MSR_19.1 */
 /* PRQA L:uncoveredCode */
@@ -1961,6 +2314,13 @@ ChunkInfos are always initialized with a particular sector (from a given partiti
 or implicitly (Fee_ChunkInfo_clone)
 \COUNTERMEASURE \N If this behavior was not given, Test would not succeed.
 
+\ID SBSW_FEE_ReadBatchJobs
+\DESCRIPTION Accessing an element of a user-supplied vector of read requests, or passing the vector as an argument.
+The vector was passed when requesting Fee_ReadBatch; indices are always less than the passed number of elements.
+\COUNTERMEASURE \S Caller has to ensure that the vector is and remains valid (and holds the passed number of elements),
+for a request's complete processing time.
+\R Runtime-Check exists to verify it's not a NULL_PTR
+
 \ID SBSW_FEE_Conversion_OptionsPointer
 \DESCRIPTION A user-supplied data buffer is used and eventually a user-supplied function is called via function pointer.
 Both pointers were passed when requesting Fee_ConvertBlockConfig.
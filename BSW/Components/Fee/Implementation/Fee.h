@@ -216,6 +216,10 @@
 #include "Fee_Types.h"
 #include "Fee_Cfg.h"
 
+#ifndef FEE_READ_BATCH_API /* COV_FEE_COMPATIBILITY */
+# define FEE_READ_BATCH_API                                           STD_OFF
+#endif
+
 /**********************************************************************************************************************
  *  GLOBAL FUNCTION PROTOTYPES
  *********************************************************************************************************************/
@@ -595,6 +599,30 @@ FUNC(Std_ReturnType, FEE_API_CODE) Fee_SyncLookUpTable(void);
 #endif
 
 
+#if (FEE_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ * Fee_ReadBatch
+ *********************************************************************************************************************/
+/*! \brief      Requests reading of several blocks within one job
+ *  \details    Checks all elements of Jobs, sorts them by partition and, if the LookUpTable is enabled, by the
+ *              physical address of the blocks' most recent chunks. The elements are then read one after another
+ *              without returning to idle in between; each element's result is stored in its JobResult member.
+ *              Fee's job result becomes MEMIF_JOB_OK once all elements were processed.
+ *  \param[in,out] Jobs              Vector of read requests. Is reordered only if the job is accepted; must remain
+ *                                  valid until job is finished.
+ *  \param[in]  NumberOfJobs         Number of elements in Jobs.
+ *  \return     E_OK                Job accepted.
+ *  \return     E_NOT_OK            Job rejected.
+ *  \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ *  \pre        Module must be initialized.
+ *  \context    TASK
+ *  \reentrant  FALSE
+ *  \synchronous FALSE
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, FEE_API_CODE) Fee_ReadBatch(MemIf_ReadBatchJobPtrType Jobs, uint16 NumberOfJobs);
+#endif
+
+
 
 # define FEE_STOP_SEC_CODE
 # include "MemMap.h"
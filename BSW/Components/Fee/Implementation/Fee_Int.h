@@ -37,6 +37,7 @@
 #include "Fee_PrivateCfg.h"
 #include "Fee_IntBase.h"
 #include "Fee_Cfg.h"
+#include "Fee.h"
 #include "Fee_Sector.h"
 #include "Fee_Partition.h"
 #include "Fee_ChunkInfo.h"
@@ -333,6 +334,15 @@ typedef P2CONST(struct Fee_LookUpTableContextStruct, AUTOMATIC, FEE_VAR_NOINIT)
 
 typedef uint8 Fee_InternalErrorType;
 
+#if (FEE_READ_BATCH_API == STD_ON)
+struct Fee_ReadBatchStruct /*<! Progress of a batched read request (Fee_ReadBatch) */
+{
+    MemIf_ReadBatchJobPtrType Jobs_pt; /*<! caller's (sorted) vector; NULL_PTR, if no batch is active */
+    uint16 NumberOfJobs;               /*<! number of elements in vector */
+    uint16 CurrentJob;                 /*<! index of the element currently being read */
+};
+#endif
+
 struct Fee_ChunkHoppingContextStruct   /*<! Context, i.e. parameters and run-time variables, of Chunk Hopping operations */
 {
     struct Fee_ChunkInfoStruct tempChunk_t; /*<! Temporary chunk (whose header is to be evaluated) */
@@ -529,6 +539,10 @@ typedef struct Fee_GlobalVariableStruct /*<! (Almost) all FEE variables are gath
     struct Fee_LookUpTableContextStruct LookUpTableContext_t; /*!< parameters which are used in LUT chunk search context */
 #endif /* (FEE_LOOKUPTABLE_MODE == STD_ON) */
     struct Fee_SectorSwitchData SectorSwitchData_t;      /*<! sector switch's progress data */
+#if (FEE_READ_BATCH_API == STD_ON)
+    struct Fee_ReadBatchStruct ReadBatch_t;              /*<! batched read progress; controlled by API and MainFunction,
+                                                              exclusive area necessary */
+#endif
     struct
     {
         Fee_BitFieldType forceFblMode :1;       /* sector switch processing shall be done in FBL mode */
@@ -635,6 +649,26 @@ FEE_INTERN_FUNC(void) Fee_SignalNeedProcessing(void);
  */
 FEE_INTERN_FUNC(Fee_Bool) Fee_FsmIsSectorSwitchFsmRunning(Fee_GlobalsConstPtrType g);
 
+
+
+#if (FEE_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ * Fee_InternalContinueReadBatch
+ *********************************************************************************************************************/
+/*!
+ * \brief      Stores result of finished job in current batch element and requests reading of next element
+ * \details    Does nothing, if no batched read is active. After the last element, the batch is closed and
+ *             the job result is set to MEMIF_JOB_OK.
+ * \return     TRUE: Next element was requested; job is still pending
+ * \return     FALSE: No batch active, or batch has been completed
+ * \config     FEE_READ_BATCH_API is enabled via pre-compile switch
+ * \pre        Job's result has already been stored in FeeJobResult_t
+ * \context    TASK
+ * \reentrant  FALSE
+ */
+FEE_INTERN_FUNC(Fee_Bool) Fee_InternalContinueReadBatch(void);
+#endif
+
 #define FEE_STOP_SEC_CODE
 #include "MemMap.h"
 
@@ -389,6 +389,35 @@ FEE_INTERN_FUNC(Fee_LengthType) Fee_Lut_GetChunkAddressFromLut(Fee_LookUpTableCo
   return entryRef->ChunkHeaderAddress; /* SBSW_FEE_Lut_Entry_ref */
 }
 
+
+/**********************************************************************************************************************
+ * Fee_Lut_GetChunkAddressOfBlock
+ ******************************************************************************************************************** */
+/*!
+ * Internal comment removed.
+ *
+ *
+  */
+FEE_INTERN_FUNC(Fee_LengthType) Fee_Lut_GetChunkAddressOfBlock(Fee_PartitionRefType partitionRef,
+                                                               Fee_BlockConfigRefType blockConfigRef, uint8 datasetIndex)
+{
+  struct Fee_LookUpTableContextStruct lutContext;
+  Fee_LengthType retVal = 0u;
+
+  /* #10 Build a temporary LookUpTable context for given block  */
+  lutContext.Partition_pt = partitionRef;
+  lutContext.BlockConfig_pt = blockConfigRef;
+  lutContext.datasetIndex = datasetIndex;
+
+  /* #20 Read entry's ChunkHeaderAddress, if LookUpTable is enabled for partition  */
+  if (Fee_Lut_IsAccessAllowed(&lutContext) == FEE_TRUE) /* PRQA S 1881 */  /* MD_FEE_10.4_compare_FeeBool_to_enum */ /* SBSW_FEE_Func_passParamByReference */
+  {
+    retVal = Fee_Lut_GetChunkAddressFromLut(&lutContext); /* SBSW_FEE_Func_passParamByReference */
+  }
+
+  return retVal;
+}
+
 /**********************************************************************************************************************
  * Fee_Lut_GetSectorByAddress
  ******************************************************************************************************************** */
@@ -80,6 +80,25 @@ FEE_INTERN_FUNC(void) Fee_Lut_InitContextStruct(Fee_LookUpTableContextRefType se
  */
 FEE_INTERN_FUNC(Fee_LengthType) Fee_Lut_GetChunkAddressFromLut(Fee_LookUpTableContextConstRefType self);
 
+/**********************************************************************************************************************
+ * Fee_Lut_GetChunkAddressOfBlock
+ *********************************************************************************************************************/
+/*!
+ * \brief      Returns ChunkHeaderAddress of LookUpTable entry of given block
+ * \details    Works without a job context; used to order requests by physical address
+ * \param[in]  partitionRef
+ * \param[in]  blockConfigRef
+ * \param[in]  datasetIndex
+ * \return     address of the block's most recent chunk header; 0, if LookUpTable is not enabled for partition
+ * \pre        -
+ * \config        FEE_LOOKUPTABLE_MODE is enabled via pre-compile switch
+ * \context    TASK
+ * \reentrant  FALSE
+ * \synchronous TRUE
+ */
+FEE_INTERN_FUNC(Fee_LengthType) Fee_Lut_GetChunkAddressOfBlock(Fee_PartitionRefType partitionRef,
+                                                               Fee_BlockConfigRefType blockConfigRef, uint8 datasetIndex);
+
 
 /**********************************************************************************************************************
  * Fee_Lut_GetSectorByAddress
@@ -6060,20 +6060,26 @@ FEE_LOCAL_FUNC(void) Fee_ActFinalizeJob(void)
                 break;
         }
 
-    #if (STD_OFF == FEE_NVM_POLLING_MODE)
-        if ((Fee_LocalJobResultType)FEE_LOCAL_JOB_RESULT_OK == Fee_Globals_t.FeeLocalJobResult_t)
-        {
-            Fee_NvMJobEndNotification();
-        }
-        else
+#if (FEE_READ_BATCH_API == STD_ON)
+        /* Within a batched read, next element is processed without notifying the user */
+        if(Fee_InternalContinueReadBatch() == FEE_FALSE) /* PRQA S 1881 */  /* MD_FEE_10.4_compare_FeeBool_to_enum */
+#endif
         {
-            Fee_NvMJobErrorNotification();
-        }
+    #if (STD_OFF == FEE_NVM_POLLING_MODE)
+            if (MEMIF_JOB_OK == Fee_Globals_t.FeeJobResult_t)
+            {
+                Fee_NvMJobEndNotification();
+            }
+            else
+            {
+                Fee_NvMJobErrorNotification();
+            }
     #endif /* (STD_OFF == FEE_NVM_POLLING_MODE) */
 
-        Fee_Globals_t.JobParams.requestedJob = FEE_JOB_NONE;
+            Fee_Globals_t.JobParams.requestedJob = FEE_JOB_NONE;
 
-        Fee_Globals_t.FeeModuleStatus_t = MEMIF_BUSY_INTERNAL;
+            Fee_Globals_t.FeeModuleStatus_t = MEMIF_BUSY_INTERNAL;
+        }
     }
 
     Fee_SignalReEnterMainFunction();
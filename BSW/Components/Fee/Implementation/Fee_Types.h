@@ -84,6 +84,7 @@ typedef enum {
 
 #define FEE_SID_CONVERT_BLOCK_CONFIG                                  (0x24u)
 #define FEE_SID_SYNC_LOOKUP_TABLE                                     (0x25u)
+#define FEE_SID_READ_BATCH                                            (0x26u)
 
 #define FEE_SID_SUSPEND_WRITE                                         (0x30u)
 #define FEE_SID_RESUME_WRITE                                          (0x31u)
@@ -88,6 +88,10 @@
 /* Value that is 1 greater than the maximum value of a byte, where the maximum value of a byte is 0xFF. */
 #define IPBASE_SOCK_VALUE_BY_1_GREATER_THAN_MAX_BYTE_VALUE (0x100u)
 
+/* Masks for folding checksum accumulators. */
+#define IPBASE_SOCK_MASK_LOWER_16_BITS            (0x0000FFFFu)
+#define IPBASE_SOCK_MASK_LOWER_32_BITS            (0xFFFFFFFFu)
+
 /***********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  **********************************************************************************************************************/
@@ -327,9 +331,7 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_TcpIpChecksumCopyAddHlp(
  *  \synchronous   TRUE
  *  \trace         CREQ-120251
  **********************************************************************************************************************/
-#if IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY == STD_ON
 IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint8) IpBase_AlignmentOffset32Bit(IPBASE_CONSTP2CONSTAPPLDATA(uint8) Pointer);
-#endif /* IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY */
 
 /***********************************************************************************************************************
  *  IpBase_SmallLenChecksumCopyAddHlp
@@ -723,10 +725,49 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_PartialChecksumCopyAddHlp(
  *  \synchronous   TRUE
  *  \trace         CREQ-120251
  **********************************************************************************************************************/
-#if IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY == STD_ON
 IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAddHlp(IPBASE_CONSTCONST(uint32) Data,
                                                                   IPBASE_CONSTCONST(uint32) Checksum);
-#endif /* IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY */
+
+/***********************************************************************************************************************
+ *  IpBase_ChecksumAdd4WordsHlp
+ **********************************************************************************************************************/
+/*! \brief         Adds 4 x 4 bytes to the checksum with deferred carry
+ *  \details       The words are summed without an end-around carry per addition. The carries are folded back once
+ *                 (IPBASE_CHECKSUM_64BIT_ACCUMULATOR == STD_ON) or can not occur because the 16-bit halves of the words
+ *                 are summed (IPBASE_CHECKSUM_64BIT_ACCUMULATOR == STD_OFF). The returned value is congruent to the
+ *                 one's complement sum modulo 0xFFFF, which is all that is evaluated when the checksum is folded.
+ *  \param[in]     Word0             First word to add.
+ *  \param[in]     Word1             Second word to add.
+ *  \param[in]     Word2             Third word to add.
+ *  \param[in]     Word3             Fourth word to add.
+ *  \param[in]     Checksum          Current 32-bit checksum of processed data.
+ *  \return        Calculated 32-bit checksum.
+ *  \pre           -
+ *  \context       ANY
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ **********************************************************************************************************************/
+IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAdd4WordsHlp(IPBASE_CONSTCONST(uint32) Word0,
+                                                                        IPBASE_CONSTCONST(uint32) Word1,
+                                                                        IPBASE_CONSTCONST(uint32) Word2,
+                                                                        IPBASE_CONSTCONST(uint32) Word3,
+                                                                        IPBASE_CONSTCONST(uint32) Checksum);
+
+/***********************************************************************************************************************
+ *  IpBase_ChecksumAddAlignedWordsHlp
+ **********************************************************************************************************************/
+/*! \brief         Calculates the checksum of 32-bit aligned data
+ *  \details       Reads the data in 32-bit words in host byte order and sums them with deferred carry.
+ *  \param[in]     WordPtr           Pointer to the 32-bit aligned data.
+ *  \param[in]     WordLen           Data length in 32-bit words.
+ *  \return        Calculated 32-bit checksum in host byte order.
+ *  \pre           -
+ *  \context       ANY
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ **********************************************************************************************************************/
+IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAddAlignedWordsHlp(IPBASE_P2CONSTAPPLDATA(uint32) WordPtr,
+                                                                              IPBASE_CONSTCONST(uint32) WordLen);
 
 /***********************************************************************************************************************
  *  IpBase_ChecksumIntermediateOrFinalize
@@ -1082,42 +1123,28 @@ IPBASE_FUNCCODE(uint16) IpBase_CalcTcpIpChecksum2(IPBASE_P2CONSTAPPLDATA(uint8)
   else
   {
     /* ----- Implementation ----------------------------------------------- */
-    uint32_least idx      = (uint32_least)(LenByte >> 1);  /* 16 bit LenByte, 8 bit idx -> divide by 2 */               /* PRQA S 4391 */ /* MD_IpBase_4391 */
-    uint32       checksum = 0u;
+    uint32 checksum;
 
-    /* #20 Add checksum data */
-    while ( idx != 0u ) /* FETA_IPBASE_SOCK_LEN_PARAM */
-    {
-      idx--;
-      checksum += (uint16)(((uint32)(DataPtr[(idx << 1)]) << 8)+DataPtr[(idx << 1) + 1u]);
-    }
-    /* #30 Add odd byte */
-    if ( (LenByte & 0x00000001u) != 0u )
-    {
-      checksum += (uint16)(((uint32)(DataPtr[LenByte - 1u]) << 8));
-    }
-    /* #40 Add pseudo header checksum */
+    /* #20 Add checksum data including a padded odd byte */
+    checksum = IpBase_TcpIpChecksumAddHlp(DataPtr, LenByte, 0u);                                                        /* SBSW_IPBASE_PASSING_API_POINTER */
+
+    /* #30 Add pseudo header checksum (complete 16-bit words only) */
     if ( PseudoHdrPtr != NULL_PTR )
     {
-      idx   = (uint32_least)(PseudoHdrLenByte >> 1);                                                                    /* PRQA S 4391 */ /* MD_IpBase_4391 */
-      while ( idx != 0u ) /* FETA_IPBASE_SOCK_LEN_PARAM */
-      {
-        idx--;
-        checksum += (uint16)(((uint32)(PseudoHdrPtr[(idx << 1)]) << 8)+PseudoHdrPtr[(idx << 1) + 1u]);
-      }
+      checksum = IpBase_TcpIpChecksumAddHlp(PseudoHdrPtr, PseudoHdrLenByte & 0xFFFFFFFEu, checksum);                    /* SBSW_IPBASE_PASSING_API_POINTER */
     }
-    /* #50 Consider overflow */
+    /* #40 Consider overflow */
     while ( (checksum>>16) != 0u ) /* FETA_IPBASE_SOCK_CHKSUM_SHIFT */
     {
       checksum = (uint32)((checksum & 0xFFFFu) + (checksum >> 16));
     }
-    /* #60 Build one's complement */
+    /* #50 Build one's complement */
     retVal = (uint16) ~checksum;
   }
 
   /* ----- Development Error Report ------------------------------------- */
 #if (IPBASE_DEV_ERROR_REPORT == STD_ON)
-  /* #70 Check ErrorId and report DET */
+  /* #60 Check ErrorId and report DET */
   if (errorId != IPBASE_E_NO_ERROR)
   {
     (void)Det_ReportError(IPBASE_MODULE_ID, IPBASE_INSTANCE_ID, IPBASE_API_SID_CALC_TCPIP_CHECKSUM2, errorId);
@@ -1351,43 +1378,68 @@ IPBASE_LOCAL IPBASE_FUNCCODE(uint32) IpBase_TcpIpChecksumAddHlp(IPBASE_P2CONSTAP
 {
   /* ----- Local Variables ---------------------------------------------- */
   uint32 dataIdx  = 0u;
-  uint32 checksumRet  = Checksum;
+  uint32 checksumRet  = 0u; /* Checksum of the data behind an odd start byte. */
   uint32 lenByteLoc = LenByte;
+  uint8  headLen = IpBase_AlignmentOffset32Bit(DataPtr);                                                                /* SBSW_IPBASE_NUMERIC_POINTER_ADDRESS */
+  boolean isOddStart = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Add Checksum */
-  while ( lenByteLoc > 3u ) /* FETA_IPBASE_SOCK_LEN_PARAM */
-  { /* #20 Add 32 bit values */
-    lenByteLoc -= 4u;
-    checksumRet += IpBase_GetUint32(DataPtr, dataIdx);                                                                  /* SBSW_IPBASE_PASSING_API_POINTER */
-    if ( checksumRet < IpBase_GetUint32(DataPtr, dataIdx) )                                                             /* SBSW_IPBASE_PASSING_API_POINTER */
-    { /* overflow */
-      checksumRet++;
-    }
-    dataIdx += 4u;
+  /* #10 If the data starts at an odd address, put the first byte aside. The remaining data starts at an even address
+         but its bytes are paired the other way round, which is corrected by swapping its checksum (the one's complement
+         sum is byte order independent, RFC 1071). */
+  if ( ((headLen % IPBASE_SOCK_MODULO_2_OFFSET_EVEN_ODD) != 0u) && (lenByteLoc > 0u) )
+  {
+    isOddStart = TRUE;
+    dataIdx = 1u;
+    lenByteLoc--;
+    headLen--;
+  }
+
+  /* #20 Add two bytes to reach the next 32-bit boundary */
+  if ( (headLen != 0u) && (lenByteLoc > 1u) )
+  {
+    checksumRet = IpBase_GetUint16(DataPtr, dataIdx);                                                                   /* SBSW_IPBASE_PASSING_API_POINTER */
+    dataIdx += 2u;
+    lenByteLoc -= 2u;
+  }
+
+  /* #30 Add the 32-bit aligned words with deferred carry. The words are read in host byte order, so their checksum is
+         swapped into network byte order on 'low byte first' platforms. */
+  if ( lenByteLoc > 3u )
+  {
+    IPBASE_CONSTCONST(uint32) wordLen = lenByteLoc / IPBASE_SOCK_BYTE_LEN_32_BIT_WORD;
+    /* The data is 32-bit aligned at 'dataIdx' here. */
+    uint32 wordsChecksum = IpBase_ChecksumAddAlignedWordsHlp(                                                           /* SBSW_IPBASE_PASSING_API_POINTER */
+                             (IPBASE_P2CONSTAPPLDATA(uint32))&DataPtr[dataIdx], wordLen);                               /* PRQA S 310,3305 */ /* MD_IpBase_310_3305_PtrCast */
+
+#if ( CPU_BYTE_ORDER == LOW_BYTE_FIRST )                                                                                /* COV_IPBASE_BYTE_ORDER */
+    wordsChecksum = IPBASE_BYTE_SWAP32(wordsChecksum);
+#endif
+    checksumRet = IpBase_ChecksumAddHlp(wordsChecksum, checksumRet);
+    dataIdx += wordLen * IPBASE_SOCK_BYTE_LEN_32_BIT_WORD;
+    lenByteLoc -= wordLen * IPBASE_SOCK_BYTE_LEN_32_BIT_WORD;
   }
 
   if ( lenByteLoc > 1u )
-  { /* #30 Add two '32-odd' bytes */
+  { /* #40 Add two '32-odd' bytes */
     lenByteLoc -= 2u;
-    checksumRet += IpBase_GetUint16(DataPtr, dataIdx);                                                                  /* SBSW_IPBASE_PASSING_API_POINTER */
-    if ( checksumRet < IpBase_GetUint16(DataPtr, dataIdx) )                                                             /* SBSW_IPBASE_PASSING_API_POINTER */
-    { /* overflow */
-      checksumRet++;
-    }
+    checksumRet = IpBase_ChecksumAddHlp(IpBase_GetUint16(DataPtr, dataIdx), checksumRet);                               /* SBSW_IPBASE_PASSING_API_POINTER */
     dataIdx += 2u;
   }
 
   if ( lenByteLoc > 0u )
-  { /* #40 Add one '32-odd' bytes */
-    checksumRet += (uint32)(DataPtr[dataIdx]) << 8u;
-    if ( checksumRet < ((uint32)(DataPtr[dataIdx]) << 8u) )
-    { /* overflow */
-      checksumRet++;
-    }
+  { /* #50 Add one '32-odd' bytes */
+    checksumRet = IpBase_ChecksumAddHlp((uint32)(DataPtr[dataIdx]) << 8u, checksumRet);
   }
 
-  return checksumRet;
+  /* #60 Correct the byte pairing and add the odd start byte as high byte of the first word */
+  if ( isOddStart == TRUE )
+  {
+    checksumRet = IpBase_ChecksumAddHlp(IPBASE_BYTE_SWAP32(checksumRet), (uint32)(DataPtr[0]) << 8u);
+  }
+
+  /* #70 Add the checksum of the previously processed data */
+  return IpBase_ChecksumAddHlp(checksumRet, Checksum);
 } /* IpBase_TcpIpChecksumAddHlp() */
 
 /* ---- Checksum and Copy Functions ---- */
@@ -1560,7 +1612,6 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_TcpIpChecksumCopyAddHlp(
  *
  *
  **********************************************************************************************************************/
-#if IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY == STD_ON
 IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint8) IpBase_AlignmentOffset32Bit(IPBASE_CONSTP2CONSTAPPLDATA(uint8) Pointer)
 {
   /* ----- Local Variables ---------------------------------------------- */
@@ -1582,7 +1633,6 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint8) IpBase_AlignmentOffset32Bit(IPBASE_CO
 
   return offset;
 } /* IpBase_AlignmentOffset32Bit() */
-#endif /* IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY */
 
 /***********************************************************************************************************************
  * IpBase_SmallLenChecksumCopyAddHlp
@@ -1938,10 +1988,11 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAlignedCopyAddHlp(
     IpBase_AlignedOneBlockCopyHlp(AlignedArrayCopyDataPtr, wordIdx);                                                    /* SBSW_IPBASE_STRUCT_PASSED_IDX_VALIDITY */ /* VCA_IPBASE_STRUCT_IDX_VALIDITY */
 
     /* #40 Calculate the checksum for 4 x 4 bytes. */
-    checksumRet = IpBase_ChecksumAddHlp(AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx]     , checksumRet);
-    checksumRet = IpBase_ChecksumAddHlp(AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx + 1u], checksumRet);
-    checksumRet = IpBase_ChecksumAddHlp(AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx + 2u], checksumRet);
-    checksumRet = IpBase_ChecksumAddHlp(AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx + 3u], checksumRet);
+    checksumRet = IpBase_ChecksumAdd4WordsHlp(AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx],
+                                              AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx + 1u],
+                                              AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx + 2u],
+                                              AlignedArrayCopyDataPtr->SrcDataPtr[wordIdx + 3u],
+                                              checksumRet);
   }
 
   /* #50 If the root source offset is odd, swap the calculated checksum. */
@@ -2186,10 +2237,8 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumUnalignedCopyAddBlock
                                     &modSrcWords);
 
     /* #40 Calculate the checksum for 4 x 4 bytes. */
-    checksumRet = IpBase_ChecksumAddHlp(modSrcWords.SrcWord0, checksumRet);
-    checksumRet = IpBase_ChecksumAddHlp(modSrcWords.SrcWord1, checksumRet);
-    checksumRet = IpBase_ChecksumAddHlp(modSrcWords.SrcWord2, checksumRet);
-    checksumRet = IpBase_ChecksumAddHlp(modSrcWords.SrcWord3, checksumRet);
+    checksumRet = IpBase_ChecksumAdd4WordsHlp(modSrcWords.SrcWord0, modSrcWords.SrcWord1,
+                                              modSrcWords.SrcWord2, modSrcWords.SrcWord3, checksumRet);
   }
 
   /* #50 If the offset sum is odd, swap the calculated checksum. */
@@ -2330,7 +2379,6 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_PartialChecksumCopyAddHlp(
  *
  *
   **********************************************************************************************************************/
-#if IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY == STD_ON
 IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAddHlp(IPBASE_CONSTCONST(uint32) Data,
                                                                   IPBASE_CONSTCONST(uint32) Checksum)
 {
@@ -2349,7 +2397,91 @@ IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAddHlp(IPBASE_CONSTCO
 
   return checksumRet;
 } /* IpBase_ChecksumAddHlp() */
-#endif /* IPBASE_ENABLE_ONE_STEP_CHECKSUM_COPY */
+
+/***********************************************************************************************************************
+ *  IpBase_ChecksumAdd4WordsHlp
+ **********************************************************************************************************************/
+ /*! Internal comment removed.
+  **********************************************************************************************************************/
+IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAdd4WordsHlp(IPBASE_CONSTCONST(uint32) Word0,
+                                                                        IPBASE_CONSTCONST(uint32) Word1,
+                                                                        IPBASE_CONSTCONST(uint32) Word2,
+                                                                        IPBASE_CONSTCONST(uint32) Word3,
+                                                                        IPBASE_CONSTCONST(uint32) Checksum)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 checksumRet;
+
+  /* ----- Implementation ----------------------------------------------- */
+#if (IPBASE_CHECKSUM_64BIT_ACCUMULATOR == STD_ON)
+  /* #10 Sum the words in a 64-bit accumulator. The carries are collected in the upper half and folded back twice
+         (the first fold may carry again). */
+  uint64 accu = (uint64)Checksum + (uint64)Word0 + (uint64)Word1 + (uint64)Word2 + (uint64)Word3;
+
+  accu = (accu & IPBASE_SOCK_MASK_LOWER_32_BITS) + (accu >> IPBASE_SOCK_BIT_LEN_4_BYTES);
+  accu = (accu & IPBASE_SOCK_MASK_LOWER_32_BITS) + (accu >> IPBASE_SOCK_BIT_LEN_4_BYTES);
+  checksumRet = (uint32)accu;
+#else
+  /* #20 Sum the 16-bit halves in a 32-bit accumulator. Ten halves can not overflow it, so no carry handling is
+         needed. The result stays below 2^20 and can be passed to the next call. */
+  checksumRet = (Checksum & IPBASE_SOCK_MASK_LOWER_16_BITS) + (Checksum >> IPBASE_SOCK_BIT_LEN_2_BYTES)
+              + (Word0 & IPBASE_SOCK_MASK_LOWER_16_BITS)    + (Word0 >> IPBASE_SOCK_BIT_LEN_2_BYTES)
+              + (Word1 & IPBASE_SOCK_MASK_LOWER_16_BITS)    + (Word1 >> IPBASE_SOCK_BIT_LEN_2_BYTES)
+              + (Word2 & IPBASE_SOCK_MASK_LOWER_16_BITS)    + (Word2 >> IPBASE_SOCK_BIT_LEN_2_BYTES)
+              + (Word3 & IPBASE_SOCK_MASK_LOWER_16_BITS)    + (Word3 >> IPBASE_SOCK_BIT_LEN_2_BYTES);
+#endif
+
+  return checksumRet;
+} /* IpBase_ChecksumAdd4WordsHlp() */
+
+/***********************************************************************************************************************
+ *  IpBase_ChecksumAddAlignedWordsHlp
+ **********************************************************************************************************************/
+ /*! Internal comment removed.
+  **********************************************************************************************************************/
+IPBASE_LOCAL_INLINE IPBASE_FUNCCODE(uint32) IpBase_ChecksumAddAlignedWordsHlp(IPBASE_P2CONSTAPPLDATA(uint32) WordPtr,
+                                                                              IPBASE_CONSTCONST(uint32) WordLen)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  IPBASE_CONSTCONST(uint32) blockWordLen = WordLen - (WordLen % IPBASE_SOCK_BYTE_LEN_32_BIT_WORD);
+  uint32_least wordIdx;
+  uint32 checksumRet;
+
+  /* ----- Implementation ----------------------------------------------- */
+#if (IPBASE_CHECKSUM_64BIT_ACCUMULATOR == STD_ON)
+  /* The accumulator can not overflow: the data length is limited to 2^30 words. */
+  uint64 accu = 0u;
+
+  /* #10 Sum the words in 16-byte blocks into a 64-bit accumulator and fold the carries back once at the end. */
+  for (wordIdx = 0u; wordIdx < blockWordLen; wordIdx += 4u)
+  {
+    accu += (uint64)WordPtr[wordIdx] + (uint64)WordPtr[wordIdx + 1u]
+          + (uint64)WordPtr[wordIdx + 2u] + (uint64)WordPtr[wordIdx + 3u];
+  }
+  for (; wordIdx < WordLen; wordIdx++)
+  {
+    accu += (uint64)WordPtr[wordIdx];
+  }
+  accu = (accu & IPBASE_SOCK_MASK_LOWER_32_BITS) + (accu >> IPBASE_SOCK_BIT_LEN_4_BYTES);
+  accu = (accu & IPBASE_SOCK_MASK_LOWER_32_BITS) + (accu >> IPBASE_SOCK_BIT_LEN_4_BYTES);
+  checksumRet = (uint32)accu;
+#else
+  checksumRet = 0u;
+
+  /* #20 Sum the words in 16-byte blocks with deferred carry. */
+  for (wordIdx = 0u; wordIdx < blockWordLen; wordIdx += 4u)
+  {
+    checksumRet = IpBase_ChecksumAdd4WordsHlp(WordPtr[wordIdx], WordPtr[wordIdx + 1u],
+                                              WordPtr[wordIdx + 2u], WordPtr[wordIdx + 3u], checksumRet);
+  }
+  for (; wordIdx < WordLen; wordIdx++)
+  {
+    checksumRet = IpBase_ChecksumAdd4WordsHlp(WordPtr[wordIdx], 0u, 0u, 0u, checksumRet);
+  }
+#endif
+
+  return checksumRet;
+} /* IpBase_ChecksumAddAlignedWordsHlp() */
 
 /***********************************************************************************************************************
  *  IpBase_ChecksumIntermediateOrFinalize
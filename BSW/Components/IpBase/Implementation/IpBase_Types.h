@@ -32,6 +32,26 @@
  *********************************************************************************************************************/
 # include "IpBase_Cfg.h"
 
+/* Checksum accumulator: STD_ON sums 32-bit words in a 64-bit accumulator (for CPUs with native 64-bit adds), STD_OFF
+   sums 16-bit halves in a 32-bit accumulator. Both defer the end-around carry of the one's complement sum. */
+# if !defined (IPBASE_CHECKSUM_64BIT_ACCUMULATOR)                                                                      /* COV_IPBASE_COMPATIBILITY */
+#  define IPBASE_CHECKSUM_64BIT_ACCUMULATOR     STD_OFF
+# endif
+
+/* Integral type a data pointer is cast to for the 32-bit alignment check of the checksum calculation. It has the width
+   of a pointer, so the cast does not truncate the address on 64-bit targets. */
+# if !defined (IPBASE_CHECKSUM_DATA_POINTER_TYPE)                                                                      /* COV_IPBASE_COMPATIBILITY */
+/* Not each PlatformTypes.h defines CPU_TYPE_64 */
+#  if !defined (CPU_TYPE_64)                                                                                           /* COV_IPBASE_COMPATIBILITY */
+#   define CPU_TYPE_64                          64u
+#  endif
+#  if (CPU_TYPE == CPU_TYPE_64)                                                                                        /* COV_IPBASE_COMPATIBILITY */
+#   define IPBASE_CHECKSUM_DATA_POINTER_TYPE    uint64
+#  else
+#   define IPBASE_CHECKSUM_DATA_POINTER_TYPE    uint32
+#  endif
+# endif
+
 /**********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
  *********************************************************************************************************************/
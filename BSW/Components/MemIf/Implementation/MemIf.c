@@ -176,6 +176,60 @@ FUNC(Std_ReturnType, MEMIF_CODE) MemIf_Read(uint8 DeviceIndex, uint16 BlockNumbe
 }
 
 
+#if (MEMIF_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ *  MemIf_ReadBatch()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, MEMIF_CODE) MemIf_ReadBatch(uint8 DeviceIndex, MemIf_ReadBatchJobPtrType Jobs, uint16 NumberOfJobs)
+{
+  /* ----- Local Variables ------------------------------------------------------------------------------*/
+  Std_ReturnType retVal = E_NOT_OK;
+  uint8 errorId = MEMIF_E_NO_ERROR;
+
+  /* ----- Development Error Detection ------------------------------------------------------------------*/
+#if (MEMIF_DEV_ERROR_DETECT == STD_ON)
+  if (MemIf_DetChkDeviceIndex(DeviceIndex) == E_NOT_OK)
+  {
+    errorId = MEMIF_E_PARAM_DEVICE;
+  }
+  else if ((Jobs == NULL_PTR) || (NumberOfJobs == 0u))
+  {
+    errorId = MEMIF_E_PARAM_POINTER;
+  }
+  else
+#endif
+  {
+  /* ----- Implementation -------------------------------------------------------------------------------*/
+    /* #10 Devices without batch support reject the request; caller falls back to single reads */
+    if (MemIf_MemHwaReadBatchApis[DeviceIndex] != NULL_PTR)
+    {
+      retVal = MemIf_MemHwaReadBatchApis[DeviceIndex](Jobs, NumberOfJobs); /* SBSW_MEMIF_02 */
+    }
+  }
+
+  /* ----- Development Error Report ---------------------------------------------------------------------*/
+#if (MEMIF_DEV_ERROR_REPORT == STD_ON)
+  if (errorId != MEMIF_E_NO_ERROR)
+  {
+    (void)Det_ReportError(MEMIF_MODULE_ID, MEMIF_INSTANCE_ID, MEMIF_SID_READ_BATCH, errorId);
+  }
+#else
+  MEMIF_DUMMY_STATEMENT(errorId); /* SBSW_MEMIF_03 */
+#endif
+
+  return retVal;
+}
+#endif
+
+
 /**********************************************************************************************************************
  *  MemIf_Write()
  *********************************************************************************************************************/
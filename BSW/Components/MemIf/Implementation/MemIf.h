@@ -91,6 +91,14 @@
 # define MEMIF_SID_INVALIDATE               (0x07U)
 # define MEMIF_SID_VERSION_INFO             (0x08u)
 # define MEMIF_SID_ERASE                    (0x09u)
+# define MEMIF_SID_READ_BATCH               (0x0Au)
+
+/**** Optional APIs **************************************************************************************************/
+# if !defined (MEMIF_READ_BATCH_API) /* COV_MEMIF_COMPATIBILITY */
+/* Batched reads require the generated table MemIf_MemHwaReadBatchApis (one Fee_ReadBatch/Ea_ReadBatch
+ * entry per device, NULL_PTR for devices without batch support) in MemIf_Cfg.h */
+#  define MEMIF_READ_BATCH_API              STD_OFF
+# endif
 
 
 /**********************************************************************************************************************
@@ -130,6 +138,30 @@
 FUNC(Std_ReturnType, MEMIF_CODE) MemIf_Read(uint8 DeviceIndex, uint16 BlockNumber, uint16 BlockOffset, MemIf_DataPtr_pu8 DataBufferPtr, uint16 Length);
 
 
+# if (MEMIF_READ_BATCH_API == STD_ON)
+/**********************************************************************************************************************
+ *  MemIf_ReadBatch()
+ *********************************************************************************************************************/
+/*!
+ * \brief      Reads several data blocks from the EA/FEE within one job
+ * \details    Passes a vector of read requests to device DeviceIndex. The device may reorder the vector to access
+ *             its medium in ascending physical order; each element's result is stored in its JobResult member.
+ *             Device's job result becomes MEMIF_JOB_OK once all elements have been processed.
+ *             NvM does not issue batched reads; the service is provided for users accessing MemIf directly.
+ * \param[in]  DeviceIndex
+ * \param[in,out] Jobs - vector of read requests; must remain valid until the job has been finished
+ * \param[in]  NumberOfJobs - number of elements in Jobs
+ * \return     Returns if requested job has been accepted by the underlying MemHwA device.
+ * \pre        -
+ * \config     MEMIF_READ_BATCH_API is enabled via pre-compile switch
+ * \context    TASK
+ * \reentrant  FALSE
+ * \synchronous FALSE
+ */
+FUNC(Std_ReturnType, MEMIF_CODE) MemIf_ReadBatch(uint8 DeviceIndex, MemIf_ReadBatchJobPtrType Jobs, uint16 NumberOfJobs);
+# endif
+
+
 /**********************************************************************************************************************
 *  MemIf_Write()
 *********************************************************************************************************************/
@@ -96,6 +96,22 @@ typedef enum
 typedef P2VAR(uint8, AUTOMATIC, MEMIF_APPL_DATA) MemIf_DataPtr_pu8;
 typedef P2CONST(uint8, AUTOMATIC, MEMIF_APPL_DATA) MemIf_ConstDataPtr_pu8;
 
+
+/* One element of a batched read request (MemIf_ReadBatch). The caller provides a vector of these;
+ * the memory hardware abstraction module may reorder the vector in order to process the reads in
+ * ascending physical order, and it stores each element's individual result in JobResult.
+ */
+typedef struct
+{
+  uint16 BlockNumber;
+  uint16 BlockOffset;
+  MemIf_DataPtr_pu8 DataBufferPtr;
+  uint16 Length;
+  MemIf_JobResultType JobResult;
+} MemIf_ReadBatchJobType;
+
+typedef P2VAR(MemIf_ReadBatchJobType, AUTOMATIC, MEMIF_APPL_DATA) MemIf_ReadBatchJobPtrType;
+
 /* Workaround for AUTOSAR Release 2.0 Flash Drivers:
  *
  * Fls assumes, that MemIf provides MemIf_AddressType and MemIf_LenghthType.
@@ -92,6 +92,11 @@ VAR(uint8, NVM_FAST_DATA) NvM_ApiFlags_u8; /*!< API flags - which are accessible
 NVM_LOCAL VAR(struct NvM_CrcJobStruct, NVM_PRIVATE_DATA) NvM_AsyncCrcJob_t;
 #endif
 
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1))
+/*! Next block to be checked by the deferred background restore. NVM_TOTAL_NUM_OF_NVRAM_BLOCKS: nothing to restore. */
+NVM_LOCAL VAR(NvM_BlockIdType, NVM_PRIVATE_DATA) NvM_DeferredRestoreBlockId;
+#endif
+
 #define NVM_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "NvM_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -306,6 +311,41 @@ NVM_LOCAL_INLINE FUNC(NvM_RamMngmtPtrType, NVM_PRIVATE_CODE) NvM_GetMngmtAreaPtr
 NVM_LOCAL_INLINE FUNC(void, NVM_PRIVATE_CODE) NvM_ProcessBackgroundCrcJobs(void);
 #endif
 
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1))
+/**********************************************************************************************************************
+ * NvM_IsDeferredBlockOutstanding
+ *********************************************************************************************************************/
+/*! \brief Checks whether a block was deferred by ReadAll and was not restored since.
+ *  \details A block is outstanding, if it is selected for deferred ReadAll, ReadAll skipped it and its permanent RAM
+ *           block is not valid. A block which was read or written by the user in the meantime is not outstanding.
+ *  \param[in] BlockId in range [1, (number of blocks - 1)].
+ *  \return TRUE block still has to be restored
+ *  \return FALSE otherwise
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Deferred ReadAll is enabled and API configuration class > 1
+ *  \pre -
+ */
+NVM_LOCAL_INLINE FUNC(boolean, NVM_PRIVATE_CODE) NvM_IsDeferredBlockOutstanding(const NvM_BlockIdType BlockId);
+
+/**********************************************************************************************************************
+ *  NvM_ProcessDeferredRestore
+ *********************************************************************************************************************/
+/*!
+ * \brief           Restores blocks deferred by ReadAll in background.
+ * \details         As long as the NvM is idle (no multi block job, no queued job), a read job into the permanent RAM
+ *                  is queued for the next outstanding deferred block. Only one background job is queued at a time,
+ *                  user requests always take precedence.
+ * \pre             -
+ * \context         TASK
+ * \reentrant       FALSE
+ * \synchronous     TRUE
+ * \config          NVM_DEFERRED_READALL == STD_ON && API configuration class > 1
+ */
+NVM_LOCAL_INLINE FUNC(void, NVM_PRIVATE_CODE) NvM_ProcessDeferredRestore(void);
+#endif /* ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1)) */
+
 /**********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  *********************************************************************************************************************/
@@ -340,6 +380,11 @@ FUNC(void, NVM_PUBLIC_CODE) NvM_Init(void)
     NvM_ApiFlags_u8 = 0u;
     NvM_BlockMngmtArea_at[0u].NvRamErrorStatus_u8 = NVM_REQ_OK; /* SBSW_NvM_AccessBlockManagementArea */
 
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1))
+    /* No deferred background restore until ReadAll was requested. */
+    NvM_DeferredRestoreBlockId = NVM_TOTAL_NUM_OF_NVRAM_BLOCKS;
+#endif
+
     /* Set all data indices to zero. */
     for (i = 0u; i < NVM_TOTAL_NUM_OF_NVRAM_BLOCKS; i++)
     {
@@ -1259,6 +1304,122 @@ FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_CancelJobs(NvM_BlockIdType BlockId)
 
     return returnValue;
 }
+
+# if ((NVM_JOB_PRIORISATION == STD_ON) && (NVM_QUEUE_STATISTICS_API == STD_ON))
+/**********************************************************************************************************************
+*  NvM_GetQueueStatistics
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_GetQueueStatistics(uint8 PrioLevel,
+    P2VAR(NvM_QueueStatisticsType, AUTOMATIC, NVM_APPL_DATA) StatisticsPtr)
+{
+    Std_ReturnType returnValue = E_NOT_OK; /* PRQA S 2981 */ /* MD_MSR_RetVal */
+    uint8 detErrorId = NVM_E_NO_ERROR;
+
+#  if (NVM_DEV_ERROR_DETECT == STD_ON) /* ECO_IGNORE_LINE */
+    if(NvM_CheckInitialized() == FALSE)
+    {
+        detErrorId = NVM_E_NOT_INITIALIZED;
+    }
+    else if (StatisticsPtr == NULL_PTR)
+    {
+        detErrorId = NVM_E_PARAM_DATA;
+    }
+    else
+#  endif /* ECO_IGNORE_LINE */
+    /* the level range is checked independent from DET, an invalid level would lead to an out of bounds access */
+    if (PrioLevel < NVM_JOB_QUEUE_PRIO_LEVELS)
+    {
+        NvM_QueueGetStatistics(PrioLevel, StatisticsPtr); /* SBSW_NvM_FuncCall_PtrParam_PublicAPI */
+
+        returnValue = E_OK;
+    }
+    else
+    {
+        detErrorId = NVM_E_PARAM_DATA;
+    }
+
+#  if (NVM_DEV_ERROR_REPORT == STD_ON)
+    if(detErrorId != NVM_E_NO_ERROR)
+    {
+        NvM_Errorhook(NVM_SERVICE_ID_GET_QUEUE_STATISTICS, detErrorId);
+    }
+#  else
+    NVM_DUMMY_STATEMENT(detErrorId); /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+#  endif
+
+    return returnValue;
+}
+# endif /* ((NVM_JOB_PRIORISATION == STD_ON) && (NVM_QUEUE_STATISTICS_API == STD_ON)) */
+
+# if (NVM_DEFERRED_READALL == STD_ON)
+/**********************************************************************************************************************
+*  NvM_RestoreDeferredBlock
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_RestoreDeferredBlock(NvM_BlockIdType BlockId)
+{
+    Std_ReturnType returnValue = E_NOT_OK; /* PRQA S 2981 */ /* MD_MSR_RetVal */
+    uint8 detErrorId = NVM_E_NO_ERROR;
+
+#  if (NVM_DEV_ERROR_DETECT == STD_ON) /* ECO_IGNORE_LINE */
+    if(NvM_CheckInitialized() == FALSE)
+    {
+        detErrorId = NVM_E_NOT_INITIALIZED;
+    }
+    else if ((NvM_CheckBlockId(BlockId) == FALSE) || (NVM_BLOCK_FROM_DCM_ID(BlockId) != BlockId))
+    {
+        detErrorId = NVM_E_PARAM_BLOCK_ID;
+    }
+    else
+#  endif /* ECO_IGNORE_LINE */
+    {
+        /* #10 permanent RAM block is valid, nothing to restore */
+        if((NvM_BlockMngmtArea_at[BlockId].NvRamAttributes_u8 & NVM_STATE_VALID_SET) != 0u)
+        {
+            returnValue = E_OK;
+        }
+        else
+        {
+            /* #20 block was not restored in background yet: queue the read job now */
+            if(NvM_IsDeferredBlockOutstanding(BlockId) == TRUE)
+            {
+                (void)NvM_QueueDeferredReadJob(BlockId);
+            }
+#  if (NVM_JOB_PRIORISATION == STD_ON)
+            /* #30 the block's read job shall be the next normal priority job to be processed, a job of another
+             *     service queued by the user for this block is not promoted */
+            NvM_QueuePromoteJob(BlockId, NVM_INT_FID_READ_BLOCK);
+#  endif
+        }
+    }
+
+#  if (NVM_DEV_ERROR_REPORT == STD_ON)
+    if(detErrorId != NVM_E_NO_ERROR)
+    {
+        NvM_Errorhook(NVM_SERVICE_ID_RESTORE_DEFERRED_BLOCK, detErrorId);
+    }
+#  else
+    NVM_DUMMY_STATEMENT(detErrorId); /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+#  endif
+
+    return returnValue;
+}
+# endif /* (NVM_DEFERRED_READALL == STD_ON) */
 #endif /* (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1) */
 
 /**********************************************************************************************************************
@@ -1300,6 +1461,10 @@ FUNC(void, NVM_PUBLIC_CODE) NvM_ReadAll(void)
         NvM_BlockMngmtArea_at[0].NvRamErrorStatus_u8 = NVM_REQ_PENDING; /* SBSW_NvM_AccessBlockManagementArea */
         NvM_ApiFlags_u8 &= NVM_APIFLAG_KILL_READ_ALL_CL;
         NvM_ApiFlags_u8 |= NVM_APIFLAG_READ_ALL_SET;
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1))
+        /* blocks skipped as deferred will be restored in background, as soon as ReadAll has finished */
+        NvM_DeferredRestoreBlockId = 1u;
+#endif
 
         NvM_ExitCriticalSection();
 
@@ -1670,6 +1835,16 @@ FUNC(void, NVM_PUBLIC_CODE) NvM_MainFunction(void)
         /* reset the wait flag */
         NvM_CurrentBlockInfo_t.InternalFlags_u8 &= NVM_INTFLAG_WAIT_CL;
 
+#if ((NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1) && (NVM_JOB_PRIORISATION == STD_ON))
+        /* #205 Advance the queue time base, promote aged jobs to higher priority levels */
+        NvM_QueueProcessAging();
+#endif
+
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1))
+        /* #207 Restore blocks deferred by ReadAll, if NvM is idle */
+        NvM_ProcessDeferredRestore();
+#endif
+
 #if ((NVM_SET_RAM_BLOCK_STATUS_API == STD_ON) && (NVM_CALC_RAM_CRC_USED == STD_ON))
         /* #210 Process asynchronous background CRC job queue */
         NvM_ProcessBackgroundCrcJobs();
@@ -1855,6 +2030,65 @@ NVM_LOCAL_INLINE FUNC(boolean, NVM_PRIVATE_CODE) NvM_CheckBlockType(const NvM_Bl
   return (boolean)((NvM_BlockDescriptorTable_at[NVM_BLOCK_FROM_DCM_ID(BlockId)].MngmtType_t & NVM_BLOCK_DATASET) != 0u);
 }
 
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1))
+/**********************************************************************************************************************
+*  NvM_IsDeferredBlockOutstanding
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+NVM_LOCAL_INLINE FUNC(boolean, NVM_PRIVATE_CODE) NvM_IsDeferredBlockOutstanding(const NvM_BlockIdType BlockId)
+{
+    NvM_RamMngmtConstPtrToConstType mngmtPtr = &NvM_BlockMngmtArea_at[BlockId];
+
+    return (boolean)(
+        (NvM_IsBooleanBitfieldTrue(NvM_BlockDescriptorTable_at[BlockId].Flags.SelectBlockForDeferredReadAllEnabled) == TRUE) &&
+        (mngmtPtr->NvRamErrorStatus_u8 == NVM_REQ_BLOCK_SKIPPED) &&
+        ((mngmtPtr->NvRamAttributes_u8 & NVM_STATE_VALID_SET) == 0u));
+}
+
+/**********************************************************************************************************************
+*  NvM_ProcessDeferredRestore
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+NVM_LOCAL_INLINE FUNC(void, NVM_PRIVATE_CODE) NvM_ProcessDeferredRestore(void)
+{
+    /* #10 background restore only if no multi block job is requested or running and no single block job is queued,
+     *     neither in the normal nor in the high priority (immediate) queue */
+    if((NvM_DeferredRestoreBlockId < NVM_TOTAL_NUM_OF_NVRAM_BLOCKS) &&
+       (NvM_TaskState_t == NVM_STATE_IDLE) &&
+       ((NvM_ApiFlags_u8 & (NVM_APIFLAG_READ_ALL_SET | NVM_APIFLAG_PRE_READ_ALL_SET | NVM_APIFLAG_WRITE_ALL_SET)) == 0u) &&
+# if (NVM_JOB_PRIORISATION == STD_ON)
+       (NvM_QryHighPrioJob() == FALSE) &&
+# endif
+       (NvM_QryNormalPrioJob() == FALSE))
+    {
+        boolean jobQueued = FALSE;
+
+        /* #20 queue a read job for the next outstanding deferred block, blocks restored by the user are passed */
+        while((jobQueued == FALSE) && (NvM_DeferredRestoreBlockId < NVM_TOTAL_NUM_OF_NVRAM_BLOCKS))              /* FETA_NVM_ProcessDeferredRestore */
+        {
+            const NvM_BlockIdType blockId = NvM_DeferredRestoreBlockId;
+
+            NvM_DeferredRestoreBlockId++;
+
+            if(NvM_IsDeferredBlockOutstanding(blockId) == TRUE)
+            {
+                jobQueued = NvM_QueueDeferredReadJob(blockId);
+            }
+        }
+    }
+}
+#endif /* ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1)) */
+
 #if ((NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1) && (NVM_DEV_ERROR_DETECT == STD_ON))
 /**********************************************************************************************************************
 *  NvM_CheckAddress
@@ -2431,6 +2665,20 @@ MD_NvM_2.3_MultiBlockCbk_UnusedVariablesDueToFunctionMacro:
  \DESCRIPTION To call user defined functions, function macros are used. They are always invoked with valid parameters.
  \COUNTERMEASURE \T Correct NvM behavior is checked during component tests and code reviews.
 
+\ID SBSW_NvM_AccessArray_CompressBuffer
+ \DESCRIPTION The compression codec writes into the NV buffer (encoding) or the RAM buffer (decoding). Each write is preceded by a
+              check of the write index against the buffer length passed by the caller.
+ \COUNTERMEASURE \T Correct NvM behavior is checked during component tests and code reviews.
+
+\ID SBSW_NvM_AccessPtr_CompressPosition
+ \DESCRIPTION The write position is a local variable of the encoding function, passed by reference to its local helper.
+ \COUNTERMEASURE \N The pointer always references a valid local variable.
+
+\ID SBSW_NvM_FuncCall_PtrParam_Compress
+ \DESCRIPTION The compression codec is invoked with the block's RAM and NV buffers and their configured lengths. The generator sizes the
+              NV buffer of compressed blocks to the configured NV block length.
+ \COUNTERMEASURE \T Correct NvM behavior is checked during component tests and code reviews.
+
 SBSW_JUSTIFICATION_END */
 
 /***********************************************************************************************************************
@@ -683,6 +683,56 @@ extern FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_CancelJobs
     (
         NvM_BlockIdType BlockId
     );
+
+# if ((NVM_JOB_PRIORISATION == STD_ON) && (NVM_QUEUE_STATISTICS_API == STD_ON))
+/**********************************************************************************************************************
+ *  NvM_GetQueueStatistics
+ **********************************************************************************************************************/
+/*! \brief Provides the runtime statistics of one priority level of the job queue.
+ *  \details The statistics contain the current and maximum number of queued jobs, the number of processed jobs, their
+ *           accumulated and maximum wait time and the number of jobs promoted into the level by aging. Wait times are
+ *           given in NvM_MainFunction cycles. The statistics are reset by NvM_Init().
+ *  \param[in] PrioLevel in range [0, (NVM_JOB_QUEUE_PRIO_LEVELS - 1)]; level 0 is served first.
+ *  \param[out] StatisticsPtr to store the statistics to. Must not be NULL_PTR.
+ *  \return E_OK statistics were copied
+ *  \return E_NOT_OK otherwise
+ *  \context ANY
+ *  \reentrant TRUE
+ *  \synchronous TRUE
+ *  \config NvM configuration class is 2 or 3, job prioritization and queue statistics are enabled
+ *  \pre -
+ */
+extern FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_GetQueueStatistics
+    (
+        uint8 PrioLevel,
+        P2VAR(NvM_QueueStatisticsType, AUTOMATIC, NVM_APPL_DATA) StatisticsPtr
+    );
+# endif /* ((NVM_JOB_PRIORISATION == STD_ON) && (NVM_QUEUE_STATISTICS_API == STD_ON)) */
+
+# if (NVM_DEFERRED_READALL == STD_ON)
+/**********************************************************************************************************************
+ *  NvM_RestoreDeferredBlock
+ **********************************************************************************************************************/
+/*! \brief Ensures that a block deferred by ReadAll is restored, before its permanent RAM block is accessed.
+ *  \details Blocks selected for deferred ReadAll are skipped by NvM_ReadAll and read in background afterwards, as
+ *           long as the NvM is idle. If the permanent RAM block is not yet valid, the read job of the block is queued
+ *           (if not already queued) and moved to the front of the normal priority queue. The result of the read job
+ *           can be polled via NvM_GetErrorStatus() or is notified via the single block callback.
+ *           A SW-C may call this service from its permanent RAM access hook, or simply request NvM_ReadBlock().
+ *  \param[in] BlockId in range [1, (number of blocks - 1)].
+ *  \return E_OK the permanent RAM block is valid and may be accessed
+ *  \return E_NOT_OK the block is being restored (or is not valid and not deferred)
+ *  \context ANY
+ *  \reentrant TRUE
+ *  \synchronous TRUE
+ *  \config NvM configuration class is 2 or 3 and deferred ReadAll is enabled
+ *  \pre -
+ */
+extern FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_RestoreDeferredBlock
+    (
+        NvM_BlockIdType BlockId
+    );
+# endif /* (NVM_DEFERRED_READALL == STD_ON) */
 #endif /* (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1) */
 
 /**********************************************************************************************************************
@@ -690,7 +740,8 @@ extern FUNC(Std_ReturnType, NVM_PUBLIC_CODE) NvM_CancelJobs
  **********************************************************************************************************************/
 /*! \brief Setup a read all job.
  *  \details Request to read the data of all "Select Block For ReadAll" configured RAM blocks from their corresponding
- *           NV blocks. Only the data of valid NV blocks is read.
+ *           NV blocks. Only the data of valid NV blocks is read. Blocks selected for deferred ReadAll are skipped and
+ *           restored in background after ReadAll has finished.
  *  \context ANY
  *  \reentrant FALSE
  *  \synchronous FALSE
@@ -31,6 +31,7 @@
 #include "NvM_JobProc.h"
 #include "NvM_Queue.h"
 #include "NvM_MemIfAbstraction.h"
+#include "NvM_Compress.h"
 
 #include "NvM_PrivateCbk.h"
 
@@ -911,6 +912,23 @@ FUNC(void, NVM_PRIVATE_CODE) NvM_ActCopyRamDataToInternalBuffer(void);
 FUNC(void, NVM_PRIVATE_CODE) NvM_ActProcessEncryptionJob(void);
 #endif
 
+#if (NVM_COMPRESSION == STD_ON)
+/**********************************************************************************************************************
+ *  NvM_ActCompressData
+ *********************************************************************************************************************/
+/*!
+ * \brief           Compress the copied RAM data into the NV buffer
+ * \details         Runs after the data copy (including PreWriteTransform); the NV buffer afterwards holds the
+ *                  compressed-length header followed by the encoded data.
+ * \pre             Current block has data compression enabled
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       FALSE
+ * \synchronous     TRUE
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_ActCompressData(void);
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION PROTOTYPES: PRIVATE HELPER FUNCTIONS
  *********************************************************************************************************************/
@@ -1238,6 +1256,9 @@ CONST(NvM_ActFctPtrType, NVM_PRIVATE_CONST) NvM_ActionTable_ap[(uint32)NVM_ACT_I
 #if (NVM_CSM_CIPHERING_ENABLED == STD_ON)
     NvM_ActProcessEncryptionJob,
 #endif
+#if (NVM_COMPRESSION == STD_ON)
+    NvM_ActCompressData,
+#endif
 #if (NVM_API_CONFIG_CLASS != NVM_API_CONFIG_CLASS_1)
     NvM_ActGetNormalPrioJob,
 # if (NVM_JOB_PRIORISATION == STD_ON)
@@ -1749,6 +1770,12 @@ NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_ActInitBlock(void)
         NvM_CurrentBlockInfo_t.NvRamAddr_t = NvM_CipheredDataBuffer;
     }
     else
+#elif (NVM_COMPRESSION == STD_ON)
+    if(NvM_QryIsCompressedBlock(NvM_CurrentBlockInfo_t.Descriptor_pt) == TRUE) /* SBSW_NvM_FuncCall_PtrParam_CurrBlockInfo */
+    {
+        NvM_CurrentBlockInfo_t.NvRamAddr_t = NvM_CompressedDataBuffer;
+    }
+    else
 #endif
     {
         NvM_CurrentBlockInfo_t.NvRamAddr_t = NvM_CurrentBlockInfo_t.RamAddr_t;
@@ -2813,6 +2840,7 @@ NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NVM_ActRepairRedBlocksInitBlock(void)
     NvM_CurrentBlockInfo_t.ByteCount_u16 = 0u;
     /* Use:
      * CipheredDataBuffer: if data ciphering is enabled and the block stores ciphered data,
+     * CompressedDataBuffer: if data compression is enabled and the block stores compressed data,
      * An internal buffer (depending on block priority): if data ciphering is disabled or the block stores plain data
      * This ensures the used buffer is large enough to store the current block (ciphered data
      * may be > or < internal buffer length!).
@@ -2824,6 +2852,13 @@ NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NVM_ActRepairRedBlocksInitBlock(void)
         NvM_CurrentBlockInfo_t.RamAddr_t = NvM_CipheredDataBuffer;
     }
     else
+#elif (NVM_COMPRESSION == STD_ON)
+    if(NvM_QryIsCompressedBlock(NvM_CurrentBlockInfo_t.Descriptor_pt) == TRUE) /* SBSW_NvM_FuncCall_PtrParam_CurrBlockInfo */
+    {
+        NvM_CurrentBlockInfo_t.NvRamAddr_t = NvM_CompressedDataBuffer;
+        NvM_CurrentBlockInfo_t.RamAddr_t = NvM_CompressedDataBuffer;
+    }
+    else
 #endif
     {
       NvM_RamAddressType internalBuffer = NvM_GetInternalBufferPtrForCurrentBlock();
@@ -3236,6 +3271,25 @@ FUNC(void, NVM_PRIVATE_CODE) NvM_ActProcessEncryptionJob(void)
 }
 #endif
 
+#if (NVM_COMPRESSION == STD_ON)
+/**********************************************************************************************************************
+ *  NvM_ActCompressData
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_ActCompressData(void)
+{
+  /* The NVRAMDataLength stores the size of the NV block, the NvBlockLength the size of the uncompressed user data. */
+  NvM_CurrentBlockInfo_t.CompressionSuccessful = NvM_Compress_Encode(NvM_CurrentBlockInfo_t.RamAddr_t,                /* SBSW_NvM_FuncCall_PtrParam_Compress */
+      NvM_CurrentBlockInfo_t.Descriptor_pt->NvBlockLength_u16,
+      NvM_CurrentBlockInfo_t.NvRamAddr_t,
+      NvM_CurrentBlockInfo_t.Descriptor_pt->NvBlockNVRAMDataLength);
+}
+#endif
+
 #if (NVM_REPAIR_REDUNDANT_BLOCKS_API == STD_ON)
 /**********************************************************************************************************************
 *  NvM_ActProcessCrc
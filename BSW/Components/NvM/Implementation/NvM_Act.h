@@ -119,6 +119,9 @@ typedef enum
 #if (NVM_CSM_CIPHERING_ENABLED == STD_ON)
     NVM_ACT_ID_ProcessEncryptionJob,
 #endif
+#if (NVM_COMPRESSION == STD_ON)
+    NVM_ACT_ID_CompressData,
+#endif
 #if (NVM_API_CONFIG_CLASS != NVM_API_CONFIG_CLASS_1)
     NVM_ACT_ID_GetNormalPrioJob,
 # if (NVM_JOB_PRIORISATION == STD_ON)
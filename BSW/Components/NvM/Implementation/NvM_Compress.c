@@ -0,0 +1,356 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2023 by Vector Informatik GmbH.                                                  All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  NvM_Compress.c
+ *        \brief  NvM compression submodule source file
+ *      \details  This sub-module implements the run length codec used for blocks with data compression enabled.
+ *                Encoded data consists of tokens: a control byte below 0x80 is followed by (control + 1) literal
+ *                bytes, a control byte of 0x80 or above is followed by one byte that is repeated
+ *                ((control & 0x7F) + NVM_COMPRESS_MIN_RUN_LENGTH) times.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Refer to the module's header file.
+ *********************************************************************************************************************/
+
+#define NVM_COMPRESS_SOURCE
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "NvM_Compress.h"
+
+#if (NVM_COMPRESSION == STD_ON)
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define NVM_COMPRESS_RUN_FLAG               (0x80u)
+#define NVM_COMPRESS_CONTROL_MASK           (0x7Fu)
+/* Runs shorter than 3 bytes do not save anything, they are stored as literals */
+#define NVM_COMPRESS_MIN_RUN_LENGTH         (3u)
+#define NVM_COMPRESS_MAX_RUN_LENGTH         (NVM_COMPRESS_CONTROL_MASK + NVM_COMPRESS_MIN_RUN_LENGTH)
+#define NVM_COMPRESS_MAX_LITERAL_LENGTH     (NVM_COMPRESS_CONTROL_MASK + 1u)
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ *********************************************************************************************************************/
+#ifndef NVM_LOCAL                                                                                                       /* COV_NVM_COMPATIBILITY */
+# define NVM_LOCAL static
+#endif
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+#define NVM_START_SEC_CODE
+#include "NvM_MemMap.h"                                                                                                     /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/**********************************************************************************************************************
+ *  NvM_Compress_GetRunLength
+ *********************************************************************************************************************/
+/*!
+ * \brief           Counts equal bytes starting at given position.
+ * \details         Counting stops at the end of data or at NVM_COMPRESS_MAX_RUN_LENGTH.
+ * \param[in]       Src          Pointer to uncompressed data. Pointer must be valid.
+ * \param[in]       Position     Start position, less than SrcLength.
+ * \param[in]       SrcLength    Length of uncompressed data.
+ * \return          Number of equal bytes, at least 1
+ * \pre             -
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       TRUE
+ * \synchronous     TRUE
+ */
+NVM_LOCAL FUNC(uint16, NVM_PRIVATE_CODE) NvM_Compress_GetRunLength(
+    NvM_ConstRamAddressType Src,
+    uint16 Position,
+    uint16 SrcLength);
+
+/**********************************************************************************************************************
+ *  NvM_Compress_PutLiterals
+ *********************************************************************************************************************/
+/*!
+ * \brief           Writes a literal token for all pending literal bytes.
+ * \details         Does nothing if there are no pending literal bytes.
+ * \param[in]       Src          Pointer to uncompressed data. Pointer must be valid.
+ * \param[in]       LiteralStart Position of first pending literal byte.
+ * \param[in]       LiteralEnd   Position behind last pending literal byte; at most NVM_COMPRESS_MAX_LITERAL_LENGTH
+ *                               bytes behind LiteralStart.
+ * \param[in,out]   Dst          Pointer to NV buffer. Pointer must be valid.
+ * \param[in,out]   DstPosition  Current write position within NV buffer, updated by written token.
+ * \param[in]       DstLength    Length of NV buffer.
+ * \return          TRUE token fits into the NV buffer, FALSE otherwise
+ * \pre             -
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       TRUE
+ * \synchronous     TRUE
+ */
+NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_Compress_PutLiterals(
+    NvM_ConstRamAddressType Src,
+    uint16 LiteralStart,
+    uint16 LiteralEnd,
+    NvM_RamAddressType Dst,
+    P2VAR(uint16, AUTOMATIC, NVM_PRIVATE_DATA) DstPosition,
+    uint16 DstLength);
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  NvM_Compress_GetRunLength
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+NVM_LOCAL FUNC(uint16, NVM_PRIVATE_CODE) NvM_Compress_GetRunLength(
+    NvM_ConstRamAddressType Src,
+    uint16 Position,
+    uint16 SrcLength)
+{
+  uint16 runLength = 1u;
+
+  while(((Position + runLength) < SrcLength) && (runLength < NVM_COMPRESS_MAX_RUN_LENGTH) &&
+        (Src[Position + runLength] == Src[Position]))
+  {
+    runLength++;
+  }
+
+  return runLength;
+}
+
+/**********************************************************************************************************************
+ *  NvM_Compress_PutLiterals
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_Compress_PutLiterals(
+    NvM_ConstRamAddressType Src,
+    uint16 LiteralStart,
+    uint16 LiteralEnd,
+    NvM_RamAddressType Dst,
+    P2VAR(uint16, AUTOMATIC, NVM_PRIVATE_DATA) DstPosition,
+    uint16 DstLength)
+{
+  const uint16 literalLength = (uint16)(LiteralEnd - LiteralStart);
+  boolean retVal = TRUE;
+
+  if(literalLength > 0u)
+  {
+    /* #10 Control byte and all literal bytes must fit into the NV buffer */
+    if(((uint32)*DstPosition + 1u + literalLength) <= DstLength)
+    {
+      uint16 srcIdx;
+
+      Dst[*DstPosition] = (uint8)(literalLength - 1u);                                                                  /* SBSW_NvM_AccessArray_CompressBuffer */
+      (*DstPosition)++;                                                                                                 /* SBSW_NvM_AccessPtr_CompressPosition */
+
+      for(srcIdx = LiteralStart; srcIdx < LiteralEnd; srcIdx++)
+      {
+        Dst[*DstPosition] = Src[srcIdx];                                                                                /* SBSW_NvM_AccessArray_CompressBuffer */
+        (*DstPosition)++;                                                                                               /* SBSW_NvM_AccessPtr_CompressPosition */
+      }
+    }
+    else
+    {
+      retVal = FALSE;
+    }
+  }
+
+  return retVal;
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  NvM_Compress_Encode
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(boolean, NVM_PRIVATE_CODE) NvM_Compress_Encode(
+    NvM_ConstRamAddressType Src,
+    uint16 SrcLength,
+    NvM_RamAddressType Dst,
+    uint16 DstLength)
+{
+  uint16 srcIdx = 0u;
+  uint16 literalStart = 0u;
+  uint16 dstIdx = NVM_COMPRESS_HEADER_LENGTH;
+  boolean fits = (boolean)(DstLength >= NVM_COMPRESS_HEADER_LENGTH);
+
+  /* #10 Encode runs of at least NVM_COMPRESS_MIN_RUN_LENGTH equal bytes as run token, collect everything else as literals */
+  while((srcIdx < SrcLength) && (fits == TRUE))
+  {
+    const uint16 runLength = NvM_Compress_GetRunLength(Src, srcIdx, SrcLength);                                         /* SBSW_NvM_FuncCall_PtrParam_Compress */
+
+    if(runLength >= NVM_COMPRESS_MIN_RUN_LENGTH)
+    {
+      /* #20 Pending literals precede the run */
+      fits = NvM_Compress_PutLiterals(Src, literalStart, srcIdx, Dst, &dstIdx, DstLength);                             /* SBSW_NvM_FuncCall_PtrParam_Compress */
+
+      if((fits == TRUE) && (((uint32)dstIdx + 2u) <= DstLength))
+      {
+        Dst[dstIdx] = (uint8)(NVM_COMPRESS_RUN_FLAG | (runLength - NVM_COMPRESS_MIN_RUN_LENGTH));                       /* SBSW_NvM_AccessArray_CompressBuffer */
+        Dst[dstIdx + 1u] = Src[srcIdx];                                                                                 /* SBSW_NvM_AccessArray_CompressBuffer */
+        dstIdx += 2u;
+      }
+      else
+      {
+        fits = FALSE;
+      }
+
+      srcIdx += runLength;
+      literalStart = srcIdx;
+    }
+    else
+    {
+      srcIdx++;
+
+      /* #30 Literal token is full */
+      if((srcIdx - literalStart) == NVM_COMPRESS_MAX_LITERAL_LENGTH)
+      {
+        fits = NvM_Compress_PutLiterals(Src, literalStart, srcIdx, Dst, &dstIdx, DstLength);                           /* SBSW_NvM_FuncCall_PtrParam_Compress */
+        literalStart = srcIdx;
+      }
+    }
+  }
+
+  if(fits == TRUE)
+  {
+    fits = NvM_Compress_PutLiterals(Src, literalStart, srcIdx, Dst, &dstIdx, DstLength);                               /* SBSW_NvM_FuncCall_PtrParam_Compress */
+  }
+
+  /* #40 Write header and clear unused part of NV buffer */
+  if(fits == TRUE)
+  {
+    const uint16 encodedLength = (uint16)(dstIdx - NVM_COMPRESS_HEADER_LENGTH);
+
+    Dst[0] = (uint8)(encodedLength >> 8u);                                                                              /* SBSW_NvM_AccessArray_CompressBuffer */
+    Dst[1] = (uint8)(encodedLength);                                                                                    /* SBSW_NvM_AccessArray_CompressBuffer */
+
+    while(dstIdx < DstLength)
+    {
+      Dst[dstIdx] = 0u;                                                                                                 /* SBSW_NvM_AccessArray_CompressBuffer */
+      dstIdx++;
+    }
+  }
+
+  return fits;
+}
+
+/**********************************************************************************************************************
+ *  NvM_Compress_Decode
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(boolean, NVM_PRIVATE_CODE) NvM_Compress_Decode(
+    NvM_ConstRamAddressType Src,
+    uint16 SrcLength,
+    NvM_RamAddressType Dst,
+    uint16 DstLength)
+{
+  uint32 srcEnd = 0u;
+  uint32 srcIdx = NVM_COMPRESS_HEADER_LENGTH;
+  uint32 dstIdx = 0u;
+  boolean valid = FALSE;
+
+  /* #10 Header must describe encoded data within the NV buffer */
+  if(SrcLength >= NVM_COMPRESS_HEADER_LENGTH)
+  {
+    srcEnd = NVM_COMPRESS_HEADER_LENGTH + (((uint32)Src[0] << 8u) | (uint32)Src[1]);
+    valid = (boolean)(srcEnd <= SrcLength);
+  }
+
+  /* #20 Expand tokens; every token must stay within both buffers */
+  while((srcIdx < srcEnd) && (valid == TRUE))
+  {
+    const uint8 control = Src[srcIdx];
+    uint32 tokenLength;
+
+    if((control & NVM_COMPRESS_RUN_FLAG) != 0u)
+    {
+      tokenLength = (uint32)(control & NVM_COMPRESS_CONTROL_MASK) + NVM_COMPRESS_MIN_RUN_LENGTH;
+
+      if(((srcIdx + 2u) <= srcEnd) && ((dstIdx + tokenLength) <= DstLength))
+      {
+        const uint8 value = Src[srcIdx + 1u];
+        const uint32 runEnd = dstIdx + tokenLength;
+
+        for(; dstIdx < runEnd; dstIdx++)
+        {
+          Dst[dstIdx] = value;                                                                                          /* SBSW_NvM_AccessArray_CompressBuffer */
+        }
+        srcIdx += 2u;
+      }
+      else
+      {
+        valid = FALSE;
+      }
+    }
+    else
+    {
+      tokenLength = (uint32)control + 1u;
+
+      if(((srcIdx + 1u + tokenLength) <= srcEnd) && ((dstIdx + tokenLength) <= DstLength))
+      {
+        const uint32 literalEnd = srcIdx + 1u + tokenLength;
+
+        for(srcIdx++; srcIdx < literalEnd; srcIdx++)
+        {
+          Dst[dstIdx] = Src[srcIdx];                                                                                    /* SBSW_NvM_AccessArray_CompressBuffer */
+          dstIdx++;
+        }
+      }
+      else
+      {
+        valid = FALSE;
+      }
+    }
+  }
+
+  /* #30 Decoded data must fill the RAM buffer exactly */
+  return (boolean)((valid == TRUE) && (dstIdx == DstLength));
+}
+
+#define NVM_STOP_SEC_CODE
+#include "NvM_MemMap.h"                                                                                                     /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* (NVM_COMPRESSION == STD_ON) */
+
+/**********************************************************************************************************************
+ *  END OF FILE: NvM_Compress.c
+ *********************************************************************************************************************/
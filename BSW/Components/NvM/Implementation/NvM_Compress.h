@@ -0,0 +1,109 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2023 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/*!        \file  NvM_Compress.h
+ *        \brief  NvM compression submodule header file
+ *      \details  This submodule implements the run length codec used for blocks with data compression enabled.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Refer to the module's header file.
+ *********************************************************************************************************************/
+
+#if (!defined NVM_COMPRESS_H_)
+# define NVM_COMPRESS_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+# include "NvM_JobProc.h"
+
+# if (NVM_COMPRESSION == STD_ON)
+
+/* Compressed data replaces ciphered data in the NV buffer, both transformations can not be combined. */
+#  if (NVM_CSM_CIPHERING_ENABLED == STD_ON)
+#   error "NvM configuration error: NVM_COMPRESSION can not be used together with CSM ciphering!"
+#  endif
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* Compressed NV data starts with the length (big endian) of the encoded data following the header. */
+#  define NVM_COMPRESS_HEADER_LENGTH      (2u)
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+#  define NVM_START_SEC_CODE
+#  include "NvM_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/**********************************************************************************************************************
+ *  NvM_Compress_Encode
+ *********************************************************************************************************************/
+/*!
+ * \brief           Compresses RAM data into the NV buffer.
+ * \details         Writes the compressed-length header, the run length encoded data and fills the remaining NV buffer
+ *                  with zeros, so that data integrity information over the whole NV buffer is reproducible.
+ * \param[in]       Src          Pointer to uncompressed data. Pointer must be valid.
+ * \param[in]       SrcLength    Length of uncompressed data.
+ * \param[in,out]   Dst          Pointer to NV buffer. Pointer must be valid.
+ * \param[in]       DstLength    Length of NV buffer.
+ * \return          TRUE compressed data fits into the NV buffer, FALSE otherwise
+ * \pre             Src and Dst do not overlap
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       TRUE
+ * \synchronous     TRUE
+ */
+extern FUNC(boolean, NVM_PRIVATE_CODE) NvM_Compress_Encode(
+    NvM_ConstRamAddressType Src,
+    uint16 SrcLength,
+    NvM_RamAddressType Dst,
+    uint16 DstLength);
+
+/**********************************************************************************************************************
+ *  NvM_Compress_Decode
+ *********************************************************************************************************************/
+/*!
+ * \brief           Decompresses NV data into the RAM buffer.
+ * \details         Decoding is only successful, if the header is plausible, all tokens stay within both buffers and
+ *                  the decoded data has exactly the RAM buffer's length.
+ * \param[in]       Src          Pointer to NV buffer holding compressed data. Pointer must be valid.
+ * \param[in]       SrcLength    Length of NV buffer.
+ * \param[in,out]   Dst          Pointer to RAM buffer. Pointer must be valid.
+ * \param[in]       DstLength    Length of uncompressed data.
+ * \return          TRUE data decoded successfully, FALSE otherwise
+ * \pre             Src and Dst do not overlap
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       TRUE
+ * \synchronous     TRUE
+ */
+extern FUNC(boolean, NVM_PRIVATE_CODE) NvM_Compress_Decode(
+    NvM_ConstRamAddressType Src,
+    uint16 SrcLength,
+    NvM_RamAddressType Dst,
+    uint16 DstLength);
+
+#  define NVM_STOP_SEC_CODE
+#  include "NvM_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+# endif /* (NVM_COMPRESSION == STD_ON) */
+
+#endif /* NVM_COMPRESS_H_ */
+
+/**********************************************************************************************************************
+ *  END OF FILE: NvM_Compress.h
+ *********************************************************************************************************************/
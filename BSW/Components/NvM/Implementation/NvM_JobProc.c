@@ -736,6 +736,12 @@ NVM_LOCAL CONST(NvM_StateDescrType, NVM_PRIVATE_CONST) NvM_StateDescrTable_at[]
                     NVM_STATE_THEN{NVM_ACT_ID_ProcessEncryptionJob, NVM_ACT_ID_Nop},
                     NVM_NEXT_STATE(NVM_STATE_WRITE_ENCRYPT_DATA)
             },
+#elif (NVM_COMPRESSION == STD_ON)
+            {   /* Compression configured */
+                NVM_STATE_ELSEIF{NVM_QRY_ID_HAS_COMPRESSION, NVM_QRY_ID_TRUE},
+                    NVM_STATE_THEN{NVM_ACT_ID_CompressData, NVM_ACT_ID_Nop},
+                    NVM_NEXT_STATE(NVM_STATE_WRITE_COMPRESS_DATA)
+            },
 #else
             {   /* In case CSM module is not used, this path always has to be false */
                 NVM_STATE_ELSEIF{NVM_QRY_ID_FALSE, NVM_QRY_ID_FALSE},
@@ -779,6 +785,32 @@ NVM_LOCAL CONST(NvM_StateDescrType, NVM_PRIVATE_CONST) NvM_StateDescrTable_at[]
             NVM_NEXT_STATE(NVM_STATE_WRITE_CHECK_DATAINTEGRITYRECORD_COMPMECHANISM_SKIP)
         }
     },
+#endif
+    /* NVM_STATE_WRITE_COMPRESS_DATA */
+#if (NVM_COMPRESSION == STD_ON)
+    {
+        {
+            {   /* Compressed data does not fit into NV block => Abort job with NOK */
+                NVM_STATE_ELSEIF{NVM_QRY_ID_COMPRESSION_FAILED, NVM_QRY_ID_TRUE},
+                    NVM_STATE_ELSE{NVM_ACT_ID_SetReqNotOk, NVM_ACT_ID_FinishWriteBlock},
+                    NVM_NEXT_STATE(NVM_STATE_FSM_FINISHED)
+            },
+            {   /* Compression succeeded && DataIntegrity algorithm configured */
+                NVM_STATE_ELSEIF{NVM_QRY_ID_IS_DATA_INTEGRITY_ALGORITHM_CONFIGURED, NVM_QRY_ID_TRUE },
+                    NVM_STATE_THEN{NVM_ACT_ID_SetupDataIntegrityGeneration, NVM_ACT_ID_Nop},
+                    NVM_NEXT_STATE(NVM_STATE_WRITE_GENERATE_DATA_INTEGRITY_INFORMATION)
+            },
+            {   /* Placeholder, this path always has to be false */
+                NVM_STATE_ELSEIF{NVM_QRY_ID_FALSE, NVM_QRY_ID_FALSE},
+                    NVM_STATE_THEN{NVM_ACT_ID_Nop, NVM_ACT_ID_Nop},
+                    NVM_NEXT_STATE(NVM_STATE_FSM_FINISHED)
+            }
+        },
+        {   /* Compression succeeded, no DataIntegrity algorithm configured */
+            NVM_STATE_ELSE{NVM_ACT_ID_Nop, NVM_ACT_ID_Nop},
+            NVM_NEXT_STATE(NVM_STATE_WRITE_CHECK_DATAINTEGRITYRECORD_COMPMECHANISM_SKIP)
+        }
+    },
 #endif
     /* NVM_STATE_WRITE_GENERATE_DATA_INTEGRITY_INFORMATION */
     {
@@ -138,6 +138,9 @@ typedef struct
     boolean                     CsmJobAttemptSuccessful;    /*!< Flag if last CSM job attempt was successful */
     uint8                       CsmJobRetryCounter_u8;      /*!< CSM retry counter */
 #endif /* (NVM_CSM_CIPHERING_ENABLED == STD_ON) */
+#if (NVM_COMPRESSION == STD_ON)
+    boolean                     CompressionSuccessful;      /*!< Flag if compressed data fit into the NV buffer */
+#endif
 } NvM_BlockInfoType; /*!< Job processing structure: contains all information related to the processing of one certain job. */
 
 typedef P2VAR(NvM_BlockInfoType, AUTOMATIC, NVM_FAST_DATA) NvM_BlockInfoPtrType;
@@ -180,6 +183,9 @@ typedef enum
     NVM_STATE_WRITE_COPY_BUFFER_DATA,
 #if (NVM_CSM_CIPHERING_ENABLED == STD_ON)
     NVM_STATE_WRITE_ENCRYPT_DATA,
+#endif
+#if (NVM_COMPRESSION == STD_ON)
+    NVM_STATE_WRITE_COMPRESS_DATA,
 #endif
     NVM_STATE_WRITE_GENERATE_DATA_INTEGRITY_INFORMATION,
     NVM_STATE_WRITE_CHECK_DATAINTEGRITYRECORD_COMPMECHANISM_SKIP,
@@ -32,6 +32,7 @@
 #include "NvM_JobProc.h"
 #include "NvM_Queue.h"
 #include "NvM_MemIfAbstraction.h"
+#include "NvM_Compress.h"
 
 /**********************************************************************************************************************
  *  LOCAL CONSTANT MACROS
@@ -312,7 +313,8 @@ NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QrySecondaryRedundantBlock(void);
  * NvM_QrySkipBlock
  *********************************************************************************************************************/
 /*! \brief Checks whether the block is not selected for NvM_ReadAll-job or it isn't a dataset block (shall be skipped)
- *  \details Checks whether the block is not selected for NvM_ReadAll-job or it isn't a dataset block (shall be skipped)
+ *  \details Checks whether the block is not selected for NvM_ReadAll-job or it isn't a dataset block (shall be skipped).
+ *           Blocks selected for deferred ReadAll are skipped as well, they are restored in background afterwards.
  *  \return TRUE block shall be skipped
  *  \return FALSE otherwise
  *  \context TASK
@@ -580,6 +582,38 @@ NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryRedundantCrcMatches(void);
 NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryHasEncryptionJob(void);
 #endif
 
+#if (NVM_COMPRESSION == STD_ON)
+/**********************************************************************************************************************
+ *  NvM_QryHasCompression
+ *********************************************************************************************************************/
+/*!
+ * \brief           Test if currently processed block has data compression enabled
+ * \details         -
+ * \return          TRUE if data compression is enabled; FALSE otherwise
+ * \pre             -
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       FALSE
+ * \synchronous     TRUE
+ */
+NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryHasCompression(void);
+
+/**********************************************************************************************************************
+ *  NvM_QryCompressionFailed
+ *********************************************************************************************************************/
+/*!
+ * \brief           Test if compressed data of currently processed block did not fit into the NV block
+ * \details         -
+ * \return          TRUE if compression failed; FALSE otherwise
+ * \pre             NvM_ActCompressData was invoked for the current block
+ * \config          NVM_COMPRESSION
+ * \context         TASK
+ * \reentrant       FALSE
+ * \synchronous     TRUE
+ */
+NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryCompressionFailed(void);
+#endif
+
 #if(NVM_SET_RAM_BLOCK_STATUS_API == STD_ON)
 /**********************************************************************************************************************
  *  NvM_QryHasExplicitSynchronization
@@ -695,6 +729,10 @@ CONST(NvM_QryFctPtrType, NVM_PRIVATE_CONST) NvM_QueryTable_ap[(uint32)NVM_QRY_ID
 #if (NVM_CSM_CIPHERING_ENABLED == STD_ON)
     NvM_QryHasEncryptionJob,
 #endif
+#if (NVM_COMPRESSION == STD_ON)
+    NvM_QryHasCompression,
+    NvM_QryCompressionFailed,
+#endif
 #if(NVM_SET_RAM_BLOCK_STATUS_API == STD_ON)
     NvM_QryHasExplicitSynchronization,
     NvM_QryExplicitSyncAttemptNecessary,
@@ -1067,6 +1105,9 @@ NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QrySkipBlock(void)
 {
   return (boolean)(
       (NvM_IsBooleanBitfieldTrue(NvM_CurrentBlockInfo_t.Descriptor_pt->Flags.SelectBlockForReadAllEnabled) == FALSE)
+#if ((NVM_DEFERRED_READALL == STD_ON) && (NVM_API_CONFIG_CLASS > NVM_API_CONFIG_CLASS_1)) /* ECO_IGNORE_LINE */
+      || (NvM_IsBooleanBitfieldTrue(NvM_CurrentBlockInfo_t.Descriptor_pt->Flags.SelectBlockForDeferredReadAllEnabled) == TRUE)
+#endif /* ECO_IGNORE_LINE */
 #if (NVM_DYNAMIC_CONFIGURATION == STD_ON) /* ECO_IGNORE_LINE */
       || ((!NvM_QryHasRom()) && (NvM_QryExtRuntime())) /* PRQA S 3415 */ /* MD_NvM_13.5 */
 #endif /* ECO_IGNORE_LINE */
@@ -1376,6 +1417,16 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_QrySyncDecrypt(void)
         retVal = TRUE;
     }
     return retVal;
+#elif (NVM_COMPRESSION == STD_ON)
+    boolean retVal = TRUE;
+    /* #300 Compression enabled and the current block is compressed: decoded data must match the configured user data length. */
+    if(NvM_QryIsCompressedBlock(NvM_CurrentBlockInfo_t.Descriptor_pt) == TRUE) /* SBSW_NvM_FuncCall_PtrParam_CurrBlockInfo */
+    {
+      retVal = NvM_Compress_Decode(NvM_CurrentBlockInfo_t.NvRamAddr_t,                                                 /* SBSW_NvM_FuncCall_PtrParam_Compress */
+          NvM_CurrentBlockInfo_t.Descriptor_pt->NvBlockNVRAMDataLength,
+          NvM_CurrentBlockInfo_t.RamAddr_t, NvM_CurrentBlockInfo_t.Descriptor_pt->NvBlockLength_u16);
+    }
+    return retVal;
 #else
     return TRUE;
 #endif
@@ -1481,6 +1532,35 @@ NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryHasEncryptionJob(void)
 }
 #endif
 
+#if (NVM_COMPRESSION == STD_ON)
+/**********************************************************************************************************************
+ *  NvM_QryHasCompression
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryHasCompression(void)
+{
+  return NvM_QryIsCompressedBlock(NvM_CurrentBlockInfo_t.Descriptor_pt); /* SBSW_NvM_FuncCall_PtrParam_CurrBlockInfo */
+}
+
+/**********************************************************************************************************************
+ *  NvM_QryCompressionFailed
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+NVM_LOCAL FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryCompressionFailed(void)
+{
+  return (boolean)(NvM_CurrentBlockInfo_t.CompressionSuccessful == FALSE);
+}
+#endif
+
 #if(NVM_SET_RAM_BLOCK_STATUS_API == STD_ON)
 /**********************************************************************************************************************
  *  NvM_QryHasExplicitSynchronization
@@ -1573,6 +1653,21 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryIsCipherBlock(NvM_BlockDescrPtrType Block
 }
 #endif /* (NVM_CSM_CIPHERING_ENABLED == STD_ON) */
 
+#if (NVM_COMPRESSION == STD_ON)
+/**********************************************************************************************************************
+ * NvM_QryIsCompressedBlock
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryIsCompressedBlock(NvM_BlockDescrPtrType BlockDescriptor)
+{
+  return NvM_IsBooleanBitfieldTrue(BlockDescriptor->Flags.CompressionEnabled);
+}
+#endif /* (NVM_COMPRESSION == STD_ON) */
+
 #define NVM_STOP_SEC_CODE
 #include "NvM_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
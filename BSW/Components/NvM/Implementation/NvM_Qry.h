@@ -90,6 +90,10 @@ typedef enum
 #if (NVM_CSM_CIPHERING_ENABLED == STD_ON)
   NVM_QRY_ID_HAS_ENCRYPTION_JOB,
 #endif
+#if (NVM_COMPRESSION == STD_ON)
+  NVM_QRY_ID_HAS_COMPRESSION,
+  NVM_QRY_ID_COMPRESSION_FAILED,
+#endif
 #if(NVM_SET_RAM_BLOCK_STATUS_API == STD_ON)
   NVM_QRY_ID_HAS_EXPLICITSYNCHRONIZATION,
   NVM_QRY_ID_EXPLICITSYNC_ATTEMPT_NECESSARY,
@@ -169,6 +173,22 @@ extern FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryIsInitCallbackConfigured(NvM_Block
 FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryIsCipherBlock(NvM_BlockDescrPtrType BlockDescriptor);
 #endif
 
+#if (NVM_COMPRESSION == STD_ON)
+/**********************************************************************************************************************
+ * NvM_QryIsCompressedBlock
+ *********************************************************************************************************************/
+/*! \brief Returns whether the passed block descriptor has data compression enabled or not.
+ *  \details Compressed blocks store run length encoded data in the NV block, the user gets the decoded data.
+ *  \param[in] BlockDescriptor as a valid pointer to a block descriptor. Caller has to ensure validity of pointer.
+ *  \return TRUE Block data is compressed, FALSE otherwise
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \pre NVM_COMPRESSION == STD_ON (at least one NvM block has data compression enabled).
+ */
+FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryIsCompressedBlock(NvM_BlockDescrPtrType BlockDescriptor);
+#endif
+
 /**********************************************************************************************************************
  * NvM_QrySyncDecrypt
  *********************************************************************************************************************/
@@ -176,6 +196,7 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryIsCipherBlock(NvM_BlockDescrPtrType Block
  *         required, data is ok.
  *  \details Decryption is only successful, in case the CSM returns E_OK and the result length matches
  *           configured user data length. NvM will then provide the decrypted data to the user.
+ *           For compressed blocks the NV data is decompressed into the user buffer instead.
  *  \return TRUE Data decrypted successfully or no decryption needed, FALSE decryption failed.
  *  \context TASK
  *  \reentrant FALSE
@@ -60,6 +60,15 @@ VAR(NvM_JobType, NVM_PRIVATE_DATA) NvM_CurrentJob_t;
 #define NVM_LOWEST_JOB_PRIO     (0xFFu)
 #define NVM_LIST_END            (0xFFu)
 
+#if (NVM_JOB_PRIORISATION == STD_ON)
+# if ((NVM_JOB_QUEUE_PRIO_LEVELS < 1u) || (NVM_JOB_QUEUE_PRIO_LEVELS > 8u))
+#  error "NVM_JOB_QUEUE_PRIO_LEVELS must be in range [1, 8]."
+# endif
+/* Maps a configured block priority [0, 255] to a priority level of the normal priority queue; level 0 is served first.
+ * Jobs within one level are served in FIFO order, regardless of their exact block priority. */
+# define NVM_QUEUE_LEVEL_OF_PRIO(prio) ((uint8)(((uint16)(prio) * NVM_JOB_QUEUE_PRIO_LEVELS) >> 8u))
+#endif /* (NVM_JOB_PRIORISATION == STD_ON) */
+
 /**********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  *********************************************************************************************************************/
@@ -73,6 +82,15 @@ typedef struct
     NvM_QueueEntryRefType EmptyList; /*!< Points to next empty queue element to use. */
 } NvM_JobQueueType; /*!< Structure storing the next queue indexes - empty and full element. */
 
+#if (NVM_JOB_PRIORISATION == STD_ON)
+typedef struct
+{
+    uint16 EnqueueTime; /*!< Queue time base value at which the job was queued. */
+    uint16 LevelTime; /*!< Queue time base value at which the job entered its current priority level. */
+    uint8 Level; /*!< Current priority level of the job. */
+} NvM_QueueEntryTimingType; /*!< Aging information of a normal priority queue element. */
+#endif /* (NVM_JOB_PRIORISATION == STD_ON) */
+
 /**********************************************************************************************************************
  *  LOCAL DATA PROTOTYPES
  *********************************************************************************************************************/
@@ -83,6 +101,22 @@ typedef struct
 NVM_LOCAL VAR(NvM_JobQueueType, NVM_PRIVATE_DATA) NvM_HighPrioQueue;
 
 NVM_LOCAL VAR(NvM_QueueEntryRefType, NVM_PRIVATE_DATA) NvM_LastJobEntry;
+
+/*! Service lists of the normal priority queue, one ring list per priority level. */
+NVM_LOCAL VAR(NvM_QueueEntryRefType, NVM_PRIVATE_DATA) NvM_PrioLevelList[NVM_JOB_QUEUE_PRIO_LEVELS];
+
+/*! Bit n is set, if priority level n contains at least one job. */
+NVM_LOCAL VAR(uint8, NVM_PRIVATE_DATA) NvM_PrioLevelMask;
+
+/*! Aging information of the normal priority queue elements. */
+NVM_LOCAL VAR(NvM_QueueEntryTimingType, NVM_PRIVATE_DATA) NvM_QueueEntryTiming[NVM_SIZE_STANDARD_JOB_QUEUE];
+
+/*! Queue time base, incremented once per NvM_MainFunction cycle. */
+NVM_LOCAL VAR(uint16, NVM_PRIVATE_DATA) NvM_QueueTime;
+
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
+NVM_LOCAL VAR(NvM_QueueStatisticsType, NVM_PRIVATE_DATA) NvM_QueueStatistics[NVM_JOB_QUEUE_PRIO_LEVELS];
+# endif
 #endif /* (NVM_JOB_PRIORISATION == STD_ON) */
 
 NVM_LOCAL VAR(NvM_JobQueueType, NVM_PRIVATE_DATA) NvM_NormalPrioQueue;
@@ -149,6 +183,27 @@ NVM_LOCAL FUNC(NvM_QueueEntryRefType, NVM_PRIVATE_CODE) NvM_QueuePop(NvM_QueueLi
  */
 NVM_LOCAL FUNC(NvM_QueueEntryRefType, NVM_PRIVATE_CODE) NvM_QueueFindBlock(NvM_QueueEntryRefType QueueHead, NvM_BlockIdType BlockId);
 
+/**********************************************************************************************************************
+ * NvM_QueueInsertJob
+ *********************************************************************************************************************/
+/*! \brief Sets up a free queue element and puts it into the given queue.
+ *  \details Takes the next free element of the given queue, sets up the job and queues it. The block state is set to
+ *           NVM_REQ_PENDING. The given queue shall not be full. Must be called within a critical section.
+ *  \param[in,out] UsedQueue as the normal or high priority queue. Caller has to ensure validity.
+ *  \param[in] BlockId in range [1, (number of blocks - 1)].
+ *  \param[in] ServiceId as a request type. Caller has to ensure validity.
+ *  \param[in] RamAddress pointing to the buffer used to for request. May be NULL_PTR for specific BlockIds.
+ *  \param[in,out] RamMngmtPtr as the management area of the block. Caller has to ensure validity.
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1
+ *  \pre -
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueInsertJob(P2VAR(NvM_JobQueueType, AUTOMATIC, NVM_PRIVATE_DATA) UsedQueue,
+    NvM_BlockIdType BlockId, NvM_InternalServiceIdType ServiceId, NvM_RamAddressType RamAddress,
+    const NvM_RamMngmtPtrType RamMngmtPtr);
+
 #if (NVM_JOB_PRIORISATION == STD_ON)
 /**********************************************************************************************************************
  * NvM_QueueRequeueLastJob
@@ -162,6 +217,53 @@ NVM_LOCAL FUNC(NvM_QueueEntryRefType, NVM_PRIVATE_CODE) NvM_QueueFindBlock(NvM_Q
  *  \pre -
  */
 NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueRequeueLastJob(void);
+
+/**********************************************************************************************************************
+ * NvM_QueueLevelInsert
+ *********************************************************************************************************************/
+/*! \brief Adds a job to a priority level of the normal priority queue.
+ *  \details Pushes the element onto the ring list of the given level as its newest element and marks the level as
+ *           non-empty. Must be called within a critical section.
+ *  \param[in] Level in range [0, (NVM_JOB_QUEUE_PRIO_LEVELS - 1)].
+ *  \param[in] Elem as an index to a normal priority queue element. Caller has to ensure validity.
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1 and priority handling is enabled
+ *  \pre -
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueLevelInsert(uint8 Level, NvM_QueueEntryRefType Elem);
+
+/**********************************************************************************************************************
+ * NvM_QueueLevelRemove
+ *********************************************************************************************************************/
+/*! \brief Removes a job from its priority level of the normal priority queue.
+ *  \details Unlinks the element from the ring list of its current level. The level is marked as empty, if the element
+ *           was the last one. The element is not freed. Must be called within a critical section.
+ *  \param[in] Elem as an index to a queued normal priority queue element. Caller has to ensure validity.
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1 and priority handling is enabled
+ *  \pre -
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueLevelRemove(NvM_QueueEntryRefType Elem);
+
+/**********************************************************************************************************************
+ * NvM_QueueFindBlockInLevels
+ *********************************************************************************************************************/
+/*! \brief Searches for requested block within all priority levels of the normal priority queue.
+ *  \details Must be called within a critical section.
+ *  \param[in] BlockId in range [1, (number of blocks - 1)].
+ *  \return queue element which stores the blockId if blockId was found within queue
+ *  \return queue end if blockId wasn't found within queue
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1 and priority handling is enabled
+ *  \pre -
+ */
+NVM_LOCAL FUNC(NvM_QueueEntryRefType, NVM_PRIVATE_CODE) NvM_QueueFindBlockInLevels(NvM_BlockIdType BlockId);
 #endif
 
 #define NVM_STOP_SEC_CODE
@@ -187,6 +289,9 @@ FUNC(void, NVM_PRIVATE_CODE) NvM_QueueInit(void)
 {
     uint8 maxQueueIndex = (NVM_SIZE_STANDARD_JOB_QUEUE + NVM_SIZE_IMMEDIATE_JOB_QUEUE - 1u);
     uint8 index = maxQueueIndex;
+#if (NVM_JOB_PRIORISATION == STD_ON)
+    uint8 level;
+#endif
 
     /* link all list elements */
     while(index > 0u)                                                                                                   /* FETA_NVM_QueueInit */
@@ -207,6 +312,21 @@ FUNC(void, NVM_PRIVATE_CODE) NvM_QueueInit(void)
 #if (NVM_JOB_PRIORISATION == STD_ON)
         NvM_LastJobEntry = NVM_LIST_END;
 
+        for(level = 0u; level < NVM_JOB_QUEUE_PRIO_LEVELS; level++)                                                     /* FETA_NVM_QueueInit */
+        {
+            NvM_PrioLevelList[level] = NVM_LIST_END; /* SBSW_NvM_AccessPrioLevelList */
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
+            NvM_QueueStatistics[level].CurrentDepth = 0u; /* SBSW_NvM_AccessQueueStatistics */
+            NvM_QueueStatistics[level].MaxDepth = 0u; /* SBSW_NvM_AccessQueueStatistics */
+            NvM_QueueStatistics[level].MaxWaitTime = 0u; /* SBSW_NvM_AccessQueueStatistics */
+            NvM_QueueStatistics[level].Promotions = 0u; /* SBSW_NvM_AccessQueueStatistics */
+            NvM_QueueStatistics[level].DequeuedJobs = 0u; /* SBSW_NvM_AccessQueueStatistics */
+            NvM_QueueStatistics[level].AccumulatedWaitTime = 0u; /* SBSW_NvM_AccessQueueStatistics */
+# endif
+        }
+        NvM_PrioLevelMask = 0u;
+        NvM_QueueTime = 0u;
+
         NvM_HighPrioQueue.SrvList = NVM_LIST_END;
         NvM_HighPrioQueue.EmptyList = index;
 
@@ -270,19 +390,8 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_QueueJob(NvM_BlockIdType BlockId,
     /* #210 queue is not full and the requested block isn't already pending */
     if((queueFull == FALSE) && (blockAlreadyPending == FALSE))
     {
-        /* #211 find next free element in queue */
-        const NvM_QueueEntryRefType elem = NvM_QueuePop(&usedQueue->EmptyList); /* SBSW_NvM_FuncCall_PtrParam_Queue */
-        CONSTP2VAR(NvM_QueueEntryType, AUTOMATIC, NVM_PRIVATE_DATA) elemPtr = &NvM_JobQueue_at[elem];
-        /* #212 setup and queue NvM job */
-        elemPtr->BlockId   = BlockId; /* SBSW_NvM_AccessJobQueue */
-        elemPtr->RamAddr_t = RamAddress; /* SBSW_NvM_AccessJobQueue */
-        elemPtr->ServiceId = ServiceId; /* SBSW_NvM_AccessJobQueue */
-#if(NVM_JOB_PRIORISATION == STD_ON)
-        elemPtr->JobPrio = priority; /* SBSW_NvM_AccessJobQueue */
-#endif
-        NvM_QueuePush(&usedQueue->SrvList, elem); /* SBSW_NvM_FuncCall_PtrParam_Queue */
-        /* #213 set the block status to NVM_REQ_PENDING */
-        ramMngmtPtr->NvRamErrorStatus_u8 = NVM_REQ_PENDING; /* SBSW_NvM_AccessBlockManagementArea */
+        /* #211 setup and queue NvM job, set the block status to NVM_REQ_PENDING */
+        NvM_QueueInsertJob(usedQueue, BlockId, ServiceId, RamAddress, ramMngmtPtr); /* SBSW_NvM_FuncCall_PtrParam_Queue */
         /* block queued and pending, return successfully */
         retVal = TRUE;
     }
@@ -309,6 +418,58 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_QueueJob(NvM_BlockIdType BlockId,
     return retVal;
 }
 
+#if (NVM_DEFERRED_READALL == STD_ON)
+/**********************************************************************************************************************
+*  NvM_QueueDeferredReadJob
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(boolean, NVM_PRIVATE_CODE) NvM_QueueDeferredReadJob(NvM_BlockIdType BlockId)
+{
+    boolean retVal = FALSE;
+    boolean queueFull;
+    boolean restoreOutstanding;
+    const NvM_RamMngmtPtrType ramMngmtPtr = &NvM_BlockMngmtArea_at[BlockId];
+
+    /* #10 critical section (Reason: the block state must not change between the check and queuing the job) */
+    NvM_EnterCriticalSection();
+
+    queueFull = (NvM_NormalPrioQueue.EmptyList == NVM_LIST_END);
+    restoreOutstanding = (boolean)((ramMngmtPtr->NvRamErrorStatus_u8 == NVM_REQ_BLOCK_SKIPPED) &&
+                                   ((ramMngmtPtr->NvRamAttributes_u8 & NVM_STATE_VALID_SET) == 0u));
+
+    /* #20 block was neither restored nor requested since ReadAll skipped it: queue the read job */
+    if((queueFull == FALSE) && (restoreOutstanding == TRUE))
+    {
+        NvM_QueueInsertJob(&NvM_NormalPrioQueue, BlockId, NVM_INT_FID_READ_BLOCK, NULL_PTR, ramMngmtPtr); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+        retVal = TRUE;
+    }
+
+    NvM_ExitCriticalSection();
+
+    /* #30 report queue overflow or invoke notifications out of the critical section */
+    if(retVal == TRUE)
+    {
+        NvM_BlockNotification(BlockId, NvM_IntServiceDescrTable_at[NVM_INT_FID_READ_BLOCK].PublicFid_t, NVM_REQ_PENDING);
+    }
+    else if((queueFull == TRUE) && (restoreOutstanding == TRUE))
+    {
+        NvM_DemReportErrorQueueOverflow();
+    }
+    else
+    {
+        /* nothing to do here */
+    }
+
+    return retVal;
+}
+#endif /* (NVM_DEFERRED_READALL == STD_ON) */
+
 /**********************************************************************************************************************
 *  NvM_UnQueueJob
 **********************************************************************************************************************/
@@ -342,23 +503,42 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_UnQueueJob(NvM_BlockIdType BlockId)
      * ==> conditionally search HighPrioQueue.                                             *
      * After that UsedQueue points to the Queue where the Block was found                  */
 
-    elem = NvM_QueueFindBlock(UsedQueue->SrvList, BlockId);
-
 #if(NVM_JOB_PRIORISATION == STD_ON)
+    /* The normal prio queue is split into priority levels; a job may have been promoted by aging or re-queued,
+     * therefore all levels are searched. */
+    elem = NvM_QueueFindBlockInLevels(BlockId);
+
+    if(elem != NVM_LIST_END)
+    {
+        const NvM_InternalServiceIdType srvId = NvM_JobQueue_at[elem].ServiceId;
+
+        retVal = TRUE;
+
+        NvM_QueueLevelRemove(elem);
+        NvM_QueuePush(&NvM_NormalPrioQueue.EmptyList, elem); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+
+        NvM_RamMngmt_ptloc->NvRamErrorStatus_u8 = NVM_REQ_CANCELED; /* SBSW_NvM_AccessBlockManagementArea */
+        NvM_BlockNotification(BlockId, NvM_IntServiceDescrTable_at[srvId].PublicFid_t, NVM_REQ_CANCELED);
+    }
     /* If nothing was found in normal prio queue, look into high prio queue, if it is a high prio block *
      * (and not its DCM-alias)                                                                          */
-    if((elem == NVM_LIST_END) &&
-        (NvM_BlockDescriptorTable_at[NVM_BLOCK_FROM_DCM_ID(BlockId)].BlockPrio_u8 == 0u) &&
+    else if((NvM_BlockDescriptorTable_at[NVM_BLOCK_FROM_DCM_ID(BlockId)].BlockPrio_u8 == 0u) &&
         ((BlockId & NVM_DCM_BLOCK_OFFSET) == 0u))
     {
         UsedQueue = &NvM_HighPrioQueue;
         elem = NvM_QueueFindBlock(UsedQueue->SrvList, BlockId);
     }
+    else
+    {
+        /* nothing to do here */
+    }
+#else
+    elem = NvM_QueueFindBlock(UsedQueue->SrvList, BlockId);
 #endif
 
     /* If block was found, remove it from the queue <UsedQueue>,    *
      *  free the queue Item and set block's error/status to CANCELED */
-    if(elem != NVM_LIST_END)
+    if((elem != NVM_LIST_END) && (retVal == FALSE))
     {
         const NvM_InternalServiceIdType srvId = NvM_JobQueue_at[elem].ServiceId;
         const NvM_ServiceIdType   PublicServiceId =  NvM_IntServiceDescrTable_at[srvId].PublicFid_t;
@@ -400,7 +580,11 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_UnQueueJob(NvM_BlockIdType BlockId)
  */
 FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryNormalPrioJob(void)
 {
+#if (NVM_JOB_PRIORISATION == STD_ON)
+    return (boolean)(NvM_PrioLevelMask != 0u);
+#else
     return (boolean)(NvM_NormalPrioQueue.SrvList != NVM_LIST_END);
+#endif
 }
 
 /**********************************************************************************************************************
@@ -424,59 +608,40 @@ FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryNormalPrioJob(void)
 FUNC(void, NVM_PRIVATE_CODE) NvM_ActGetNormalPrioJob(void)
 {
 #if (NVM_JOB_PRIORISATION == STD_ON)
-    /* search for the highest prioritized entry */
-    NvM_QueueEntryRefType maxPrioElem;
-    NvM_QueueEntryRefType currentElem;
-    uint8 maxPrio;
+    NvM_QueueEntryRefType elem;
+    uint8 level = 0u;
 
     NvM_EnterCriticalSection();
-    /* We have to guarantee, that we really get the last element.
-     * We only get it, as long as our head element remains the head element.
-     * Otherwise it would just point to its predecessor. */
-    currentElem = NvM_JobQueue_at[NvM_NormalPrioQueue.SrvList].PrevEntry;
-    maxPrioElem = NvM_JobQueue_at[NvM_NormalPrioQueue.SrvList].PrevEntry;
 
-    maxPrio = NvM_JobQueue_at[maxPrioElem].JobPrio;
+    /* #10 find the highest non-empty priority level, the number of levels is limited to 8 */
+    while((NvM_PrioLevelMask & (uint8)(1u << level)) == 0u)                                                             /* FETA_NVM_ActGetNormalPrioJob */
+    {
+        level++;
+    }
 
-    NvM_ExitCriticalSection();
+    /* #20 take the oldest entry of the level (predecessor of the list head) and remove it from the level */
+    elem = NvM_JobQueue_at[NvM_PrioLevelList[level]].PrevEntry;
+    NvM_QueueLevelRemove(elem);
 
-    /* the actual iteration over the queue is not a critical section,
-       because the consistency of the list (prev and next pointers) is guaranteed by
-       NvM_QueueJob()
-       If the queue contains only one element, it will be checked twice
-       (one iteration - it will be compared with itself -> that's no problem */
-    do                                                                                                                  /* FETA_NVM_ActGetNormalPrioJob */
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
     {
-        currentElem = NvM_JobQueue_at[currentElem].PrevEntry;
+        const uint16 waitTime = (uint16)(NvM_QueueTime - NvM_QueueEntryTiming[elem].EnqueueTime);
 
-        if(NvM_JobQueue_at[currentElem].JobPrio < maxPrio)
+        NvM_QueueStatistics[level].DequeuedJobs++; /* SBSW_NvM_AccessQueueStatistics */
+        NvM_QueueStatistics[level].AccumulatedWaitTime += waitTime; /* SBSW_NvM_AccessQueueStatistics */
+        if(waitTime > NvM_QueueStatistics[level].MaxWaitTime)
         {
-            maxPrioElem = currentElem;
-            maxPrio = NvM_JobQueue_at[currentElem].JobPrio;
+            NvM_QueueStatistics[level].MaxWaitTime = waitTime; /* SBSW_NvM_AccessQueueStatistics */
         }
     }
-    while(currentElem != NvM_NormalPrioQueue.SrvList);
-
-
-    /* now, we have the entry of interest. */
-    NvM_LastJobEntry = maxPrioElem;
-
-    NvM_CurrentJob_t.JobBlockId_t = NvM_JobQueue_at[maxPrioElem].BlockId;
-    NvM_CurrentJob_t.JobServiceId_t = NvM_JobQueue_at[maxPrioElem].ServiceId;
-    NvM_CurrentJob_t.RamAddr_t = NvM_JobQueue_at[maxPrioElem].RamAddr_t;
-
-
-    /* remove entry from the queue, discard the return value */
-    NvM_EnterCriticalSection();
+# endif
 
-    (void)NvM_QueuePop(&maxPrioElem); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+    /* #30 the entry is kept in NvM_LastJobEntry, it will be freed or re-queued later */
+    NvM_LastJobEntry = elem;
 
-    /* if it was the first element of the queue, we need to adjust the real queue head.
-     * Otherwise it would not have been changed be removing the entry. */
-    if(NvM_NormalPrioQueue.SrvList == NvM_LastJobEntry)
-    {
-        NvM_NormalPrioQueue.SrvList = maxPrioElem;
-    }
+    NvM_CurrentJob_t.JobBlockId_t = NvM_JobQueue_at[elem].BlockId;
+    NvM_CurrentJob_t.JobServiceId_t = NvM_JobQueue_at[elem].ServiceId;
+    NvM_CurrentJob_t.RamAddr_t = NvM_JobQueue_at[elem].RamAddr_t;
 
     NvM_ExitCriticalSection();
 #else
@@ -590,6 +755,101 @@ FUNC(void, NVM_PRIVATE_CODE) NvM_ActQueueFreeLastJob(void)
         NvM_ExitCriticalSection();
     }
 }
+
+/**********************************************************************************************************************
+*  NvM_QueueProcessAging
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(void, NVM_PRIVATE_CODE) NvM_QueueProcessAging(void)
+{
+# if (NVM_JOB_QUEUE_AGING_CYCLES > 0u)
+    uint8 level;
+# endif
+
+    NvM_EnterCriticalSection();
+
+    NvM_QueueTime++;
+
+# if (NVM_JOB_QUEUE_AGING_CYCLES > 0u)
+    /* #10 check the oldest job of each level (except the highest one), promote it if its deadline expired.
+     *     Levels are processed from high to low priority, a promoted job is not promoted twice in one cycle. */
+    for(level = 1u; level < NVM_JOB_QUEUE_PRIO_LEVELS; level++)                                                         /* FETA_NVM_QueueProcessAging */
+    {
+        if(NvM_PrioLevelList[level] != NVM_LIST_END)
+        {
+            const NvM_QueueEntryRefType oldest = NvM_JobQueue_at[NvM_PrioLevelList[level]].PrevEntry;
+
+            if((uint16)(NvM_QueueTime - NvM_QueueEntryTiming[oldest].LevelTime) >= (uint16)NVM_JOB_QUEUE_AGING_CYCLES)
+            {
+                NvM_QueueLevelRemove(oldest);
+                NvM_QueueLevelInsert(level - 1u, oldest);
+#  if (NVM_QUEUE_STATISTICS_API == STD_ON)
+                NvM_QueueStatistics[level - 1u].Promotions++; /* SBSW_NvM_AccessQueueStatistics */
+#  endif
+            }
+        }
+    }
+# endif
+
+    NvM_ExitCriticalSection();
+}
+
+/**********************************************************************************************************************
+*  NvM_QueuePromoteJob
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, NVM_PRIVATE_CODE) NvM_QueuePromoteJob(NvM_BlockIdType BlockId, NvM_InternalServiceIdType ServiceId)
+{
+    NvM_QueueEntryRefType elem;
+
+    NvM_EnterCriticalSection();
+
+    elem = NvM_QueueFindBlockInLevels(BlockId);
+
+    /* only the requested job type is promoted, any other job queued for the block keeps its position */
+    if((elem != NVM_LIST_END) && (NvM_JobQueue_at[elem].ServiceId == ServiceId))
+    {
+        NvM_QueueLevelRemove(elem);
+        NvM_QueueLevelInsert(0u, elem);
+
+        /* shift level start to next element, the promoted job becomes the oldest one */
+        NvM_PrioLevelList[0] = NvM_JobQueue_at[elem].NextEntry; /* SBSW_NvM_AccessPrioLevelList */
+    }
+
+    NvM_ExitCriticalSection();
+}
+
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
+/**********************************************************************************************************************
+*  NvM_QueueGetStatistics
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, NVM_PRIVATE_CODE) NvM_QueueGetStatistics(uint8 PrioLevel,
+    P2VAR(NvM_QueueStatisticsType, AUTOMATIC, NVM_APPL_DATA) StatisticsPtr)
+{
+    NvM_EnterCriticalSection();
+
+    *StatisticsPtr = NvM_QueueStatistics[PrioLevel]; /* SBSW_NvM_PtrAccess_PublicAPI */
+
+    NvM_ExitCriticalSection();
+}
+# endif /* (NVM_QUEUE_STATISTICS_API == STD_ON) */
 #endif /* (NVM_JOB_PRIORISATION == STD_ON) */
 
 /**********************************************************************************************************************
@@ -701,6 +961,48 @@ NVM_LOCAL FUNC(NvM_QueueEntryRefType, NVM_PRIVATE_CODE) NvM_QueueFindBlock(NvM_Q
     return entryRef;
 }
 
+/**********************************************************************************************************************
+*  NvM_QueueInsertJob
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueInsertJob(P2VAR(NvM_JobQueueType, AUTOMATIC, NVM_PRIVATE_DATA) UsedQueue,
+    NvM_BlockIdType BlockId, NvM_InternalServiceIdType ServiceId, NvM_RamAddressType RamAddress,
+    const NvM_RamMngmtPtrType RamMngmtPtr)
+{
+    /* #10 find next free element in queue */
+    const NvM_QueueEntryRefType elem = NvM_QueuePop(&UsedQueue->EmptyList); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+    CONSTP2VAR(NvM_QueueEntryType, AUTOMATIC, NVM_PRIVATE_DATA) elemPtr = &NvM_JobQueue_at[elem];
+#if(NVM_JOB_PRIORISATION == STD_ON)
+    const uint8 priority = (uint8)NvM_BlockDescriptorTable_at[NVM_BLOCK_FROM_DCM_ID(BlockId)].BlockPrio_u8;
+#endif
+
+    /* #20 setup and queue NvM job */
+    elemPtr->BlockId   = BlockId; /* SBSW_NvM_AccessJobQueue */
+    elemPtr->RamAddr_t = RamAddress; /* SBSW_NvM_AccessJobQueue */
+    elemPtr->ServiceId = ServiceId; /* SBSW_NvM_AccessJobQueue */
+#if(NVM_JOB_PRIORISATION == STD_ON)
+    elemPtr->JobPrio = priority; /* SBSW_NvM_AccessJobQueue */
+    /* #30 normal priority jobs are queued into the priority level derived from the block priority */
+    if(UsedQueue == &NvM_NormalPrioQueue)
+    {
+        NvM_QueueEntryTiming[elem].EnqueueTime = NvM_QueueTime; /* SBSW_NvM_AccessQueueEntryTiming */
+        NvM_QueueLevelInsert(NVM_QUEUE_LEVEL_OF_PRIO(priority), elem);
+    }
+    else
+#endif
+    {
+        NvM_QueuePush(&UsedQueue->SrvList, elem); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+    }
+    /* #40 set the block status to NVM_REQ_PENDING */
+    RamMngmtPtr->NvRamErrorStatus_u8 = NVM_REQ_PENDING; /* SBSW_NvM_AccessBlockManagementArea */
+}
+
 #if (NVM_JOB_PRIORISATION == STD_ON)
 /**********************************************************************************************************************
 *  NvM_QueueRequeueLastJob
@@ -718,19 +1020,100 @@ NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueRequeueLastJob(void)
     if(NvM_LastJobEntry != NVM_LIST_END)
     {
         NvM_EnterCriticalSection();
-        /* add element at list start */
-        NvM_QueuePush(&NvM_NormalPrioQueue.SrvList, NvM_LastJobEntry); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+        /* add element to the highest priority level */
+        NvM_QueueLevelInsert(0u, NvM_LastJobEntry);
 
         /*  set the highest possible priority */
         NvM_JobQueue_at[NvM_LastJobEntry].JobPrio = NVM_IMMEDIATE_JOB_PRIO; /* SBSW_NvM_AccessJobQueue */
 
-        /* shift Queue Start to next element, remember: it is a ring list ... */
-        NvM_NormalPrioQueue.SrvList = NvM_JobQueue_at[NvM_LastJobEntry].NextEntry;
+        /* shift level start to next element, remember: it is a ring list ... the re-queued job becomes the oldest one */
+        NvM_PrioLevelList[0] = NvM_JobQueue_at[NvM_LastJobEntry].NextEntry; /* SBSW_NvM_AccessPrioLevelList */
 
         NvM_LastJobEntry = NVM_LIST_END;
         NvM_ExitCriticalSection();
     }
 }
+
+/**********************************************************************************************************************
+*  NvM_QueueLevelInsert
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueLevelInsert(uint8 Level, NvM_QueueEntryRefType Elem)
+{
+    NvM_QueuePush(&NvM_PrioLevelList[Level], Elem); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+    NvM_PrioLevelMask |= (uint8)(1u << Level);
+
+    NvM_QueueEntryTiming[Elem].Level = Level; /* SBSW_NvM_AccessQueueEntryTiming */
+    NvM_QueueEntryTiming[Elem].LevelTime = NvM_QueueTime; /* SBSW_NvM_AccessQueueEntryTiming */
+
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
+    NvM_QueueStatistics[Level].CurrentDepth++; /* SBSW_NvM_AccessQueueStatistics */
+    if(NvM_QueueStatistics[Level].CurrentDepth > NvM_QueueStatistics[Level].MaxDepth)
+    {
+        NvM_QueueStatistics[Level].MaxDepth = NvM_QueueStatistics[Level].CurrentDepth; /* SBSW_NvM_AccessQueueStatistics */
+    }
+# endif
+}
+
+/**********************************************************************************************************************
+*  NvM_QueueLevelRemove
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+NVM_LOCAL FUNC(void, NVM_PRIVATE_CODE) NvM_QueueLevelRemove(NvM_QueueEntryRefType Elem)
+{
+    const uint8 level = NvM_QueueEntryTiming[Elem].Level;
+    NvM_QueueEntryRefType successor = Elem;
+
+    /* pop "Elem" of the level -> pretend "Elem" being the list head. After that "successor" points to the successor
+     * of "Elem", or to the list end if "Elem" was the only element */
+    (void)NvM_QueuePop(&successor); /* SBSW_NvM_FuncCall_PtrParam_Queue */
+
+    if(NvM_PrioLevelList[level] == Elem)
+    {
+        NvM_PrioLevelList[level] = successor; /* SBSW_NvM_AccessPrioLevelList */
+    }
+
+    if(NvM_PrioLevelList[level] == NVM_LIST_END)
+    {
+        NvM_PrioLevelMask &= (uint8)(~(uint8)(1u << level));
+    }
+
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
+    NvM_QueueStatistics[level].CurrentDepth--; /* SBSW_NvM_AccessQueueStatistics */
+# endif
+}
+
+/**********************************************************************************************************************
+*  NvM_QueueFindBlockInLevels
+**********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+NVM_LOCAL FUNC(NvM_QueueEntryRefType, NVM_PRIVATE_CODE) NvM_QueueFindBlockInLevels(NvM_BlockIdType BlockId)
+{
+    NvM_QueueEntryRefType entryRef = NVM_LIST_END;
+    uint8 level;
+
+    for(level = 0u; (level < NVM_JOB_QUEUE_PRIO_LEVELS) && (entryRef == NVM_LIST_END); level++)                         /* FETA_NVM_QueueFindBlockInLevels */
+    {
+        entryRef = NvM_QueueFindBlock(NvM_PrioLevelList[level], BlockId);
+    }
+
+    return entryRef;
+}
 #endif /* (NVM_JOB_PRIORISATION == STD_ON) */
 
 #define NVM_STOP_SEC_CODE
@@ -73,6 +73,26 @@ extern FUNC(void, NVM_PRIVATE_CODE) NvM_QueueInit(void);
  */
 extern FUNC(boolean, NVM_PRIVATE_CODE) NvM_QueueJob(NvM_BlockIdType BlockId, NvM_InternalServiceIdType ServiceId, NvM_RamAddressType RamAddress);
 
+#if (NVM_DEFERRED_READALL == STD_ON)
+/**********************************************************************************************************************
+ * NvM_QueueDeferredReadJob
+ *********************************************************************************************************************/
+/*! \brief Queues the read job restoring a block skipped by a deferred ReadAll.
+ *  \details The read job into the permanent RAM block is queued only, if the block is still in state
+ *           NVM_REQ_BLOCK_SKIPPED and its RAM block is invalid. The check and queuing are done atomically, i.e. a
+ *           concurrent request for the block either prevents the restore or is rejected as the block is pending.
+ *  \param[in] BlockId in range [1, (number of blocks - 1)], block shall be selected for deferred ReadAll.
+ *  \return TRUE read job was queued successfully
+ *  \return FALSE otherwise
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1 and deferred ReadAll is enabled
+ *  \pre -
+ */
+extern FUNC(boolean, NVM_PRIVATE_CODE) NvM_QueueDeferredReadJob(NvM_BlockIdType BlockId);
+#endif
+
 /**********************************************************************************************************************
  * NvM_UnQueueJob
  *********************************************************************************************************************/
@@ -109,9 +129,10 @@ extern FUNC(boolean, NVM_PRIVATE_CODE) NvM_QryNormalPrioJob(void);
  * NvM_ActGetNormalPrioJob
  *********************************************************************************************************************/
 /*! \brief Setups the NvM internal job variable for next job.
- *  \details Scans the given queue for the entry with highest priority, located nearest to the list end.
- *           The element is removed from the list, but stored in NvM_lastJobEntry. The job parameters will be copied
- *           to the passed job structure. The queue is expected to contain at least one element.
+ *  \details In case priority handling is enabled, the oldest entry of the highest non-empty priority level is taken.
+ *           The element is removed from the list, but stored in NvM_lastJobEntry. Otherwise the oldest entry of the
+ *           queue is taken and freed. The job parameters will be copied to the passed job structure.
+ *           The queue is expected to contain at least one element.
  *  \context TASK
  *  \reentrant FALSE
  *  \synchronous TRUE
@@ -162,6 +183,55 @@ extern FUNC(void, NVM_PRIVATE_CODE) NvM_ActGetHighPrioJob(void);
  *  \pre -
  */
 extern FUNC(void, NVM_PRIVATE_CODE) NvM_ActQueueFreeLastJob(void);
+
+/**********************************************************************************************************************
+ * NvM_QueueProcessAging
+ *********************************************************************************************************************/
+/*! \brief Advances the queue time base and promotes aged jobs.
+ *  \details Shall be called once per NvM_MainFunction cycle. If aging is configured, the oldest job of each priority
+ *           level which waited NVM_JOB_QUEUE_AGING_CYCLES in its level is moved to the next higher priority level.
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1 and priority handling is enabled
+ *  \pre -
+ */
+extern FUNC(void, NVM_PRIVATE_CODE) NvM_QueueProcessAging(void);
+
+/**********************************************************************************************************************
+ * NvM_QueuePromoteJob
+ *********************************************************************************************************************/
+/*! \brief Moves a queued normal priority job to the front of the queue.
+ *  \details If a job of the given service for the given block is queued in the normal priority queue, it is moved to the
+ *           highest priority level as its oldest element, i.e. it is the next normal priority job to be processed.
+ *           Jobs of any other service are left untouched.
+ *  \param[in] BlockId in range [1, (number of blocks - 1)].
+ *  \param[in] ServiceId as the request type of the job to promote.
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1 and priority handling is enabled
+ *  \pre -
+ */
+extern FUNC(void, NVM_PRIVATE_CODE) NvM_QueuePromoteJob(NvM_BlockIdType BlockId, NvM_InternalServiceIdType ServiceId);
+
+# if (NVM_QUEUE_STATISTICS_API == STD_ON)
+/**********************************************************************************************************************
+ * NvM_QueueGetStatistics
+ *********************************************************************************************************************/
+/*! \brief Copies the statistics of one priority level.
+ *  \details Copies the statistics of one priority level of the normal priority queue consistently.
+ *  \param[in] PrioLevel in range [0, (NVM_JOB_QUEUE_PRIO_LEVELS - 1)].
+ *  \param[out] StatisticsPtr to store the statistics to. Must not be NULL_PTR.
+ *  \context TASK
+ *  \reentrant FALSE
+ *  \synchronous TRUE
+ *  \config Configuration class is > 1, priority handling and queue statistics are enabled
+ *  \pre -
+ */
+extern FUNC(void, NVM_PRIVATE_CODE) NvM_QueueGetStatistics(uint8 PrioLevel,
+    P2VAR(NvM_QueueStatisticsType, AUTOMATIC, NVM_APPL_DATA) StatisticsPtr);
+# endif /* (NVM_QUEUE_STATISTICS_API == STD_ON) */
 #endif /* (NVM_JOB_PRIORISATION == STD_ON) */
 
 #define NVM_STOP_SEC_CODE
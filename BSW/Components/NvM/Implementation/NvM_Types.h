@@ -97,11 +97,47 @@ typedef uint16 NvM_BlockIdType; /*!< Type used to store a block identifier. User
 # define NVM_SERVICE_ID_REPAIR_REDUNDANT_BLOCKS (21u) /*!< Service ID NvM_RepairRedundantBlocks(). */
 # define NVM_SERVICE_ID_KILL_READ_ALL           (22u) /*!< Service ID NvM_KillReadAll(). */
 # define NVM_SERVICE_ID_PRE_READ_ALL            (23u) /*!< Service ID NvM_PreReadAll(). */
+# define NVM_SERVICE_ID_GET_QUEUE_STATISTICS    (24u) /*!< Service ID NvM_GetQueueStatistics(). */
+# define NVM_SERVICE_ID_RESTORE_DEFERRED_BLOCK  (25u) /*!< Service ID NvM_RestoreDeferredBlock(). */
+
+/* Configuration parameters of the prioritized job queue. Older generator versions do not provide them.
+ * The 256 block priorities are mapped to NVM_JOB_QUEUE_PRIO_LEVELS levels of equal width (32 priorities per level with
+ * the default of 8 levels). Jobs within one level are served in FIFO order, i.e. blocks with different priorities that
+ * fall into the same level are no longer ordered by their priority. Configure the block priorities accordingly. */
+#ifndef NVM_JOB_QUEUE_PRIO_LEVELS /* COV_NVM_COMPATIBILITY */
+# define NVM_JOB_QUEUE_PRIO_LEVELS              (8u)      /*!< Number of priority levels of the normal priority queue. */
+#endif
+#ifndef NVM_JOB_QUEUE_AGING_CYCLES /* COV_NVM_COMPATIBILITY */
+# define NVM_JOB_QUEUE_AGING_CYCLES             (0u)      /*!< MainFunction cycles until a queued job is promoted; 0: no aging. */
+#endif
+#ifndef NVM_QUEUE_STATISTICS_API /* COV_NVM_COMPATIBILITY */
+# define NVM_QUEUE_STATISTICS_API               STD_OFF   /*!< Enables NvM_GetQueueStatistics(). */
+#endif
+
+/* Deferred ReadAll: blocks flagged by SelectBlockForDeferredReadAllEnabled are restored in background after ReadAll. */
+#ifndef NVM_DEFERRED_READALL /* COV_NVM_COMPATIBILITY */
+# define NVM_DEFERRED_READALL                   STD_OFF
+#endif
+
+/* Data compression: blocks flagged by CompressionEnabled are stored run length encoded (see NvM_Compress.h). */
+#ifndef NVM_COMPRESSION /* COV_NVM_COMPATIBILITY */
+# define NVM_COMPRESSION                        STD_OFF
+#endif
 
 #ifndef Rte_TypeDef_NvM_ServiceIdType
 typedef uint8 NvM_ServiceIdType;   /*!< Type used to store a service identifier. */
 #endif
 
+typedef struct
+{
+    uint16 CurrentDepth;        /*!< Number of jobs currently waiting in the priority level. */
+    uint16 MaxDepth;            /*!< Maximum number of jobs waiting in the priority level at the same time. */
+    uint16 MaxWaitTime;         /*!< Longest wait time of a dequeued job, in NvM_MainFunction cycles. */
+    uint16 Promotions;          /*!< Number of jobs promoted into this priority level by aging. */
+    uint32 DequeuedJobs;        /*!< Number of jobs taken from this priority level for processing. */
+    uint32 AccumulatedWaitTime; /*!< Sum of the wait times of all dequeued jobs, in NvM_MainFunction cycles. */
+} NvM_QueueStatisticsType; /*!< Runtime statistics of one priority level of the NvM job queue. */
+
 /* Map the internal ServiceIds to user defined ServiceIds to be compatible to user implementations */
 
 /* These Service Ids will not be published via callbacks etc. (job end callbacks won't be called during WriteAll, etc.),
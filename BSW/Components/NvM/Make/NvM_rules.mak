@@ -31,6 +31,7 @@
 LIBRARIES_TO_BUILD      += NvM
 NvM_FILES                = NvM$(BSW_SRC_DIR)\NvM.c \
                            NvM$(BSW_SRC_DIR)\NvM_Act.c \
+                           NvM$(BSW_SRC_DIR)\NvM_Compress.c \
                            NvM$(BSW_SRC_DIR)\NvM_Crc.c \
                            NvM$(BSW_SRC_DIR)\NvM_JobProc.c \
                            NvM$(BSW_SRC_DIR)\NvM_Qry.c \
@@ -43,6 +44,7 @@ NvM_FILES                = NvM$(BSW_SRC_DIR)\NvM.c \
 # e.g.: CC_FILES_TO_BUILD       += drv\can_drv.c
 CC_FILES_TO_BUILD       += NvM$(BSW_SRC_DIR)\NvM.c \
                            NvM$(BSW_SRC_DIR)\NvM_Act.c \
+                           NvM$(BSW_SRC_DIR)\NvM_Compress.c \
                            NvM$(BSW_SRC_DIR)\NvM_Crc.c \
                            NvM$(BSW_SRC_DIR)\NvM_JobProc.c \
                            NvM$(BSW_SRC_DIR)\NvM_Qry.c \
@@ -81,6 +81,23 @@
 /* PartitionData array has always size == 1 for every partition. */
 # define SD_PARTITION_DATA_IDX 0u
 
+/* The Rx entry matching index is module global and therefore only available in single partition configurations. */
+#if (SD_RX_INDEX == STD_ON) && (SD_MULTI_PARTITION == STD_OFF)                                                          /* COV_SD_QM_FEATURE_MULTI_PARTITION */
+# define SD_RX_INDEX_ENABLED STD_ON
+#else
+# define SD_RX_INDEX_ENABLED STD_OFF
+#endif
+
+/* End of a hash chain of the Rx entry matching index. */
+#define SD_RX_INDEX_INV 0xFFFFu
+
+/* The state machine scheduling data is module global and therefore only available in single partition configurations. */
+#if (SD_STATE_SCHED == STD_ON) && (SD_MULTI_PARTITION == STD_OFF)                                                       /* COV_SD_QM_FEATURE_MULTI_PARTITION */
+# define SD_STATE_SCHED_ENABLED STD_ON
+#else
+# define SD_STATE_SCHED_ENABLED STD_OFF
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
  *********************************************************************************************************************/
@@ -114,9 +131,25 @@
 # define SdHookEnd_EventServer_Tx_ProcessPendingMessages()
 #endif /* SD_RUNTIME_MEASUREMENT_SUPPORT */
 
+/* Indication of an external event to the state machine scheduling. */
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+# define SD_STATE_SCHED_NOTIFY_EVENT()                         Sd_StateSched_NotifyEvent()
+#else
+# define SD_STATE_SCHED_NOTIFY_EVENT()
+#endif /* SD_STATE_SCHED_ENABLED */
+
 /**********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  *********************************************************************************************************************/
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+/* Scheduling data of a server or client state machine. */
+typedef struct
+{
+  Sd_ExtendedTimeType Wakeup;        /* Expiry of the timer the suspended state machine waits for. Invalid if the state
+                                        machine is not suspended. */
+  uint32              EventCounter;  /* Event counter at the time the state machine was suspended. */
+} Sd_StateSchedEntryType;
+#endif /* SD_STATE_SCHED_ENABLED */
 
 /**********************************************************************************************************************
  *  LOCAL DATA
@@ -139,6 +172,72 @@ SD_LOCAL VAR(boolean, SD_VAR_INIT) Sd_FirstInit = TRUE;
 #define SD_STOP_SEC_VAR_INIT_8
 #include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+# define SD_START_SEC_VAR_CLEARED_8
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Indication if servers/event handlers and clients/consumed eventgroups are matched by the Rx index. */
+SD_LOCAL VAR(boolean, SD_VAR_CLEARED) Sd_RxIndexServerActive = FALSE;
+SD_LOCAL VAR(boolean, SD_VAR_CLEARED) Sd_RxIndexClientActive = FALSE;
+
+# define SD_STOP_SEC_VAR_CLEARED_8
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+# define SD_START_SEC_VAR_NO_INIT_16
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Rx index hash chains: First element per hash bucket, and next element of the same bucket per element.
+ * Servers and clients are keyed by ServiceId, InstanceId and MajorVersion, event handlers and consumed eventgroups by
+ * their server or client and the EventgroupId. Chains are sorted by ascending element index. */
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexServerHead[SD_RX_INDEX_HASH_SIZE];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexServerNext[SD_RX_INDEX_SERVICE_NUM];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexClientHead[SD_RX_INDEX_HASH_SIZE];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexClientNext[SD_RX_INDEX_SERVICE_NUM];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexEventHandlerHead[SD_RX_INDEX_HASH_SIZE];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexEventHandlerNext[SD_RX_INDEX_EVENTGROUP_NUM];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexCegHead[SD_RX_INDEX_HASH_SIZE];
+SD_LOCAL VAR(uint16, SD_VAR_NO_INIT) Sd_RxIndexCegNext[SD_RX_INDEX_EVENTGROUP_NUM];
+
+# define SD_STOP_SEC_VAR_NO_INIT_16
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+#endif /* SD_RX_INDEX_ENABLED */
+
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+# define SD_START_SEC_VAR_CLEARED_8
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Indication if the state machines of an instance are currently processed by Sd_State_Process(). */
+SD_LOCAL VAR(boolean, SD_VAR_CLEARED) Sd_StateSchedActive = FALSE;
+
+# define SD_STOP_SEC_VAR_CLEARED_8
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+# define SD_START_SEC_VAR_CLEARED_32
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Counter of external events and of timers scheduled outside of the state machines. Incremented on each event. */
+SD_LOCAL VAR(uint32, SD_VAR_CLEARED) Sd_StateSchedEventCounter = 0u;
+
+/* Event counter at the start of the execution of the currently processed state machine. */
+SD_LOCAL VAR(uint32, SD_VAR_CLEARED) Sd_StateSchedRunEventCounter = 0u;
+
+# define SD_STOP_SEC_VAR_CLEARED_32
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+# define SD_START_SEC_VAR_NO_INIT_UNSPECIFIED
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Earliest timer scheduled by the currently processed state machine. */
+SD_LOCAL VAR(Sd_ExtendedTimeType, SD_VAR_NO_INIT) Sd_StateSchedRunWakeup;
+
+/* Scheduling data of the server and client state machines. */
+SD_LOCAL VAR(Sd_StateSchedEntryType, SD_VAR_NO_INIT) Sd_StateSchedServer[SD_STATE_SCHED_SERVICE_NUM];
+SD_LOCAL VAR(Sd_StateSchedEntryType, SD_VAR_NO_INIT) Sd_StateSchedClient[SD_STATE_SCHED_SERVICE_NUM];
+
+# define SD_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+# include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
+#endif /* SD_STATE_SCHED_ENABLED */
+
 #define SD_START_SEC_VAR_CLEARED_32
 #include "Sd_MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -305,6 +404,175 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_Init_Client(
 SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_Init_ClientCeg(
   Sd_PartitionConfigIdxType PartitionIdx);
 
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Init()
+ *********************************************************************************************************************/
+/*! \brief          Builds the Rx entry matching index of all servers, clients, event handlers and consumed eventgroups.
+ *  \details        The index of servers or clients is deactivated if the configured elements do not fit into it.
+ *  \param[in]      PartitionIdx            Index of partition.
+ *                                          [range: PartitionIdx < Sd_GetSizeOfPartitionIdentifiers()]
+ *  \pre            Instance IDs of servers and clients are initialized.
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(void, SD_CODE) Sd_RxIndex_Init(
+  Sd_PartitionConfigIdxType PartitionIdx);
+
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Hash()
+ *********************************************************************************************************************/
+/*! \brief          Calculates the hash bucket of an Rx index key.
+ *  \details        -
+ *  \param[in]      KeyA                    First part of the key.
+ *  \param[in]      KeyB                    Second part of the key.
+ *  \param[in]      KeyC                    Third part of the key.
+ *  \return         Hash bucket.            [range: < SD_RX_INDEX_HASH_SIZE]
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(uint16, SD_CODE) Sd_RxIndex_Hash(
+  uint16 KeyA,
+  uint16 KeyB,
+  uint16 KeyC);
+
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Insert()
+ *********************************************************************************************************************/
+/*! \brief          Inserts an element into a hash chain of an Rx index.
+ *  \details        The chain is kept sorted by ascending element index.
+ *  \param[in,out]  HeadPtr                 First elements of the hash buckets.
+ *  \param[in,out]  NextPtr                 Next elements of the hash chains.
+ *  \param[in]      Hash                    Hash bucket of the element.
+ *  \param[in]      Idx                     Element to insert.
+ *  \pre            The element is not part of any hash chain of the index.
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(void, SD_CODE) Sd_RxIndex_Insert(
+  SD_P2VAR(uint16) HeadPtr,
+  SD_P2VAR(uint16) NextPtr,
+  uint16 Hash,
+  uint16 Idx);
+
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Remove()
+ *********************************************************************************************************************/
+/*! \brief          Removes an element from a hash chain of an Rx index.
+ *  \details        Nothing is done if the element is not part of the chain.
+ *  \param[in,out]  HeadPtr                 First elements of the hash buckets.
+ *  \param[in,out]  NextPtr                 Next elements of the hash chains.
+ *  \param[in]      Hash                    Hash bucket of the element.
+ *  \param[in]      Idx                     Element to remove.
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(void, SD_CODE) Sd_RxIndex_Remove(
+  SD_P2VAR(uint16) HeadPtr,
+  SD_P2VAR(uint16) NextPtr,
+  uint16 Hash,
+  uint16 Idx);
+#endif /* SD_RX_INDEX_ENABLED */
+
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+/**********************************************************************************************************************
+ *  Sd_StateSched_Init()
+ *********************************************************************************************************************/
+/*! \brief          Initializes the scheduling data of all server and client state machines.
+ *  \details        -
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(void, SD_CODE) Sd_StateSched_Init(void);
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_NotifyEvent()
+ *********************************************************************************************************************/
+/*! \brief          Indicates an external event which may be relevant for suspended state machines.
+ *  \details        All suspended state machines are resumed at the next run of the state machines of their instance.
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_StateSched_NotifyEvent(void);
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_RegisterTimer()
+ *********************************************************************************************************************/
+/*! \brief          Registers a timer which triggers the execution of the state machines.
+ *  \details        During the execution of a state machine the timer is assigned to this state machine, otherwise it is
+ *                  handled like an external event.
+ *  \param[in]      Timer                   Timer which triggers the execution of the state machines.
+ *  \pre            Called within a critical section.
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_StateSched_RegisterTimer(
+  Sd_ExtendedTimeType Timer);
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_Resume()
+ *********************************************************************************************************************/
+/*! \brief          Checks if a suspended state machine has to be resumed.
+ *  \details        A suspended state machine is resumed if its timer expired or if an event occurred since it was
+ *                  suspended. Otherwise its timer is scheduled again for the instance.
+ *  \param[in,out]  EntryTablePtr           Scheduling data of all servers or of all clients.
+ *  \param[in]      EntryIdx                Index of the server or client.
+ *  \param[in]      InstanceIdx             Corresponding instance index.
+ *                                          [range: InstanceIdx < Sd_GetSizeOfInstance()]
+ *  \param[in]      PartitionIdx            Index of partition.
+ *                                          [range: PartitionIdx < Sd_GetSizeOfPartitionIdentifiers()]
+ *  \return         TRUE                    State machine is suspended and has to be resumed.
+ *  \return         FALSE                   State machine is not suspended or remains suspended.
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(boolean, SD_CODE) Sd_StateSched_Resume(
+  SD_P2VAR(Sd_StateSchedEntryType) EntryTablePtr,
+  uint16 EntryIdx,
+  Sd_SizeOfInstanceType InstanceIdx,
+  Sd_PartitionConfigIdxType PartitionIdx);
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_BeginRun()
+ *********************************************************************************************************************/
+/*! \brief          Prepares the scheduling data for the execution of a state machine.
+ *  \details        -
+ *  \param[in,out]  EntryTablePtr           Scheduling data of all servers or of all clients.
+ *  \param[in]      EntryIdx                Index of the server or client.
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(void, SD_CODE) Sd_StateSched_BeginRun(
+  SD_P2VAR(Sd_StateSchedEntryType) EntryTablePtr,
+  uint16 EntryIdx);
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_Suspend()
+ *********************************************************************************************************************/
+/*! \brief          Suspends a state machine after its execution if it only waits for one of its timers.
+ *  \details        The state machine is not suspended if no timer was scheduled during its execution, if an event
+ *                  occurred during its execution or if it is not covered by the scheduling data.
+ *  \param[in,out]  EntryTablePtr           Scheduling data of all servers or of all clients.
+ *  \param[in]      EntryIdx                Index of the server or client.
+ *  \param[in]      Requested               Indication if the state machine requested its execution again.
+ *  \return         TRUE                    State machine is suspended. Its execution request has to be cleared.
+ *  \return         FALSE                   State machine is not suspended.
+ *  \pre            Called within a critical section.
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(boolean, SD_CODE) Sd_StateSched_Suspend(
+  SD_P2VAR(Sd_StateSchedEntryType) EntryTablePtr,
+  uint16 EntryIdx,
+  boolean Requested);
+#endif /* SD_STATE_SCHED_ENABLED */
+
 /**********************************************************************************************************************
  *  Sd_CloseAllSocketsOfInstance()
  *********************************************************************************************************************/
@@ -756,6 +1024,25 @@ SD_LOCAL_INLINE FUNC(Sd_SizeOfEventHandlerType, SD_CODE) Sd_RxServer_SearchEvent
   uint16 IndexOfEntry,
   SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr);
 
+/**********************************************************************************************************************
+ *  Sd_RxServer_GetNextServer()
+ *********************************************************************************************************************/
+/*! \brief          Returns the next server to check for a received entry.
+ *  \details        Without index this is the subsequent server, with index the next server of the index bucket.
+ *  \param[in]      ServerIdx               Current server index.
+ *                                          [range: ServerIdx < Sd_GetSizeOfServer()]
+ *  \param[in]      ServerEndIdx            End of the checked server range.
+ *  \param[in]      UseIndex                TRUE if the servers of an index bucket are checked.
+ *  \return         Index of the next server, ServerEndIdx or larger if there is none.
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(Sd_SizeOfServerType, SD_CODE) Sd_RxServer_GetNextServer(
+  Sd_SizeOfServerType ServerIdx,
+  Sd_SizeOfServerType ServerEndIdx,
+  boolean UseIndex);
+
 /**********************************************************************************************************************
  *  Sd_RxServer_CheckConfigOptionByCbk()
  *********************************************************************************************************************/
@@ -2338,7 +2625,8 @@ SD_LOCAL_INLINE FUNC(Std_ReturnType, SD_CODE) Sd_StateClient_UpdateEventGroupAck
  *  Sd_StateClient_FindBestMatchLocalRemoteSoCon()
  *********************************************************************************************************************/
 /*! \brief          Searches for the socket connection with the best local and remote address match.
- *  \details        -
+ *  \details        The search is not covered by the best match cache of SoAd since it depends on the addresses
+ *                  configured for and offered to the consumed eventgroup.
  *  \param[in]      ConsumedEventgroupIdx   Corresponding consumed eventgroup index.
  *                                          [range: ConsumedEventgroupIdx < Sd_GetSizeOfConsumedEventgroup()]
  *  \param[in]      PartitionIdx            Index of partition.
@@ -2629,6 +2917,48 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntry(
   uint16 IndexOfEntry,
   SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr);
 
+/**********************************************************************************************************************
+ *  Sd_RxClient_ProcessEntryOfClient()
+ *********************************************************************************************************************/
+/*! \brief          Processes a received client entry for a client with matching InstanceId and MajorVersion.
+ *  \details        -
+ *  \param[in]      ClientIdx               Corresponding client index.
+ *                                          [range: ClientIdx < Sd_GetSizeOfClient()]
+ *  \param[in]      PartitionIdx            Index of partition.
+ *                                          [range: PartitionIdx < Sd_GetSizeOfPartitionIdentifiers()]
+ *  \param[in]      RxEntryType             Type of the received entry.
+ *  \param[in]      IndexOfEntry            Start index of the Entry-Option.
+ *  \param[in]      RxMessageInfoPtr        Information about the received message.
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntryOfClient(
+  Sd_SizeOfClientType ClientIdx,
+  Sd_PartitionConfigIdxType PartitionIdx,
+  Sd_EntryType RxEntryType,
+  uint16 IndexOfEntry,
+  SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr);
+
+/**********************************************************************************************************************
+ *  Sd_RxClient_GetNextClient()
+ *********************************************************************************************************************/
+/*! \brief          Returns the next client to check for a received entry.
+ *  \details        Without index this is the subsequent client, with index the next client of the index bucket.
+ *  \param[in]      ClientIdx               Current client index.
+ *                                          [range: ClientIdx < Sd_GetSizeOfClient()]
+ *  \param[in]      ClientEndIdx            End of the checked client range.
+ *  \param[in]      UseIndex                TRUE if the clients of an index bucket are checked.
+ *  \return         Index of the next client, ClientEndIdx or larger if there is none.
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(Sd_SizeOfClientType, SD_CODE) Sd_RxClient_GetNextClient(
+  Sd_SizeOfClientType ClientIdx,
+  Sd_SizeOfClientType ClientEndIdx,
+  boolean UseIndex);
+
 /**********************************************************************************************************************
  *  Sd_RxClient_ProcessEntryOffer()
  *********************************************************************************************************************/
@@ -2696,6 +3026,26 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntryAcknowledge(
   uint16 IndexOfEntry,
   SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr);
 
+/**********************************************************************************************************************
+ *  Sd_RxClient_SearchConsumedEventgroup()
+ *********************************************************************************************************************/
+/*! \brief          Searches the requested consumed eventgroup of a client with the matching ID.
+ *  \details        -
+ *  \param[in]      ClientIdx               Corresponding client index.
+ *                                          [range: ClientIdx < Sd_GetSizeOfClient()]
+ *  \param[in]      PartitionIdx            Index of partition.
+ *                                          [range: PartitionIdx < Sd_GetSizeOfPartitionIdentifiers()]
+ *  \param[in]      EventGroupId            Received EventgroupId.
+ *  \return         Index of the matching consumed eventgroup, Sd_GetSizeOfConsumedEventgroup() if there is none.
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL_INLINE FUNC(Sd_SizeOfConsumedEventgroupType, SD_CODE) Sd_RxClient_SearchConsumedEventgroup(
+  Sd_SizeOfClientType ClientIdx,
+  Sd_PartitionConfigIdxType PartitionIdx,
+  uint16 EventGroupId);
+
 /**********************************************************************************************************************
  *  Sd_RxClient_CheckConfigOptionByCbk()
  *********************************************************************************************************************/
@@ -3090,7 +3440,8 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_State_HandleRunMode(
  *  Sd_State_Process()
  *********************************************************************************************************************/
 /*! \brief          Processes all state machines of clients and servers.
- *  \details        State machines are only executed if the corresponding timer is exceeded.
+ *  \details        State machines are only executed if the corresponding timer is exceeded. State machines which only
+ *                  wait for one of their timers are suspended until this timer expires or an event occurs.
  *  \param[in]      InstanceIdx             Index of instance to process.
  *                                          [range: InstanceIdx < Sd_GetSizeOfInstance()]
  *  \param[in]      PartitionIdx            Index of partition.
@@ -3331,7 +3682,8 @@ SD_LOCAL FUNC(void, SD_CODE) Sd_Tx_CheckAndRestartRetry(
  *  Sd_Tx_SerializeMessage()
  *********************************************************************************************************************/
 /*! \brief          Serializes pending entries to a single SD message and triggers the transmission.
- *  \details        -
+ *  \details        The space reserved for the entries array is adapted during serialization, so that the payload is
+ *                  filled with as many entries and options as possible.
  *  \param[in]      InstanceIdx             Index of instance which triggers transmission.
  *                                          [range: InstanceIdx < Sd_GetSizeOfInstance()]
  *  \param[in]      PartitionIdx            Index of partition.
@@ -3365,6 +3717,26 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_Tx_SerializeHeader(
   Sd_SizeOfAddressStorageType AddressStorageIdx,
   Sd_PartitionConfigIdxType PartitionIdx);
 
+/**********************************************************************************************************************
+ *  Sd_Tx_MoveOptionsArray()
+ *********************************************************************************************************************/
+/*! \brief          Moves the already serialized options array within the payload.
+ *  \details        Used to enlarge or to shrink the space reserved for the entries array in front of the options.
+ *  \param[in]      PartitionIdx            Index of partition.
+ *                                          [range: PartitionIdx < Sd_GetSizeOfPartitionIdentifiers()]
+ *  \param[in,out]  OptionArrayInfoPtr      Information about the options array. Start and end index are updated.
+ *  \param[in]      NewArrayStartIdx        New start index of the options array.
+ *                                          [range: NewArrayStartIdx + (ArrayEndIdx - ArrayStartIdx) <=
+ *                                                  Sd_GetSizeOfPayload()]
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *********************************************************************************************************************/
+SD_LOCAL FUNC(void, SD_CODE) Sd_Tx_MoveOptionsArray(
+  Sd_PartitionConfigIdxType PartitionIdx,
+  SD_P2VAR(Sd_OptionArrayInfoType) OptionArrayInfoPtr,
+  uint16 NewArrayStartIdx);
+
 /**********************************************************************************************************************
  *  Sd_Tx_SerializeRelatedOptions()
  *********************************************************************************************************************/
@@ -4807,6 +5179,16 @@ FUNC(void, SD_CODE) Sd_Init(
         /* #60 Initialize client data. */
         Sd_Init_Client(partitionIdx);
 
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+        /* #65 Build the index to match received entries. */
+        Sd_RxIndex_Init(partitionIdx);
+#endif
+
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+        /* #66 Initialize the state machine scheduling. */
+        Sd_StateSched_Init();
+#endif
+
         /* #70 Set the state to initialized. */
         Sd_SetInitializedOfPartitionDataDyn(SD_PARTITION_DATA_IDX, SD_STATE_PARTITION_INIT, partitionIdx);              /* SBSW_SD_PARTITION_DATA_CSL05 */
       }
@@ -5090,6 +5472,9 @@ FUNC(void, SD_CODE) Sd_RxIndication(
     SoAd_SoConIdType rxSoConId = 0u;
     Sd_RxMessageInfoType messageInfo = { 0u };
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     messageInfo.PduInfoPtr = PduInfoPtr;
 
     /* #20 Check whether message was received by unicast or multicast PDU. */
@@ -5173,6 +5558,9 @@ FUNC(void, SD_CODE) Sd_LocalIpAddrAssignmentChg(
 #endif
   {
     /* ----- Implementation ----------------------------------------------- */
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #20 Check if SoConId is valid. */
     if ((SoConId < Sd_GetSizeOfTxSoConIdMap()) && (Sd_IsInvalidHndOfTxSoConIdMap(SoConId) == FALSE))
     {
@@ -5271,6 +5659,9 @@ FUNC(void, SD_CODE) Sd_SoConModeChg(
 #endif
   {
     /* ----- Implementation ----------------------------------------------- */
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #20 Check if SoConId is valid. */
     if ((SoConId < Sd_GetSizeOfSoConModeIdMap()) && (Sd_IsInvalidHndOfSoConModeIdMap(SoConId) == FALSE))
     {
@@ -5351,6 +5742,9 @@ FUNC(Std_ReturnType, SD_CODE) Sd_ServerServiceSetState(
     const Sd_PartitionConfigIdxType partitionIdx =
       Sd_GetPartitionSpecificServerPartitionIdxOfServerIdMap(ServerServiceHandleId);
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #20 Verify that server is not member of any service group. */
     if(Sd_IsServiceGroupMemberOfServer(serverIdx, partitionIdx) == FALSE)
     {
@@ -5452,6 +5846,9 @@ FUNC(Std_ReturnType, SD_CODE) Sd_ClientServiceSetState(
     const Sd_PartitionConfigIdxType partitionIdx =
       Sd_GetPartitionSpecificClientPartitionIdxOfClientIdMap(ClientServiceHandleId);
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #20 Verify that client is not member of any service group. */
     if(Sd_IsServiceGroupMemberOfClient(clientIdx, partitionIdx) == FALSE)
     {
@@ -5537,8 +5934,25 @@ FUNC(Std_ReturnType, SD_CODE) Sd_ServerServiceSetInstanceId(
     const Sd_PartitionConfigIdxType partitionIdx =
       Sd_GetPartitionSpecificServerPartitionIdxOfServerIdMap(ServerServiceHandleId);
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #20 Set ServerServiceInstanceId. */
     SD_BEGIN_CRITICAL_SECTION();
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+    /* #200 Move the server to the index bucket of the new InstanceId. */
+    if(Sd_RxIndexServerActive == TRUE)
+    {
+      Sd_RxIndex_Remove(Sd_RxIndexServerHead, Sd_RxIndexServerNext,
+        Sd_RxIndex_Hash(Sd_GetServiceIdOfServer(serverIdx, partitionIdx),
+          Sd_GetInstanceIdOfServerDyn(serverIdx, partitionIdx), Sd_GetMajorVersionOfServer(serverIdx, partitionIdx)),
+        (uint16)serverIdx);                                                                                             /* SBSW_SD_REFERENCE_OF_VARIABLE */
+      Sd_RxIndex_Insert(Sd_RxIndexServerHead, Sd_RxIndexServerNext,
+        Sd_RxIndex_Hash(Sd_GetServiceIdOfServer(serverIdx, partitionIdx),
+          ServerServiceInstanceId, Sd_GetMajorVersionOfServer(serverIdx, partitionIdx)),
+        (uint16)serverIdx);                                                                                             /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    }
+#endif
     Sd_SetInstanceIdOfServerDyn(serverIdx, ServerServiceInstanceId, partitionIdx);                                      /* SBSW_SD_CSL03_CSL05 */
     SD_END_CRITICAL_SECTION();
 
@@ -5609,8 +6023,25 @@ FUNC(Std_ReturnType, SD_CODE) Sd_ClientServiceSetInstanceId(
     const Sd_PartitionConfigIdxType partitionIdx =
       Sd_GetPartitionSpecificClientPartitionIdxOfClientIdMap(ClientServiceHandleId);
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #20 Set ClientServiceInstanceId. */
     SD_BEGIN_CRITICAL_SECTION();
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+    /* #200 Move the client to the index bucket of the new InstanceId. */
+    if(Sd_RxIndexClientActive == TRUE)
+    {
+      Sd_RxIndex_Remove(Sd_RxIndexClientHead, Sd_RxIndexClientNext,
+        Sd_RxIndex_Hash(Sd_GetServiceIdOfClient(clientIdx, partitionIdx),
+          Sd_GetInstanceIdOfClientDyn(clientIdx, partitionIdx), Sd_GetMajorVersionOfClient(clientIdx, partitionIdx)),
+        (uint16)clientIdx);                                                                                             /* SBSW_SD_REFERENCE_OF_VARIABLE */
+      Sd_RxIndex_Insert(Sd_RxIndexClientHead, Sd_RxIndexClientNext,
+        Sd_RxIndex_Hash(Sd_GetServiceIdOfClient(clientIdx, partitionIdx),
+          ClientServiceInstanceId, Sd_GetMajorVersionOfClient(clientIdx, partitionIdx)),
+        (uint16)clientIdx);                                                                                             /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    }
+#endif
     Sd_SetInstanceIdOfClientDyn(clientIdx, ClientServiceInstanceId, partitionIdx);                                      /* SBSW_SD_CSL03_CSL05 */
     SD_END_CRITICAL_SECTION();
 
@@ -5679,8 +6110,12 @@ FUNC(void, SD_CODE) Sd_ServiceGroupStart(
     const Sd_PartitionConfigIdxType partitionIdx =
       Sd_GetPartitionSpecificServiceGroupPartitionIdxOfServiceGroupIdMap(ServiceGroupHandleId);
 
-    /* #20 Iterate over all members of the service group. */
     Sd_ServiceGroupMemberIterType memberIdx;
+
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
+    /* #20 Iterate over all members of the service group. */
     for(memberIdx = Sd_GetServiceGroupMemberStartIdxOfServiceGroup(serviceGroupIdx, partitionIdx);
         memberIdx < Sd_GetServiceGroupMemberEndIdxOfServiceGroup(serviceGroupIdx, partitionIdx);
         memberIdx++)
@@ -5762,9 +6197,12 @@ FUNC(void, SD_CODE) Sd_ServiceGroupStop(
     const Sd_PartitionConfigIdxType partitionIdx =
       Sd_GetPartitionSpecificServiceGroupPartitionIdxOfServiceGroupIdMap(ServiceGroupHandleId);
 
-    /* #20 Iterate over all members of the service group. */
     Sd_ServiceGroupMemberIterType memberIdx;
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
+    /* #20 Iterate over all members of the service group. */
     for(memberIdx = Sd_GetServiceGroupMemberStartIdxOfServiceGroup(serviceGroupIdx, partitionIdx);
         memberIdx < Sd_GetServiceGroupMemberEndIdxOfServiceGroup(serviceGroupIdx, partitionIdx);
         memberIdx++)
@@ -5875,6 +6313,9 @@ FUNC(Std_ReturnType, SD_CODE) Sd_ConsumedEventGroupSetState(
       Sd_GetPartitionSpecificConsumedEventgroupPartitionIdxOfConsumedEventgroupIdMap(ConsumedEventGroupHandleId);
     const Sd_SizeOfClientType clientIdx = Sd_GetClientIdxOfConsumedEventgroup(consumedEventgroupIdx, partitionIdx);
 
+    /* #15 Indicate the event to the state machine scheduling. */
+    SD_STATE_SCHED_NOTIFY_EVENT();
+
     /* #30 Check if the consumed eventgroup is requested while the corresponding client service instance is not
      *     requested. */
     if((ConsumedEventGroupState == SD_CONSUMED_EVENTGROUP_REQUESTED) &&
@@ -6530,6 +6971,347 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_Init_ClientCeg(
   }
 }
 
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Init()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+SD_LOCAL FUNC(void, SD_CODE) Sd_RxIndex_Init(
+  Sd_PartitionConfigIdxType PartitionIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint16_least hashIdx;
+  Sd_ServerIterType serverIdx;
+  Sd_SizeOfClientType clientIdx;
+  Sd_EventHandlerIterType eventHandlerIdx;
+  Sd_ConsumedEventgroupIterType consumedEventgroupIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Clear all hash buckets. */
+  for(hashIdx = 0u; hashIdx < SD_RX_INDEX_HASH_SIZE; hashIdx++)
+  {
+    Sd_RxIndexServerHead[hashIdx] = SD_RX_INDEX_INV;
+    Sd_RxIndexClientHead[hashIdx] = SD_RX_INDEX_INV;
+    Sd_RxIndexEventHandlerHead[hashIdx] = SD_RX_INDEX_INV;
+    Sd_RxIndexCegHead[hashIdx] = SD_RX_INDEX_INV;
+  }
+
+  /* #20 Index the servers and their event handlers if they fit into the index. */
+  Sd_RxIndexServerActive = (boolean)((Sd_GetSizeOfServer(PartitionIdx) <= SD_RX_INDEX_SERVICE_NUM) &&
+    (Sd_GetSizeOfEventHandler(PartitionIdx) <= SD_RX_INDEX_EVENTGROUP_NUM));
+
+  if(Sd_RxIndexServerActive == TRUE)
+  {
+    for(serverIdx = 0u; serverIdx < Sd_GetSizeOfServer(PartitionIdx); serverIdx++)
+    {
+      Sd_RxIndex_Insert(Sd_RxIndexServerHead, Sd_RxIndexServerNext,
+        Sd_RxIndex_Hash(Sd_GetServiceIdOfServer(serverIdx, PartitionIdx),
+          Sd_GetInstanceIdOfServerDyn(serverIdx, PartitionIdx), Sd_GetMajorVersionOfServer(serverIdx, PartitionIdx)),
+        (uint16)serverIdx);                                                                                             /* SBSW_SD_REFERENCE_OF_VARIABLE */
+
+      for(eventHandlerIdx = Sd_GetEventHandlerStartIdxOfServer(serverIdx, PartitionIdx);
+          eventHandlerIdx < Sd_GetEventHandlerEndIdxOfServer(serverIdx, PartitionIdx);
+          eventHandlerIdx++)
+      {
+        Sd_RxIndex_Insert(Sd_RxIndexEventHandlerHead, Sd_RxIndexEventHandlerNext,
+          Sd_RxIndex_Hash((uint16)serverIdx, Sd_GetEventGroupIdOfEventHandler(eventHandlerIdx, PartitionIdx), 0u),
+          (uint16)eventHandlerIdx);                                                                                     /* SBSW_SD_REFERENCE_OF_VARIABLE */
+      }
+    }
+  }
+
+  /* #30 Index the clients and their consumed eventgroups if they fit into the index. */
+  Sd_RxIndexClientActive = (boolean)((Sd_GetSizeOfClient(PartitionIdx) <= SD_RX_INDEX_SERVICE_NUM) &&
+    (Sd_GetSizeOfConsumedEventgroup(PartitionIdx) <= SD_RX_INDEX_EVENTGROUP_NUM));
+
+  if(Sd_RxIndexClientActive == TRUE)
+  {
+    for(clientIdx = 0u; clientIdx < Sd_GetSizeOfClient(PartitionIdx); clientIdx++)
+    {
+      Sd_RxIndex_Insert(Sd_RxIndexClientHead, Sd_RxIndexClientNext,
+        Sd_RxIndex_Hash(Sd_GetServiceIdOfClient(clientIdx, PartitionIdx),
+          Sd_GetInstanceIdOfClientDyn(clientIdx, PartitionIdx), Sd_GetMajorVersionOfClient(clientIdx, PartitionIdx)),
+        (uint16)clientIdx);                                                                                             /* SBSW_SD_REFERENCE_OF_VARIABLE */
+
+      for(consumedEventgroupIdx = Sd_GetConsumedEventgroupStartIdxOfClient(clientIdx, PartitionIdx);
+          consumedEventgroupIdx < Sd_GetConsumedEventgroupEndIdxOfClient(clientIdx, PartitionIdx);
+          consumedEventgroupIdx++)
+      {
+        Sd_RxIndex_Insert(Sd_RxIndexCegHead, Sd_RxIndexCegNext,
+          Sd_RxIndex_Hash((uint16)clientIdx, Sd_GetEventGroupIdOfConsumedEventgroup(consumedEventgroupIdx, PartitionIdx),
+            0u),
+          (uint16)consumedEventgroupIdx);                                                                               /* SBSW_SD_REFERENCE_OF_VARIABLE */
+      }
+    }
+  }
+}
+
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Hash()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SD_LOCAL_INLINE FUNC(uint16, SD_CODE) Sd_RxIndex_Hash(
+  uint16 KeyA,
+  uint16 KeyB,
+  uint16 KeyC)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 hash = ((((uint32)KeyA * 31u) + (uint32)KeyB) * 31u) + (uint32)KeyC;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Fold the upper bits into the bucket bits. */
+  hash ^= (hash >> 7u) ^ (hash >> 15u);
+
+  return (uint16)(hash & (SD_RX_INDEX_HASH_SIZE - 1u));
+}
+
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Insert()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SD_LOCAL FUNC(void, SD_CODE) Sd_RxIndex_Insert(
+  SD_P2VAR(uint16) HeadPtr,
+  SD_P2VAR(uint16) NextPtr,
+  uint16 Hash,
+  uint16 Idx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  SD_P2VAR(uint16) linkPtr = &HeadPtr[Hash];
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Skip all elements of the chain with a lower index. */
+  while((*linkPtr != SD_RX_INDEX_INV) && (*linkPtr < Idx))
+  {
+    linkPtr = &NextPtr[*linkPtr];
+  }
+
+  /* #20 Link the element in front of the first element with a higher index. */
+  NextPtr[Idx] = *linkPtr;                                                                                              /* SBSW_SD_POINTER_WRITE */
+  *linkPtr = Idx;                                                                                                       /* SBSW_SD_POINTER_WRITE */
+}
+
+/**********************************************************************************************************************
+ *  Sd_RxIndex_Remove()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SD_LOCAL FUNC(void, SD_CODE) Sd_RxIndex_Remove(
+  SD_P2VAR(uint16) HeadPtr,
+  SD_P2VAR(uint16) NextPtr,
+  uint16 Hash,
+  uint16 Idx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  SD_P2VAR(uint16) linkPtr = &HeadPtr[Hash];
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Search the link to the element. */
+  while((*linkPtr != SD_RX_INDEX_INV) && (*linkPtr != Idx))
+  {
+    linkPtr = &NextPtr[*linkPtr];
+  }
+
+  /* #20 Unlink the element if it was found. */
+  if(*linkPtr == Idx)
+  {
+    *linkPtr = NextPtr[Idx];                                                                                            /* SBSW_SD_POINTER_WRITE */
+  }
+}
+#endif /* SD_RX_INDEX_ENABLED */
+
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+/**********************************************************************************************************************
+ *  Sd_StateSched_Init()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL FUNC(void, SD_CODE) Sd_StateSched_Init(void)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint16_least entryIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Mark all state machines as not suspended. */
+  for(entryIdx = 0u; entryIdx < SD_STATE_SCHED_SERVICE_NUM; entryIdx++)
+  {
+    Sd_Util_ResetTimerToInvalid(&Sd_StateSchedServer[entryIdx].Wakeup);                                                 /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    Sd_Util_ResetTimerToInvalid(&Sd_StateSchedClient[entryIdx].Wakeup);                                                 /* SBSW_SD_REFERENCE_OF_VARIABLE */
+  }
+
+  /* #20 No state machine is executed and no wakeup of a running state machine is registered. */
+  Sd_StateSchedActive = FALSE;
+  Sd_Util_ResetTimerToInvalid(&Sd_StateSchedRunWakeup);                                                                 /* SBSW_SD_REFERENCE_OF_VARIABLE */
+}
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_NotifyEvent()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ */
+SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_StateSched_NotifyEvent(void)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Increment the event counter. */
+  SD_BEGIN_CRITICAL_SECTION();
+  Sd_StateSchedEventCounter++;
+  SD_END_CRITICAL_SECTION();
+}
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_RegisterTimer()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_StateSched_RegisterTimer(
+  Sd_ExtendedTimeType Timer)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Assign the timer to the currently executed state machine if it expires earlier than its other timers. */
+  if(Sd_StateSchedActive == TRUE)
+  {
+    if(Sd_Util_CheckIfTimerExceededInt(Sd_StateSchedRunWakeup, Timer, FALSE) == TRUE)
+    {
+      Sd_StateSchedRunWakeup = Timer;
+    }
+  }
+  /* #20 Otherwise, handle a valid timer like an external event, the state machine which waits for it is unknown. */
+  else if(!Sd_CheckIfTimerIsInvalid(Timer))
+  {
+    Sd_StateSchedEventCounter++;
+  }
+  else
+  {
+    /* Invalid timer. Nothing to do. */
+  }
+}
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_Resume()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+SD_LOCAL FUNC(boolean, SD_CODE) Sd_StateSched_Resume(
+  SD_P2VAR(Sd_StateSchedEntryType) EntryTablePtr,
+  uint16 EntryIdx,
+  Sd_SizeOfInstanceType InstanceIdx,
+  Sd_PartitionConfigIdxType PartitionIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  boolean resume = FALSE;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if the state machine is suspended. */
+  if((EntryIdx < SD_STATE_SCHED_SERVICE_NUM) && (!Sd_CheckIfTimerIsInvalid(EntryTablePtr[EntryIdx].Wakeup)))
+  {
+    /* #100 Resume the state machine if an event occurred since it was suspended or if its timer expired. */
+    if((EntryTablePtr[EntryIdx].EventCounter != Sd_StateSchedEventCounter) ||
+       (Sd_Util_CheckIfTimerExceeded(PartitionIdx, EntryTablePtr[EntryIdx].Wakeup, TRUE) == TRUE))
+    {
+      Sd_Util_ResetTimerToInvalid(&EntryTablePtr[EntryIdx].Wakeup);                                                     /* SBSW_SD_POINTER_WRITE */
+      resume = TRUE;
+    }
+    /* #101 Otherwise, schedule the next run of the state machines of the instance for the timer again. */
+    else
+    {
+      Sd_Util_SetNextStateMachineRun(InstanceIdx, PartitionIdx, EntryTablePtr[EntryIdx].Wakeup);
+    }
+  }
+
+  return resume;
+}
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_BeginRun()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL FUNC(void, SD_CODE) Sd_StateSched_BeginRun(
+  SD_P2VAR(Sd_StateSchedEntryType) EntryTablePtr,
+  uint16 EntryIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 The executed state machine is not suspended anymore. */
+  if(EntryIdx < SD_STATE_SCHED_SERVICE_NUM)
+  {
+    Sd_Util_ResetTimerToInvalid(&EntryTablePtr[EntryIdx].Wakeup);                                                       /* SBSW_SD_POINTER_WRITE */
+  }
+
+  /* #20 Reset the timer of the execution and store the current event counter. */
+  SD_BEGIN_CRITICAL_SECTION();
+  Sd_StateSchedRunWakeup.Seconds = SD_INV_TIMER_VALUE_32BIT;
+  Sd_StateSchedRunWakeup.Milliseconds = SD_INV_TIMER_VALUE_16BIT;
+  Sd_StateSchedRunEventCounter = Sd_StateSchedEventCounter;
+  SD_END_CRITICAL_SECTION();
+}
+
+/**********************************************************************************************************************
+ *  Sd_StateSched_Suspend()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL FUNC(boolean, SD_CODE) Sd_StateSched_Suspend(
+  SD_P2VAR(Sd_StateSchedEntryType) EntryTablePtr,
+  uint16 EntryIdx,
+  boolean Requested)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  boolean suspend = FALSE;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Suspend the state machine if it requested its execution again, scheduled a timer and no event occurred. */
+  if((Requested == TRUE) && (EntryIdx < SD_STATE_SCHED_SERVICE_NUM) &&
+     (!Sd_CheckIfTimerIsInvalid(Sd_StateSchedRunWakeup)) &&
+     (Sd_StateSchedRunEventCounter == Sd_StateSchedEventCounter))
+  {
+    EntryTablePtr[EntryIdx].Wakeup = Sd_StateSchedRunWakeup;                                                            /* SBSW_SD_POINTER_WRITE */
+    EntryTablePtr[EntryIdx].EventCounter = Sd_StateSchedEventCounter;                                                   /* SBSW_SD_POINTER_WRITE */
+    suspend = TRUE;
+  }
+
+  return suspend;
+}
+#endif /* SD_STATE_SCHED_ENABLED */
+
 /**********************************************************************************************************************
  *  Sd_CloseAllSocketsOfInstance()
  *********************************************************************************************************************/
@@ -7610,8 +8392,9 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxServer_ProcessEntry(
   SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Sd_SizeOfServerType serverIdx;
+  Sd_SizeOfServerType serverIdx, firstServerIdx;
   uint16 serverStartIdx, serverEndIdx;
+  boolean useIndex = FALSE;
   Sd_EntryType rxEntryType;
   uint16 rxServiceId;
   uint16 rxInstanceId;
@@ -7648,17 +8431,36 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxServer_ProcessEntry(
     /* #320 Received FindService entry with wildcard ServiceId. Process all servers of the instance. */
   }
 
+  /* #35 Start with the first server of the ServiceId. If the entry contains no wildcard, only the servers of the index
+   *     bucket of the entry are checked instead. */
+  firstServerIdx = (Sd_SizeOfServerType)serverStartIdx;
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+  if((Sd_RxIndexServerActive == TRUE) &&
+     (rxServiceId != SD_ENTRY_WILDCARD_SERVICE_ID) &&
+     (rxInstanceId != SD_ENTRY_WILDCARD_INSTANCE_ID) &&
+     (rxMajorVersion != SD_ENTRY_WILDCARD_MAJOR_VERSION))
+  {
+    uint16 headIdx = Sd_RxIndexServerHead[Sd_RxIndex_Hash(rxServiceId, rxInstanceId, rxMajorVersion)];
+
+    firstServerIdx = (headIdx == SD_RX_INDEX_INV) ? (Sd_SizeOfServerType)serverEndIdx : (Sd_SizeOfServerType)headIdx;
+    useIndex = TRUE;
+  }
+#endif
+
   /* #40 Differentiate between entry types. */
   if(rxEntryType == SD_ENTRY_FIND_SERVICE)
   {
     /* #400 For FindService entries: Iterate over all matching servers to find the one corresponding to the entry. */
-    for(serverIdx = (Sd_SizeOfServerType)serverStartIdx; serverIdx < (Sd_SizeOfServerType)serverEndIdx; serverIdx++)
-    {
-      SD_GET_UINT32(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY1_MINORVERSION_OFFSET, rxMinorVersion);
+    SD_GET_UINT32(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY1_MINORVERSION_OFFSET, rxMinorVersion);
 
+    for(serverIdx = firstServerIdx;
+        serverIdx < (Sd_SizeOfServerType)serverEndIdx;
+        serverIdx = Sd_RxServer_GetNextServer(serverIdx, (Sd_SizeOfServerType)serverEndIdx, useIndex))
+    {
       /* #4000 Check if the InstanceId, MajorVersion and MinorVersion matches.
        *       Wildcards are allowed for FindService entries (format type 1). */
-      if(((rxInstanceId == Sd_GetInstanceIdOfServerDyn(serverIdx, PartitionIdx)) ||
+      if((serverIdx >= (Sd_SizeOfServerType)serverStartIdx) &&
+         ((rxInstanceId == Sd_GetInstanceIdOfServerDyn(serverIdx, PartitionIdx)) ||
             (rxInstanceId == SD_ENTRY_WILDCARD_INSTANCE_ID)) &&
          ((rxMajorVersion == Sd_GetMajorVersionOfServer(serverIdx, PartitionIdx)) ||
             (rxMajorVersion == SD_ENTRY_WILDCARD_MAJOR_VERSION)) &&
@@ -7673,11 +8475,14 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxServer_ProcessEntry(
   else
   {
     /* #410 For (Stop)SubscribeEventgroup entries: Iterate over all matching servers to find the one corresponding to the entry. */
-    for(serverIdx = (Sd_SizeOfServerType)serverStartIdx; serverIdx < (Sd_SizeOfServerType)serverEndIdx; serverIdx++)
+    for(serverIdx = firstServerIdx;
+        serverIdx < (Sd_SizeOfServerType)serverEndIdx;
+        serverIdx = Sd_RxServer_GetNextServer(serverIdx, (Sd_SizeOfServerType)serverEndIdx, useIndex))
     {
       /* #4100 Check if the InstanceId, MajorVersion and MinorVersion matches.
        *       Wildcards are not allowed for (Stop)SubscribeEventgroup entries (format type 2). */
-      if((rxInstanceId == Sd_GetInstanceIdOfServerDyn(serverIdx, PartitionIdx)) &&
+      if((serverIdx >= (Sd_SizeOfServerType)serverStartIdx) &&
+         (rxInstanceId == Sd_GetInstanceIdOfServerDyn(serverIdx, PartitionIdx)) &&
          (rxMajorVersion == Sd_GetMajorVersionOfServer(serverIdx, PartitionIdx)))
       {
         /* #41000 Found the corresponding service instance. */
@@ -7700,11 +8505,43 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxServer_ProcessEntry(
       SD_GET_UINT16(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY2_RESERVEDCOUNTER_OFFSET, rxReservedField);
       SD_GET_UINT16(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY2_EVENTGROUPID_OFFSET, rxEventGroupId);
 
-      Sd_Util_AddEventGroupNackEntryToList(InstanceIdx, PartitionIdx, Sd_GetSizeOfServer(PartitionIdx), rxServiceId,
-        rxInstanceId, rxMajorVersion, rxReservedField, rxEventGroupId, RxMessageInfoPtr->AddressStorageIdx,
-        Sd_GetSizeOfServerTimer(PartitionIdx));
-    }
+      Sd_Util_AddEventGroupNackEntryToList(InstanceIdx, PartitionIdx, Sd_GetSizeOfServer(PartitionIdx), rxServiceId,
+        rxInstanceId, rxMajorVersion, rxReservedField, rxEventGroupId, RxMessageInfoPtr->AddressStorageIdx,
+        Sd_GetSizeOfServerTimer(PartitionIdx));
+    }
+  }
+}
+
+/**********************************************************************************************************************
+ *  Sd_RxServer_GetNextServer()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SD_LOCAL_INLINE FUNC(Sd_SizeOfServerType, SD_CODE) Sd_RxServer_GetNextServer(
+  Sd_SizeOfServerType ServerIdx,
+  Sd_SizeOfServerType ServerEndIdx,
+  boolean UseIndex)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Sd_SizeOfServerType nextServerIdx = ServerIdx + 1u;
+
+  /* ----- Implementation ----------------------------------------------- */
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+  /* #10 Follow the hash chain if the index is used. The chain is sorted, so it ends at the end of the range. */
+  if(UseIndex == TRUE)
+  {
+    nextServerIdx = (Sd_RxIndexServerNext[ServerIdx] == SD_RX_INDEX_INV) ?
+      ServerEndIdx : (Sd_SizeOfServerType)Sd_RxIndexServerNext[ServerIdx];
   }
+#else
+  SD_DUMMY_STATEMENT(ServerEndIdx); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+  SD_DUMMY_STATEMENT(UseIndex); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+#endif
+
+  return nextServerIdx;
 }
 
 /**********************************************************************************************************************
@@ -7995,20 +8832,46 @@ SD_LOCAL_INLINE FUNC(Sd_SizeOfEventHandlerType, SD_CODE) Sd_RxServer_SearchEvent
   /* #10 Read the eventgroup ID from the SD header. */
   SD_GET_UINT16(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY2_EVENTGROUPID_OFFSET, rxEventGroupId);
 
-  /* #20 Iterate trough each event handler to find the corresponding one. */
-  for(eventHandlerIdx = Sd_GetEventHandlerStartIdxOfServer(ServerIdx, PartitionIdx);
-      eventHandlerIdx < Sd_GetEventHandlerEndIdxOfServer(ServerIdx, PartitionIdx);
-      eventHandlerIdx++)
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+  if(Sd_RxIndexServerActive == TRUE)
   {
-    if(Sd_GetEventGroupIdOfEventHandler(eventHandlerIdx, PartitionIdx) == rxEventGroupId)
+    uint16 indexIdx = Sd_RxIndexEventHandlerHead[Sd_RxIndex_Hash((uint16)ServerIdx, rxEventGroupId, 0u)];
+
+    /* #20 Walk the index bucket of server and eventgroup to find the corresponding event handler. */
+    while(indexIdx != SD_RX_INDEX_INV)
     {
-      /* #200 Found the corresponding event handler. Stop searching. */
-      foundEventHandler = TRUE;
-      break;
+      eventHandlerIdx = (Sd_SizeOfEventHandlerType)indexIdx;
+
+      if((eventHandlerIdx >= Sd_GetEventHandlerStartIdxOfServer(ServerIdx, PartitionIdx)) &&
+         (eventHandlerIdx < Sd_GetEventHandlerEndIdxOfServer(ServerIdx, PartitionIdx)) &&
+         (Sd_GetEventGroupIdOfEventHandler(eventHandlerIdx, PartitionIdx) == rxEventGroupId))
+      {
+        /* #200 Found the corresponding event handler. Stop searching. */
+        foundEventHandler = TRUE;
+        break;
+      }
+
+      indexIdx = Sd_RxIndexEventHandlerNext[indexIdx];
+    }
+  }
+  else
+#endif
+  {
+    /* #30 Otherwise, iterate trough each event handler to find the corresponding one. */
+    for(eventHandlerIdx = Sd_GetEventHandlerStartIdxOfServer(ServerIdx, PartitionIdx);
+        eventHandlerIdx < Sd_GetEventHandlerEndIdxOfServer(ServerIdx, PartitionIdx);
+        eventHandlerIdx++)
+    {
+      if(Sd_GetEventGroupIdOfEventHandler(eventHandlerIdx, PartitionIdx) == rxEventGroupId)
+      {
+        /* #300 Found the corresponding event handler. Stop searching. */
+        foundEventHandler = TRUE;
+        break;
+      }
     }
   }
 
-  /* #30 Set the eventHandlerIdx to an invalid value if no matching event handler was found. */
+  /* #40 Set the eventHandlerIdx to an invalid value if no matching event handler was found. */
   if(foundEventHandler == FALSE)
   {
     eventHandlerIdx = Sd_GetSizeOfEventHandler(PartitionIdx);
@@ -13347,13 +14210,13 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntry(
   SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Sd_SizeOfClientType clientIdx;
+  Sd_SizeOfClientType clientIdx, firstClientIdx;
   uint16 clientStartIdx, clientEndIdx;
   Sd_EntryType rxEntryType;
   uint16 rxServiceId;
   uint16 rxInstanceId;
   uint8 rxMajorVersion;
-  uint32 rxMinorVersion;
+  boolean useIndex = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
   /* #10 Read the header fields of the entry. */
@@ -13369,43 +14232,114 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntry(
   /* #30 Search for the matching client(s). */
   Sd_Util_GetServices(PartitionIdx, rxServiceId, Sd_Util_GetClientServiceId, &clientStartIdx, &clientEndIdx);           /* SBSW_SD_REFERENCE_OF_VARIABLE */
 
+  /* #35 Start with the first client of the ServiceId, or with the first client of the index bucket of the entry. */
+  firstClientIdx = (Sd_SizeOfClientType)clientStartIdx;
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+  if(Sd_RxIndexClientActive == TRUE)
+  {
+    uint16 headIdx = Sd_RxIndexClientHead[Sd_RxIndex_Hash(rxServiceId, rxInstanceId, rxMajorVersion)];
+
+    firstClientIdx = (headIdx == SD_RX_INDEX_INV) ? (Sd_SizeOfClientType)clientEndIdx : (Sd_SizeOfClientType)headIdx;
+    useIndex = TRUE;
+  }
+#endif
+
   /* #40 Iterate over all matching clients to find the one corresponding to the entry. */
-  for(clientIdx = (Sd_SizeOfClientType)clientStartIdx; clientIdx < (Sd_SizeOfClientType)clientEndIdx; clientIdx++)
+  for(clientIdx = firstClientIdx;
+      clientIdx < (Sd_SizeOfClientType)clientEndIdx;
+      clientIdx = Sd_RxClient_GetNextClient(clientIdx, (Sd_SizeOfClientType)clientEndIdx, useIndex))
   {
     /* #400 Check if the InstanceId and MajorVersion match. */
-    if((rxInstanceId == Sd_GetInstanceIdOfClientDyn(clientIdx, PartitionIdx)) &&
+    if((clientIdx >= (Sd_SizeOfClientType)clientStartIdx) &&
+      (rxInstanceId == Sd_GetInstanceIdOfClientDyn(clientIdx, PartitionIdx)) &&
       (rxMajorVersion == Sd_GetMajorVersionOfClient(clientIdx, PartitionIdx)))
     {
-      /* #4000 Differentiate between entry format type 1 or 2 */
-      if(rxEntryType == SD_ENTRY_OFFER_SERVICE)
-      {
-        /* #40000 Entry format type 1 - OfferService.
-         *        Process the entry even if the service is not available. */
-        SD_GET_UINT32(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY1_MINORVERSION_OFFSET, rxMinorVersion);
-
-        /* #40001 Check the minor version fits to the configuration. */
-        if(((Sd_GetFindBehaviorOfClient(clientIdx, PartitionIdx) == SD_FIND_BEHAVIOR_EXACT_OR_ANY_MINOR_VERSION) &&
-           ((rxMinorVersion == Sd_GetMinorVersionOfClient(clientIdx, PartitionIdx)) || Sd_IsMinorVersionWildcardOfClient(clientIdx, PartitionIdx))) ||
-          ((Sd_GetFindBehaviorOfClient(clientIdx, PartitionIdx) == SD_FIND_BEHAVIOR_MINIMUM_MINOR_VERSION) &&
-          (rxMinorVersion >= Sd_GetMinorVersionOfClient(clientIdx, PartitionIdx))))
-        {
-          /* #400010 Process the received OfferService entry. */
-          Sd_RxClient_ProcessEntryOffer(clientIdx, PartitionIdx, IndexOfEntry, RxMessageInfoPtr);                       /* SBSW_SD_PASSING_API_POINTER */
-        }
-      }
-      else
-      {
-        /* #40002 Entry format type 2 - SubscribeEventgroup(N)Ack.
-         *        Process the acknowledge only if no reboot of the remote server was detected. */
-        if(!Sd_IsRebootDetectedOfAddressStorage(RxMessageInfoPtr->AddressStorageIdx, PartitionIdx))
-        {
-          Sd_RxClient_ProcessEntryAcknowledge(clientIdx, PartitionIdx, IndexOfEntry, RxMessageInfoPtr);                 /* SBSW_SD_PASSING_API_POINTER */
-        }
-      }
+      /* #4000 Process the entry for the client. */
+      Sd_RxClient_ProcessEntryOfClient(clientIdx, PartitionIdx, rxEntryType, IndexOfEntry, RxMessageInfoPtr);           /* SBSW_SD_PASSING_API_POINTER */
+    }
+  }
+}
+
+/**********************************************************************************************************************
+ *  Sd_RxClient_ProcessEntryOfClient()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntryOfClient(
+  Sd_SizeOfClientType ClientIdx,
+  Sd_PartitionConfigIdxType PartitionIdx,
+  Sd_EntryType RxEntryType,
+  uint16 IndexOfEntry,
+  SD_P2CONST(Sd_RxMessageInfoType) RxMessageInfoPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 rxMinorVersion;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Differentiate between entry format type 1 or 2 */
+  if(RxEntryType == SD_ENTRY_OFFER_SERVICE)
+  {
+    /* #100 Entry format type 1 - OfferService.
+     *      Process the entry even if the service is not available. */
+    SD_GET_UINT32(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY1_MINORVERSION_OFFSET, rxMinorVersion);
+
+    /* #101 Check the minor version fits to the configuration. */
+    if(((Sd_GetFindBehaviorOfClient(ClientIdx, PartitionIdx) == SD_FIND_BEHAVIOR_EXACT_OR_ANY_MINOR_VERSION) &&
+       ((rxMinorVersion == Sd_GetMinorVersionOfClient(ClientIdx, PartitionIdx)) || Sd_IsMinorVersionWildcardOfClient(ClientIdx, PartitionIdx))) ||
+      ((Sd_GetFindBehaviorOfClient(ClientIdx, PartitionIdx) == SD_FIND_BEHAVIOR_MINIMUM_MINOR_VERSION) &&
+      (rxMinorVersion >= Sd_GetMinorVersionOfClient(ClientIdx, PartitionIdx))))
+    {
+      /* #1010 Process the received OfferService entry. */
+      Sd_RxClient_ProcessEntryOffer(ClientIdx, PartitionIdx, IndexOfEntry, RxMessageInfoPtr);                           /* SBSW_SD_PASSING_API_POINTER */
+    }
+  }
+  else
+  {
+    /* #110 Entry format type 2 - SubscribeEventgroup(N)Ack.
+     *      Process the acknowledge only if no reboot of the remote server was detected. */
+    if(!Sd_IsRebootDetectedOfAddressStorage(RxMessageInfoPtr->AddressStorageIdx, PartitionIdx))
+    {
+      Sd_RxClient_ProcessEntryAcknowledge(ClientIdx, PartitionIdx, IndexOfEntry, RxMessageInfoPtr);                     /* SBSW_SD_PASSING_API_POINTER */
     }
   }
 }
 
+/**********************************************************************************************************************
+ *  Sd_RxClient_GetNextClient()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SD_LOCAL_INLINE FUNC(Sd_SizeOfClientType, SD_CODE) Sd_RxClient_GetNextClient(
+  Sd_SizeOfClientType ClientIdx,
+  Sd_SizeOfClientType ClientEndIdx,
+  boolean UseIndex)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Sd_SizeOfClientType nextClientIdx = ClientIdx + 1u;
+
+  /* ----- Implementation ----------------------------------------------- */
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+  /* #10 Follow the hash chain if the index is used. The chain is sorted, so it ends at the end of the range. */
+  if(UseIndex == TRUE)
+  {
+    nextClientIdx = (Sd_RxIndexClientNext[ClientIdx] == SD_RX_INDEX_INV) ?
+      ClientEndIdx : (Sd_SizeOfClientType)Sd_RxIndexClientNext[ClientIdx];
+  }
+#else
+  SD_DUMMY_STATEMENT(ClientEndIdx); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+  SD_DUMMY_STATEMENT(UseIndex); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+#endif
+
+  return nextClientIdx;
+}
+
 /**********************************************************************************************************************
  *  Sd_RxClient_ProcessEntryOffer()
  *********************************************************************************************************************/
@@ -13649,91 +14583,154 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_RxClient_ProcessEntryAcknowledge(
   SD_GET_UINT24(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY_TTL_OFFSET, rxTTL);
   SD_GET_UINT16(RxMessageInfoPtr->PduInfoPtr, IndexOfEntry + SD_ENTRY2_EVENTGROUPID_OFFSET, rxEventGroupId);
 
-  /* #20 Iterate through each eventgroup to find the corresponding one. */
-  for(consumedEventgroupIdx = Sd_GetConsumedEventgroupStartIdxOfClient(ClientIdx, PartitionIdx);
-      consumedEventgroupIdx < Sd_GetConsumedEventgroupEndIdxOfClient(ClientIdx, PartitionIdx);
-      consumedEventgroupIdx++)
+  /* #20 Search the requested consumed eventgroup with the received ID. */
+  consumedEventgroupIdx = Sd_RxClient_SearchConsumedEventgroup(ClientIdx, PartitionIdx, rxEventGroupId);
+
+  if(consumedEventgroupIdx < Sd_GetSizeOfConsumedEventgroup(PartitionIdx))
   {
-    if((rxEventGroupId == Sd_GetEventGroupIdOfConsumedEventgroup(consumedEventgroupIdx, PartitionIdx)) &&
-       (Sd_GetServiceModeRequestOfConsumedEventgroupDyn(consumedEventgroupIdx, PartitionIdx) ==
-         SD_CONSUMED_EVENTGROUP_REQUESTED))
+    /* #200 Found the corresponding eventgroup, update the acknowledged TTL. */
+    Sd_SetAcknowledgedTTLOfConsumedEventgroupDyn(consumedEventgroupIdx, rxTTL, PartitionIdx);                           /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
+
+    /* #201 Process the corresponding option array.
+     *      Check if all attached endpoint options are valid and there exist no conflicts. */
+
+    /* #202 Check if a first option run is available.*/
+    if(nr1stOptions != 0u)
     {
-      /* #200 Found the corresponding eventgroup, update the acknowledged TTL. */
-      Sd_SetAcknowledgedTTLOfConsumedEventgroupDyn(consumedEventgroupIdx, rxTTL, PartitionIdx);                         /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
+      /* #2020 Process first option run. */
+      optionsRetVal = Sd_RxClient_ProcessOptionRun(PartitionIdx, RxMessageInfoPtr->PduInfoPtr,
+        index1stOption, nr1stOptions, Sd_GetEMalformedMsgIdOfInstance(instanceIdx, PartitionIdx),
+        consumedEventgroupIdx, &attachedOptions);                                                                       /* SBSW_SD_PDU_INFO_PTR */ /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    }
 
-      /* #201 Process the corresponding option array.
-       *      Check if all attached endpoint options are valid and there exist no conflicts. */
+    /* #300 Check if a second option run is available.*/
+    if((nr2ndOptions != 0u) && ((nr1stOptions == 0u) || (optionsRetVal == SD_OPTIONS_OK)))
+    {
+      /* #3000 Process second option run. */
+      optionsRetVal = Sd_RxClient_ProcessOptionRun(PartitionIdx, RxMessageInfoPtr->PduInfoPtr,
+        index2ndOption, nr2ndOptions, Sd_GetEMalformedMsgIdOfInstance(instanceIdx, PartitionIdx),
+        consumedEventgroupIdx, &attachedOptions);                                                                       /* SBSW_SD_PDU_INFO_PTR */ /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    }
+    /* #400 Otherwise, check if both option runs are empty.*/
+    else if((nr1stOptions == 0u) && (nr2ndOptions == 0u)) /* PRQA S 2995 */ /* MD_Sd_FalsePositive_2995_2996_2853 */
+    {
+      /* #4000 In case no first or second option run exists, only SD_ENTRY_SUBSCRIBE_EVENTGROUP_(N)ACK messages are allowed. */
+      optionsRetVal = SD_OPTIONS_OK;
+    }
+    /* #500 Otherwise, nothing to process.*/
+    else
+    {
+      /* #5000 No second option run present. Keep result of first option run. */
+    }
 
-      /* #202 Check if a first option run is available.*/
-      if(nr1stOptions != 0u)
-      {
-        /* #2020 Process first option run. */
-        optionsRetVal = Sd_RxClient_ProcessOptionRun(PartitionIdx, RxMessageInfoPtr->PduInfoPtr,
-          index1stOption, nr1stOptions, Sd_GetEMalformedMsgIdOfInstance(instanceIdx, PartitionIdx),
-          consumedEventgroupIdx, &attachedOptions);                                                                     /* SBSW_SD_PDU_INFO_PTR */ /* SBSW_SD_REFERENCE_OF_VARIABLE */
-      }
+    /* #600 Check if all required endpoint options are present. */
+    if((optionsRetVal == SD_OPTIONS_OK) &&
+      (attachedOptions.EndpointAddrUdp.family == SOAD_AF_INVALID) &&
+      Sd_ConsumedEventGroupUsesMulticast(consumedEventgroupIdx, PartitionIdx) &&
+      (!Sd_ConsumedEventGroupUsesUdp(consumedEventgroupIdx, PartitionIdx)))
+    {
+      /* #6000 Missing multicast endpoint is not allowed for pure multicast consumed eventgroups. Ignore message. */
+      optionsRetVal = SD_OPTIONS_NOT_OK;
+    }
 
-      /* #300 Check if a second option run is available.*/
-      if((nr2ndOptions != 0u) && ((nr1stOptions == 0u) || (optionsRetVal == SD_OPTIONS_OK)))
-      {
-        /* #3000 Process second option run. */
-        optionsRetVal = Sd_RxClient_ProcessOptionRun(PartitionIdx, RxMessageInfoPtr->PduInfoPtr,
-          index2ndOption, nr2ndOptions, Sd_GetEMalformedMsgIdOfInstance(instanceIdx, PartitionIdx),
-          consumedEventgroupIdx, &attachedOptions);                                                                     /* SBSW_SD_PDU_INFO_PTR */ /* SBSW_SD_REFERENCE_OF_VARIABLE */
-      }
-      /* #400 Otherwise, check if both option runs are empty.*/
-      else if((nr1stOptions == 0u) && (nr2ndOptions == 0u)) /* PRQA S 2995 */ /* MD_Sd_FalsePositive_2995_2996_2853 */
-      {
-        /* #4000 In case no first or second option run exists, only SD_ENTRY_SUBSCRIBE_EVENTGROUP_(N)ACK messages are allowed. */
-        optionsRetVal = SD_OPTIONS_OK;
-      }
-      /* #500 Otherwise, nothing to process.*/
-      else
-      {
-        /* #5000 No second option run present. Keep result of first option run. */
-      }
+    if(optionsRetVal == SD_OPTIONS_OK)
+    {
+      /* #7000 Check the attached configuration options by a user callout. */
+      optionsRetVal = Sd_RxClient_CheckConfigOptionByCbk(
+        ClientIdx, PartitionIdx,
+        (RxMessageInfoPtr->MulticastMessage == TRUE) ?
+        Sd_GetMulticastRxPduIdOfInstance(instanceIdx, PartitionIdx) :
+        Sd_GetUnicastRxPduIdOfInstance(instanceIdx, PartitionIdx),
+        SD_ENTRY_SUBSCRIBE_EVENTGROUP_ACK,
+        rxConfigOptionPtrArray);                                                                                        /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    }
 
-      /* #600 Check if all required endpoint options are present. */
-      if((optionsRetVal == SD_OPTIONS_OK) &&
-        (attachedOptions.EndpointAddrUdp.family == SOAD_AF_INVALID) &&
-        Sd_ConsumedEventGroupUsesMulticast(consumedEventgroupIdx, PartitionIdx) &&
-        (!Sd_ConsumedEventGroupUsesUdp(consumedEventgroupIdx, PartitionIdx)))
-      {
-        /* #6000 Missing multicast endpoint is not allowed for pure multicast consumed eventgroups. Ignore message. */
-        optionsRetVal = SD_OPTIONS_NOT_OK;
-      }
+    if(optionsRetVal == SD_OPTIONS_OK)
+    {
+      /* #8000 The attached options are valid. Save the received event. */
+      Sd_RxClient_ProcessEntryAcknowledgeSave(consumedEventgroupIdx, PartitionIdx, &attachedOptions.EndpointAddrUdp,
+        rxTTL, RxMessageInfoPtr->AddressStorageIdx);                                                                   /* SBSW_SD_REFERENCE_OF_VARIABLE */
+    }
 
-      if(optionsRetVal == SD_OPTIONS_OK)
-      {
-        /* #7000 Check the attached configuration options by a user callout. */
-        optionsRetVal = Sd_RxClient_CheckConfigOptionByCbk(
-          ClientIdx, PartitionIdx,
-          (RxMessageInfoPtr->MulticastMessage == TRUE) ?
-          Sd_GetMulticastRxPduIdOfInstance(instanceIdx, PartitionIdx) :
-          Sd_GetUnicastRxPduIdOfInstance(instanceIdx, PartitionIdx),
-          SD_ENTRY_SUBSCRIBE_EVENTGROUP_ACK,
-          rxConfigOptionPtrArray);                                                                                      /* SBSW_SD_REFERENCE_OF_VARIABLE */
-      }
+#if(SD_GET_RESET_MEASUREMENT_DATA_API == STD_ON)
+    /* #900 Increment measurement data counter for SubscribeNack entries. */
+    if(rxTTL == 0u)
+    {
+      Sd_Measure_Inc(SD_MEAS_SUBSCRIBE_NACK, 1u);
+    }
+#endif
+  }
+}
 
-      if(optionsRetVal == SD_OPTIONS_OK)
+/**********************************************************************************************************************
+ *  Sd_RxClient_SearchConsumedEventgroup()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL_INLINE FUNC(Sd_SizeOfConsumedEventgroupType, SD_CODE) Sd_RxClient_SearchConsumedEventgroup(
+  Sd_SizeOfClientType ClientIdx,
+  Sd_PartitionConfigIdxType PartitionIdx,
+  uint16 EventGroupId)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Sd_SizeOfConsumedEventgroupType consumedEventgroupIdx;
+  boolean foundConsumedEventgroup = FALSE;
+
+  /* ----- Implementation ----------------------------------------------- */
+#if (SD_RX_INDEX_ENABLED == STD_ON)
+  if(Sd_RxIndexClientActive == TRUE)
+  {
+    uint16 indexIdx = Sd_RxIndexCegHead[Sd_RxIndex_Hash((uint16)ClientIdx, EventGroupId, 0u)];
+
+    /* #10 Walk the index bucket of client and eventgroup to find the corresponding consumed eventgroup. */
+    while(indexIdx != SD_RX_INDEX_INV)
+    {
+      consumedEventgroupIdx = (Sd_SizeOfConsumedEventgroupType)indexIdx;
+
+      if((consumedEventgroupIdx >= Sd_GetConsumedEventgroupStartIdxOfClient(ClientIdx, PartitionIdx)) &&
+         (consumedEventgroupIdx < Sd_GetConsumedEventgroupEndIdxOfClient(ClientIdx, PartitionIdx)) &&
+         (EventGroupId == Sd_GetEventGroupIdOfConsumedEventgroup(consumedEventgroupIdx, PartitionIdx)) &&
+         (Sd_GetServiceModeRequestOfConsumedEventgroupDyn(consumedEventgroupIdx, PartitionIdx) ==
+           SD_CONSUMED_EVENTGROUP_REQUESTED))
       {
-        /* #8000 The attached options are valid. Save the received event. */
-        Sd_RxClient_ProcessEntryAcknowledgeSave(consumedEventgroupIdx, PartitionIdx, &attachedOptions.EndpointAddrUdp,
-          rxTTL, RxMessageInfoPtr->AddressStorageIdx);                                                                 /* SBSW_SD_REFERENCE_OF_VARIABLE */
+        /* #100 Found the corresponding eventgroup. Stop searching. */
+        foundConsumedEventgroup = TRUE;
+        break;
       }
 
-#if(SD_GET_RESET_MEASUREMENT_DATA_API == STD_ON)
-      /* #900 Increment measurement data counter for SubscribeNack entries. */
-      if(rxTTL == 0u)
+      indexIdx = Sd_RxIndexCegNext[indexIdx];
+    }
+  }
+  else
+#endif
+  {
+    /* #20 Otherwise, iterate through each eventgroup of the client to find the corresponding one. */
+    for(consumedEventgroupIdx = Sd_GetConsumedEventgroupStartIdxOfClient(ClientIdx, PartitionIdx);
+        consumedEventgroupIdx < Sd_GetConsumedEventgroupEndIdxOfClient(ClientIdx, PartitionIdx);
+        consumedEventgroupIdx++)
+    {
+      if((EventGroupId == Sd_GetEventGroupIdOfConsumedEventgroup(consumedEventgroupIdx, PartitionIdx)) &&
+         (Sd_GetServiceModeRequestOfConsumedEventgroupDyn(consumedEventgroupIdx, PartitionIdx) ==
+           SD_CONSUMED_EVENTGROUP_REQUESTED))
       {
-        Sd_Measure_Inc(SD_MEAS_SUBSCRIBE_NACK, 1u);
+        /* #200 Found the corresponding eventgroup. Stop searching. */
+        foundConsumedEventgroup = TRUE;
+        break;
       }
-#endif
-
-      /* #1000 Found the corresponding eventgroup, stop searching. */
-      break;
     }
   }
+
+  /* #30 Set the consumedEventgroupIdx to an invalid value if no matching consumed eventgroup was found. */
+  if(foundConsumedEventgroup == FALSE)
+  {
+    consumedEventgroupIdx = Sd_GetSizeOfConsumedEventgroup(PartitionIdx);
+  }
+
+  return consumedEventgroupIdx;
 }
 
 /**********************************************************************************************************************
@@ -14837,19 +15834,44 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_State_Process(
     /* #100 Reset the timer. */
     Sd_Util_ResetTimerToInvalid(Sd_GetAddrNextStateMachineRunOfInstanceDyn(InstanceIdx, PartitionIdx));                 /* SBSW_SD_REFERENCE_OF_ARRAY_ELEMENT_OUTER_INDEX_SAME_SIZE */
 
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+    Sd_StateSchedActive = TRUE;
+#endif
+
     /* #101 Iterate over all server state machines of the instance. */
     SdHookBegin_State_Process_ServerSMs();
     for(serverIdx = Sd_GetServerStartIdxOfInstance(InstanceIdx, PartitionIdx);
         serverIdx < Sd_GetServerEndIdxOfInstance(InstanceIdx, PartitionIdx);
         serverIdx++)
     {
-      /* #1010 Only execute state machine if requested for server. */
       SD_BEGIN_CRITICAL_SECTION();
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+      /* #1010 Resume the server state machine if it is suspended and its timer expired or an event occurred. */
+      if(Sd_StateSched_Resume(Sd_StateSchedServer, (uint16)serverIdx, InstanceIdx, PartitionIdx) == TRUE)               /* SBSW_SD_REFERENCE_OF_VARIABLE */
+      {
+        Sd_SetStateMachineExecutionRequestedOfServerDyn(serverIdx, TRUE, PartitionIdx);                                 /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
+      }
+#endif
+
+      /* #1011 Only execute state machine if requested for server. */
       if(Sd_IsStateMachineExecutionRequestedOfServerDyn(serverIdx, PartitionIdx))
       {
         Sd_SetStateMachineExecutionRequestedOfServerDyn(serverIdx, FALSE, PartitionIdx);                                /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
         SD_END_CRITICAL_SECTION();
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+        Sd_StateSched_BeginRun(Sd_StateSchedServer, (uint16)serverIdx);                                                 /* SBSW_SD_REFERENCE_OF_VARIABLE */
+#endif
         Sd_StateServer_Process(serverIdx, PartitionIdx);
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+        /* #1012 Suspend the state machine if it only waits for one of its timers. */
+        SD_BEGIN_CRITICAL_SECTION();
+        if(Sd_StateSched_Suspend(Sd_StateSchedServer, (uint16)serverIdx,                                                /* SBSW_SD_REFERENCE_OF_VARIABLE */
+             Sd_IsStateMachineExecutionRequestedOfServerDyn(serverIdx, PartitionIdx)) == TRUE)
+        {
+          Sd_SetStateMachineExecutionRequestedOfServerDyn(serverIdx, FALSE, PartitionIdx);                              /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
+        }
+        SD_END_CRITICAL_SECTION();
+#endif
       }
       else
       {
@@ -14865,7 +15887,15 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_State_Process(
         clientIdx++)
     {
       SD_BEGIN_CRITICAL_SECTION();
-      /* #1020 Only execute state machine if requested for client. */
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+      /* #1020 Resume the client state machine if it is suspended and its timer expired or an event occurred. */
+      if(Sd_StateSched_Resume(Sd_StateSchedClient, (uint16)clientIdx, InstanceIdx, PartitionIdx) == TRUE)               /* SBSW_SD_REFERENCE_OF_VARIABLE */
+      {
+        Sd_SetStateMachineExecutionRequestedOfClientDyn(clientIdx, TRUE, PartitionIdx);                                 /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
+      }
+#endif
+
+      /* #1021 Only execute state machine if requested for client. */
       if(Sd_IsStateMachineExecutionRequestedOfClientDyn(clientIdx, PartitionIdx))
       {
         Sd_SetStateMachineExecutionRequestedOfClientDyn(clientIdx, FALSE, PartitionIdx);                                /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
@@ -14873,7 +15903,20 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_State_Process(
         Sd_SetEventMainOfClientDyn(clientIdx, Sd_GetEventRxOfClientDyn(clientIdx, PartitionIdx), PartitionIdx);         /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
         Sd_SetEventRxOfClientDyn(clientIdx, SD_CLIENT_EVENT_SERVICE_NONE, PartitionIdx);                                /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
         SD_END_CRITICAL_SECTION();
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+        Sd_StateSched_BeginRun(Sd_StateSchedClient, (uint16)clientIdx);                                                 /* SBSW_SD_REFERENCE_OF_VARIABLE */
+#endif
         Sd_StateClient_Process(clientIdx, PartitionIdx);
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+        /* #1022 Suspend the state machine if it only waits for one of its timers. */
+        SD_BEGIN_CRITICAL_SECTION();
+        if(Sd_StateSched_Suspend(Sd_StateSchedClient, (uint16)clientIdx,                                                /* SBSW_SD_REFERENCE_OF_VARIABLE */
+             Sd_IsStateMachineExecutionRequestedOfClientDyn(clientIdx, PartitionIdx)) == TRUE)
+        {
+          Sd_SetStateMachineExecutionRequestedOfClientDyn(clientIdx, FALSE, PartitionIdx);                              /* SBSW_SD_API_ARGUMENT_IDX_INDIRECTION */
+        }
+        SD_END_CRITICAL_SECTION();
+#endif
       }
       else
       {
@@ -14881,6 +15924,10 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_State_Process(
       }
     }
     SdHookEnd_State_Process_ClientSMs();
+
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+    Sd_StateSchedActive = FALSE;
+#endif
   }
 }
 
@@ -15606,6 +16653,7 @@ SD_LOCAL FUNC(Sd_SizeOfSendEntryType, SD_CODE) Sd_Tx_SerializeMessage(
   uint16 payloadEntryIdx = 0u;   /* PRQA S 2981 */ /* MD_Sd_Rule-2.2_2981 */
   Sd_OptionArrayInfoType optionArrayInfo;
   uint16 optionArrayEndIdxPrev;
+  Sd_OptionArrayInfoType optionArrayInfoPrev;
   Sd_SendEntrySkipType skipEntry;
 
   /* ----- Implementation ----------------------------------------------- */
@@ -15643,22 +16691,62 @@ SD_LOCAL FUNC(Sd_SizeOfSendEntryType, SD_CODE) Sd_Tx_SerializeMessage(
       Sd_Tx_CheckAndRestartRetry(sendEntryIdx, PartitionIdx);
 
       /* #400 Serialize the entry with all corresponding options. */
+      optionArrayInfoPrev = optionArrayInfo;
       bufferTooSmall = Sd_Tx_SerializeEntryAndOptions(sendEntryIdx, PartitionIdx, payloadEntryIdx, &optionArrayInfo);   /* SBSW_SD_REFERENCE_OF_VARIABLE */
 
-      /* #401 Stop processing if TxBuffer is too small for next entry. */
-      if(bufferTooSmall == TRUE)
+      /* #401 If the options of the entry do not fit, release half of the unused space reserved for the entries array
+       *      and serialize the entry again. */
+      if((bufferTooSmall == TRUE) && (maxNumberOfEntriesToSerialize > (numSerializedEntries + 1u)))
+      {
+        Sd_SizeOfSendEntryType releasedEntries =
+          (Sd_SizeOfSendEntryType)((maxNumberOfEntriesToSerialize - numSerializedEntries) / 2u);
+
+        optionArrayInfo = optionArrayInfoPrev;
+        Sd_Tx_MoveOptionsArray(PartitionIdx, &optionArrayInfo,                                                          /* SBSW_SD_REFERENCE_OF_VARIABLE */
+          optionArrayInfo.ArrayStartIdx - ((uint16)releasedEntries * SD_ENTRY_SIZE));
+        maxNumberOfEntriesToSerialize -= releasedEntries;
+        sizeEntriesArray -= (uint16)releasedEntries * SD_ENTRY_SIZE;
+        optionArrayEndIdxPrev = optionArrayInfo.ArrayEndIdx;
+        bufferTooSmall = FALSE;
+      }
+      /* #402 Otherwise, stop processing if TxBuffer is too small for next entry. */
+      else if(bufferTooSmall == TRUE)
       {
         continueIter = FALSE;
       }
       else
       {
-        /* #402 Remove sent entry from queue and get next entry ready to send. */
+        /* #403 Remove sent entry from queue and get next entry ready to send. */
         Sd_SizeOfSendEntryType sendEntryNext = Sd_GetSendEntryNextIdxOfSendEntry(sendEntryIdx, PartitionIdx);
         payloadEntryIdx += SD_ENTRY_SIZE;
         numSerializedEntries++;
         optionArrayEndIdxPrev = optionArrayInfo.ArrayEndIdx;
         (void)Sd_Util_RemoveSendEntryFromList(InstanceIdx, PartitionIdx, AddressStorageIdx, sendEntryIdx);
         sendEntryIdx = sendEntryNext;
+
+        /* #404 Extend the entries array if it is full, further entries are pending and the payload has space left.
+         *      A quarter of the remaining space is kept for the options of the additional entries. */
+        if((numSerializedEntries == maxNumberOfEntriesToSerialize) &&
+           (sendEntryIdx < Sd_GetSizeOfSendEntry(PartitionIdx)))
+        {
+          uint16 freeLength = (uint16)Sd_GetSizeOfPayload(PartitionIdx) - optionArrayInfo.ArrayEndIdx;
+          Sd_SizeOfSendEntryType additionalEntries =
+            (Sd_SizeOfSendEntryType)((freeLength - (freeLength / 4u)) / SD_ENTRY_SIZE);
+
+          if(additionalEntries > Sd_GetSendEntryNrPendingIdxOfAddressStorage(AddressStorageIdx, PartitionIdx))
+          {
+            additionalEntries = Sd_GetSendEntryNrPendingIdxOfAddressStorage(AddressStorageIdx, PartitionIdx);
+          }
+
+          if(additionalEntries > 0u)
+          {
+            Sd_Tx_MoveOptionsArray(PartitionIdx, &optionArrayInfo,                                                      /* SBSW_SD_REFERENCE_OF_VARIABLE */
+              optionArrayInfo.ArrayStartIdx + ((uint16)additionalEntries * SD_ENTRY_SIZE));
+            maxNumberOfEntriesToSerialize += additionalEntries;
+            sizeEntriesArray += (uint16)additionalEntries * SD_ENTRY_SIZE;
+            optionArrayEndIdxPrev = optionArrayInfo.ArrayEndIdx;
+          }
+        }
       }
     }
     else if(skipEntry == SD_SENDENTRY_SKIP)
@@ -15794,6 +16882,48 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_Tx_SerializeHeader(
   Sd_Util_Write24Bit(Sd_GetAddrPayload(SD_HEADER_RESERVED_OFFSET, PartitionIdx), SD_HEADER_RESERVED);                   /* SBSW_SD_REFERENCE_MESSAGE_SIZE_WITH_ENTRIES */
 }
 
+/**********************************************************************************************************************
+ *  Sd_Tx_MoveOptionsArray()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SD_LOCAL FUNC(void, SD_CODE) Sd_Tx_MoveOptionsArray(
+  Sd_PartitionConfigIdxType PartitionIdx,
+  SD_P2VAR(Sd_OptionArrayInfoType) OptionArrayInfoPtr,
+  uint16 NewArrayStartIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint16 optionsLength = OptionArrayInfoPtr->ArrayEndIdx - OptionArrayInfoPtr->ArrayStartIdx;
+  SD_P2VAR(uint8) payloadPtr = Sd_GetAddrPayload(0u, PartitionIdx);
+  uint16 byteIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Move the options towards the end of the payload, beginning with the last byte. */
+  if(NewArrayStartIdx > OptionArrayInfoPtr->ArrayStartIdx)
+  {
+    for(byteIdx = optionsLength; byteIdx > 0u; byteIdx--)
+    {
+      payloadPtr[NewArrayStartIdx + byteIdx - 1u] = payloadPtr[OptionArrayInfoPtr->ArrayStartIdx + byteIdx - 1u];       /* SBSW_SD_TX_MOVE_OPTIONS */
+    }
+  }
+  /* #20 Otherwise, move the options towards the beginning of the payload, beginning with the first byte. */
+  else
+  {
+    for(byteIdx = 0u; byteIdx < optionsLength; byteIdx++)
+    {
+      payloadPtr[NewArrayStartIdx + byteIdx] = payloadPtr[OptionArrayInfoPtr->ArrayStartIdx + byteIdx];                 /* SBSW_SD_TX_MOVE_OPTIONS */
+    }
+  }
+
+  /* #30 Update the start and end index of the options array. */
+  OptionArrayInfoPtr->ArrayStartIdx = NewArrayStartIdx;                                                                 /* SBSW_SD_POINTER_WRITE */
+  OptionArrayInfoPtr->ArrayEndIdx = NewArrayStartIdx + optionsLength;                                                   /* SBSW_SD_POINTER_WRITE */
+}
+
 /**********************************************************************************************************************
  *  Sd_Tx_SerializeRelatedOptions()
  *********************************************************************************************************************/
@@ -18312,6 +19442,11 @@ SD_LOCAL_INLINE FUNC(void, SD_CODE) Sd_Util_TriggerStateMachineRun(
   (Sd_GetAddrNextStateMachineRunOfInstanceDyn(InstanceIdx, PartitionIdx))->Seconds = 0u;                                /* SBSW_SD_API_ARGUMENT_IDX_SAME_SIZE */
   (Sd_GetAddrNextStateMachineRunOfInstanceDyn(InstanceIdx, PartitionIdx))->Milliseconds = 0u;                           /* SBSW_SD_API_ARGUMENT_IDX_SAME_SIZE */
 
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+  /* #20 Register the immediate execution for the state machine scheduling. */
+  Sd_StateSched_RegisterTimer(Sd_GetNextStateMachineRunOfInstanceDyn(InstanceIdx, PartitionIdx));
+#endif
+
   SD_END_CRITICAL_SECTION();
 }
 
@@ -18344,6 +19479,11 @@ SD_LOCAL FUNC(void, SD_CODE) Sd_Util_SetNextStateMachineRun(
     (Sd_GetAddrNextStateMachineRunOfInstanceDyn(InstanceIdx, PartitionIdx))->Milliseconds = Timer.Milliseconds;         /* SBSW_SD_API_ARGUMENT_IDX_SAME_SIZE */
   }
 
+#if (SD_STATE_SCHED_ENABLED == STD_ON)
+  /* #20 Register the timer for the state machine scheduling. */
+  Sd_StateSched_RegisterTimer(Timer);
+#endif
+
   SD_END_CRITICAL_SECTION();
 }
 
@@ -19209,6 +20349,12 @@ SD_LOCAL_INLINE FUNC(Std_ReturnType, SD_CODE) Sd_SoAd_GetRemoteAddr(
                           array. The length check ensures that the access is always valid. The PartitionIdx has been
                           derived in advance by a qualified use-case of CSL05.
 
+  \ID SBSW_SD_TX_MOVE_OPTIONS
+    \DESCRIPTION      Write access to the partition specific payload array.
+    \COUNTERMEASURE   \R  The caller of Sd_Tx_MoveOptionsArray() ensures that the moved options array ends within the
+                          payload array. Options are only moved into space reserved for the entries array or into the
+                          unused space behind the serialized options, which is checked against the payload length.
+
   \ID SBSW_SD_TX_SERIALIZE_OPTION
     \DESCRIPTION      Pointer to array element is passed as function argument.
     \COUNTERMEASURE   \R  The partition specific payload array is accessed to retrieve the serialize option fields.
@@ -313,6 +313,50 @@
 
 # define SD_CONSUMEDEVENTGROUPMULTICAST               (SD_MULTICASTSOCONID)
 
+/* ----- Rx entry matching index -----
+ * Received entries are matched to servers, clients, event handlers and consumed eventgroups by hash indices which are
+ * built at Sd_Init(). The index is only used in single partition configurations and if the configured number of
+ * elements fits into the index. Otherwise entries are matched by a linear search. Disabled by default. */
+# if !defined (SD_RX_INDEX)                                                                                             /* COV_SD_COMPATIBILITY */
+#  define SD_RX_INDEX                                 STD_OFF
+# endif
+
+/*! Number of hash buckets of each index. Power of two. */
+# if !defined (SD_RX_INDEX_HASH_SIZE)                                                                                   /* COV_SD_COMPATIBILITY */
+#  define SD_RX_INDEX_HASH_SIZE                       (64u)
+# endif
+
+/*! Maximum number of servers and clients covered by the index. */
+# if !defined (SD_RX_INDEX_SERVICE_NUM)                                                                                 /* COV_SD_COMPATIBILITY */
+#  define SD_RX_INDEX_SERVICE_NUM                     (128u)
+# endif
+
+/*! Maximum number of event handlers and consumed eventgroups covered by the index. */
+# if !defined (SD_RX_INDEX_EVENTGROUP_NUM)                                                                              /* COV_SD_COMPATIBILITY */
+#  define SD_RX_INDEX_EVENTGROUP_NUM                  (256u)
+# endif
+
+# if ((SD_RX_INDEX_HASH_SIZE == 0u) || ((SD_RX_INDEX_HASH_SIZE & (SD_RX_INDEX_HASH_SIZE - 1u)) != 0u))
+#  error "Sd.h: SD_RX_INDEX_HASH_SIZE must be a power of two."
+# endif
+# if ((SD_RX_INDEX_SERVICE_NUM >= 0xFFFFu) || (SD_RX_INDEX_EVENTGROUP_NUM >= 0xFFFFu))
+#  error "Sd.h: SD_RX_INDEX_SERVICE_NUM and SD_RX_INDEX_EVENTGROUP_NUM must be less than 65535."
+# endif
+
+/* ----- State machine scheduling -----
+ * A server or client state machine which only waits for one of its timers is suspended until this timer expires, even
+ * if the state machines of its instance are triggered earlier because of another service. Suspended state machines are
+ * resumed as soon as any external event is indicated to the module. Only available in single partition configurations
+ * and for the servers and clients covered by SD_STATE_SCHED_SERVICE_NUM. Disabled by default. */
+# if !defined (SD_STATE_SCHED)                                                                                          /* COV_SD_COMPATIBILITY */
+#  define SD_STATE_SCHED                              STD_OFF
+# endif
+
+/*! Number of servers and of clients which can be suspended. */
+# if !defined (SD_STATE_SCHED_SERVICE_NUM)                                                                              /* COV_SD_COMPATIBILITY */
+#  define SD_STATE_SCHED_SERVICE_NUM                  (128u)
+# endif
+
 /**********************************************************************************************************************
  *  GLOBAL FUNCTION PROTOTYPES
  *********************************************************************************************************************/
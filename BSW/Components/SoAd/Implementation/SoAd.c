@@ -2934,6 +2934,21 @@ FUNC(void, SOAD_CODE) SoAd_TcpIpEvent(
                          In case of optional indirection it is ensured that optional indirection is available according
                          to Safe BSW assumptions modeled in ComStackLib.
 
+  \ID SBSW_SOAD_TIMEOUT_LIST_WHEEL
+    \DESCRIPTION      Access to the module-local timer wheel arrays of the UDP alive supervision timeout.
+    \COUNTERMEASURE   \R Socket connection and instance indices are checked against SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM
+                         and SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM before the timer wheel is used. Slot indices are
+                         masked with SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM - 1 which is ensured to be a power of two by a
+                         preprocessor check. Chain indices are only linked socket connection indices or the invalid
+                         index which is checked before access.
+
+  \ID SBSW_SOAD_BEST_MATCH_CACHE
+    \DESCRIPTION      Access to the module-local best match cache.
+    \COUNTERMEASURE   \R Cache entry indices are loop counters limited to SOAD_BEST_MATCH_CACHE_SIZE or an index
+                         selected by such a loop. List indices are limited to the list size which is checked against
+                         SOAD_BEST_MATCH_CACHE_LIST_LEN before an entry is stored. The remote address is copied by
+                         SoAd_Util_CopySockAddr() into a SoAd_SockAddrInetXType which fits all supported domains.
+
 SBSW_JUSTIFICATION_END */
 
 /* COV_JUSTIFICATION_BEGIN
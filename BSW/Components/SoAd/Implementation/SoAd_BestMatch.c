@@ -42,6 +42,32 @@
  *  LOCAL CONSTANT MACROS
  *********************************************************************************************************************/
 
+/*! Enables the cache of recently derived best match lists (refer to SoAd_BestMatch_CacheLookup()). Disabled by
+ *  default. The cache only covers the best match algorithm of SoAd. The local and remote address match of Sd
+ *  (Sd_StateClient_FindBestMatchLocalRemoteSoCon()) evaluates the multicast socket connections of a consumed eventgroup
+ *  against the configured and the offered addresses. It is only executed on the initial eventgroup acknowledgement and
+ *  is not cached. */
+#if !defined (SOAD_BEST_MATCH_CACHE) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_BEST_MATCH_CACHE                    STD_OFF
+#endif /* !defined (SOAD_BEST_MATCH_CACHE) */
+
+/*! Number of remote addresses for which the derived best match list is cached. */
+#if !defined (SOAD_BEST_MATCH_CACHE_SIZE) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_BEST_MATCH_CACHE_SIZE               8u
+#endif /* !defined (SOAD_BEST_MATCH_CACHE_SIZE) */
+
+/*! Maximum length of a cached best match list. Longer lists are not cached. */
+#if !defined (SOAD_BEST_MATCH_CACHE_LIST_LEN) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_BEST_MATCH_CACHE_LIST_LEN           4u
+#endif /* !defined (SOAD_BEST_MATCH_CACHE_LIST_LEN) */
+
+/* The cache is stored in module-local variables which are not partition specific. */
+#if ( (SOAD_BEST_MATCH_CACHE == STD_ON) && (SOAD_MULTI_PARTITION != STD_ON) )
+# define SOAD_BEST_MATCH_CACHE_ENABLED            STD_ON
+#else
+# define SOAD_BEST_MATCH_CACHE_ENABLED            STD_OFF
+#endif /* (SOAD_BEST_MATCH_CACHE == STD_ON) && (SOAD_MULTI_PARTITION != STD_ON) */
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
  *********************************************************************************************************************/
@@ -58,10 +84,46 @@
 # define SOAD_LOCAL_INLINE LOCAL_INLINE
 #endif /* !defined (SOAD_LOCAL_INLINE) */
 
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+/*! Best match list derived for a remote address on a socket connection group. */
+typedef struct sSoAd_BestMatch_CacheEntryType
+{
+  SoAd_SockAddrInetXType RemAddr;                                       /*!< Remote address used to derive the list. */
+  uint32                 LastUse;                                       /*!< Use stamp for least recently used
+                                                                             replacement. */
+  SoAd_SizeOfSoConType   SoConStartIdx;                                 /*!< First socket connection of the group. */
+  SoAd_SizeOfSoConType   SoConEndIdx;                                   /*!< End of socket connections of the group. */
+  SoAd_SizeOfSoConType   ListSize;                                      /*!< Number of socket connections in list. */
+  SoAd_SizeOfSoConType   SoConIdxList[SOAD_BEST_MATCH_CACHE_LIST_LEN];  /*!< Socket connections with highest
+                                                                             best match priority. */
+  boolean                Valid;                                         /*!< Indicates if the entry is valid. */
+} SoAd_BestMatch_CacheEntryType;
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  LOCAL DATA PROTOTYPES
  *********************************************************************************************************************/
 
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+# define SOAD_START_SEC_VAR_NO_INIT_UNSPECIFIED
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+/*! Cache of recently derived best match lists. */
+SOAD_LOCAL VAR(SoAd_BestMatch_CacheEntryType, SOAD_VAR_NO_INIT) SoAd_BestMatch_Cache[SOAD_BEST_MATCH_CACHE_SIZE];
+
+# define SOAD_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+# define SOAD_START_SEC_VAR_NO_INIT_32
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+/*! Use stamp incremented on each cache access. */
+SOAD_LOCAL VAR(uint32, SOAD_VAR_NO_INIT) SoAd_BestMatch_CacheStamp;
+
+# define SOAD_STOP_SEC_VAR_NO_INIT_32
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  GLOBAL DATA
  *********************************************************************************************************************/
@@ -97,6 +159,74 @@ SOAD_LOCAL_INLINE FUNC(SoAd_BestMatchPrioType, SOAD_CODE) SoAd_BestMatch_GetPrio
   SoAd_PartitionConfigIdxType PartitionIdx,
   P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr);
 
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_CacheIsEqualAddr()
+ *********************************************************************************************************************/
+/*! \brief      Checks if a cache entry was derived for a remote address.
+ *  \details    -
+ *  \param[in]  CacheIdx          Cache entry index.
+ *                                [range: CacheIdx < SOAD_BEST_MATCH_CACHE_SIZE]
+ *  \param[in]  SockAddrPtr       Pointer to socket address.
+ *                                [Points to one of the following structs depending on domain:
+ *                                  - SoAd_SockAddrInetType for IPv4
+ *                                  - SoAd_SockAddrInet6Type for IPv6]
+ *  \return     TRUE              Remote address of cache entry is equal.
+ *  \return     FALSE             Remote address of cache entry is not equal.
+ *  \pre        -
+ *  \context    TASK|ISR2
+ *  \reentrant  TRUE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_BestMatch_CacheIsEqualAddr(
+  uint32_least CacheIdx,
+  P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr);
+
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_CacheLookup()
+ *********************************************************************************************************************/
+/*! \brief      Restores the best match list from the cache if it was derived for a remote address before.
+ *  \details    The cache is invalidated whenever a remote address of a socket connection changes since the best
+ *              match priority depends on the remote addresses only.
+ *  \param[in]  SoConStartEndIdxStruct Combines parameters to identify socket connection group and instance.
+ *                                     [range: InstanceIdx < SoAd_GetSizeOfInstance(),
+ *                                             PartitionIdx < size of SoAd_PCPartitionConfig,
+ *                                             SoConStartIdx < SoAd_GetSizeOfSoCon(),
+ *                                             SoConEndIdx < SoAd_GetSizeOfSoCon()]
+ *  \param[in]  SockAddrPtr       Pointer to socket address used to perform best match algorithm.
+ *  \param[out] ListSizePtr       Pointer to size of the restored best match list.
+ *  \return     TRUE              List restored from cache.
+ *  \return     FALSE             No cache entry found.
+ *  \pre        Called in critical section.
+ *  \context    TASK|ISR2
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_BestMatch_CacheLookup(
+  SoAd_BestMatch_SoConStartEndIdxType SoConStartEndIdxStruct,
+  P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr,
+  P2VAR(SoAd_SizeOfSoConType, AUTOMATIC, SOAD_APPL_VAR) ListSizePtr);
+
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_CacheStore()
+ *********************************************************************************************************************/
+/*! \brief      Stores a derived best match list in the least recently used cache entry.
+ *  \details    Lists longer than SOAD_BEST_MATCH_CACHE_LIST_LEN are not stored.
+ *  \param[in]  SoConStartEndIdxStruct Combines parameters to identify socket connection group and instance.
+ *                                     [range: InstanceIdx < SoAd_GetSizeOfInstance(),
+ *                                             PartitionIdx < size of SoAd_PCPartitionConfig,
+ *                                             SoConStartIdx < SoAd_GetSizeOfSoCon(),
+ *                                             SoConEndIdx < SoAd_GetSizeOfSoCon()]
+ *  \param[in]  SockAddrPtr       Pointer to socket address used to perform best match algorithm.
+ *  \param[in]  ListSize          Size of the derived best match list.
+ *  \pre        Called in critical section.
+ *  \context    TASK|ISR2
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_BestMatch_CacheStore(
+  SoAd_BestMatch_SoConStartEndIdxType SoConStartEndIdxStruct,
+  P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr,
+  SoAd_SizeOfSoConType ListSize);
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTIONS
  *********************************************************************************************************************/
@@ -179,6 +309,144 @@ SOAD_LOCAL_INLINE FUNC(SoAd_BestMatchPrioType, SOAD_CODE) SoAd_BestMatch_GetPrio
   return bestMachPrio;
 } /* SoAd_BestMatch_GetPrio() */
 
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_CacheIsEqualAddr()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_BestMatch_CacheIsEqualAddr(
+  uint32_least CacheIdx,
+  P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  /* PRQA S 310, 3305 1 */ /* MD_SoAd_PointerCastOnStruct */
+  SOAD_P2CONST(SoAd_SockAddrInetXType) sockAddrPtr = SOAD_A_P2CONST(SoAd_SockAddrInetXType)SockAddrPtr;
+  boolean                              isEqual = FALSE;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Compare domain, port and IP address. */
+  if ( (SoAd_BestMatch_Cache[CacheIdx].RemAddr.domain == sockAddrPtr->domain) &&
+    (SoAd_BestMatch_Cache[CacheIdx].RemAddr.port == sockAddrPtr->port) )
+  {
+    isEqual = (SoAd_Util_CompareIpAddr(sockAddrPtr->domain, SoAd_BestMatch_Cache[CacheIdx].RemAddr.addr,                /* SBSW_SOAD_POINTER_AND_CONST_POINTER_FORWARD */
+      sockAddrPtr->addr) == E_OK) ? TRUE : FALSE;
+  }
+
+  return isEqual;
+} /* SoAd_BestMatch_CacheIsEqualAddr() */
+
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_CacheLookup()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_BestMatch_CacheLookup(
+  SoAd_BestMatch_SoConStartEndIdxType SoConStartEndIdxStruct,
+  P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr,
+  P2VAR(SoAd_SizeOfSoConType, AUTOMATIC, SOAD_APPL_VAR) ListSizePtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  SoAd_SizeOfBestMatchSoConIdxListType bestMatchSoConIdxListStartIdx = SoAd_GetBestMatchSoConIdxListStartIdxOfInstance(
+    SoConStartEndIdxStruct.InstanceIdx, SoConStartEndIdxStruct.PartitionIdx);
+  uint32_least                         cacheIter;
+  boolean                              isHit = FALSE;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Search for a valid entry derived for the socket connection group and the remote address. */
+  for ( cacheIter = 0u; cacheIter < SOAD_BEST_MATCH_CACHE_SIZE; cacheIter++ )
+  {
+    if ( (SoAd_BestMatch_Cache[cacheIter].Valid == TRUE) &&
+      (SoAd_BestMatch_Cache[cacheIter].SoConStartIdx == SoConStartEndIdxStruct.SoConStartIdx) &&
+      (SoAd_BestMatch_Cache[cacheIter].SoConEndIdx == SoConStartEndIdxStruct.SoConEndIdx) &&
+      (SoAd_BestMatch_CacheIsEqualAddr(cacheIter, SockAddrPtr) == TRUE) )                                               /* SBSW_SOAD_POINTER_FORWARD */
+    {
+      SoAd_SizeOfSoConType listIter;
+
+      /* #20 Restore best match list of entry and mark entry as most recently used. */
+      for ( listIter = 0u; listIter < SoAd_BestMatch_Cache[cacheIter].ListSize; listIter++ )
+      {
+        SoAd_SetSoConIdxOfBestMatchSoConIdxList(bestMatchSoConIdxListStartIdx + listIter,                               /* SBSW_SOAD_CALCULATED_CHECKED_CSL03_CSL05 */
+          SoAd_BestMatch_Cache[cacheIter].SoConIdxList[listIter], SoConStartEndIdxStruct.PartitionIdx);
+      }
+      SoAd_BestMatch_CacheStamp++;
+      SoAd_BestMatch_Cache[cacheIter].LastUse = SoAd_BestMatch_CacheStamp;                                              /* SBSW_SOAD_BEST_MATCH_CACHE */
+      *ListSizePtr = SoAd_BestMatch_Cache[cacheIter].ListSize;                                                          /* SBSW_SOAD_POINTER_WRITE */
+      isHit = TRUE;
+      break;
+    }
+  }
+
+  return isHit;
+} /* SoAd_BestMatch_CacheLookup() */
+
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_CacheStore()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_BestMatch_CacheStore(
+  SoAd_BestMatch_SoConStartEndIdxType SoConStartEndIdxStruct,
+  P2CONST(SoAd_SockAddrType, AUTOMATIC, SOAD_APPL_VAR) SockAddrPtr,
+  SoAd_SizeOfSoConType ListSize)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  SoAd_SizeOfBestMatchSoConIdxListType bestMatchSoConIdxListStartIdx = SoAd_GetBestMatchSoConIdxListStartIdxOfInstance(
+    SoConStartEndIdxStruct.InstanceIdx, SoConStartEndIdxStruct.PartitionIdx);
+  uint32_least                         cacheIter;
+  uint32_least                         victimIdx = 0u;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if list fits into a cache entry. */
+  if ( ListSize <= SOAD_BEST_MATCH_CACHE_LIST_LEN )
+  {
+    SoAd_SizeOfSoConType listIter;
+
+    /* #20 Select an invalid entry or the least recently used entry. */
+    for ( cacheIter = 0u; cacheIter < SOAD_BEST_MATCH_CACHE_SIZE; cacheIter++ )
+    {
+      if ( SoAd_BestMatch_Cache[cacheIter].Valid == FALSE )
+      {
+        victimIdx = cacheIter;
+        break;
+      }
+      if ( SoAd_BestMatch_Cache[cacheIter].LastUse < SoAd_BestMatch_Cache[victimIdx].LastUse )
+      {
+        victimIdx = cacheIter;
+      }
+    }
+
+    /* #30 Store remote address, socket connection group and best match list in entry. */
+    /* PRQA S 310 1 */ /* MD_SoAd_PointerCastOnStruct */
+    SoAd_Util_CopySockAddr(SOAD_A_P2VAR(SoAd_SockAddrType)&SoAd_BestMatch_Cache[victimIdx].RemAddr, SockAddrPtr);       /* SBSW_SOAD_BEST_MATCH_CACHE */
+    SoAd_BestMatch_Cache[victimIdx].SoConStartIdx = SoConStartEndIdxStruct.SoConStartIdx;                               /* SBSW_SOAD_BEST_MATCH_CACHE */
+    SoAd_BestMatch_Cache[victimIdx].SoConEndIdx = SoConStartEndIdxStruct.SoConEndIdx;                                   /* SBSW_SOAD_BEST_MATCH_CACHE */
+    for ( listIter = 0u; listIter < ListSize; listIter++ )
+    {
+      SoAd_BestMatch_Cache[victimIdx].SoConIdxList[listIter] = SoAd_GetSoConIdxOfBestMatchSoConIdxList(                 /* SBSW_SOAD_BEST_MATCH_CACHE */
+        bestMatchSoConIdxListStartIdx + listIter, SoConStartEndIdxStruct.PartitionIdx);
+    }
+    SoAd_BestMatch_Cache[victimIdx].ListSize = ListSize;                                                                /* SBSW_SOAD_BEST_MATCH_CACHE */
+    SoAd_BestMatch_CacheStamp++;
+    SoAd_BestMatch_Cache[victimIdx].LastUse = SoAd_BestMatch_CacheStamp;                                                /* SBSW_SOAD_BEST_MATCH_CACHE */
+    SoAd_BestMatch_Cache[victimIdx].Valid = TRUE;                                                                       /* SBSW_SOAD_BEST_MATCH_CACHE */
+  }
+} /* SoAd_BestMatch_CacheStore() */
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  *********************************************************************************************************************/
@@ -201,8 +469,38 @@ FUNC(void, SOAD_CODE) SoAd_BestMatch_Init(
   /* #10 Reset best match list size. */
   SoAd_SetBestMatchListSizeOfInstanceDyn(InstanceIdx, 0u, PartitionIdx);                                               /* SBSW_SOAD_PARAMETER_IDX */
 
+  /* #20 Invalidate best match cache. */
+  SoAd_BestMatch_InvalidateCache(PartitionIdx);
 } /* SoAd_BestMatch_Init() */
 
+/**********************************************************************************************************************
+ *  SoAd_BestMatch_InvalidateCache()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, SOAD_CODE) SoAd_BestMatch_InvalidateCache(
+  SoAd_PartitionConfigIdxType PartitionIdx)
+{
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32_least cacheIter;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Mark all cache entries as invalid. */
+  for ( cacheIter = 0u; cacheIter < SOAD_BEST_MATCH_CACHE_SIZE; cacheIter++ )
+  {
+    SoAd_BestMatch_Cache[cacheIter].Valid = FALSE;                                                                      /* SBSW_SOAD_BEST_MATCH_CACHE */
+    SoAd_BestMatch_Cache[cacheIter].LastUse = 0u;                                                                       /* SBSW_SOAD_BEST_MATCH_CACHE */
+  }
+  SoAd_BestMatch_CacheStamp = 0u;
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
+
+  SOAD_DUMMY_STATEMENT(PartitionIdx); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint !e438 */
+} /* SoAd_BestMatch_InvalidateCache() */
+
 /**********************************************************************************************************************
  *  SoAd_BestMatch_DeriveList()
  *********************************************************************************************************************/
@@ -235,6 +533,7 @@ FUNC(void, SOAD_CODE) SoAd_BestMatch_DeriveList(
   SoAd_SizeOfBestMatchSoConIdxListType bestMatchSoConIdxListEndIdx = SoAd_GetBestMatchSoConIdxListEndIdxOfInstance(
     SoConStartEndIdxStruct.InstanceIdx, SoConStartEndIdxStruct.PartitionIdx);
   SoAd_BestMatchPrioType               bestMatchPrio = SOAD_BEST_MATCH_NONE;
+  boolean                              isCached = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
   /* #10 Reset best match list size. */
@@ -244,53 +543,75 @@ FUNC(void, SOAD_CODE) SoAd_BestMatch_DeriveList(
   if ( (SoConStartEndIdxStruct.SoConEndIdx - SoConStartEndIdxStruct.SoConStartIdx) <=
     (bestMatchSoConIdxListEndIdx - bestMatchSoConIdxListStartIdx) )
   {
-    /* #30 Iterate over all socket connections. */
-    for ( soConIter = SoConStartEndIdxStruct.SoConStartIdx; soConIter < SoConStartEndIdxStruct.SoConEndIdx;
-      soConIter++ )
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+    /* #21 Restore list from cache if derived for this remote address before (not if socket connection mode is
+     *     considered since mode changes do not invalidate the cache). */
+    if ( ConsiderReconnectOnly == FALSE )
     {
-      const SoAd_SizeOfSoConType soConIdxTmp = (SoAd_SizeOfSoConType)soConIter;
+      isCached = SoAd_BestMatch_CacheLookup(SoConStartEndIdxStruct, SockAddrPtr, &soConIdxListSize);                    /* SBSW_SOAD_POINTER_AND_VARIABLE_POINTER_FORWARD */
+    }
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
 
-      /* #40 Check if socket connection mode reconnect is considered only. */
+    /* #22 Derive list if it is not restored from cache. */
+    if ( isCached == FALSE )
+    {
+      /* #30 Iterate over all socket connections. */
+      for ( soConIter = SoConStartEndIdxStruct.SoConStartIdx; soConIter < SoConStartEndIdxStruct.SoConEndIdx;
+        soConIter++ )
+      {
+        const SoAd_SizeOfSoConType soConIdxTmp = (SoAd_SizeOfSoConType)soConIter;
+
+        /* #40 Check if socket connection mode reconnect is considered only. */
 #if ( SOAD_TCP == STD_ON )
-      /* PRQA S 3415 2 */ /* MD_SoAd_RightHandOperandWithoutSideEffects */
-      if ( (ConsiderReconnectOnly == FALSE) ||
-        (SoAd_SoCon_GetMode(soConIdxTmp, SoConStartEndIdxStruct.PartitionIdx) == SOAD_SOCON_RECONNECT) )
+        /* PRQA S 3415 2 */ /* MD_SoAd_RightHandOperandWithoutSideEffects */
+        if ( (ConsiderReconnectOnly == FALSE) ||
+          (SoAd_SoCon_GetMode(soConIdxTmp, SoConStartEndIdxStruct.PartitionIdx) == SOAD_SOCON_RECONNECT) )
 #else
-      SOAD_DUMMY_STATEMENT(ConsiderReconnectOnly); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint !e438 */
+        SOAD_DUMMY_STATEMENT(ConsiderReconnectOnly); /* PRQA S 1338, 2983, 3112 */ /* MD_MSR_DummyStmt */ /*lint !e438 */
 #endif /* SOAD_TCP == STD_ON */
-      {
-        /* #50 Get best match priority of current socket connection. */
-        const SoAd_BestMatchPrioType bestMatchPrioTmp = SoAd_BestMatch_GetPrio(soConIdxTmp,
-          SoConStartEndIdxStruct.PartitionIdx, SockAddrPtr);                                                           /* SBSW_SOAD_POINTER_FORWARD */
-
-        /* #60 Store current socket connection if best match priority is higher than the highest priority up to now. */
-        if ( bestMatchPrioTmp > bestMatchPrio )
         {
-          bestMatchPrio = bestMatchPrioTmp;
-          SoAd_SetSoConIdxOfBestMatchSoConIdxList(bestMatchSoConIdxListStartIdx, soConIdxTmp,                          /* SBSW_SOAD_CSL02_CSL05 */
-            SoConStartEndIdxStruct.PartitionIdx);
-          soConIdxListSize = 1u;
+          /* #50 Get best match priority of current socket connection. */
+          const SoAd_BestMatchPrioType bestMatchPrioTmp = SoAd_BestMatch_GetPrio(soConIdxTmp,
+            SoConStartEndIdxStruct.PartitionIdx, SockAddrPtr);                                                          /* SBSW_SOAD_POINTER_FORWARD */
 
-          /* #600 Stop iteration if best match with highest priority has been found (i.e. IP and port match). */
-          if ( bestMatchPrio == SOAD_BEST_MATCH_IP_MATCH_PORT_MATCH )
+          /* #60 Store current socket connection if best match priority is higher than the highest priority up to
+           *     now. */
+          if ( bestMatchPrioTmp > bestMatchPrio )
           {
-            break;
+            bestMatchPrio = bestMatchPrioTmp;
+            SoAd_SetSoConIdxOfBestMatchSoConIdxList(bestMatchSoConIdxListStartIdx, soConIdxTmp,                         /* SBSW_SOAD_CSL02_CSL05 */
+              SoConStartEndIdxStruct.PartitionIdx);
+            soConIdxListSize = 1u;
+
+            /* #600 Stop iteration if best match with highest priority has been found (i.e. IP and port match). */
+            if ( bestMatchPrio == SOAD_BEST_MATCH_IP_MATCH_PORT_MATCH )
+            {
+              break;
+            }
+          }
+          /* #61 Store current socket connection additionally if best match priority is equal to the highest and not
+           *     none. */
+          else if ( (bestMatchPrioTmp == bestMatchPrio) && (bestMatchPrioTmp != SOAD_BEST_MATCH_NONE) )
+          {
+            SoAd_SetSoConIdxOfBestMatchSoConIdxList(bestMatchSoConIdxListStartIdx + soConIdxListSize, soConIdxTmp,      /* SBSW_SOAD_CALCULATED_CHECKED_CSL03_CSL05 */
+              SoConStartEndIdxStruct.PartitionIdx);
+            soConIdxListSize++;
+          }
+          /* #62 Continue without any action if best match priority is lower than the highest priority up to now. */
+          else
+          {
+            /* Nothing to do. */
           }
         }
-        /* #61 Store current socket connection additionally if best match priority is equal to the highest and not
-         *     none. */
-        else if ( (bestMatchPrioTmp == bestMatchPrio) && (bestMatchPrioTmp != SOAD_BEST_MATCH_NONE) )
-        {
-          SoAd_SetSoConIdxOfBestMatchSoConIdxList(bestMatchSoConIdxListStartIdx + soConIdxListSize, soConIdxTmp,       /* SBSW_SOAD_CALCULATED_CHECKED_CSL03_CSL05 */
-            SoConStartEndIdxStruct.PartitionIdx);
-          soConIdxListSize++;
-        }
-        /* #62 Continue without any action if best match priority is lower than the highest priority up to now. */
-        else
-        {
-          /* Nothing to do. */
-        }
       }
+
+#if ( SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON )
+      /* #63 Store derived list in cache. */
+      if ( ConsiderReconnectOnly == FALSE )
+      {
+        SoAd_BestMatch_CacheStore(SoConStartEndIdxStruct, SockAddrPtr, soConIdxListSize);                               /* SBSW_SOAD_POINTER_FORWARD */
+      }
+#endif /* SOAD_BEST_MATCH_CACHE_ENABLED == STD_ON */
     }
   }
 
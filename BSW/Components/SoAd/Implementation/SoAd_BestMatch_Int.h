@@ -69,7 +69,7 @@ typedef struct sSoAd_BestMatch_SoConStartEndIdxType
 /**********************************************************************************************************************
   SoAd_BestMatch_Init()
  *********************************************************************************************************************/
-/*! \brief       Initializes best match list size.
+/*! \brief       Initializes best match list size and invalidates the best match cache.
  *  \details     -
  *  \param[in]   InstanceIdx  Socket connection index.
  *                            [range: InstanceIdx < SoAd_GetSizeOfInstance()]
@@ -83,6 +83,21 @@ FUNC(void, SOAD_CODE) SoAd_BestMatch_Init(
   SoAd_SizeOfInstanceType InstanceIdx,
   SoAd_PartitionConfigIdxType PartitionIdx);
 
+/**********************************************************************************************************************
+  SoAd_BestMatch_InvalidateCache()
+ *********************************************************************************************************************/
+/*! \brief       Invalidates all lists in the best match cache.
+ *  \details     Has to be called whenever a remote address or remote address state of a socket connection changes
+ *               since the cached lists are derived from them.
+ *  \param[in]   PartitionIdx Partition index.
+ *                            [range: PartitionIdx < size of SoAd_PCPartitionConfig]
+ *  \pre         -
+ *  \context     TASK|ISR2
+ *  \reentrant   FALSE
+ *********************************************************************************************************************/
+FUNC(void, SOAD_CODE) SoAd_BestMatch_InvalidateCache(
+  SoAd_PartitionConfigIdxType PartitionIdx);
+
 /**********************************************************************************************************************
  *  SoAd_BestMatch_DeriveList()
  *********************************************************************************************************************/
@@ -180,7 +180,7 @@ SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_RemoteAddr_IsLocked(
  *  SoAd_RemoteAddr_Overwrite()
  *********************************************************************************************************************/
 /*! \brief       Overwrites current remote address and state with new one.
- *  \details     -
+ *  \details     Invalidates the best match cache.
  *  \param[in]   SoConIdx         Socket connection index.
  *                                [range: SoConIdx < SoAd_GetSizeOfSoCon()]
  *  \param[in]   PartitionIdx     Partition index.
@@ -562,6 +562,7 @@ SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_RemoteAddr_IsLocked(
  *
  *
  *
+ *
  */
 SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_RemoteAddr_Overwrite(
   SoAd_SizeOfSoConType SoConIdx,
@@ -577,6 +578,9 @@ SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_RemoteAddr_Overwrite(
 
   /* #20 Set remote address state. */
   SoAd_SetRemAddrStateDynOfSoConDyn(SoConIdx, RemAddrState, PartitionIdx);                                             /* SBSW_SOAD_CSL02_CSL05 */
+
+  /* #30 Invalidate best match cache since best match priorities depend on remote address and state. */
+  SoAd_BestMatch_InvalidateCache(PartitionIdx);
 } /* SoAd_RemoteAddr_Overwrite() */
 
 /**********************************************************************************************************************
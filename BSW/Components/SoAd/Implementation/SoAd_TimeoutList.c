@@ -48,6 +48,50 @@
  *  LOCAL CONSTANT MACROS
  *********************************************************************************************************************/
 
+/*! Enables the timer wheel for UDP alive supervision timeouts (refer to "Concept for TimeoutList"). Disabled by
+ *  default. */
+#if !defined (SOAD_TIMEOUT_LIST_UDP_ALIVE_WHEEL) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_TIMEOUT_LIST_UDP_ALIVE_WHEEL          STD_OFF
+#endif
+
+/*! Number of timer wheel slots per instance. Has to be a power of two. */
+#if !defined (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM           64u
+#endif
+
+/*! Number of socket connections handled by the timer wheel. Socket connections with a higher index use the list. */
+#if !defined (SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM         512u
+#endif
+
+/*! Number of instances handled by the timer wheel. Instances with a higher index use the list. */
+#if !defined (SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM       2u
+#endif
+
+/* The timer wheel is stored in module-local variables which are not partition specific. */
+#if ( (SOAD_TIMEOUT_LIST_UDP_ALIVE_WHEEL == STD_ON) && (SOAD_MULTI_PARTITION != STD_ON) )
+# define SOAD_TIMEOUT_LIST_WHEEL_ENABLED            STD_ON
+#else
+# define SOAD_TIMEOUT_LIST_WHEEL_ENABLED            STD_OFF
+#endif /* (SOAD_TIMEOUT_LIST_UDP_ALIVE_WHEEL == STD_ON) && (SOAD_MULTI_PARTITION != STD_ON) */
+
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+# if ( (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM & (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM - 1u)) != 0u )
+#  error "SoAd_TimeoutList: SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM has to be a power of two"
+# endif
+# if ( SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM >= 0xFFFFu )
+#  error "SoAd_TimeoutList: SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM has to be smaller than 65535"
+# endif
+/*! Invalid timer wheel element index marking the end of a slot chain. */
+# define SOAD_TIMEOUT_LIST_WHEEL_INV_IDX            0xFFFFu
+/*! Flag in the element index of the UDP alive supervision timeout check indicating that the timer wheel is checked
+ *  completely and the list is checked. */
+# define SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG      0x80000000u
+#else
+# define SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG      0x00000000u
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
  *********************************************************************************************************************/
@@ -68,6 +112,40 @@
  *  LOCAL DATA PROTOTYPES
  *********************************************************************************************************************/
 
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+# define SOAD_START_SEC_VAR_NO_INIT_32
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+/*! Timer counter value at which the UDP alive supervision timeout of a socket connection in the timer wheel exceeds. */
+SOAD_LOCAL VAR(uint32, SOAD_VAR_NO_INIT) SoAd_TimeoutListWheelTimeout[SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM];
+
+# define SOAD_STOP_SEC_VAR_NO_INIT_32
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+# define SOAD_START_SEC_VAR_NO_INIT_16
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+/*! First socket connection of each timer wheel slot per instance. */
+SOAD_LOCAL VAR(uint16, SOAD_VAR_NO_INIT)
+  SoAd_TimeoutListWheelHead[SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM][SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM];
+/*! Next socket connection in the same timer wheel slot. */
+SOAD_LOCAL VAR(uint16, SOAD_VAR_NO_INIT) SoAd_TimeoutListWheelNext[SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM];
+/*! Previous socket connection in the same timer wheel slot. */
+SOAD_LOCAL VAR(uint16, SOAD_VAR_NO_INIT) SoAd_TimeoutListWheelPrev[SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM];
+
+# define SOAD_STOP_SEC_VAR_NO_INIT_16
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+# define SOAD_START_SEC_VAR_NO_INIT_8
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+
+/*! Indicates if a socket connection is linked into the timer wheel. */
+SOAD_LOCAL VAR(boolean, SOAD_VAR_NO_INIT) SoAd_TimeoutListWheelLinked[SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM];
+
+# define SOAD_STOP_SEC_VAR_NO_INIT_8
+# include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  GLOBAL DATA
  *********************************************************************************************************************/
@@ -79,10 +157,293 @@
 #define SOAD_START_SEC_CODE
 #include "SoAd_MemMap.h"  /* PRQA S 5087 */  /* MD_MSR_MemMap */
 
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelInit()
+ *********************************************************************************************************************/
+/*! \brief        Initializes the timer wheel.
+ *  \details      -
+ *  \pre          -
+ *  \context      TASK
+ *  \reentrant    FALSE
+ *  \synchronous  TRUE
+ *********************************************************************************************************************/
+SOAD_LOCAL FUNC(void, SOAD_CODE) SoAd_TimeoutList_WheelInit(void);
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelIsUsed()
+ *********************************************************************************************************************/
+/*! \brief        Checks if the timer wheel handles the UDP alive supervision timeout of a socket connection.
+ *  \details      -
+ *  \param[in]    SoConIdx      Socket connection index.
+ *                              [range: SoConIdx < SoAd_GetSizeOfSoCon()]
+ *  \param[in]    InstanceIdx   Instance index.
+ *                              [range: InstanceIdx < SoAd_GetSizeOfInstance()]
+ *  \return       TRUE          Timeout is handled by the timer wheel.
+ *  \return       FALSE         Timeout is handled by the list.
+ *  \pre          -
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_TimeoutList_WheelIsUsed(
+  SoAd_SizeOfSoConType SoConIdx,
+  SoAd_SizeOfInstanceType InstanceIdx);
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelLink()
+ *********************************************************************************************************************/
+/*! \brief        Links a socket connection into the timer wheel slot of its timeout.
+ *  \details      -
+ *  \param[in]    SoConIdx      Socket connection index.
+ *                              [range: SoConIdx < SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM]
+ *  \param[in]    InstanceIdx   Instance index.
+ *                              [range: InstanceIdx < SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM]
+ *  \param[in]    TimeoutCnt    Timer counter value at which the timeout exceeds.
+ *  \pre          Socket connection is not linked into the timer wheel. Called in critical section.
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_TimeoutList_WheelLink(
+  SoAd_SizeOfSoConType SoConIdx,
+  SoAd_SizeOfInstanceType InstanceIdx,
+  uint32 TimeoutCnt);
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelUnlink()
+ *********************************************************************************************************************/
+/*! \brief        Unlinks a socket connection from the timer wheel if linked.
+ *  \details      -
+ *  \param[in]    SoConIdx      Socket connection index.
+ *                              [range: SoConIdx < SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM]
+ *  \param[in]    InstanceIdx   Instance index.
+ *                              [range: InstanceIdx < SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM]
+ *  \pre          Called in critical section.
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_TimeoutList_WheelUnlink(
+  SoAd_SizeOfSoConType SoConIdx,
+  SoAd_SizeOfInstanceType InstanceIdx);
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelCheck()
+ *********************************************************************************************************************/
+/*! \brief        Checks for a UDP alive supervision timeout in the current timer wheel slot.
+ *  \details      Only the slot of the current timer counter value is checked. The element index is used as cursor to
+ *                continue with the next element of the slot in the following call. The element index is set to
+ *                indicate that the list has to be checked if the slot is checked completely.
+ *  \param[in,out] ElementIdxPtr Pointer to element index.
+ *  \param[out]   HandleIdxPtr  Pointer to socket connection index with timeout.
+ *  \param[in]    InstanceIdx   Instance index.
+ *                              [range: InstanceIdx < SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM]
+ *  \param[in]    TimerCounter  Running timer counter value.
+ *  \return       E_OK          Element with timeout found and out parameter are set.
+ *  \return       E_NOT_OK      No element with timeout found in timer wheel.
+ *  \pre          Called in critical section.
+ *  \context      TASK
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(Std_ReturnType, SOAD_CODE) SoAd_TimeoutList_WheelCheck(
+  P2VAR(uint32, AUTOMATIC, SOAD_APPL_VAR) ElementIdxPtr,
+  P2VAR(uint32, AUTOMATIC, SOAD_APPL_VAR) HandleIdxPtr,
+  SoAd_SizeOfInstanceType InstanceIdx,
+  uint32 TimerCounter);
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTIONS
  *********************************************************************************************************************/
 
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelInit()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SOAD_LOCAL FUNC(void, SOAD_CODE) SoAd_TimeoutList_WheelInit(void)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32_least wheelIter;
+  uint32_least slotIter;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Mark all socket connections as not linked. */
+  for ( wheelIter = 0u; wheelIter < SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM; wheelIter++ )
+  {
+    SoAd_TimeoutListWheelLinked[wheelIter] = FALSE;                                                                    /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+  }
+
+  /* #20 Mark all slots of all instances as empty. */
+  for ( wheelIter = 0u; wheelIter < SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM; wheelIter++ )
+  {
+    for ( slotIter = 0u; slotIter < SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM; slotIter++ )
+    {
+      SoAd_TimeoutListWheelHead[wheelIter][slotIter] = SOAD_TIMEOUT_LIST_WHEEL_INV_IDX;                                /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+    }
+  }
+} /* SoAd_TimeoutList_WheelInit() */
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelIsUsed()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_TimeoutList_WheelIsUsed(
+  SoAd_SizeOfSoConType SoConIdx,
+  SoAd_SizeOfInstanceType InstanceIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if socket connection and instance are in range of the timer wheel. */
+  return (boolean)(((uint32)SoConIdx < SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM) &&
+    ((uint32)InstanceIdx < SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM));
+} /* SoAd_TimeoutList_WheelIsUsed() */
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelLink()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_TimeoutList_WheelLink(
+  SoAd_SizeOfSoConType SoConIdx,
+  SoAd_SizeOfInstanceType InstanceIdx,
+  uint32 TimeoutCnt)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 slotIdx = TimeoutCnt & (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM - 1u);
+  uint16 headIdx = SoAd_TimeoutListWheelHead[InstanceIdx][slotIdx];
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Store timeout of socket connection. */
+  SoAd_TimeoutListWheelTimeout[SoConIdx] = TimeoutCnt;                                                                 /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+  SoAd_TimeoutListWheelLinked[SoConIdx] = TRUE;                                                                        /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+
+  /* #20 Insert socket connection at the front of the slot selected by the lower bits of the timeout. */
+  SoAd_TimeoutListWheelPrev[SoConIdx] = SOAD_TIMEOUT_LIST_WHEEL_INV_IDX;                                               /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+  SoAd_TimeoutListWheelNext[SoConIdx] = headIdx;                                                                       /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+  if ( headIdx != SOAD_TIMEOUT_LIST_WHEEL_INV_IDX )
+  {
+    SoAd_TimeoutListWheelPrev[headIdx] = (uint16)SoConIdx;                                                             /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+  }
+  SoAd_TimeoutListWheelHead[InstanceIdx][slotIdx] = (uint16)SoConIdx;                                                  /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+} /* SoAd_TimeoutList_WheelLink() */
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelUnlink()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(void, SOAD_CODE) SoAd_TimeoutList_WheelUnlink(
+  SoAd_SizeOfSoConType SoConIdx,
+  SoAd_SizeOfInstanceType InstanceIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if socket connection is linked. */
+  if ( SoAd_TimeoutListWheelLinked[SoConIdx] == TRUE )
+  {
+    uint16 prevIdx = SoAd_TimeoutListWheelPrev[SoConIdx];
+    uint16 nextIdx = SoAd_TimeoutListWheelNext[SoConIdx];
+
+    /* #20 Link predecessor or slot head to successor. */
+    if ( prevIdx != SOAD_TIMEOUT_LIST_WHEEL_INV_IDX )
+    {
+      SoAd_TimeoutListWheelNext[prevIdx] = nextIdx;                                                                    /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+    }
+    else
+    {
+      SoAd_TimeoutListWheelHead[InstanceIdx][SoAd_TimeoutListWheelTimeout[SoConIdx] &                                  /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+        (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM - 1u)] = nextIdx;
+    }
+
+    /* #30 Link successor to predecessor. */
+    if ( nextIdx != SOAD_TIMEOUT_LIST_WHEEL_INV_IDX )
+    {
+      SoAd_TimeoutListWheelPrev[nextIdx] = prevIdx;                                                                    /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+    }
+
+    SoAd_TimeoutListWheelLinked[SoConIdx] = FALSE;                                                                     /* SBSW_SOAD_TIMEOUT_LIST_WHEEL */
+  }
+} /* SoAd_TimeoutList_WheelUnlink() */
+
+/**********************************************************************************************************************
+ *  SoAd_TimeoutList_WheelCheck()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(Std_ReturnType, SOAD_CODE) SoAd_TimeoutList_WheelCheck(
+  P2VAR(uint32, AUTOMATIC, SOAD_APPL_VAR) ElementIdxPtr,
+  P2VAR(uint32, AUTOMATIC, SOAD_APPL_VAR) HandleIdxPtr,
+  SoAd_SizeOfInstanceType InstanceIdx,
+  uint32 TimerCounter)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32          slotIdx = TimerCounter & (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM - 1u);
+  uint32          cursorIdx = *ElementIdxPtr;
+  uint16          wheelIdx = SoAd_TimeoutListWheelHead[InstanceIdx][slotIdx];
+  Std_ReturnType  retVal = E_NOT_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Continue at cursor element (element index minus one) if it is still linked into the current slot. */
+  if ( (cursorIdx > 0u) && (cursorIdx <= SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM) )
+  {
+    cursorIdx--;
+    if ( (SoAd_TimeoutListWheelLinked[cursorIdx] == TRUE) &&
+      ((SoAd_TimeoutListWheelTimeout[cursorIdx] & (SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM - 1u)) == slotIdx) )
+    {
+      wheelIdx = (uint16)cursorIdx;
+    }
+  }
+
+  /* #20 Search slot for a timeout. Other elements of the slot exceed in one of the next wheel rotations. */
+  while ( wheelIdx != SOAD_TIMEOUT_LIST_WHEEL_INV_IDX )
+  {
+    if ( SoAd_TimeoutListWheelTimeout[wheelIdx] == TimerCounter )
+    {
+      /* #30 Return timeout and store successor as cursor or indicate that list has to be checked next. */
+      *HandleIdxPtr = (uint32)wheelIdx;                                                                                /* SBSW_SOAD_POINTER_WRITE */
+      if ( SoAd_TimeoutListWheelNext[wheelIdx] != SOAD_TIMEOUT_LIST_WHEEL_INV_IDX )
+      {
+        *ElementIdxPtr = (uint32)SoAd_TimeoutListWheelNext[wheelIdx] + 1u;                                             /* SBSW_SOAD_POINTER_WRITE */
+      }
+      else
+      {
+        *ElementIdxPtr = SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG;                                                        /* SBSW_SOAD_POINTER_WRITE */
+      }
+      retVal = E_OK;
+      break;
+    }
+    wheelIdx = SoAd_TimeoutListWheelNext[wheelIdx];
+  }
+
+  return retVal;
+} /* SoAd_TimeoutList_WheelCheck() */
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+
 /**********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  *********************************************************************************************************************/
@@ -125,6 +486,11 @@ FUNC(void, SOAD_CODE) SoAd_TimeoutList_Init(
       SoAd_GetSizeOfTimeoutListUdpAlive(PartitionIdx), PartitionIdx);
   }
 
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+  /* #21 Reset timer wheel for UDP alive supervision timeout. */
+  SoAd_TimeoutList_WheelInit();
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+
   /* #30 Reset timeout list for nPdu. */
   for ( timeoutListNPduUdpTxMapIter = 0u;
     timeoutListNPduUdpTxMapIter < SoAd_GetSizeOfTimeoutListNPduUdpTxMap(PartitionIdx);
@@ -205,27 +571,38 @@ FUNC(Std_ReturnType, SOAD_CODE) SoAd_TimeoutList_SetElement(
       timeListMgmtIdx = SoAd_GetTimeoutListMgmtIdxOfTimeoutListUdpAliveConfig(
         SoAd_GetTimeoutListUdpAliveConfigIdxOfTimeoutListIdent(timeoutListIdentIdx, PartitionIdx), PartitionIdx);
 
-      /* #300 Check if handle is not yet in list. */
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+      /* #300 Move handle to the timer wheel slot of the new timeout if handle is handled by the timer wheel. */
+      if ( SoAd_TimeoutList_WheelIsUsed(soConIdx, InstanceIdx) == TRUE )
+      {
+        SoAd_TimeoutList_WheelUnlink(soConIdx, InstanceIdx);
+        SoAd_TimeoutList_WheelLink(soConIdx, InstanceIdx, (uint32)(timerCounter + Timeout));
+
+        retVal = E_OK;
+      }
+      else
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+      /* #301 Check if handle is not yet in list. */
       if ( SoAd_GetTimeoutListUdpAliveIdxOfTimeoutListUdpAliveMap(soConIdx, PartitionIdx) ==
         SoAd_GetSizeOfTimeoutListUdpAlive(PartitionIdx) )
       {
-        /* #3000 Add handle to list. */
+        /* #3010 Add handle to list. */
         SoAd_SetSoConIdxOfTimeoutListUdpAlive(SoAd_GetLvlOfTimeoutListMgmt(timeListMgmtIdx, PartitionIdx), soConIdx,   /* SBSW_SOAD_CALCULATED_TimeoutListUdpAlive */
           PartitionIdx);
         SoAd_SetTimeoutOfTimeoutListUdpAlive(SoAd_GetLvlOfTimeoutListMgmt(timeListMgmtIdx, PartitionIdx),              /* SBSW_SOAD_CALCULATED_TimeoutListUdpAlive */
           (uint32)(timerCounter + Timeout), PartitionIdx);
 
-        /* #3001 Add used list index to socket connection to list index map. */
+        /* #3011 Add used list index to socket connection to list index map. */
         SoAd_SetTimeoutListUdpAliveIdxOfTimeoutListUdpAliveMap(soConIdx,                                               /* SBSW_SOAD_PARAMETER_IDX */
           (SoAd_SizeOfTimeoutListUdpAliveType)SoAd_GetLvlOfTimeoutListMgmt(timeListMgmtIdx, PartitionIdx),
           PartitionIdx);
 
-        /* #3002 Increment timeout list level. */
+        /* #3012 Increment timeout list level. */
         SoAd_IncLvlOfTimeoutListMgmt(timeListMgmtIdx, PartitionIdx);                                                   /* SBSW_SOAD_OPTIONAL_CSL03_CSL05 */
 
         retVal = E_OK;
       }
-      /* #301 Update timeout in list entry otherwise. */
+      /* #302 Update timeout in list entry otherwise. */
       else
       {
         SoAd_SetTimeoutOfTimeoutListUdpAlive(SoAd_GetTimeoutListUdpAliveIdxOfTimeoutListUdpAliveMap(soConIdx,          /* SBSW_SOAD_CALCULATED_TimeoutListUdpAlive */
@@ -373,10 +750,30 @@ FUNC(Std_ReturnType, SOAD_CODE) SoAd_TimeoutList_GetCurrentTimeout(
       soConIdx = (SoAd_SizeOfSoConType)HandleIdx;
       timeListUdpAliveIdx = SoAd_GetTimeoutListUdpAliveIdxOfTimeoutListUdpAliveMap(soConIdx, PartitionIdx);
 
-      /* #300 Check if handle is in list. */
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+      /* #300 Get current timeout value from timer wheel if handle is linked into the timer wheel. */
+      if ( ((uint32)soConIdx < SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM) &&
+        (SoAd_TimeoutListWheelLinked[soConIdx] == TRUE) )
+      {
+        uint32 currentTimeout = SoAd_TimeoutListWheelTimeout[soConIdx];
+
+        if ( currentTimeout >= TimerCounter )
+        { /* no timer counter overflow */
+          *TimeoutPtr = (uint32)(currentTimeout - TimerCounter);                                                       /* SBSW_SOAD_POINTER_WRITE */
+        }
+        else
+        { /* timer counter overflow */
+          *TimeoutPtr = (uint32)(currentTimeout + (SOAD_MAX_TIMEOUT_32 - TimerCounter));                               /* SBSW_SOAD_POINTER_WRITE */
+        }
+
+        retVal = E_OK;
+      }
+      else
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+      /* #301 Check if handle is in list. */
       if ( timeListUdpAliveIdx != SoAd_GetSizeOfTimeoutListUdpAlive(PartitionIdx) )
       {
-        /* #3000 Get current timeout value. */
+        /* #3010 Get current timeout value. */
         uint32 currentTimeout = SoAd_GetTimeoutOfTimeoutListUdpAlive(timeListUdpAliveIdx, PartitionIdx);
 
         if ( currentTimeout >= TimerCounter )
@@ -480,23 +877,37 @@ FUNC(Std_ReturnType, SOAD_CODE) SoAd_TimeoutList_CheckElements(
     case SOAD_TIMEOUT_LIST_UDP_ALIVE:
     {
       SoAd_TimeoutListUdpAliveIterType timeListUdpAliveIter;
+      uint32                           listElementIdx = *ElementIdxPtr & (~SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG);
 
       /* Optional indirection with constant index: Refer to precondition in function description. */
       timeListMgmtIdx = SoAd_GetTimeoutListMgmtIdxOfTimeoutListUdpAliveConfig(
         SoAd_GetTimeoutListUdpAliveConfigIdxOfTimeoutListIdent(timeoutListIdentIdx, partitionIdx), partitionIdx);
 
-      /* #300 Search for timeout. */
-      for ( timeListUdpAliveIter = (SoAd_SizeOfTimeoutListUdpAliveType)*ElementIdxPtr;
-        timeListUdpAliveIter < SoAd_GetLvlOfTimeoutListMgmt(timeListMgmtIdx, partitionIdx);
-        timeListUdpAliveIter++ )
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+      /* #300 Search for timeout in current timer wheel slot before list is searched. */
+      if ( ((*ElementIdxPtr & SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG) == 0u) &&
+        ((uint32)instanceIdx < SOAD_TIMEOUT_LIST_WHEEL_INSTANCE_NUM) )
+      {
+        retVal = SoAd_TimeoutList_WheelCheck(ElementIdxPtr, HandleIdxPtr, instanceIdx, timerCounter);                  /* SBSW_SOAD_POINTER_FORWARD */
+        listElementIdx = 0u;
+      }
+
+      if ( retVal != E_OK )
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
       {
-        if ( SoAd_GetTimeoutOfTimeoutListUdpAlive(timeListUdpAliveIter, partitionIdx) == timerCounter )
+        /* #301 Search for timeout in list. */
+        for ( timeListUdpAliveIter = (SoAd_SizeOfTimeoutListUdpAliveType)listElementIdx;
+          timeListUdpAliveIter < SoAd_GetLvlOfTimeoutListMgmt(timeListMgmtIdx, partitionIdx);
+          timeListUdpAliveIter++ )
         {
-          /* #3000 Return first occurred timeout. */
-          *ElementIdxPtr = (uint32)timeListUdpAliveIter;                                                               /* SBSW_SOAD_POINTER_WRITE */
-          *HandleIdxPtr = SoAd_GetSoConIdxOfTimeoutListUdpAlive(timeListUdpAliveIter, partitionIdx);                   /* SBSW_SOAD_POINTER_WRITE */
-          retVal = E_OK;
-          break;
+          if ( SoAd_GetTimeoutOfTimeoutListUdpAlive(timeListUdpAliveIter, partitionIdx) == timerCounter )
+          {
+            /* #3010 Return first occurred timeout. */
+            *ElementIdxPtr = (uint32)timeListUdpAliveIter | SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG;                     /* SBSW_SOAD_POINTER_WRITE */
+            *HandleIdxPtr = SoAd_GetSoConIdxOfTimeoutListUdpAlive(timeListUdpAliveIter, partitionIdx);                 /* SBSW_SOAD_POINTER_WRITE */
+            retVal = E_OK;
+            break;
+          }
         }
       }
       break;
@@ -617,14 +1028,22 @@ FUNC(void, SOAD_CODE) SoAd_TimeoutList_RemoveElement(
       soConIdx = (SoAd_SizeOfSoConType)HandleIdx;
       timeListUdpAliveIdx = SoAd_GetTimeoutListUdpAliveIdxOfTimeoutListUdpAliveMap(soConIdx, PartitionIdx);
 
-      /* #300 Check if handle index has an element. */
+#if ( SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON )
+      /* #300 Unlink handle from timer wheel if handle is handled by the timer wheel. */
+      if ( SoAd_TimeoutList_WheelIsUsed(soConIdx, InstanceIdx) == TRUE )
+      {
+        SoAd_TimeoutList_WheelUnlink(soConIdx, InstanceIdx);
+      }
+      else
+#endif /* SOAD_TIMEOUT_LIST_WHEEL_ENABLED == STD_ON */
+      /* #301 Check if handle index has an element. */
       if ( timeListUdpAliveIdx != SoAd_GetSizeOfTimeoutListUdpAlive(PartitionIdx) )
       {
         /* Optional indirection with constant index: Refer to precondition in function description. */
         SoAd_SizeOfTimeoutListMgmtType timeListMgmtIdx = SoAd_GetTimeoutListMgmtIdxOfTimeoutListUdpAliveConfig(
           SoAd_GetTimeoutListUdpAliveConfigIdxOfTimeoutListIdent(timeoutListIdentIdx, PartitionIdx), PartitionIdx);
 
-        /* #3000 Remove element of handle index. */
+        /* #3010 Remove element of handle index. */
         SoAd_DecLvlOfTimeoutListMgmt(timeListMgmtIdx, PartitionIdx);                                                   /* SBSW_SOAD_OPTIONAL_CSL03_CSL05 */
         SoAd_SetTimeoutListUdpAliveIdxOfTimeoutListUdpAliveMap(soConIdx, SoAd_GetSizeOfTimeoutListUdpAlive(            /* SBSW_SOAD_PARAMETER_IDX */
           PartitionIdx), PartitionIdx);
@@ -633,10 +1052,10 @@ FUNC(void, SOAD_CODE) SoAd_TimeoutList_RemoveElement(
         lastTimeListUdpAliveIdx = (SoAd_SizeOfTimeoutListUdpAliveType)SoAd_GetLvlOfTimeoutListMgmt(timeListMgmtIdx,
           PartitionIdx);
 
-        /* #3001 Check if list has more elements. */
+        /* #3011 Check if list has more elements. */
         if ( (lastTimeListUdpAliveIdx > 0u) && (lastTimeListUdpAliveIdx != timeListUdpAliveIdx) )
         {
-          /* #30010 Replace removed element by last element. */
+          /* #30110 Replace removed element by last element. */
           /* Replace at index. */
           SoAd_SetSoConIdxOfTimeoutListUdpAlive(timeListUdpAliveIdx,                                                   /* SBSW_SOAD_CALCULATED_TimeoutListUdpAlive */
             SoAd_GetSoConIdxOfTimeoutListUdpAlive(lastTimeListUdpAliveIdx, PartitionIdx), PartitionIdx);
@@ -774,6 +1193,17 @@ FUNC(void, SOAD_CODE) SoAd_TimeoutList_RemoveElement(
   timeout list is not designed to have unused elements. Therefore, when a timeout exceeds and is removed from the
   timeout list the last timeout list element is moved to the index of the removed element.
 
+  UDP alive supervision timeouts are refreshed on each reception and exceed rarely. To avoid checking all socket
+  connections in each main function, they are stored in a hashed timer wheel if SOAD_TIMEOUT_LIST_UDP_ALIVE_WHEEL is
+  enabled (single partition configurations only). Each instance has SOAD_TIMEOUT_LIST_WHEEL_SLOT_NUM slots. A socket
+  connection is linked into a doubly linked chain of the slot selected by the lower bits of its timeout counter value.
+  Setting, updating and removing a timeout is done in constant time by unlinking and linking. In main function only
+  the slot of the current timer counter value is checked. Elements of this slot with a different timeout counter value
+  exceed in one of the next wheel rotations. While the caller iterates the timeouts, the element index is used as
+  cursor: 0 starts at the slot head, values up to SOAD_TIMEOUT_LIST_WHEEL_SO_CON_NUM continue at the element with
+  index value minus one and SOAD_TIMEOUT_LIST_UDP_ALIVE_LIST_FLAG marks that the list is checked. Socket connections
+  or instances exceeding the timer wheel size use the list.
+
 */
 
 /**********************************************************************************************************************
@@ -63,6 +63,14 @@
 /*! Number of retries to send an nPdu if nPdu becomes larger (caused by larger PDUs in trigger transmit calls). */
 #define SOAD_N_PDU_UDP_TX_QUEUE_RETRY_CNT_DIRECT    2u
 
+/*! Minimum free nPdu space (payload without PDU header) required to keep collecting PDUs. If less space is left after a
+ *  PDU is added or if the nPdu queue has no free element, the nPdu is considered full and is transmitted immediately
+ *  instead of waiting for its trigger timeout. 0 disables the early transmission (default). A value of 16 corresponds to
+ *  the size of a SOME/IP header, i.e. the smallest SOME/IP message. */
+#if !defined (SOAD_N_PDU_UDP_TX_FLUSH_RESERVE) /* COV_SOAD_COMPATIBILITY */
+# define SOAD_N_PDU_UDP_TX_FLUSH_RESERVE            0u
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
  *********************************************************************************************************************/
@@ -1409,6 +1417,27 @@ SOAD_LOCAL FUNC(Std_ReturnType, SOAD_CODE) SoAd_TxNPduUdp_SetTriggerTimeout(
   SoAd_SizeOfPduRouteDestType PduRouteDestIdx,
   SoAd_PartitionConfigIdxType PartitionIdx);
 
+/**********************************************************************************************************************
+ *  SoAd_TxNPduUdp_IsFull()
+ *********************************************************************************************************************/
+/*! \brief      Checks if an nPdu is full so that it can be transmitted without waiting for its trigger timeout.
+ *  \details    An nPdu is full if the queue has no free element or if the remaining nPdu size is smaller than
+ *              SOAD_N_PDU_UDP_TX_FLUSH_RESERVE (plus PDU header size if PDU header is enabled). An nPdu is never
+ *              considered full if SOAD_N_PDU_UDP_TX_FLUSH_RESERVE is 0.
+ *  \param[in]  NPduIdx           NPdu index.
+ *                                [range: NPduIdx < SoAd_GetSizeOfNPduUdpTx()]
+ *  \param[in]  PartitionIdx      Partition index.
+ *                                [range: PartitionIdx < size of SoAd_PCPartitionConfig]
+ *  \return     TRUE              NPdu is full.
+ *  \return     FALSE             NPdu can store further PDUs.
+ *  \pre        -
+ *  \context    TASK|ISR2
+ *  \reentrant  FALSE
+ *********************************************************************************************************************/
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_TxNPduUdp_IsFull(
+  SoAd_SizeOfNPduUdpTxType NPduIdx,
+  SoAd_PartitionConfigIdxType PartitionIdx);
+
 /**********************************************************************************************************************
  *  SoAd_TxNPduUdp_Clear()
  *********************************************************************************************************************/
@@ -3208,8 +3237,9 @@ SOAD_LOCAL_INLINE FUNC(Std_ReturnType, SOAD_CODE) SoAd_TxIf_UdpTransmitNPduQueue
       /* #1001 Try to add new PDU to nPdu again. */
       if ( SoAd_TxNPduUdp_QueueAddOrUpdateElement(PduRouteDestIdx, PartitionIdx, PduInfoPtr) == SOAD_NPDU_OK )         /* SBSW_SOAD_POINTER_FORWARD */
       {
-        /* #1002 Transmit nPdu now if trigger mode is set to always. */
-        if ( SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS )
+        /* #1002 Transmit nPdu now if trigger mode is set to always or if nPdu is full. */
+        if ( (SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS) ||
+          (SoAd_TxNPduUdp_IsFull(nPduIdx, PartitionIdx) == TRUE) )
         {
           SoAd_TxNPduUdp_QueueTransmit(nPduIdx, PartitionIdx);
         }
@@ -3228,8 +3258,9 @@ SOAD_LOCAL_INLINE FUNC(Std_ReturnType, SOAD_CODE) SoAd_TxIf_UdpTransmitNPduQueue
     /* #102 Handle nPdu in case new PDU is added to nPdu successfully. */
     case SOAD_NPDU_OK:
     {
-      /* #1020 Transmit nPdu now if trigger mode is set to always. */
-      if ( SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS )
+      /* #1020 Transmit nPdu now if trigger mode is set to always or if nPdu is full. */
+      if ( (SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS) ||
+        (SoAd_TxNPduUdp_IsFull(nPduIdx, PartitionIdx) == TRUE) )
       {
         SoAd_TxNPduUdp_QueueTransmit(nPduIdx, PartitionIdx);
       }
@@ -3286,8 +3317,9 @@ SOAD_LOCAL_INLINE FUNC(Std_ReturnType, SOAD_CODE) SoAd_TxIf_UdpTransmitNPduBuffe
       /* #1001 Try to add new PDU to nPdu again. */
       if ( SoAd_TxNPduUdp_BufferAddElement(pduRouteIdx, PduRouteDestIdx, PartitionIdx, PduInfoPtr) == SOAD_NPDU_OK )   /* SBSW_SOAD_POINTER_FORWARD */
       {
-        /* #1002 Transmit nPdu now if trigger mode is set to always. */
-        if ( SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS )
+        /* #1002 Transmit nPdu now if trigger mode is set to always or if nPdu is full. */
+        if ( (SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS) ||
+          (SoAd_TxNPduUdp_IsFull(nPduIdx, PartitionIdx) == TRUE) )
         {
           SoAd_TxNPduUdp_BufferSend(nPduIdx, PartitionIdx);
         }
@@ -3298,8 +3330,9 @@ SOAD_LOCAL_INLINE FUNC(Std_ReturnType, SOAD_CODE) SoAd_TxIf_UdpTransmitNPduBuffe
     /* #101 Handle nPdu in case new PDU is added to nPdu successfully. */
     case SOAD_NPDU_OK:
     {
-      /* #1010 Transmit nPdu now if trigger mode is set to always. */
-      if ( SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS )
+      /* #1010 Transmit nPdu now if trigger mode is set to always or if nPdu is full. */
+      if ( (SoAd_GetTxUdpTriggerModeOfPduRouteDest(PduRouteDestIdx, PartitionIdx) == SOAD_TX_UDP_TRIGGER_ALWAYS) ||
+        (SoAd_TxNPduUdp_IsFull(nPduIdx, PartitionIdx) == TRUE) )
       {
         SoAd_TxNPduUdp_BufferSend(nPduIdx, PartitionIdx);
       }
@@ -5611,6 +5644,60 @@ SOAD_LOCAL FUNC(Std_ReturnType, SOAD_CODE) SoAd_TxNPduUdp_SetTriggerTimeout(
   return retVal;
 } /* SoAd_TxNPduUdp_SetTriggerTimeout() */
 
+/**********************************************************************************************************************
+ *  SoAd_TxNPduUdp_IsFull()
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+SOAD_LOCAL_INLINE FUNC(boolean, SOAD_CODE) SoAd_TxNPduUdp_IsFull(
+  SoAd_SizeOfNPduUdpTxType NPduIdx,
+  SoAd_PartitionConfigIdxType PartitionIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  SoAd_SizeOfSoConType      soConIdx = SoAd_GetSoConIdxOfNPduUdpTx(NPduIdx, PartitionIdx);
+  SoAd_SizeOfSoConGrpType   soConGrpIdx = SoAd_GetSoConGrpIdxOfSoCon(soConIdx, PartitionIdx);
+  SoAd_SizeOfSocketUdpType  socketUdpIdx = SoAd_GetSocketUdpIdxOfSoConGrp(soConGrpIdx, PartitionIdx);
+  uint32                    reserveLen = SOAD_N_PDU_UDP_TX_FLUSH_RESERVE;
+  boolean                   isFull = FALSE;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if early transmission of full nPdus is enabled. */
+  if ( reserveLen > 0u )
+  {
+    /* #20 Consider PDU header of the next PDU in the required free size. */
+    if ( SoAd_IsPduHdrEnabledOfSoConGrp(soConGrpIdx, PartitionIdx) )
+    {
+      reserveLen += SOAD_PDU_HDR_SIZE;
+    }
+
+    /* #30 Check if nPdu queue has no free element. */
+    if ( SoAd_IsNPduUdpTxQueueUsedOfNPduUdpTx(NPduIdx, PartitionIdx) &&
+      (SoAd_GetLvlOfNPduUdpTxDyn(NPduIdx, PartitionIdx) >= SoAd_GetNPduUdpTxQueueSizeOfSocketUdp(socketUdpIdx,
+        PartitionIdx)) )
+    {
+      isFull = TRUE;
+    }
+    /* #40 Check if remaining nPdu size is too small for a further PDU otherwise. */
+    else if ( ((uint32)SoAd_GetTotalLenOfNPduUdpTxDyn(NPduIdx, PartitionIdx) + reserveLen) >
+      (uint32)SoAd_GetNPduUdpTxBufferMinOfSocketUdp(socketUdpIdx, PartitionIdx) )
+    {
+      isFull = TRUE;
+    }
+    else
+    {
+      /* Nothing to do. */
+    }
+  }
+
+  return isFull;
+} /* SoAd_TxNPduUdp_IsFull() */
+
 /**********************************************************************************************************************
  *  SoAd_TxNPduUdp_Clear()
  *********************************************************************************************************************/
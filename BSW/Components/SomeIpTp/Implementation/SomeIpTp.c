@@ -81,10 +81,41 @@
 /***********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  ***********************************************************************************************************************/
+#if (SOMEIPTP_RX_REORDER == STD_ON)
+/*! Segment received ahead of the expected offset during the reassembly of an Rx SDU. */
+typedef struct
+{
+  PduIdType     RxPduId;    /*!< Rx SDU the stored segment belongs to */
+  PduLengthType DataIndex;  /*!< Position of the stored payload within the SDU */
+  PduLengthType Length;     /*!< Length of the stored payload */
+  boolean       MoreSeg;    /*!< More segments flag of the stored segment */
+  boolean       Used;       /*!< Indicates if a segment is stored. The slot is owned by RxPduId until cleared. */
+  boolean       Forwarding; /*!< Indicates if the stored segment is currently copied to the upper layer */
+} SomeIpTp_RxReorderSlotType;
+#endif
  
 /***********************************************************************************************************************
  *  LOCAL DATA PROTOTYPES
  ***********************************************************************************************************************/
+#if (SOMEIPTP_RX_REORDER == STD_ON)
+# define SOMEIPTP_START_SEC_VAR_CLEARED_8
+# include "SomeIpTp_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/*! Payload of the segment received ahead of the expected offset */
+SOMEIPTP_LOCAL VAR(uint8, SOMEIPTP_VAR_CLEARED) SomeIpTp_RxReorderBuffer[SOMEIPTP_RX_REORDER_BUFFER_SIZE];
+
+# define SOMEIPTP_STOP_SEC_VAR_CLEARED_8
+# include "SomeIpTp_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+# define SOMEIPTP_START_SEC_VAR_CLEARED_UNSPECIFIED
+# include "SomeIpTp_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/*! Management data of the segment received ahead of the expected offset */
+SOMEIPTP_LOCAL VAR(SomeIpTp_RxReorderSlotType, SOMEIPTP_VAR_CLEARED) SomeIpTp_RxReorderSlot;
+
+# define SOMEIPTP_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+# include "SomeIpTp_MemMap.h" /* PRQA S 5087 */ /* MD_MSR_MemMap */
+#endif
 
 /***********************************************************************************************************************
  *  GLOBAL DATA
@@ -382,6 +413,66 @@ SOMEIPTP_LOCAL FUNC(boolean, SOMEIPTP_CODE) SomeIpTp_IsRxMetadataValid(PduIdType
  ***********************************************************************************************************************/
 SOMEIPTP_LOCAL FUNC(boolean, SOMEIPTP_CODE) SomeIpTp_IsMsgTypeTp(uint8 MsgType);
 
+# if (SOMEIPTP_RX_REORDER == STD_ON)
+/***********************************************************************************************************************
+ * SomeIpTp_RxReorderStoreCF()
+ ***********************************************************************************************************************/
+/*! \brief        Handles a segment which does not continue the data received so far
+ *  \details      Stores a segment received ahead of the expected offset in the reorder buffer so that it can be
+ *                forwarded once the missing segments are received. Duplicates of segments which are already
+ *                forwarded or stored are discarded.
+ *  \param[in]    RxPduId         Rx PDU ID. Shall be less than the size of SomeIpTp_RXNSdu.
+ *  \param[in]    PduInfoPtr      Pdu info passed by the lower layer. The passed buffer shall be at least as long as the
+ *                                SOME/IP TP header (12 bytes) plus PayloadLen plus the length of the PDU's metadata.
+ *  \param[in]    OffsetBytes     Position of the segment's payload within the SDU.
+ *  \param[in]    PayloadLen      Payload length of the segment.
+ *  \param[in]    TpSpecificBits  Offset field and flags of the SOME/IP TP header.
+ *  \return       SOMEIPTP_E_ASSEMBLY_INTERRUPT - Invalid payload length in the received frame
+ *  \return       SOMEIPTP_E_INCONSISTENT_SEQUENCE - Segment can neither be stored nor discarded
+ *  \return       SOMEIPTP_E_INCONSISTENT_METADATA - Metadata does not match between the received CFs
+ *  \return       SOMEIPTP_E_NO_ERROR - Segment is stored or discarded
+ *  \pre          Interrupts are enabled.
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE for different PDU IDs
+ *  \synchronous  TRUE
+ *  \config       This function is only available if SOMEIPTP_RX_REORDER_BUFFER_SIZE is greater than zero.
+ ***********************************************************************************************************************/
+SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_RxReorderStoreCF(VAR(PduIdType, SOMEIPTP_APPL_VAR) RxPduId,
+  P2CONST(PduInfoType, AUTOMATIC, SOMEIPTP_APPL_DATA) PduInfoPtr, uint32 OffsetBytes, PduLengthType PayloadLen,
+  uint32 TpSpecificBits);
+
+/***********************************************************************************************************************
+ * SomeIpTp_RxReorderForwardCF()
+ ***********************************************************************************************************************/
+/*! \brief        Forwards a stored segment to the upper layer if it continues the data received so far
+ *  \details      -
+ *  \param[in]    RxPduId     Rx PDU ID. Shall be less than the size of SomeIpTp_RXNSdu.
+ *  \return       SOMEIPTP_E_ASSEMBLY_INTERRUPT - No availabe buffer from the upper layer
+ *  \return       SOMEIPTP_E_NO_ERROR - No error
+ *  \pre          Interrupts are enabled.
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE for different PDU IDs
+ *  \synchronous  TRUE
+ *  \config       This function is only available if SOMEIPTP_RX_REORDER_BUFFER_SIZE is greater than zero.
+ ***********************************************************************************************************************/
+SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_RxReorderForwardCF(VAR(PduIdType, SOMEIPTP_APPL_VAR) RxPduId);
+
+/***********************************************************************************************************************
+ * SomeIpTp_RxReorderRelease()
+ ***********************************************************************************************************************/
+/*! \brief        Releases the reorder buffer if it is owned by the given SDU
+ *  \details      Called whenever the reassembly of the SDU is finished, aborted or restarted. A segment which is
+ *                currently forwarded to the upper layer is released by SomeIpTp_RxReorderForwardCF() instead.
+ *  \param[in]    RxPduId     Rx PDU ID. Shall be less than the size of SomeIpTp_RXNSdu.
+ *  \pre          Interrupts are enabled.
+ *  \context      TASK|ISR2
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \config       This function is only available if SOMEIPTP_RX_REORDER_BUFFER_SIZE is greater than zero.
+ ***********************************************************************************************************************/
+SOMEIPTP_LOCAL FUNC(void, SOMEIPTP_CODE) SomeIpTp_RxReorderRelease(VAR(PduIdType, SOMEIPTP_APPL_VAR) RxPduId);
+# endif
+
 #endif
 
 /***********************************************************************************************************************
@@ -667,6 +758,11 @@ SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_StartNewRxSession(VAR(PduIdTy
   SomeIpTp_RxStateIdxOfRXNSduType lRxStateIdx = SomeIpTp_GetRxStateIdxOfRXNSdu(Id);
   uint8 lErrorId = SOMEIPTP_E_NO_ERROR;
 
+# if (SOMEIPTP_RX_REORDER == STD_ON)
+  /* Discard a segment stored for the previous session of this SDU. */
+  SomeIpTp_RxReorderRelease(Id);
+# endif
+
   /* Store the SOME/IP header, to use it as reference for the next segments. */
   SomeIpTp_StoreRxShortHeader(Id, PduInfoPtr->SduDataPtr);  /* SBSW_SOMEIPTP_CALL_INTERNAL_RCHECK */
 
@@ -877,12 +973,194 @@ SOMEIPTP_LOCAL FUNC(boolean, SOMEIPTP_CODE) SomeIpTp_IsMsgTypeTp(uint8 MsgType)
   return (boolean)((MsgType & (uint8)SOMEIPTP_TPFLAG_8BIT_VAL) == SOMEIPTP_TPFLAG_8BIT_VAL); /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
 } /* SomeIpTp_IsMsgTypeTp */
 
+# if (SOMEIPTP_RX_REORDER == STD_ON)
 /***********************************************************************************************************************
- * SomeIpTp_ReceiveCF()
+ * SomeIpTp_RxReorderStoreCF()
+ ***********************************************************************************************************************/
+/*! 
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_RxReorderStoreCF(VAR(PduIdType, SOMEIPTP_APPL_VAR) RxPduId,
+  P2CONST(PduInfoType, AUTOMATIC, SOMEIPTP_APPL_DATA) PduInfoPtr, uint32 OffsetBytes, PduLengthType PayloadLen,
+  uint32 TpSpecificBits)
+{
+  SomeIpTp_RxStateIdxOfRXNSduType lRxStateIdx = SomeIpTp_GetRxStateIdxOfRXNSdu(RxPduId);
+  PduLengthType lDataIndex = SomeIpTp_GetDataIndexOfRxState(lRxStateIdx);
+  PduLengthType lAvailBufSize = SomeIpTp_GetAvailBufSizeOfRxState(lRxStateIdx);
+  uint8 lRuntimeErrId = SOMEIPTP_E_INCONSISTENT_SEQUENCE;
+
+  /* #10 If the segment was already forwarded to the upper layer, discard it. */
+  if((OffsetBytes < lDataIndex) && (PayloadLen <= (lDataIndex - OffsetBytes)))
+  {
+    lRuntimeErrId = SOMEIPTP_E_NO_ERROR;
+  }
+  /* #20 If the segment overlaps data already forwarded, does not fit in the reorder buffer or ends beyond the
+   *     available buffer of the upper layer, the sequence is inconsistent. */
+  else if((OffsetBytes < lDataIndex) || (PayloadLen > SOMEIPTP_RX_REORDER_BUFFER_SIZE) ||
+    (PayloadLen > lAvailBufSize) || ((OffsetBytes - lDataIndex) > (uint32)(lAvailBufSize - PayloadLen)))
+  {
+    /* Inconsistent sequence. */
+  }
+  /* #30 If more seg flag is set and payload is not 16 byte aligned, set SOMEIPTP_E_ASSEMBLY_INTERRUPT. */
+  else if((SomeIpTp_IsMoreSegFlagSet(TpSpecificBits) == TRUE) &&
+    (SomeIpTp_IsPayloadSixteenByteAligned(PayloadLen) == FALSE)) /* PRQA S 3415 */ /* MD_SomeIpTp_3415 */
+  {
+    lRuntimeErrId = SOMEIPTP_E_ASSEMBLY_INTERRUPT;
+  }
+#  if (SOMEIPTP_RXMETADATALENGTHOFRXNSDU == STD_ON)
+  /* #40 If the metadata is inconsistent, set SOMEIPTP_E_INCONSISTENT_METADATA. */
+  else if((SomeIpTp_GetRxMetadataLengthOfRXNSdu(RxPduId) > 0u) &&
+    (SomeIpTp_IsRxMetadataValid(RxPduId, &PduInfoPtr->SduDataPtr[PduInfoPtr->SduLength - SomeIpTp_GetRxMetadataLengthOfRXNSdu(RxPduId)]) == FALSE)) /* PRQA S 3415 */ /* MD_SomeIpTp_3415 */ /* SBSW_SOMEIPTP_CALL_INTERNAL_RCHECK */
+  {
+    lRuntimeErrId = SOMEIPTP_E_INCONSISTENT_METADATA;
+  }
+#  endif
+  else
+  {
+    SchM_Enter_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+    /* #50 If the reorder buffer is not owned by any SDU, store the segment and restart the Rx timer. */
+    if(SomeIpTp_RxReorderSlot.Used == FALSE)
+    {
+      PduLengthType lIdx;
+
+      for(lIdx = 0u; lIdx < PayloadLen; lIdx++)
+      {
+        SomeIpTp_RxReorderBuffer[lIdx] = PduInfoPtr->SduDataPtr[SOMEIPTP_LONG_HEADER_LENGTH + lIdx]; /* SBSW_SOMEIPTP_WRT_REORDERBUFFER */
+      }
+      SomeIpTp_RxReorderSlot.RxPduId = RxPduId;
+      SomeIpTp_RxReorderSlot.DataIndex = (PduLengthType)OffsetBytes;
+      SomeIpTp_RxReorderSlot.Length = PayloadLen;
+      SomeIpTp_RxReorderSlot.MoreSeg = SomeIpTp_IsMoreSegFlagSet(TpSpecificBits);
+      SomeIpTp_RxReorderSlot.Used = TRUE;
+
+      SomeIpTp_SetTimerOfRxState(lRxStateIdx,                    /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
+        SomeIpTp_GetRxTimeoutTimeOfChannel(SomeIpTp_GetChannelIdxOfRXNSdu(RxPduId)));
+      lRuntimeErrId = SOMEIPTP_E_NO_ERROR;
+    }
+    /* #60 Otherwise, discard the segment if the same segment is already stored for this SDU. */
+    else if((SomeIpTp_RxReorderSlot.RxPduId == RxPduId) && (SomeIpTp_RxReorderSlot.DataIndex == OffsetBytes))
+    {
+      lRuntimeErrId = SOMEIPTP_E_NO_ERROR;
+    }
+    else
+    {
+      /* Inconsistent sequence. */
+    }
+    SchM_Exit_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+  }
+
+  return lRuntimeErrId;
+} /* SomeIpTp_RxReorderStoreCF */
+
+/***********************************************************************************************************************
+ * SomeIpTp_RxReorderForwardCF()
+ ***********************************************************************************************************************/
+/*! 
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_RxReorderForwardCF(VAR(PduIdType, SOMEIPTP_APPL_VAR) RxPduId)
+{
+  SomeIpTp_RxStateIdxOfRXNSduType lRxStateIdx = SomeIpTp_GetRxStateIdxOfRXNSdu(RxPduId);
+  PduLengthType lLength = 0u;
+  boolean lMoreSeg = FALSE;
+  boolean lStored = FALSE;
+  uint8 lRuntimeErrId = SOMEIPTP_E_NO_ERROR;
+
+  /* #10 Check if a segment is stored for this SDU that continues the data received so far, take over its length
+   *     and more seg flag and mark it as forwarded. The slot is shared by all Rx SDUs, but is not taken over or
+   *     released by others while this SDU owns it. */
+  SchM_Enter_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+  if((SomeIpTp_RxReorderSlot.Used == TRUE) && (SomeIpTp_RxReorderSlot.RxPduId == RxPduId) &&
+    (SomeIpTp_RxReorderSlot.DataIndex == SomeIpTp_GetDataIndexOfRxState(lRxStateIdx))) /* PRQA S 3415 */ /* MD_SomeIpTp_3415 */
+  {
+    lLength = SomeIpTp_RxReorderSlot.Length;
+    lMoreSeg = SomeIpTp_RxReorderSlot.MoreSeg;
+    SomeIpTp_RxReorderSlot.Forwarding = TRUE;
+    lStored = TRUE;
+  }
+  SchM_Exit_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+
+  /* #20 If so: */
+  if(lStored == TRUE)
+  {
+    PduInfoType lPduInfo;
+    PduLengthType lBufSize;
+    boolean lCopied = FALSE;
+
+    lPduInfo.SduDataPtr = SomeIpTp_RxReorderBuffer;
+    lPduInfo.SduLength = lLength;
+
+    /* #30 Copy the stored segment to the upper layer and release the reorder buffer afterwards. */
+    if((SomeIpTp_GetAvailBufSizeOfRxState(lRxStateIdx) >= lLength) &&
+      (PduR_SomeIpTpCopyRxData(SomeIpTp_GetUpperLayerIdOfRXNSdu(RxPduId), &lPduInfo, &lBufSize) == BUFREQ_OK)) /* PRQA S 3415 */ /* MD_SomeIpTp_3415 */ /* SBSW_SOMEIPTP_CALL_COPYRXDATA */
+    {
+      lCopied = TRUE;
+    }
+
+    SchM_Enter_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+    SomeIpTp_RxReorderSlot.Forwarding = FALSE;
+    SomeIpTp_RxReorderSlot.Used = FALSE;
+    SchM_Exit_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+
+    if(lCopied == TRUE)
+    {
+      /* #40 If more segments follow, update the data index and available buffer for the next segment.
+       *     Otherwise give Rx Indication to the upper layer indicating the last frame received. */
+      if(lMoreSeg == TRUE)
+      {
+        SomeIpTp_SetDataIndexOfRxState(lRxStateIdx, SomeIpTp_GetDataIndexOfRxState(lRxStateIdx) + lLength); /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
+        SomeIpTp_SetAvailBufSizeOfRxState(lRxStateIdx, lBufSize);  /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
+      }
+      else
+      {
+        PduR_SomeIpTpRxIndication(SomeIpTp_GetUpperLayerIdOfRXNSdu(RxPduId), E_OK);
+        SomeIpTp_SetStatusOfRxState(lRxStateIdx, SOMEIPTP_RX_STATUS_IDLE);  /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
+      }
+    }
+    /* #50 Otherwise set the runtime error to SOMEIPTP_E_ASSEMBLY_INTERRUPT. */
+    else
+    {
+      lRuntimeErrId = SOMEIPTP_E_ASSEMBLY_INTERRUPT;
+    }
+  }
+
+  return lRuntimeErrId;
+} /* SomeIpTp_RxReorderForwardCF */
+
+/***********************************************************************************************************************
+ * SomeIpTp_RxReorderRelease()
  ***********************************************************************************************************************/
 /*! 
  * Internal comment removed.
  *
+ */
+SOMEIPTP_LOCAL FUNC(void, SOMEIPTP_CODE) SomeIpTp_RxReorderRelease(VAR(PduIdType, SOMEIPTP_APPL_VAR) RxPduId)
+{
+  /* #10 Discard the segment stored for this SDU unless it is currently forwarded to the upper layer. */
+  SchM_Enter_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+  if((SomeIpTp_RxReorderSlot.RxPduId == RxPduId) && (SomeIpTp_RxReorderSlot.Forwarding == FALSE))
+  {
+    SomeIpTp_RxReorderSlot.Used = FALSE;
+  }
+  SchM_Exit_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+} /* SomeIpTp_RxReorderRelease */
+# endif
+
+/***********************************************************************************************************************
+ * SomeIpTp_ReceiveCF()
+ ***********************************************************************************************************************/
+/*! 
+ * Internal comment removed.
  *
  *
  *
@@ -979,10 +1257,17 @@ SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_ReceiveCF(VAR(PduIdType, SOME
         /* 1. Inconsistent header. */
         lRuntimeErrId = SOMEIPTP_E_INCONSISTENT_HEADER;
       }
-      /* 2. Received offset does not match with the payload received in the previous segments. */
+      /* 2. Received offset does not match with the payload received in the previous segments.
+       *    If reordering is enabled, segments received ahead of the expected offset are stored and duplicates are
+       *    discarded instead. */
       else if((lOffsetVal * SOMEIPTP_DATA_ALIGNMENT_LENGTH) != SomeIpTp_GetDataIndexOfRxState(lRxStateIdx))
       {
+#if (SOMEIPTP_RX_REORDER == STD_ON)
+        lRuntimeErrId = SomeIpTp_RxReorderStoreCF(RxPduId, PduInfoPtr,  /* SBSW_SOMEIPTP_CALL_INTERNAL_RCHECK */
+          (lOffsetVal * SOMEIPTP_DATA_ALIGNMENT_LENGTH), lPayloadLen, lTpSpecificBits);
+#else
         lRuntimeErrId = SOMEIPTP_E_INCONSISTENT_SEQUENCE;
+#endif
       }
       /* 3.Received payload does not fit in the available buffer. */
       else if(SomeIpTp_GetAvailBufSizeOfRxState(lRxStateIdx) < lPayloadLen)
@@ -1015,6 +1300,10 @@ SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_ReceiveCF(VAR(PduIdType, SOME
             SomeIpTp_SetAvailBufSizeOfRxState(lRxStateIdx, lBufSize);  /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
             SomeIpTp_SetTimerOfRxState(lRxStateIdx,                    /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
               SomeIpTp_GetRxTimeoutTimeOfChannel(SomeIpTp_GetChannelIdxOfRXNSdu(RxPduId)));
+#if (SOMEIPTP_RX_REORDER == STD_ON)
+            /* Forward a stored segment which continues the received data (if reordering is enabled). */
+            lRuntimeErrId = SomeIpTp_RxReorderForwardCF(RxPduId);
+#endif
           }
           /* #252 Otherwise set the runtime error to SOMEIPTP_E_ASSEMBLY_INTERRUPT. */
           else  /* 6. if upperlayer returns other than BUFREQ_OK */
@@ -1033,6 +1322,9 @@ SOMEIPTP_LOCAL FUNC(uint8, SOMEIPTP_CODE) SomeIpTp_ReceiveCF(VAR(PduIdType, SOME
             PduR_SomeIpTpRxIndication(lULId, E_OK);
             /* Reset the Pdu state to Idle */
             SomeIpTp_SetStatusOfRxState(lRxStateIdx, SOMEIPTP_RX_STATUS_IDLE);  /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
+#if (SOMEIPTP_RX_REORDER == STD_ON)
+            SomeIpTp_RxReorderRelease(RxPduId);
+#endif
           }
           else  /* 6. if upperlayer returns other than BUFREQ_OK */
           {
@@ -1218,6 +1510,10 @@ FUNC(void, SOMEIPTP_CODE) SomeIpTp_Init(P2CONST(SomeIpTp_ConfigType, AUTOMATIC,
         {
           SomeIpTp_SetStatusOfRxState(lRxIndex, SOMEIPTP_RX_STATUS_IDLE);  /* SBSW_SOMEIPTP_WRT_CSL01_RXSTATE */
         }
+# if (SOMEIPTP_RX_REORDER == STD_ON)
+        SomeIpTp_RxReorderSlot.Used = FALSE;
+        SomeIpTp_RxReorderSlot.Forwarding = FALSE;
+# endif
       }
 #endif
        /* #30 Set the module state to Initialized. */
@@ -1923,6 +2219,9 @@ FUNC(void, SOMEIPTP_CODE) SomeIpTp_RxIndication(VAR(PduIdType, SOMEIPTP_APPL_VAR
       SomeIpTp_ReportRuntimeDet(SOMEIPTP_SID_RXINDICATION, lRuntimeErrId);
       PduR_SomeIpTpRxIndication(lULId, E_NOT_OK);
       SomeIpTp_SetStatusOfRxState(lRxStateIdx, SOMEIPTP_RX_STATUS_IDLE);  /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
+# if (SOMEIPTP_RX_REORDER == STD_ON)
+      SomeIpTp_RxReorderRelease(RxPduId);
+# endif
     }
   }
   /* ----- Development Error Report --------------------------------------- */
@@ -1987,6 +2286,9 @@ FUNC(void, SOMEIPTP_CODE) SomeIpTp_MainFunctionRx(void)  /* PRQA S 6080 */ /* MD
               /* \trace CREQ-169363 */
               SomeIpTp_SetStatusOfRxState(lRxStateIdx, SOMEIPTP_RX_STATUS_IDLE);  /* SBSW_SOMEIPTP_WRT_CSL03_RXNSDU */
               SchM_Exit_SomeIpTp_SOMEIPTP_EXCLUSIVE_AREA_0();
+# if (SOMEIPTP_RX_REORDER == STD_ON)
+              SomeIpTp_RxReorderRelease((PduIdType)lSduIndex);
+# endif
               SomeIpTp_ReportRuntimeDet(SOMEIPTP_SID_MAINFUNCTION_RX, SOMEIPTP_E_ASSEMBLY_INTERRUPT);
               PduR_SomeIpTpRxIndication(SomeIpTp_GetUpperLayerIdOfRXNSdu(lSduIndex), E_NOT_OK);
             }
@@ -2089,6 +2391,13 @@ MD_SomeIpTp_3415: The right hand operand of '&&' or '||' has side effects.
   \ID SBSW_SOMEIPTP_WRT_MORESEGMENTS
     \DESCRIPTION    Write access to a variable using a passed pointer. 
     \COUNTERMEASURE \N The caller ensures the validity of the variable referenced by the pointer.
+
+  \ID SBSW_SOMEIPTP_WRT_REORDERBUFFER
+    \DESCRIPTION    Write access to SomeIpTp_RxReorderBuffer within SomeIpTp_RxReorderStoreCF with an index less than
+                    the payload length of the received segment.
+    \COUNTERMEASURE \R A runtime check ensures that the payload length does not exceed
+                       SOMEIPTP_RX_REORDER_BUFFER_SIZE. The caller ensures that the buffer referenced by PduInfoPtr
+                       contains the payload after the SOME/IP TP header.
   
 SBSW_JUSTIFICATION_END */
 
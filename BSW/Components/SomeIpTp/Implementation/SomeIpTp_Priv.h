@@ -77,6 +77,18 @@
 /* Default burst size */
 #define SOMEIPTP_DEFAULT_BURST_SIZE                   1u
 
+/* Size of the buffer holding one segment that is received ahead of the expected offset during reassembly.
+ * Reordering of received segments is disabled if the size is zero. */
+#if !defined (SOMEIPTP_RX_REORDER_BUFFER_SIZE)
+# define SOMEIPTP_RX_REORDER_BUFFER_SIZE              0u
+#endif
+
+#if ((SOMEIPTP_RXNSDU == STD_ON) && (SOMEIPTP_RX_REORDER_BUFFER_SIZE > 0u))
+# define SOMEIPTP_RX_REORDER                          STD_ON
+#else
+# define SOMEIPTP_RX_REORDER                          STD_OFF
+#endif
+
 /* ----- Modes ----- */
 # define SOMEIPTP_UNINIT                              (0x00u)
 # define SOMEIPTP_INIT                                (0x01u)
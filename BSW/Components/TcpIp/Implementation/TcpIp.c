@@ -1016,6 +1016,9 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpListen(
           if (TcpIp_Tcp_Open(socketTcpIdx, &SockAddrRem, TCPIP_TCP_PASSIVE_OPEN) == E_OK)
           {
             TcpIp_SetListenActiveConnStatOfSocketDyn(socketIdx, TCPIP_SOCK_CONN_LISTEN_ENABLED);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+            TcpIp_VSockDemuxUpdate(socketIdx);
+# endif
             TcpIp_SetMaxNumListenSocketsOfSocketTcpDyn(socketTcpIdx, MaxChannels);  /* set limit */
 
 # if (TCPIP_SUPPORT_ASRTLSSERVER == STD_ON )                                                                            /* COV_MSR_UNSUPPORTED */
@@ -1264,6 +1267,9 @@ TCPIP_LOCAL_INLINE FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpConnectInternal(
       if (TcpIp_Tcp_Open(SocketTcpIdx, RemoteAddrPtr, TCPIP_TCP_ACTIVE_OPEN) == E_OK)
       {
         TcpIp_SetListenActiveConnStatOfSocketDyn(socketIdx, TCPIP_SOCK_CONN_ACTIVE);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+        TcpIp_VSockDemuxUpdate(socketIdx);
+# endif
         /* retVal is already set to E_OK */
       }
       else
@@ -1368,6 +1374,89 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmit(
 
   return retVal;
 }
+
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_TcpTransmitPBuf()
+ *********************************************************************************************************************/
+/*! Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitPBuf(
+  TcpIp_SocketIdType         SocketId,
+  TCPIP_P2C(IpBase_PbufType) PbufPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType retVal  = E_NOT_OK;
+  uint8          errorId = TCPIP_E_NO_ERROR;
+
+  /* ----- Development Error Checks ------------------------------------- */
+#  if (TCPIP_DEV_ERROR_DETECT == STD_ON)                                                                                /* COV_TCPIP_DEV_ERROR_DETECT */
+  /* #10 Check component initialization state and input parameters. */
+  if (TcpIp_State == TCPIP_STATE_UNINIT)
+  {
+    errorId = TCPIP_E_NOTINIT;
+  }
+  /* Check parameter 'SocketId' */
+  else if (!TCPIP_SOCKET_ID_IS_VALID(SocketId))
+  {
+    errorId = TCPIP_E_INV_ARG;
+  }
+  /* Check parameter 'PbufPtr' */
+  else if (PbufPtr == NULL_PTR)
+  {
+    errorId = TCPIP_E_PARAM_POINTER;
+  }
+  else if (PbufPtr[0].totLen > 0xFFFFu)
+  {
+    /* This implementation is limited to 64k per transmit. */
+    errorId = TCPIP_E_INV_ARG;
+  }
+  else
+#  endif
+  {
+    /* ----- Implementation ----------------------------------------------- */
+    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_SOCKET_ID_TO_IDX(SocketId);
+    /*@ assert socketIdx < TcpIp_GetSizeOfSocketDyn(); */                                                               /* VCA_TCPIP_SOCKETIDX_FROM_CHECKED_SOCKETID */
+
+    /* #20 Check for state OnHold and if there is any data to transmit. */
+    if (   (TcpIp_SocketIsOnHold(SocketId) == FALSE)
+        && (PbufPtr[0].totLen > 0u)
+        && (TCPIP_SOCKET_IDX_IS_TCP(socketIdx)))
+    {
+#  if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                  /* COV_MSR_UNSUPPORTED */
+      /* #30 Reject the request if Tls is used for the socket. Tls has to encrypt the data into its own buffer. */
+      if (TcpIp_IsUseTlsOfSocketTcpDyn(TCPIP_SOCKET_IDX_TO_TCP_IDX(socketIdx)) == TRUE)
+      {
+        retVal = E_NOT_OK;
+      }
+      else
+#  endif
+      /* #40 Otherwise: Forward call to internal function. */
+      {
+        retVal = TcpIp_TcpTransmitPBufInternal(socketIdx, PbufPtr);
+      }
+    }
+  }
+
+  /* ----- Development Error Report --------------------------------------- */
+#  if (TCPIP_DEV_ERROR_REPORT == STD_ON)
+  if (errorId != TCPIP_E_NO_ERROR)
+  {
+    (void)Det_ReportError(TCPIP_MODULE_ID, TCPIP_VINSTANCE_ID, TCPIP_API_ID_TCP_TRANSMIT_PBUF, errorId);
+  }
+#  else
+  TCPIP_DUMMY_STATEMENT(errorId);                                                                                       /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+#  endif
+
+  return retVal;
+}
+# endif
 #endif /* (TCPIP_SUPPORT_TCP == STD_ON) */
 
 /**********************************************************************************************************************
@@ -1964,6 +2053,9 @@ TCPIP_LOCAL_INLINE FUNC(void, TCPIP_CODE) TcpIp_VCloseTcpSocket(
     TcpIp_SetSocketOwnerConfigIdxOfSocketDyn(socketIdx, TCPIP_NO_SOCKETOWNERCONFIGIDXOFSOCKETDYN);
     TcpIp_SetListenActiveConnStatOfSocketDyn(socketIdx, TCPIP_SOCK_CONN_NONE);
   }
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  TcpIp_VSockDemuxUpdate(socketIdx);
+# endif
   TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();  /* unlock cross core interrupts */
 
   /* #40 Actually inform upper layers about the closing of the socket, if required. */
@@ -2180,6 +2272,9 @@ TCPIP_LOCAL_INLINE FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_BindInternal(
         /* Bound UDP socket is always handled as listening socket. */
         TcpIp_SetListenActiveConnStatOfSocketDyn(SocketIdx, TCPIP_SOCK_CONN_LISTEN_ENABLED);
       }
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+      TcpIp_VSockDemuxUpdate(SocketIdx);
+#endif
     }
   }
   return retVal;
@@ -3404,6 +3499,10 @@ FUNC(TcpIp_ParameterType, TCPIP_CODE) TcpIp_GetParameterType(
   case TCPIP_PARAMID_V_TCP_UTOCHANGEABLE:
   case TCPIP_PARAMID_TCP_MSL:
   case TCPIP_PARAMID_TCP_RETRANSMIT_TIMEOUT:
+#if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+  case TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM:
+  case TCPIP_PARAMID_V_TCP_PACING:
+#endif
     parameterType.IsTcp = TRUE;
     break;
 
@@ -5157,6 +5256,86 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_GetAvailableTxBufferSize(
 }
 #endif /* (TCPIP_SUPPORT_TCP == STD_ON) */
 
+#if ((TCPIP_SUPPORT_TCP == STD_ON) && (TCPIP_TCP_RX_BURST == STD_ON))
+/**********************************************************************************************************************
+ *  TcpIp_RxBurstBegin
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, TCPIP_CODE) TcpIp_RxBurstBegin(void)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint8 errorId = TCPIP_E_NO_ERROR;
+
+  /* ----- Development Error Checks ------------------------------------- */
+# if (TCPIP_DEV_ERROR_DETECT == STD_ON)                                                                                 /* COV_TCPIP_DEV_ERROR_DETECT */
+  /* #10 Check component initialization state. */
+  if (TcpIp_State == TCPIP_STATE_UNINIT)
+  {
+    errorId = TCPIP_E_NOTINIT;
+  }
+  /* #20 Forward call to internal function. */
+  else
+# endif
+  {
+    /* ----- Implementation ----------------------------------------------- */
+    TcpIp_Tcp_RxBurstBegin();
+  }
+
+  /* ----- Development Error Report --------------------------------------- */
+# if (TCPIP_DEV_ERROR_REPORT == STD_ON)
+  if (errorId != TCPIP_E_NO_ERROR)
+  {
+    (void)Det_ReportError(TCPIP_MODULE_ID, TCPIP_VINSTANCE_ID, TCPIP_API_ID_RX_BURST, errorId);
+  }
+# else
+  TCPIP_DUMMY_STATEMENT(errorId);                                                                                       /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+# endif
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_RxBurstEnd
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, TCPIP_CODE) TcpIp_RxBurstEnd(void)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint8 errorId = TCPIP_E_NO_ERROR;
+
+  /* ----- Development Error Checks ------------------------------------- */
+# if (TCPIP_DEV_ERROR_DETECT == STD_ON)                                                                                 /* COV_TCPIP_DEV_ERROR_DETECT */
+  /* #10 Check component initialization state. */
+  if (TcpIp_State == TCPIP_STATE_UNINIT)
+  {
+    errorId = TCPIP_E_NOTINIT;
+  }
+  /* #20 Forward call to internal function. */
+  else
+# endif
+  {
+    /* ----- Implementation ----------------------------------------------- */
+    TcpIp_Tcp_RxBurstEnd();
+  }
+
+  /* ----- Development Error Report --------------------------------------- */
+# if (TCPIP_DEV_ERROR_REPORT == STD_ON)
+  if (errorId != TCPIP_E_NO_ERROR)
+  {
+    (void)Det_ReportError(TCPIP_MODULE_ID, TCPIP_VINSTANCE_ID, TCPIP_API_ID_RX_BURST, errorId);
+  }
+# else
+  TCPIP_DUMMY_STATEMENT(errorId);                                                                                       /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */ /*lint -e{438} */
+# endif
+}
+#endif
+
 /**********************************************************************************************************************
  *  INTERNAL FUNCTIONS
  *********************************************************************************************************************/
@@ -5193,6 +5372,9 @@ FUNC(void, TCPIP_CODE) TcpIp_VPreconfigSocket(TcpIp_SocketDynIterType SocketIdx)
 
   /* #20 Initialize the given socket connection status. */
   TcpIp_SetListenActiveConnStatOfSocketDyn(SocketIdx, TCPIP_SOCK_CONN_NONE);
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  TcpIp_VSockDemuxUpdate(SocketIdx);
+#endif
 } /* TcpIp_VPreconfigSocket() */
 
 /**********************************************************************************************************************
@@ -711,6 +711,7 @@
 # include "TcpIp_Lcfg.h"
 
 # include "TcpIp_Types.h"
+# include "IpBase_Types.h"
 
 # if (TCPIP_DEV_ERROR_REPORT == STD_ON)
 #  include "Det.h"
@@ -736,6 +737,65 @@
 # define TCPIP_VINSTANCE_ID                         1u   /* 1=TcpIp, 2=IpV4, 3=IpV6, 4=DhcpV4Server */
 # define TCPIP_MODULE_ID                          170u
 
+/* Zero-copy TCP transmission: TcpIp_TcpTransmitPBuf() references the data of the caller instead of copying it into
+ * the TCP tx buffer of the socket. */
+# if !defined (TCPIP_TCP_ZERO_COPY_TX)                                                                                  /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_TCP_ZERO_COPY_TX                   STD_OFF
+# endif
+
+/* Number of buffer references that can be held by all TCP sockets together. (max. 255) */
+# if !defined (TCPIP_TCP_ZERO_COPY_TX_REF_NUM)                                                                          /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_TCP_ZERO_COPY_TX_REF_NUM           32u
+# endif
+
+/* Extended TCP congestion control (CUBIC, delay-based) and tx pacing. The algorithm is selected per socket by
+ * TcpIp_ChangeParameter(). Requires TCPIP_SUPPORT_TCP_CONGESTION_CONTROL. */
+# if !defined (TCPIP_TCP_CONG_CTRL_EXT)                                                                                 /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_TCP_CONG_CTRL_EXT                  STD_OFF
+# endif
+
+/* Number of TCP sockets that may use an extended congestion control algorithm or pacing at the same time. (max. 255) */
+# if !defined (TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)                                                                        /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM         4u
+# endif
+
+/* Vendor specific parameter IDs of TcpIp_ChangeParameter() for extended congestion control. */
+# if !defined (TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM)                                                                 /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM  0xA0u
+# endif
+# if !defined (TCPIP_PARAMID_V_TCP_PACING)                                                                              /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_PARAMID_V_TCP_PACING               0xA1u
+# endif
+
+/* Values of parameter TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM */
+# define TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO        0u  /* RFC 5681 / RFC 6582 (default) */
+# define TCPIP_TCP_CONG_CTRL_ALGORITHM_CUBIC       1u  /* RFC 8312 */
+# define TCPIP_TCP_CONG_CTRL_ALGORITHM_DELAY       2u  /* delay-based (TCP Vegas), requires the TCP timestamp option */
+
+/* Hash-indexed socket demultiplexing: Received UDP datagrams and TCP segments are matched against the sockets of one
+ * hash bucket instead of all sockets. TCPIP_SOCKET_DEMUX_SOCK_NUM must be at least the number of configured sockets,
+ * otherwise the lookup falls back to a scan of all sockets. */
+# if !defined (TCPIP_SOCKET_DEMUX_HASH)                                                                                 /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_SOCKET_DEMUX_HASH                  STD_OFF
+# endif
+# if !defined (TCPIP_SOCKET_DEMUX_BUCKET_NUM)                                                                           /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_SOCKET_DEMUX_BUCKET_NUM            64u  /* must be a power of two */
+# endif
+# if !defined (TCPIP_SOCKET_DEMUX_SOCK_NUM)                                                                             /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_SOCKET_DEMUX_SOCK_NUM              64u
+# endif
+
+/* TCP rx bursts: Data received in order during an rx burst (TcpIp_RxBurstBegin() .. TcpIp_RxBurstEnd()) is forwarded
+ * to the socket owner once per socket at the end of the burst instead of in the next TcpIp_MainFunction(). */
+# if !defined (TCPIP_TCP_RX_BURST)                                                                                      /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_TCP_RX_BURST                       STD_OFF
+# endif
+
+/* Number of TCP sockets whose data can be forwarded at the end of one rx burst. (max. 255) */
+# if !defined (TCPIP_TCP_RX_BURST_SOCK_NUM)                                                                             /* COV_TCPIP_COMPATIBILITY */
+#  define TCPIP_TCP_RX_BURST_SOCK_NUM              8u
+# endif
+
 /* TCPIP ApiIds */
 /* ASR defined APIs */
 # define TCPIP_API_ID_INIT                       0x01u  /* ASR4.2.1 value */
@@ -805,6 +865,8 @@
 # define TCPIP_API_ID_SEGMENT_OPERATION          0xADu
 # define TCPIP_API_ID_MEMCPY_OPERATION           0xAEu
 # define TCPIP_API_ID_ARP_API                    0xAFu
+# define TCPIP_API_ID_TCP_TRANSMIT_PBUF          0xB0u
+# define TCPIP_API_ID_RX_BURST                   0xB1u
 
 /* ------------------------------------------------------ */
 
@@ -1109,6 +1171,36 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmit(
   TCPIP_P2V(uint8)   DataPtr,
   uint32             AvailableLength,
   boolean            ForceRetrieve);
+
+#  if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_TcpTransmitPBuf()
+ *********************************************************************************************************************/
+/*! \brief          Requests the transmission of data to a remote node using TCP without copying the data.
+ *  \details        In contrast to TcpIp_TcpTransmit() the data is not copied into the TCP tx buffer of the socket.
+ *                  TcpIp stores a reference to each buffer segment of the chain and reads the data directly from
+ *                  there whenever a TCP segment is (re)transmitted. The TCP tx buffer space of the data is reserved
+ *                  nevertheless, so the size of the TCP tx buffer still limits the amount of unacknowledged data.
+ *                  The request is accepted only if the complete data fits into the TCP tx buffer and enough buffer
+ *                  references (TCPIP_TCP_ZERO_COPY_TX_REF_NUM) are available.
+ *                  Transmit requests by TcpIp_TcpTransmit() and TcpIp_TcpTransmitPBuf() may be mixed on one socket.
+ *  \param[in]      SocketId           socket index
+ *  \param[in]      PbufPtr            Pointer to a chain of buffer segments containing PbufPtr[0].totLen bytes.
+ *                                     CONSTRAINT: The data must not be modified and must stay valid until the
+ *                                     upper layer TxConfirmation covering the last byte of the data is called or the
+ *                                     connection is closed or reset.
+ *  \return         E_OK               The request has been accepted
+ *  \return         E_NOT_OK           The request has not been accepted
+ *  \pre            Socket must not be in state OnHold. TLS must not be used for the socket.
+ *  \context        TASK|ISR2
+ *  \reentrant      TRUE for different SocketId.
+ *  \synchronous    TRUE
+ *  \config         TCPIP_SUPPORT_TCP, TCPIP_TCP_ZERO_COPY_TX
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitPBuf(
+  TcpIp_SocketIdType         SocketId,
+  TCPIP_P2C(IpBase_PbufType) PbufPtr);
+#  endif
 # endif /* (TCPIP_SUPPORT_TCP == STD_ON) */
 
 /**********************************************************************************************************************
@@ -1611,6 +1703,8 @@ FUNC(void, TCPIP_CODE) TcpIp_MultiPartitionMainFunctionState(TcpIp_OsApplication
  *     TCPIP_PARAMID_TLS_CONNECTION_ASSIGNMENT | uint16   | Specifies the TLS connection reference assigned to the TCP socket.
  *     TCPIP_PARAMID_UDP_CHECKSUM              | BOOL     | Specifies if Checksum shall calculated in software.
  *     TCPIP_PARAMID_TCP_MSL                   | uint32   | Specifies the MSL value for the TCP sockets.
+ *     TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM | uint8    | Congestion control algorithm of the socket (TCPIP_TCP_CONG_CTRL_ALGORITHM_*, default = RENO).
+ *     TCPIP_PARAMID_V_TCP_PACING              | BOOL     | Spread the transmission of new data over the round trip time. (default = false)
  *********************************************************************************************************************/
 FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_ChangeParameter(
   TcpIp_SocketIdType SocketId,
@@ -2117,6 +2211,35 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_GetAvailableTxBufferSize(
   TCPIP_P2V(uint32)   AvailableTxBufferSizePtr);
 # endif /* (TCPIP_SUPPORT_TCP == STD_ON) */
 
+# if ((TCPIP_SUPPORT_TCP == STD_ON) && (TCPIP_TCP_RX_BURST == STD_ON))
+/**********************************************************************************************************************
+ *  TcpIp_RxBurstBegin
+ *********************************************************************************************************************/
+/*! \brief          Starts an rx burst.
+ *  \details        TCP data received in order until TcpIp_RxBurstEnd() is called is not forwarded in the next
+ *                  TcpIp_MainFunction() but at the end of the burst. This coalesces the data of consecutive segments
+ *                  of a connection into one TcpIp_SocketOwnerRxIndication() call.
+ *                  Typically called by EthIf before a receive polling run (ETHIF_RX_BURST_BEGIN_CALLOUT).
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, TCPIP_CODE) TcpIp_RxBurstBegin(void);
+
+/**********************************************************************************************************************
+ *  TcpIp_RxBurstEnd
+ *********************************************************************************************************************/
+/*! \brief          Ends an rx burst and forwards the TCP data received in order during the burst.
+ *  \details        Typically called by EthIf after a receive polling run (ETHIF_RX_BURST_END_CALLOUT).
+ *  \pre            Must not interrupt TcpIp_MainFunction() or be interrupted by it.
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, TCPIP_CODE) TcpIp_RxBurstEnd(void);
+# endif
+
 
 # define TCPIP_STOP_SEC_CODE
 # include "TcpIp_MemMap.h"                                                                                              /* PRQA S 5087 */ /* MD_MSR_MemMap */
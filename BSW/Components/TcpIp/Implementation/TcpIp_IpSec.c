@@ -48,11 +48,32 @@
 /**********************************************************************************************************************
  *  LOCAL CONSTANT MACROS
  *********************************************************************************************************************/
+# define TCPIP_IPSEC_SA_IDX_INV                0xFFFFu  /* End of a hash chain of the inbound SA index */
 
 /**********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
  *********************************************************************************************************************/
+/* Hash bucket of the inbound SA index for a SPI */
+# define TCPIP_IPSEC_SA_HASH(Spi)              ((uint16)(((Spi) ^ ((Spi) >> 16u)) & (TCPIP_IPSEC_SA_HASH_SIZE - 1u)))
 
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+# if (TCPIP_IPSEC_SPD_CACHE_SIZE > 0u)
+/*! Cached result of a security policy lookup */
+typedef struct
+{
+  IpBase_AddrInType       RemAddr;         /*!< Remote IP address (network byte order) */
+  IpBase_AddrInType       LocAddr;         /*!< Local IP address (network byte order) */
+  TcpIp_IpV4CtrlIterType  IpV4CtrlIdx;     /*!< IPv4 controller */
+  TcpIp_SpdEntryIterType  SpdEntryIdx;     /*!< Matching SPD entry or TcpIp_GetSizeOfSpdEntry() */
+  IpBase_PortType         RemPort;         /*!< Remote port (network byte order) */
+  IpBase_PortType         LocPort;         /*!< Local port (network byte order) */
+  TcpIp_IpSecPolicyType   Policy;          /*!< Selected policy */
+  uint8                   Protocol;        /*!< Upper layer protocol */
+  boolean                 Valid;           /*!< TRUE: Entry is in use */
+} TcpIp_IpSecSpdCacheEntryType;
+# endif
 
 /**********************************************************************************************************************
  *  LOCAL DATA
@@ -63,9 +84,34 @@
 
 STATIC VAR(uint32, TCPIP_VAR_NO_INIT) TcpIp_IpSecSaEntryCnt;                                                            /* PRQA S 3218 */ /* MD_TCPIP_Rule8.9_3218 */
 
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+/* Anti replay windows of the SA entries. Bit 0 of word 0 is the oldest, bit 31 of the last word the newest number. */
+STATIC VAR(uint32, TCPIP_VAR_NO_INIT) TcpIp_IpSecReplayWnd[TCPIP_IPSEC_SA_ENTRY_NUM][TCPIP_IPSEC_ANTIREPLAYWINDOW_WORDS];
+# endif
+
 # define TCPIP_STOP_SEC_VAR_NO_INIT_32
 # include "TcpIp_MemMap.h"                                                                                              /* PRQA S 5087 */ /*  MD_MSR_19.1 */
 
+# define TCPIP_START_SEC_VAR_NO_INIT_16
+# include "TcpIp_MemMap.h"                                                                                              /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/* Inbound SA index: First SA entry per SPI hash bucket, and next SA entry of the same bucket per SA entry */
+STATIC VAR(uint16, TCPIP_VAR_NO_INIT) TcpIp_IpSecSaHashHead[TCPIP_IPSEC_SA_HASH_SIZE];
+STATIC VAR(uint16, TCPIP_VAR_NO_INIT) TcpIp_IpSecSaHashNext[TCPIP_IPSEC_SA_ENTRY_NUM];
+
+# define TCPIP_STOP_SEC_VAR_NO_INIT_16
+# include "TcpIp_MemMap.h"                                                                                              /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+# if (TCPIP_IPSEC_SPD_CACHE_SIZE > 0u)
+#  define TCPIP_START_SEC_VAR_NO_INIT_UNSPECIFIED
+#  include "TcpIp_MemMap.h"                                                                                             /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+STATIC VAR(TcpIp_IpSecSpdCacheEntryType, TCPIP_VAR_NO_INIT) TcpIp_IpSecSpdCache[TCPIP_IPSEC_SPD_CACHE_SIZE];
+
+#  define TCPIP_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+#  include "TcpIp_MemMap.h"                                                                                             /* PRQA S 5087 */ /* MD_MSR_MemMap */
+# endif
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION PROTOTYPES
  *********************************************************************************************************************/
@@ -142,6 +188,75 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_IpSec_VIsIpSecHdrSupported(
   TcpIp_SaEntryIterType SaEntryIdx,
   uint8                 IpSecProtocol);
 
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VShiftWnd
+ *********************************************************************************************************************/
+/*! \brief          Shifts the anti replay window bitmap towards the oldest sequence number
+ *  \details        Whole words are moved at once, only the remaining bit offset is shifted within the words.
+ *  \param[in]      SaEntryIdx       SA Entry Idx
+ *                                   \spec requires SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM; \endspec
+ *  \param[in]      ShiftBits        Number of bits the window advances
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VShiftWnd(
+  TcpIp_SaEntryIterType         SaEntryIdx,
+  uint32                        ShiftBits);
+# endif
+
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VSaIndexInsert
+ *********************************************************************************************************************/
+/*! \brief          Adds an inbound SA entry to the SPI index
+ *  \details        SA entries beyond TCPIP_IPSEC_SA_ENTRY_NUM are not indexed, they are found by a linear search.
+ *  \param[in]      SaEntryIdx       SA Entry Idx
+ *                                   \spec requires SaEntryIdx < TcpIp_GetSizeOfSaEntry(); \endspec
+ *  \pre            The SPI of the SA entry is set. Called within TCPIP_VENTER_CRITICAL_SECTION.
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VSaIndexInsert(
+  TcpIp_SaEntryIterType         SaEntryIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VSaIndexRemove
+ *********************************************************************************************************************/
+/*! \brief          Removes an SA entry from the SPI index
+ *  \details        Nothing is done if the SA entry is not indexed.
+ *  \param[in]      SaEntryIdx       SA Entry Idx
+ *                                   \spec requires SaEntryIdx < TcpIp_GetSizeOfSaEntry(); \endspec
+ *  \pre            The SPI of the SA entry is still set.
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VSaIndexRemove(
+  TcpIp_SaEntryIterType         SaEntryIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VLookupInboundSaBySpi
+ *********************************************************************************************************************/
+/*! \brief          Looks up the inbound SA entry of a controller for a received SPI
+ *  \details        Searches the hash chain of the SPI, and linearly the SA entries beyond the index.
+ *  \param[in]      IpV4CtrlIdx      Index of the IPv4 controller that received the packet
+ *                                   \spec requires IpV4CtrlIdx < TcpIp_GetSizeOfIpV4Ctrl(); \endspec
+ *  \param[in]      IpSecProt        IpSec protocol header
+ *  \param[in]      Spi              Received SPI
+ *  \return         Index of the SA entry, TcpIp_GetSizeOfSaEntry() if there is none
+ *  \pre            -
+ *  \context        TASK|ISR2
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(TcpIp_SaEntryIterType, TCPIP_CODE) TcpIp_IpSec_VLookupInboundSaBySpi(
+  TcpIp_IpV4CtrlIterType        IpV4CtrlIdx,
+  uint8                         IpSecProt,
+  TcpIp_SpiOfSaEntryType        Spi);
+
 /**********************************************************************************************************************
  *  TcpIp_IpSec_VInitEsnSupport
  *********************************************************************************************************************/
@@ -910,7 +1025,35 @@ FUNC(void, TCPIP_CODE) TcpIp_IpSec_Init(void)
   TcpIp_SaEntryIterType             ipSaEntryIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Traverse through all SA entries and clear entries */
+  {
+    uint16_least hashIdx;
+    /* #10 Clear the inbound SA index */
+    for (hashIdx = 0u; hashIdx < TCPIP_IPSEC_SA_HASH_SIZE; hashIdx++)
+    {
+      TcpIp_IpSecSaHashHead[hashIdx] = TCPIP_IPSEC_SA_IDX_INV;
+    }
+  }
+
+# if (TCPIP_IPSEC_SPD_CACHE_SIZE > 0u)
+  {
+    uint16_least cacheIdx;
+    /* #15 Invalidate the security policy decision cache */
+    for (cacheIdx = 0u; cacheIdx < TCPIP_IPSEC_SPD_CACHE_SIZE; cacheIdx++)
+    {
+      TcpIp_IpSecSpdCache[cacheIdx].Valid = FALSE;
+    }
+  }
+# endif
+
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u) && (TCPIP_DEV_ERROR_REPORT == STD_ON)
+  /* SA entries without a local anti replay window would reject all packets */
+  if (TcpIp_GetSizeOfSaEntry() > TCPIP_IPSEC_SA_ENTRY_NUM)
+  {
+    TcpIp_CallDetReportError(TCPIP_API_ID_INIT, TCPIP_E_INIT_FAILED);
+  }
+# endif
+
+  /* #20 Traverse through all SA entries and clear entries */
   for (ipSaEntryIdx = 0; ipSaEntryIdx < TcpIp_GetSizeOfSaEntry(); ipSaEntryIdx++)
   {
     TcpIp_IpSec_VRemoveSaEntry(ipSaEntryIdx);
@@ -918,7 +1061,7 @@ FUNC(void, TCPIP_CODE) TcpIp_IpSec_Init(void)
 
   {
     TcpIp_IntegrityJobPairDynIterType integrityJobPairIdx;
-    /* #20 Traverse through job pair list and set all to unused */
+    /* #30 Traverse through job pair list and set all to unused */
     for (integrityJobPairIdx = 0; integrityJobPairIdx < TcpIp_GetSizeOfIntegrityJobPairDyn(); integrityJobPairIdx++)
     {
       TcpIp_SetStatusOfIntegrityJobPairDyn(integrityJobPairIdx, TCPIP_IPSEC_STATUS_JOBPAIR_UNUSED);
@@ -2003,6 +2146,12 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE)  TcpIp_IpSec_VAddIpV4SaEntry(
       /* Set Csm job pair id for the entry */
       TcpIp_SetIntegrityJobPairIdxOfSaEntry(SaEntryIdx, (TcpIp_IntegrityJobPairIdxOfSaEntryType)IntegrityJobPairIdx);
 
+      /* Make inbound entries available to the SPI lookup of received packets */
+      if (Dir == TCPIP_IPSEC_TRAFFIC_INBOUND)
+      {
+        TcpIp_IpSec_VSaIndexInsert(SaEntryIdx);
+      }
+
 # if (TCPIP_SUPPORT_MEASUREMENT_DATA == STD_ON)
       /* Reset Diagnostic parameters */
       TcpIp_SetPktCntOfSaEntry(SaEntryIdx, 0u);
@@ -2232,7 +2381,10 @@ FUNC(Std_ReturnType, TCPIP_CODE)  TcpIp_IpSec_PrepareDelSaEntryPair(
 TCPIP_LOCAL FUNC(void, TCPIP_CODE)  TcpIp_IpSec_VRemoveSaEntry(
   TcpIp_SaEntryIterType     SaEntryIdx)
 {
-  /* #10 Clear all SA Entry fields */
+  /* #10 Remove the entry from the inbound SA index while its SPI is still known */
+  TcpIp_IpSec_VSaIndexRemove(SaEntryIdx);
+
+  /* #20 Clear all SA Entry fields */
   TcpIp_SetDirectionOfSaEntry(SaEntryIdx, TCPIP_IPSEC_TRAFFIC_INVALID);
   TcpIp_SetIntegrityJobPairIdxOfSaEntry(SaEntryIdx, TcpIp_GetSizeOfIntegrityJobPair());
   TcpIp_SetEsnSupportOfSaEntry(SaEntryIdx, FALSE);
@@ -2252,6 +2404,17 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE)  TcpIp_IpSec_VRemoveSaEntry(
   TcpIp_SetSeqNumHOfSaEntry(SaEntryIdx, 0);
   TcpIp_SetSeqNumLOfSaEntry(SaEntryIdx, 0);
   TcpIp_SetWndBitsOfSaEntry(SaEntryIdx, 0);
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+  if (SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM)
+  {
+    uint32_least wordIdx;
+
+    for (wordIdx = 0u; wordIdx < TCPIP_IPSEC_ANTIREPLAYWINDOW_WORDS; wordIdx++)
+    {
+      TcpIp_IpSecReplayWnd[SaEntryIdx][wordIdx] = 0u;
+    }
+  }
+# endif
 
   TcpIp_SetPriorityOfSaEntry(SaEntryIdx, 0);
   TcpIp_SetStateOfSaEntry(SaEntryIdx, TCPIP_IPSEC_STATUS_UNSET);
@@ -2287,25 +2450,70 @@ TCPIP_LOCAL FUNC(TcpIp_IpSecPolicyType, TCPIP_CODE) TcpIp_IpSec_VLookupSecurityP
   /* ----- Local Variables ---------------------------------------------- */
   TcpIp_IpSecPolicyType                 ipSecPolicySelected = TCPIP_IPSEC_POLICY_DISCARD;
   TcpIp_SpdEntryIterType                ipSpdEntryIdx;
+  boolean                               cacheHit = FALSE;
+# if (TCPIP_IPSEC_SPD_CACHE_SIZE > 0u)
+  uint32                                cacheIdx;
+# endif
 
   /* ----- Implementation ----------------------------------------------- */
   TcpIp_IpSecConfigSetIdxOfIpV4CtrlType ipSecConfigSetIdx = TcpIp_GetIpSecConfigSetIdxOfIpV4Ctrl(IpV4CtrlIdx);
   *IpSpdEntryIdxSelected = TcpIp_GetSizeOfSpdEntry();
 
-  /* #10 Traverse through the SPD entries for a correct match */
-  for (ipSpdEntryIdx = TcpIp_GetSpdEntryStartIdxOfIpSecConfigSet(ipSecConfigSetIdx); ipSpdEntryIdx < TcpIp_GetSpdEntryEndIdxOfIpSecConfigSet(ipSecConfigSetIdx); ipSpdEntryIdx++)
+# if (TCPIP_IPSEC_SPD_CACHE_SIZE > 0u)
+  /* #10 Use the cached decision if the same flow has been looked up before. The SPD is part of the static
+   *     configuration, so a cached decision stays valid until the next initialization. */
+  cacheIdx = (uint32)IpV4CtrlIdx ^ (uint32)IpProtocol ^ RemSock.sin_addr ^ LocSock.sin_addr
+           ^ ((uint32)RemSock.sin_port << 16u) ^ (uint32)LocSock.sin_port;
+  cacheIdx = (cacheIdx ^ (cacheIdx >> 16u) ^ (cacheIdx >> 8u)) & (TCPIP_IPSEC_SPD_CACHE_SIZE - 1u);
+
+  TCPIP_VENTER_CRITICAL_SECTION();
+  if (   (TcpIp_IpSecSpdCache[cacheIdx].Valid == TRUE)
+      && (TcpIp_IpSecSpdCache[cacheIdx].IpV4CtrlIdx == IpV4CtrlIdx)
+      && (TcpIp_IpSecSpdCache[cacheIdx].Protocol == IpProtocol)
+      && (TcpIp_IpSecSpdCache[cacheIdx].RemAddr == RemSock.sin_addr)
+      && (TcpIp_IpSecSpdCache[cacheIdx].LocAddr == LocSock.sin_addr)
+      && (TcpIp_IpSecSpdCache[cacheIdx].RemPort == RemSock.sin_port)
+      && (TcpIp_IpSecSpdCache[cacheIdx].LocPort == LocSock.sin_port))
   {
-    /*@ assert ipSpdEntryIdx < TcpIp_GetSizeOfSpdEntry(); */                                                            /* VCA_TCPIP_CSL03_START_END */
-    /* #20 Check if the protocol and the selctors of the packet match to that of the SPD entry */
-    if (   (   (TcpIp_GetXptProtocolOfSpdEntry(ipSpdEntryIdx) == IpProtocol)                                            /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-            || (TcpIp_GetXptProtocolOfSpdEntry(ipSpdEntryIdx) == TCPIP_PROTOCOL_ANY))
-        && (TcpIp_IpSec_VMatchSpdSelectors(ipSpdEntryIdx, IpProtocol, RemSock, LocSock) == TRUE))                       /* PRQA S 3415 */ /* MD_IPV4_Rule12.4_3415 */
+    ipSecPolicySelected    = TcpIp_IpSecSpdCache[cacheIdx].Policy;
+    *IpSpdEntryIdxSelected = TcpIp_IpSecSpdCache[cacheIdx].SpdEntryIdx;
+    cacheHit = TRUE;
+  }
+  TCPIP_VLEAVE_CRITICAL_SECTION();
+# endif
+
+  if (cacheHit == FALSE)
+  {
+    /* #20 Traverse through the SPD entries for a correct match */
+    for (ipSpdEntryIdx = TcpIp_GetSpdEntryStartIdxOfIpSecConfigSet(ipSecConfigSetIdx); ipSpdEntryIdx < TcpIp_GetSpdEntryEndIdxOfIpSecConfigSet(ipSecConfigSetIdx); ipSpdEntryIdx++)
     {
-      /* Best match found */
-      ipSecPolicySelected    = TcpIp_GetPolicyTypeOfSpdEntry(ipSpdEntryIdx);
-      *IpSpdEntryIdxSelected = ipSpdEntryIdx;
-      break;
+      /*@ assert ipSpdEntryIdx < TcpIp_GetSizeOfSpdEntry(); */                                                          /* VCA_TCPIP_CSL03_START_END */
+      /* #30 Check if the protocol and the selctors of the packet match to that of the SPD entry */
+      if (   (   (TcpIp_GetXptProtocolOfSpdEntry(ipSpdEntryIdx) == IpProtocol)                                          /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+              || (TcpIp_GetXptProtocolOfSpdEntry(ipSpdEntryIdx) == TCPIP_PROTOCOL_ANY))
+          && (TcpIp_IpSec_VMatchSpdSelectors(ipSpdEntryIdx, IpProtocol, RemSock, LocSock) == TRUE))                     /* PRQA S 3415 */ /* MD_IPV4_Rule12.4_3415 */
+      {
+        /* Best match found */
+        ipSecPolicySelected    = TcpIp_GetPolicyTypeOfSpdEntry(ipSpdEntryIdx);
+        *IpSpdEntryIdxSelected = ipSpdEntryIdx;
+        break;
+      }
     }
+
+# if (TCPIP_IPSEC_SPD_CACHE_SIZE > 0u)
+    /* #40 Store the decision, also a discard without matching entry, in the cache slot of the flow */
+    TCPIP_VENTER_CRITICAL_SECTION();
+    TcpIp_IpSecSpdCache[cacheIdx].RemAddr     = RemSock.sin_addr;
+    TcpIp_IpSecSpdCache[cacheIdx].LocAddr     = LocSock.sin_addr;
+    TcpIp_IpSecSpdCache[cacheIdx].IpV4CtrlIdx = IpV4CtrlIdx;
+    TcpIp_IpSecSpdCache[cacheIdx].SpdEntryIdx = *IpSpdEntryIdxSelected;
+    TcpIp_IpSecSpdCache[cacheIdx].RemPort     = RemSock.sin_port;
+    TcpIp_IpSecSpdCache[cacheIdx].LocPort     = LocSock.sin_port;
+    TcpIp_IpSecSpdCache[cacheIdx].Policy      = ipSecPolicySelected;
+    TcpIp_IpSecSpdCache[cacheIdx].Protocol    = IpProtocol;
+    TcpIp_IpSecSpdCache[cacheIdx].Valid       = TRUE;
+    TCPIP_VLEAVE_CRITICAL_SECTION();
+# endif
   }
 
   return ipSecPolicySelected;
@@ -2716,11 +2924,22 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_IpSec_VReplayCheck(
   /* #10 Check for the bit in the bitstream */
   if (ChkBit < TCPIP_IPSEC_ANTIREPLAYWINDOW)
   {
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+    /* #20 If the bit has not been set in th bitstream, the packet has not been authenticated previously */
+    if (SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM)
+    {
+      if ((TcpIp_IpSecReplayWnd[SaEntryIdx][ChkBit >> 5u] & (1uL << (ChkBit & 31u))) == 0u)
+      {
+        retVal = E_OK;
+      }
+    }
+# else
     /* #20 If the bit has not been set in th bitstream, the packet has not been authenticated previously */
     if ((TcpIp_GetWndBitsOfSaEntry(SaEntryIdx) & (1uL << ChkBit)) == 0u)
     {
       retVal = E_OK;
     }
+# endif
   }
 
   return retVal;
@@ -2738,6 +2957,14 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VSetWndBit(
   TcpIp_SaEntryIterType         SaEntryIdx,
   uint32                        SetBit)
 {
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+  /* #10 Set the bit in the bitsream */
+  if (   (SetBit < TCPIP_IPSEC_ANTIREPLAYWINDOW)
+      && (SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM))
+  {
+    TcpIp_IpSecReplayWnd[SaEntryIdx][SetBit >> 5u] |= (1uL << (SetBit & 31u));
+  }
+# else
   uint32 val;
   /* #10 Set the bit in the bitsream */
   if (SetBit < TCPIP_IPSEC_ANTIREPLAYWINDOW)
@@ -2745,6 +2972,7 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VSetWndBit(
     val = TcpIp_GetWndBitsOfSaEntry(SaEntryIdx) | (1uL << SetBit);
     TcpIp_SetWndBitsOfSaEntry(SaEntryIdx, val);
   }
+# endif
 }
 
 /**********************************************************************************************************************
@@ -2762,12 +2990,26 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VUpdateWndParams(
 {
   /* ----- Local Variables ---------------------------------------------- */
   uint32                     shiftBits = (TcpIp_GetSeqNumLOfSaEntry(SaEntryIdx) - TcpIp_GetUWndLOfSaEntry(SaEntryIdx));
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Shift the replay window bitmap right by shiftbits */
+  TcpIp_IpSec_VShiftWnd(SaEntryIdx, shiftBits);
+# else
   TcpIp_WndBitsOfSaEntryType bitstream = TcpIp_GetWndBitsOfSaEntry(SaEntryIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Shift the replay window bitstream right by shiftbits */
-  bitstream = bitstream >> shiftBits;
+  /* #10 Shift the replay window bitstream right by shiftbits, a shift by the window size or more clears it */
+  if (shiftBits < TCPIP_IPSEC_ANTIREPLAYWINDOW)
+  {
+    bitstream = bitstream >> shiftBits;
+  }
+  else
+  {
+    bitstream = 0u;
+  }
   TcpIp_SetWndBitsOfSaEntry(SaEntryIdx, bitstream);
+# endif
 
   /* #20 Set bit W -1 since the anti replay window has been updated */
   TcpIp_IpSec_VSetWndBit(SaEntryIdx, (TCPIP_IPSEC_ANTIREPLAYWINDOW - 1u));
@@ -2776,6 +3018,53 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VUpdateWndParams(
   TcpIp_SetUWndLOfSaEntry(SaEntryIdx, TcpIp_GetSeqNumLOfSaEntry(SaEntryIdx));
 }
 
+# if (TCPIP_IPSEC_ANTIREPLAYWINDOW > 32u)
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VShiftWnd
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VShiftWnd(
+  TcpIp_SaEntryIterType         SaEntryIdx,
+  uint32                        ShiftBits)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32       wordShift = ShiftBits >> 5u;
+  uint32       bitShift  = ShiftBits & 31u;
+  uint32_least wordIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  if (SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM)
+  {
+    TCPIP_P2V(uint32) wndPtr = &TcpIp_IpSecReplayWnd[SaEntryIdx][0];
+
+    /* #10 Move each word down by the whole words of the shift and merge in the bits of the next higher word */
+    for (wordIdx = 0u; wordIdx < TCPIP_IPSEC_ANTIREPLAYWINDOW_WORDS; wordIdx++)
+    {
+      uint32 word = 0u;
+
+      if (wordShift < (TCPIP_IPSEC_ANTIREPLAYWINDOW_WORDS - wordIdx))
+      {
+        uint32_least srcWordIdx = wordIdx + wordShift;
+
+        word = wndPtr[srcWordIdx] >> bitShift;
+
+        if (   (bitShift != 0u)
+            && ((srcWordIdx + 1u) < TCPIP_IPSEC_ANTIREPLAYWINDOW_WORDS))
+        {
+          word |= wndPtr[srcWordIdx + 1u] << (32u - bitShift);
+        }
+      }
+      /* #20 Words beyond the shifted window are cleared */
+      wndPtr[wordIdx] = word;
+    }
+  }
+} /* TcpIp_IpSec_VShiftWnd() */
+# endif
+
 /**********************************************************************************************************************
  *  TcpIp_IpSec_VAntiReplayWindowUpdate
  *********************************************************************************************************************/
@@ -2920,7 +3209,6 @@ TCPIP_LOCAL FUNC(TcpIp_SaEntryIterType, TCPIP_CODE) TcpIp_IpSec_VLookupSelectors
 {
   /* ----- Local Variables ---------------------------------------------- */
   TcpIp_SaEntryIterType ipSaEntryIdx;
-  boolean               foundMatchingEntry = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
   /*
@@ -2929,22 +3217,11 @@ TCPIP_LOCAL FUNC(TcpIp_SaEntryIterType, TCPIP_CODE) TcpIp_IpSec_VLookupSelectors
    * Support for multicast SA shall be added later
    */
 
-  /* #10 Traverse through the SA entries for inbound traffic */
-  for (ipSaEntryIdx = TcpIp_GetSaEntryStartIdxOfIpV4Ctrl(IpV4CtrlIdx); ipSaEntryIdx < TcpIp_GetSaEntryEndIdxOfIpV4Ctrl(IpV4CtrlIdx); ipSaEntryIdx++)
-  {
-    /*@ assert ipSaEntryIdx < TcpIp_GetSizeOfSaEntry(); */                                                              /* VCA_TCPIP_CSL03_START_END */
-    /* #20 Check if the Spi matches any SA Entry and if IpSec header is supported */
-    if (   (TcpIp_GetDirectionOfSaEntry(ipSaEntryIdx) == TCPIP_IPSEC_TRAFFIC_INBOUND)                                   /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        && (TcpIp_GetSpiOfSaEntry(ipSaEntryIdx) == Spi)
-        && (TcpIp_IpSec_VIsIpSecHdrSupported(ipSaEntryIdx, IpSecProt) == E_OK))
-    {
-      /* #30 Matching entry found, set the index */
-      foundMatchingEntry = TRUE;
-      break;
-    }
-  }
+  /* #10 Look up the inbound SA entry with matching Spi which supports the IpSec header */
+  ipSaEntryIdx = TcpIp_IpSec_VLookupInboundSaBySpi(IpV4CtrlIdx, IpSecProt, Spi);
 
-  if (foundMatchingEntry == TRUE)
+  /* #20 If a matching SA was found, set InUse flag */
+  if (ipSaEntryIdx < TcpIp_GetSizeOfSaEntry())
   {
     TcpIp_SetInUseFlagOfSaEntry(ipSaEntryIdx, TCPIP_IPSEC_SAENTRY_INUSE);
 
@@ -2958,15 +3235,132 @@ TCPIP_LOCAL FUNC(TcpIp_SaEntryIterType, TCPIP_CODE) TcpIp_IpSec_VLookupSelectors
       TcpIp_SetStateOfSaEntry(pairedIpSaEntryIdx, TCPIP_IPSEC_STATUS_TX_RX);
     }
   }
-  /* #40 If no matching SA was found, set the index to invalid, else set InUse flag */
-  else
-  {
-    ipSaEntryIdx = TcpIp_GetSizeOfSaEntry();
-  }
 
   return ipSaEntryIdx;
 } /* TcpIp_IpSec_VLookupSelectorsInRxSaEntry */
 
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VSaIndexInsert
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VSaIndexInsert(
+  TcpIp_SaEntryIterType         SaEntryIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Prepend the entry to the hash chain of its Spi */
+  if (SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM)
+  {
+    uint16 hashIdx = TCPIP_IPSEC_SA_HASH(TcpIp_GetSpiOfSaEntry(SaEntryIdx));
+
+    TcpIp_IpSecSaHashNext[SaEntryIdx] = TcpIp_IpSecSaHashHead[hashIdx];
+    TcpIp_IpSecSaHashHead[hashIdx] = (uint16)SaEntryIdx;
+  }
+} /* TcpIp_IpSec_VSaIndexInsert() */
+
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VSaIndexRemove
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_IpSec_VSaIndexRemove(
+  TcpIp_SaEntryIterType         SaEntryIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  if (SaEntryIdx < TCPIP_IPSEC_SA_ENTRY_NUM)
+  {
+    uint16 hashIdx = TCPIP_IPSEC_SA_HASH(TcpIp_GetSpiOfSaEntry(SaEntryIdx));
+
+    TCPIP_VENTER_CRITICAL_SECTION();
+    /* #10 Unlink the entry from the hash chain of its Spi, if it is part of it */
+    if (TcpIp_IpSecSaHashHead[hashIdx] == SaEntryIdx)
+    {
+      TcpIp_IpSecSaHashHead[hashIdx] = TcpIp_IpSecSaHashNext[SaEntryIdx];
+    }
+    else
+    {
+      uint16 prevSaEntryIdx = TcpIp_IpSecSaHashHead[hashIdx];
+
+      while (prevSaEntryIdx != TCPIP_IPSEC_SA_IDX_INV)
+      {
+        if (TcpIp_IpSecSaHashNext[prevSaEntryIdx] == SaEntryIdx)
+        {
+          TcpIp_IpSecSaHashNext[prevSaEntryIdx] = TcpIp_IpSecSaHashNext[SaEntryIdx];
+          break;
+        }
+        prevSaEntryIdx = TcpIp_IpSecSaHashNext[prevSaEntryIdx];
+      }
+    }
+    TCPIP_VLEAVE_CRITICAL_SECTION();
+  }
+} /* TcpIp_IpSec_VSaIndexRemove() */
+
+/**********************************************************************************************************************
+ *  TcpIp_IpSec_VLookupInboundSaBySpi
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(TcpIp_SaEntryIterType, TCPIP_CODE) TcpIp_IpSec_VLookupInboundSaBySpi(
+  TcpIp_IpV4CtrlIterType        IpV4CtrlIdx,
+  uint8                         IpSecProt,
+  TcpIp_SpiOfSaEntryType        Spi)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SaEntryIterType startSaEntryIdx = TcpIp_GetSaEntryStartIdxOfIpV4Ctrl(IpV4CtrlIdx);
+  TcpIp_SaEntryIterType endSaEntryIdx = TcpIp_GetSaEntryEndIdxOfIpV4Ctrl(IpV4CtrlIdx);
+  TcpIp_SaEntryIterType foundSaEntryIdx = TcpIp_GetSizeOfSaEntry();
+  TcpIp_SaEntryIterType ipSaEntryIdx;
+  uint16                hashSaEntryIdx = TcpIp_IpSecSaHashHead[TCPIP_IPSEC_SA_HASH(Spi)];
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Walk the hash chain of the Spi for an inbound SA entry of the controller that supports the IpSec header */
+  while (hashSaEntryIdx != TCPIP_IPSEC_SA_IDX_INV)
+  {
+    ipSaEntryIdx = hashSaEntryIdx;
+
+    if (   (ipSaEntryIdx >= startSaEntryIdx)
+        && (ipSaEntryIdx < endSaEntryIdx)
+        && (TcpIp_GetDirectionOfSaEntry(ipSaEntryIdx) == TCPIP_IPSEC_TRAFFIC_INBOUND)                                   /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        && (TcpIp_GetSpiOfSaEntry(ipSaEntryIdx) == Spi)
+        && (TcpIp_IpSec_VIsIpSecHdrSupported(ipSaEntryIdx, IpSecProt) == E_OK))
+    {
+      foundSaEntryIdx = ipSaEntryIdx;
+      break;
+    }
+    hashSaEntryIdx = TcpIp_IpSecSaHashNext[hashSaEntryIdx];
+  }
+
+  /* #20 Search the SA entries of the controller that are not covered by the index */
+  if (foundSaEntryIdx == TcpIp_GetSizeOfSaEntry())
+  {
+    ipSaEntryIdx = (startSaEntryIdx > TCPIP_IPSEC_SA_ENTRY_NUM) ? startSaEntryIdx : TCPIP_IPSEC_SA_ENTRY_NUM;
+
+    for (; ipSaEntryIdx < endSaEntryIdx; ipSaEntryIdx++)
+    {
+      /*@ assert ipSaEntryIdx < TcpIp_GetSizeOfSaEntry(); */                                                            /* VCA_TCPIP_CSL03_START_END */
+      if (   (TcpIp_GetDirectionOfSaEntry(ipSaEntryIdx) == TCPIP_IPSEC_TRAFFIC_INBOUND)                                 /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          && (TcpIp_GetSpiOfSaEntry(ipSaEntryIdx) == Spi)
+          && (TcpIp_IpSec_VIsIpSecHdrSupported(ipSaEntryIdx, IpSecProt) == E_OK))
+      {
+        foundSaEntryIdx = ipSaEntryIdx;
+        break;
+      }
+    }
+  }
+
+  return foundSaEntryIdx;
+} /* TcpIp_IpSec_VLookupInboundSaBySpi() */
+
 /**********************************************************************************************************************
  *  TcpIp_IpSec_VMatchSpdSelectors
  *********************************************************************************************************************/
@@ -77,7 +77,43 @@ Example IPv4 Authentication header for GMAC
 /**********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
  *********************************************************************************************************************/
-#  define TCPIP_IPSEC_ANTIREPLAYWINDOW       32u  /* Anti replay window is fixed to 32 bits */
+/* Size of the anti replay window in bits. Multiple of 32, max. 1024. Windows larger than 32 bits are kept in a
+ * module-local bitmap of TCPIP_IPSEC_SA_ENTRY_NUM entries. */
+#  if !defined (TCPIP_IPSEC_ANTIREPLAYWINDOW)                                                                           /* COV_TCPIP_COMPATIBILITY */
+#   define TCPIP_IPSEC_ANTIREPLAYWINDOW      32u
+#  endif
+
+/* Number of SA entries covered by the inbound SA index (and by anti replay windows larger than 32 bits).
+ * Must be at least the number of configured SA entries. Further SA entries are looked up by a linear search. */
+#  if !defined (TCPIP_IPSEC_SA_ENTRY_NUM)                                                                               /* COV_TCPIP_COMPATIBILITY */
+#   define TCPIP_IPSEC_SA_ENTRY_NUM          32u
+#  endif
+
+/* Number of hash buckets of the inbound SA index, which is keyed by the SPI. Power of two. */
+#  if !defined (TCPIP_IPSEC_SA_HASH_SIZE)                                                                               /* COV_TCPIP_COMPATIBILITY */
+#   define TCPIP_IPSEC_SA_HASH_SIZE          16u
+#  endif
+
+/* Number of entries of the security policy decision cache, which is keyed by controller, protocol, addresses and
+ * ports. Power of two. 0: Each packet is matched against the SPD. */
+#  if !defined (TCPIP_IPSEC_SPD_CACHE_SIZE)                                                                             /* COV_TCPIP_COMPATIBILITY */
+#   define TCPIP_IPSEC_SPD_CACHE_SIZE        16u
+#  endif
+
+#  define TCPIP_IPSEC_ANTIREPLAYWINDOW_WORDS (TCPIP_IPSEC_ANTIREPLAYWINDOW / 32u)  /* Number of 32 bit words of the window */
+
+#  if (((TCPIP_IPSEC_ANTIREPLAYWINDOW % 32u) != 0u) || (TCPIP_IPSEC_ANTIREPLAYWINDOW < 32u) || (TCPIP_IPSEC_ANTIREPLAYWINDOW > 1024u))
+#   error "TcpIp_IpSec.h: TCPIP_IPSEC_ANTIREPLAYWINDOW must be a multiple of 32 in the range 32..1024."
+#  endif
+#  if ((TCPIP_IPSEC_SA_HASH_SIZE == 0u) || ((TCPIP_IPSEC_SA_HASH_SIZE & (TCPIP_IPSEC_SA_HASH_SIZE - 1u)) != 0u))
+#   error "TcpIp_IpSec.h: TCPIP_IPSEC_SA_HASH_SIZE must be a power of two."
+#  endif
+#  if ((TCPIP_IPSEC_SPD_CACHE_SIZE & (TCPIP_IPSEC_SPD_CACHE_SIZE - 1u)) != 0u)
+#   error "TcpIp_IpSec.h: TCPIP_IPSEC_SPD_CACHE_SIZE must be 0 or a power of two."
+#  endif
+#  if (TCPIP_IPSEC_SA_ENTRY_NUM >= 0xFFFFu)
+#   error "TcpIp_IpSec.h: TCPIP_IPSEC_SA_ENTRY_NUM must be less than 65535."
+#  endif
 #  define TCPIP_IPSEC_ESN_LEN                4u   /* Size of the extended sequence number parameter */
 
 #  define TCPIP_IPSEC_AUTH_HDR_LEN_FIXED     12u   /* Length in bytes of the fixed part of AH */
@@ -95,12 +95,34 @@
 #define TCPIP_IPV6_PSEUDO_HDR_OFS_NEXT_HDR 39u
 #define TCPIP_IPV6_PSEUDO_HDR_LEN          40u
 
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+# if ((TCPIP_SOCKET_DEMUX_BUCKET_NUM & (TCPIP_SOCKET_DEMUX_BUCKET_NUM - 1u)) != 0u)
+#  error "TcpIp: TCPIP_SOCKET_DEMUX_BUCKET_NUM must be a power of two"
+# endif
+# define TCPIP_SOCK_DEMUX_TABLE_CON         0u  /* TCP connections, key: local port, remote address and port */
+# define TCPIP_SOCK_DEMUX_TABLE_BIND        1u  /* bound UDP and listening TCP sockets, key: protocol and local port */
+# define TCPIP_SOCK_DEMUX_TABLE_NUM         2u
+# define TCPIP_SOCK_DEMUX_BUCKET_INV        ((uint16)TCPIP_SOCKET_DEMUX_BUCKET_NUM)
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
  *********************************************************************************************************************/
  /* PRQA S 3453 5 */ /* MD_MSR_FctLikeMacro */
 #define ETHSM_TCPIP_MODE_INDICATION(CtrlIdx, TcpIpState)      \
                                                                       (void)EthSM_TcpIpModeIndication((CtrlIdx), (TcpIpState))
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+/*! Entry of a socket in the socket demultiplexing hash tables. */
+typedef struct
+{
+  TcpIp_SizeOfSocketDynType Next[TCPIP_SOCK_DEMUX_TABLE_NUM];   /*!< Next socket in the bucket (sorted by index) or TcpIp_GetSizeOfSocketDyn() */
+  uint16                    Bucket[TCPIP_SOCK_DEMUX_TABLE_NUM]; /*!< Bucket the socket is linked into or TCPIP_SOCK_DEMUX_BUCKET_INV */
+} TcpIp_SockDemuxEntryType;
+#endif
+
 /**********************************************************************************************************************
  *  LOCAL DATA
  *********************************************************************************************************************/
@@ -113,6 +135,12 @@ VAR(TcpIp_TcpIpErrorType, TCPIP_VAR_NO_INIT) TcpIp_LastSockError;
 TCPIP_LOCAL VAR(TcpIp_OsApplicationType, TCPIP_VAR_NO_INIT) TcpIp_MainApplicationId;
 #endif
 
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+TCPIP_LOCAL VAR(TcpIp_SizeOfSocketDynType, TCPIP_VAR_NO_INIT) TcpIp_SockDemuxHead[TCPIP_SOCK_DEMUX_TABLE_NUM][TCPIP_SOCKET_DEMUX_BUCKET_NUM];
+TCPIP_LOCAL VAR(TcpIp_SockDemuxEntryType, TCPIP_VAR_NO_INIT)  TcpIp_SockDemuxEntry[TCPIP_SOCKET_DEMUX_SOCK_NUM];
+TCPIP_LOCAL VAR(boolean, TCPIP_VAR_NO_INIT)                   TcpIp_SockDemuxActive;
+#endif
+
 #define TCPIP_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "TcpIp_MemMap.h"                                                                                               /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -360,6 +388,146 @@ STATIC FUNC(uint8, TCPIP_CODE) TcpIp_DListRawRemoveRange(
   TcpIp_DListIdxType             RemStartIdx,
   TcpIp_DListIdxType             RemEndIdx);
 
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxInit()
+ *********************************************************************************************************************/
+/*! \brief         Initializes the socket demultiplexing hash tables.
+ *  \details       The hash tables are only used if TCPIP_SOCKET_DEMUX_SOCK_NUM covers all configured sockets.
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxInit(void);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxHash()
+ *********************************************************************************************************************/
+/*! \brief         Maps a key to a bucket of the socket demultiplexing hash tables.
+ *  \details       -
+ *  \param[in]     Key                Key built from the ports and the remote IP address.
+ *  \return        Bucket index.
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(uint16, TCPIP_CODE) TcpIp_VSockDemuxHash(
+  uint32 Key);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxConKey()
+ *********************************************************************************************************************/
+/*! \brief         Returns the bucket of a TCP connection in the connection table.
+ *  \details       The key consists of the local port, the remote port and the remote IP address.
+ *  \param[in]     LocPort            Local port (network byte order).
+ *  \param[in]     RemSockAddrPtr     Remote socket address.
+ *                                    \spec requires RemSockAddrPtr != NULL_PTR; \endspec
+ *  \return        Bucket index.
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(uint16, TCPIP_CODE) TcpIp_VSockDemuxConKey(
+  IpBase_PortType                   LocPort,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RemSockAddrPtr);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxBindKey()
+ *********************************************************************************************************************/
+/*! \brief         Returns the bucket of a bound UDP socket or a TCP listen socket in the binding table.
+ *  \details       The key consists of the local port and the protocol.
+ *  \param[in]     LocPort            Local port (network byte order).
+ *  \param[in]     IsTcp              TRUE for TCP, FALSE for UDP.
+ *  \return        Bucket index.
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(uint16, TCPIP_CODE) TcpIp_VSockDemuxBindKey(
+  IpBase_PortType LocPort,
+  boolean         IsTcp);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxLink()
+ *********************************************************************************************************************/
+/*! \brief         Links a socket into a bucket of a hash table.
+ *  \details       The sockets of a bucket are kept sorted by index. So the lookup visits the candidates in the same
+ *                 order as a scan of the socket table and finds the same socket.
+ *  \param[in]     Table              TCPIP_SOCK_DEMUX_TABLE_CON or TCPIP_SOCK_DEMUX_TABLE_BIND.
+ *  \param[in]     SocketIdx          Index of a UDP or TCP socket.
+ *                                    \spec requires SocketIdx < TcpIp_GetSizeOfSocketDyn(); \endspec
+ *  \param[in]     Bucket             Bucket index.
+ *                                    \spec requires Bucket < TCPIP_SOCKET_DEMUX_BUCKET_NUM; \endspec
+ *  \pre           The socket is not linked into the table.
+ *  \context       TASK|ISR2
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxLink(
+  uint8                   Table,
+  TcpIp_SocketDynIterType SocketIdx,
+  uint16                  Bucket);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxUnlink()
+ *********************************************************************************************************************/
+/*! \brief         Removes a socket from a hash table, if it is linked.
+ *  \details       -
+ *  \param[in]     Table              TCPIP_SOCK_DEMUX_TABLE_CON or TCPIP_SOCK_DEMUX_TABLE_BIND.
+ *  \param[in]     SocketIdx          Index of a UDP or TCP socket.
+ *                                    \spec requires SocketIdx < TcpIp_GetSizeOfSocketDyn(); \endspec
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxUnlink(
+  uint8                   Table,
+  TcpIp_SocketDynIterType SocketIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxFirst()
+ *********************************************************************************************************************/
+/*! \brief         Returns the first candidate socket of a lookup.
+ *  \details       If the hash tables are not used, all sockets starting at StartIdx are candidates.
+ *  \param[in]     Table              TCPIP_SOCK_DEMUX_TABLE_CON or TCPIP_SOCK_DEMUX_TABLE_BIND.
+ *  \param[in]     Bucket             Bucket index.
+ *                                    \spec requires Bucket < TCPIP_SOCKET_DEMUX_BUCKET_NUM; \endspec
+ *  \param[in]     StartIdx           Lowest socket index that shall be returned.
+ *  \return        Index of the first candidate socket or TcpIp_GetSizeOfSocketDyn() if there is none.
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_VSockDemuxFirst(
+  uint8                   Table,
+  uint16                  Bucket,
+  TcpIp_SocketDynIterType StartIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxNext()
+ *********************************************************************************************************************/
+/*! \brief         Returns the candidate socket of a lookup following the given one.
+ *  \details       -
+ *  \param[in]     Table              TCPIP_SOCK_DEMUX_TABLE_CON or TCPIP_SOCK_DEMUX_TABLE_BIND.
+ *  \param[in]     SocketIdx          Index of the current candidate socket.
+ *                                    \spec requires SocketIdx < TcpIp_GetSizeOfSocketDyn(); \endspec
+ *  \return        Index of the next candidate socket or TcpIp_GetSizeOfSocketDyn() if there is none.
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+STATIC FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_VSockDemuxNext(
+  uint8                   Table,
+  TcpIp_SocketDynIterType SocketIdx);
+#endif
+
 #if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                      /* COV_TCPIP_IPV4_ALWAYS_ON */
 # if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
 /**********************************************************************************************************************
@@ -1916,6 +2084,299 @@ STATIC FUNC(boolean, TCPIP_CODE) TcpIp_VMatchLocalIpAddrIdAndPort(
   return retVal;
 } /* TcpIp_VMatchLocalIpAddrIdAndPort() */
 
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxInit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+STATIC FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxInit(void)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint16_least            bucketIdx;
+  TcpIp_SocketDynIterType socketIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Use the hash tables only if there is an entry for each configured socket. */
+  TcpIp_SockDemuxActive = (boolean)(TcpIp_GetSizeOfSocketDyn() <= TCPIP_SOCKET_DEMUX_SOCK_NUM);                         /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
+
+  /* #20 Clear all buckets and unlink all sockets. */
+  for (bucketIdx = 0u; bucketIdx < TCPIP_SOCKET_DEMUX_BUCKET_NUM; bucketIdx++)
+  {
+    TcpIp_SockDemuxHead[TCPIP_SOCK_DEMUX_TABLE_CON][bucketIdx]  = (TcpIp_SizeOfSocketDynType)TcpIp_GetSizeOfSocketDyn();
+    TcpIp_SockDemuxHead[TCPIP_SOCK_DEMUX_TABLE_BIND][bucketIdx] = (TcpIp_SizeOfSocketDynType)TcpIp_GetSizeOfSocketDyn();
+  }
+
+  if (TcpIp_SockDemuxActive == TRUE)
+  {
+    for (socketIdx = 0u; socketIdx < TcpIp_GetSizeOfSocketDyn(); socketIdx++)
+    {
+      TcpIp_SockDemuxEntry[socketIdx].Bucket[TCPIP_SOCK_DEMUX_TABLE_CON]  = TCPIP_SOCK_DEMUX_BUCKET_INV;
+      TcpIp_SockDemuxEntry[socketIdx].Bucket[TCPIP_SOCK_DEMUX_TABLE_BIND] = TCPIP_SOCK_DEMUX_BUCKET_INV;
+    }
+  }
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxHash
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ */
+STATIC FUNC(uint16, TCPIP_CODE) TcpIp_VSockDemuxHash(
+  uint32 Key)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Fold the upper half into the lower half and spread it by a multiplicative hash (golden ratio). */
+  return (uint16)((((Key ^ (Key >> 16)) * 0x9E3779B1u) >> 16) & (TCPIP_SOCKET_DEMUX_BUCKET_NUM - 1u));
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxConKey
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+STATIC FUNC(uint16, TCPIP_CODE) TcpIp_VSockDemuxConKey(
+  IpBase_PortType                   LocPort,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RemSockAddrPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 key = ((uint32)LocPort << 16) | (uint32)RemSockAddrPtr->DomainAndPort.port;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Add the remote IP address to the ports. */
+# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
+  if (RemSockAddrPtr->sa_family == IPBASE_AF_INET)
+  {
+    key ^= RemSockAddrPtr->SockAddrIn.sin_addr;
+  }
+# endif
+# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+  if (RemSockAddrPtr->sa_family == IPBASE_AF_INET6)
+  {
+    key ^= RemSockAddrPtr->SockAddrIn6.sin6_addr.addr32[0] ^ RemSockAddrPtr->SockAddrIn6.sin6_addr.addr32[1]
+         ^ RemSockAddrPtr->SockAddrIn6.sin6_addr.addr32[2] ^ RemSockAddrPtr->SockAddrIn6.sin6_addr.addr32[3];
+  }
+# endif
+
+  return TcpIp_VSockDemuxHash(key);
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxBindKey
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ */
+STATIC FUNC(uint16, TCPIP_CODE) TcpIp_VSockDemuxBindKey(
+  IpBase_PortType LocPort,
+  boolean         IsTcp)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 key = (uint32)LocPort;
+
+  /* ----- Implementation ----------------------------------------------- */
+  if (IsTcp == TRUE)
+  {
+    key |= 0x00010000u;
+  }
+
+  return TcpIp_VSockDemuxHash(key);
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxLink
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+STATIC FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxLink(
+  uint8                   Table,
+  TcpIp_SocketDynIterType SocketIdx,
+  uint16                  Bucket)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SocketDynIterType prevIdx = TcpIp_GetSizeOfSocketDyn();
+  TcpIp_SocketDynIterType nextIdx = TcpIp_SockDemuxHead[Table][Bucket];
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Find the position that keeps the bucket sorted by socket index. */
+  while (nextIdx < SocketIdx)
+  {
+    prevIdx = nextIdx;
+    nextIdx = TcpIp_SockDemuxEntry[nextIdx].Next[Table];
+  }
+
+  /* #20 Link the socket. The successor is set first, so a concurrent lookup always sees a consistent chain. */
+  TcpIp_SockDemuxEntry[SocketIdx].Next[Table]   = (TcpIp_SizeOfSocketDynType)nextIdx;
+  TcpIp_SockDemuxEntry[SocketIdx].Bucket[Table] = Bucket;
+
+  if (prevIdx < TcpIp_GetSizeOfSocketDyn())
+  {
+    TcpIp_SockDemuxEntry[prevIdx].Next[Table] = (TcpIp_SizeOfSocketDynType)SocketIdx;
+  }
+  else
+  {
+    TcpIp_SockDemuxHead[Table][Bucket] = (TcpIp_SizeOfSocketDynType)SocketIdx;
+  }
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxUnlink
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+STATIC FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxUnlink(
+  uint8                   Table,
+  TcpIp_SocketDynIterType SocketIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint16 bucket = TcpIp_SockDemuxEntry[SocketIdx].Bucket[Table];
+
+  /* ----- Implementation ----------------------------------------------- */
+  if (bucket != TCPIP_SOCK_DEMUX_BUCKET_INV)
+  {
+    TcpIp_SocketDynIterType prevIdx = TcpIp_GetSizeOfSocketDyn();
+    TcpIp_SocketDynIterType iterIdx = TcpIp_SockDemuxHead[Table][bucket];
+
+    /* #10 Search the predecessor of the socket in its bucket. */
+    while ((iterIdx < TcpIp_GetSizeOfSocketDyn()) && (iterIdx != SocketIdx))
+    {
+      prevIdx = iterIdx;
+      iterIdx = TcpIp_SockDemuxEntry[iterIdx].Next[Table];
+    }
+
+    /* #20 Bypass the socket. Its own successor is kept, so a concurrent lookup positioned on it can continue. */
+    if (iterIdx == SocketIdx)
+    {
+      if (prevIdx < TcpIp_GetSizeOfSocketDyn())
+      {
+        TcpIp_SockDemuxEntry[prevIdx].Next[Table] = TcpIp_SockDemuxEntry[SocketIdx].Next[Table];
+      }
+      else
+      {
+        TcpIp_SockDemuxHead[Table][bucket] = TcpIp_SockDemuxEntry[SocketIdx].Next[Table];
+      }
+    }
+    TcpIp_SockDemuxEntry[SocketIdx].Bucket[Table] = TCPIP_SOCK_DEMUX_BUCKET_INV;
+  }
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxFirst
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+STATIC FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_VSockDemuxFirst(
+  uint8                   Table,
+  uint16                  Bucket,
+  TcpIp_SocketDynIterType StartIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SocketDynIterType socketIdx = StartIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Skip the sockets of the bucket below StartIdx (other protocol). */
+  if (TcpIp_SockDemuxActive == TRUE)
+  {
+    socketIdx = TcpIp_SockDemuxHead[Table][Bucket];
+    while (socketIdx < StartIdx)
+    {
+      socketIdx = TcpIp_SockDemuxEntry[socketIdx].Next[Table];
+    }
+  }
+
+  return socketIdx;
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxNext
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ */
+STATIC FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_VSockDemuxNext(
+  uint8                   Table,
+  TcpIp_SocketDynIterType SocketIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SocketDynIterType nextIdx = SocketIdx + 1u;
+
+  /* ----- Implementation ----------------------------------------------- */
+  if (TcpIp_SockDemuxActive == TRUE)
+  {
+    nextIdx = TcpIp_SockDemuxEntry[SocketIdx].Next[Table];
+  }
+
+  return nextIdx;
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxUpdate
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxUpdate(
+  TcpIp_SocketDynIterType SocketIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  TCPIP_ASSERT(SocketIdx < TcpIp_GetSizeOfSocketDyn());
+
+  if (TcpIp_SockDemuxActive == TRUE)
+  {
+    uint8                   connStat = TcpIp_GetListenActiveConnStatOfSocketDyn(SocketIdx);
+    IpBase_PortType         locPort  = TcpIp_GetAddrLocSockOfSocketDyn(SocketIdx)->DomainAndPort.port;
+
+    TCPIP_VENTER_CRITICAL_SECTION();
+
+    /* #10 Remove the socket from both tables. */
+    TcpIp_VSockDemuxUnlink(TCPIP_SOCK_DEMUX_TABLE_CON, SocketIdx);
+    TcpIp_VSockDemuxUnlink(TCPIP_SOCK_DEMUX_TABLE_BIND, SocketIdx);
+
+# if (TCPIP_SUPPORT_TCP == STD_ON)
+    /* #20 Link TCP sockets that may be found by TcpIp_SearchTcpComSocket() into the connection table. */
+    if (   (TCPIP_SOCKET_IDX_IS_TCP(SocketIdx))
+        && (   (connStat == TCPIP_SOCK_CONN_LISTEN_ENABLED)
+            || (connStat == TCPIP_SOCK_CONN_ACTIVE)))
+    {
+      TcpIp_VSockDemuxLink(TCPIP_SOCK_DEMUX_TABLE_CON, SocketIdx,
+                           TcpIp_VSockDemuxConKey(locPort, TcpIp_GetAddrRemSockOfSocketDyn(SocketIdx)));
+    }
+# endif
+
+    /* #30 Link bound UDP sockets and TCP listen sockets into the binding table. */
+    if (connStat == TCPIP_SOCK_CONN_LISTEN_ENABLED)
+    {
+      TcpIp_VSockDemuxLink(TCPIP_SOCK_DEMUX_TABLE_BIND, SocketIdx,
+                           TcpIp_VSockDemuxBindKey(locPort, (boolean)(!TCPIP_SOCKET_IDX_IS_UDP(SocketIdx))));      /* PRQA S 4304, 4558 */ /* MD_MSR_AutosarBoolean, MD_MSR_AutosarBoolean */
+    }
+
+    TCPIP_VLEAVE_CRITICAL_SECTION();
+  }
+}
+#endif
+
 /**********************************************************************************************************************
  *  TcpIp_VRxUdpSockIdxIdent
  *********************************************************************************************************************/
@@ -1940,8 +2401,15 @@ FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_VRxUdpSockIdxIdent(
   TCPIP_ASSERT(RxSockLocAddrPtr != NULL_PTR);
   TCPIP_ASSERT(LocalAddrIdx < TcpIp_GetSizeOfLocalAddr());
 
-  /* #10 Iterate over all UDP sockets. */
+  /* #10 Iterate over all UDP sockets (or over the UDP sockets bound to the port, if the hash tables are used). */
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  for (socketIdx = TcpIp_VSockDemuxFirst(TCPIP_SOCK_DEMUX_TABLE_BIND,
+                                         TcpIp_VSockDemuxBindKey(RxSockLocAddrPtr->DomainAndPort.port, FALSE), 0u);
+       socketIdx < TcpIp_GetSizeOfSocketUdpDyn();
+       socketIdx = TcpIp_VSockDemuxNext(TCPIP_SOCK_DEMUX_TABLE_BIND, socketIdx))
+#else
   for (socketIdx = 0; socketIdx < TcpIp_GetSizeOfSocketUdpDyn(); socketIdx++)
+#endif
   {
     /* #20 Check if UDP socket is bound. */
     if (TcpIp_GetListenActiveConnStatOfSocketDyn(socketIdx) == TCPIP_SOCK_CONN_LISTEN_ENABLED)
@@ -2083,6 +2551,10 @@ FUNC(void, TCPIP_CODE) TcpIp_VInitSockets(void)
   TcpIp_MainApplicationId = GetApplicationID();
 #endif
 
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  TcpIp_VSockDemuxInit();
+#endif
+
   /* #10 Iterate all configured sockets and call the internal initialization function for each socket. */
   for (socketIdx = 0; socketIdx < TcpIp_GetSizeOfSocketDyn(); socketIdx++)
   {
@@ -2186,6 +2658,11 @@ FUNC(void, TCPIP_CODE) TcpIp_VDelSockAddrMapping(
   /* Reset all sockets to the main application */
   TcpIp_SetApplIdOfSocketDyn(SocketIdx, TcpIp_MainApplicationId);
 #endif
+
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  /* #60 Remove the socket from the demultiplexing hash tables. */
+  TcpIp_VSockDemuxUpdate(SocketIdx);
+#endif
 } /* TcpIp_VDelSockAddrMapping() */
 
 /**********************************************************************************************************************
@@ -3017,6 +3494,9 @@ FUNC(void, TCPIP_CODE) TcpIp_VSockTcpStateChg(
   {
   case TCPIP_TCP_STATE_CONN_ESTAB:
     TcpIp_SetListenActiveConnStatOfSocketDyn(SocketIdx, TCPIP_SOCK_CONN_ACTIVE);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+    TcpIp_VSockDemuxUpdate(SocketIdx);
+# endif
     break;
 
   case TCPIP_TCP_STATE_CONNECTED:
@@ -3024,12 +3504,18 @@ FUNC(void, TCPIP_CODE) TcpIp_VSockTcpStateChg(
       TcpIp_SocketTcpDynIterType socketTcpIdx = TCPIP_SOCKET_IDX_TO_TCP_IDX(SocketIdx);
       /*@ assert socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); */                                                       /* VCA_TCPIP_TCP_IDX_FROM_CHECKED_SOCKET_IDX */
       TcpIp_SetListenActiveConnStatOfSocketDyn(SocketIdx, TCPIP_SOCK_CONN_ACTIVE);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+      TcpIp_VSockDemuxUpdate(SocketIdx);
+# endif
       TcpIp_TcpConnectedFunctions(socketTcpIdx);
       break;
     }
 
   case TCPIP_TCP_STATE_CLOSED:
     TcpIp_SetListenActiveConnStatOfSocketDyn(SocketIdx, TCPIP_SOCK_CONN_NONE);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+    TcpIp_VSockDemuxUpdate(SocketIdx);
+# endif
 # if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
     /* Check if the socket uses TLS and a corresponding TLS connection is assigned */
     if (   (SocketUsesTls == TRUE)                                                                                      /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_ReadOnly */
@@ -3048,6 +3534,9 @@ FUNC(void, TCPIP_CODE) TcpIp_VSockTcpStateChg(
 
   case TCPIP_TCP_STATE_RESET:
     TcpIp_SetListenActiveConnStatOfSocketDyn(SocketIdx, TCPIP_SOCK_CONN_NONE);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+    TcpIp_VSockDemuxUpdate(SocketIdx);
+# endif
 # if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
     /* TLS only wants the information if the TCP connection is established. */
     /* TLS state is set in Ll_TcpConnected (after TCP handshake) to HS_ACTIVE */
@@ -3314,6 +3803,9 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_VSockTcpStateChgAccepted(
     /*@ assert listenSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); */                                                   /* VCA_TCPIP_LISTEN_SOCKET_TCP_IDX_FROM_SOCKETTCPIDX */
 
     TcpIp_SetListenActiveConnStatOfSocketDyn(socketIdx, TCPIP_SOCK_CONN_ACTIVE);
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+    TcpIp_VSockDemuxUpdate(socketIdx);
+# endif
 
     /* #20 Inform the upper layers about the new, accepted, TCP connection. */
     TCPIP_ASSERT(listenSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
@@ -4728,7 +5220,15 @@ FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_SearchTcpListenSocket(
 
   /* ----- Implementation ----------------------------------------------- */
   /* #10 Iterate over all listen TCP sockets and match IP address and Port information. */
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  for (iterSocketIdx = TcpIp_VSockDemuxFirst(TCPIP_SOCK_DEMUX_TABLE_BIND,
+                                             TcpIp_VSockDemuxBindKey(RxSockLocAddrPtr->DomainAndPort.port, TRUE),
+                                             TcpIp_GetSizeOfSocketUdpDyn());
+       iterSocketIdx < TcpIp_GetSizeOfSocketDyn();
+       iterSocketIdx = TcpIp_VSockDemuxNext(TCPIP_SOCK_DEMUX_TABLE_BIND, iterSocketIdx))
+#else
   for (iterSocketIdx = TcpIp_GetSizeOfSocketUdpDyn(); iterSocketIdx < TcpIp_GetSizeOfSocketDyn(); iterSocketIdx++)
+#endif
   {
     /* #20 Verify that socket is in state Listen. */
     if (TcpIp_GetListenActiveConnStatOfSocketDyn(iterSocketIdx) == TCPIP_SOCK_CONN_LISTEN_ENABLED)
@@ -4792,7 +5292,15 @@ FUNC(TcpIp_SocketDynIterType, TCPIP_CODE) TcpIp_SearchTcpComSocket(
 
   /* ----- Implementation ----------------------------------------------- */
   /* #10 Iterate over all TCP sockets and match IP address and Port information. */
+#if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+  for (iterSocketIdx = TcpIp_VSockDemuxFirst(TCPIP_SOCK_DEMUX_TABLE_CON,
+                                             TcpIp_VSockDemuxConKey(RxSockLocAddrPtr->DomainAndPort.port, RxSockRemAddrPtr),
+                                             TcpIp_GetSizeOfSocketUdpDyn());
+       iterSocketIdx < TcpIp_GetSizeOfSocketDyn();
+       iterSocketIdx = TcpIp_VSockDemuxNext(TCPIP_SOCK_DEMUX_TABLE_CON, iterSocketIdx))
+#else
   for (iterSocketIdx = TcpIp_GetSizeOfSocketUdpDyn(); iterSocketIdx < TcpIp_GetSizeOfSocketDyn(); iterSocketIdx++)
+#endif
   {
     if (   (TcpIp_GetListenActiveConnStatOfSocketDyn(iterSocketIdx) == TCPIP_SOCK_CONN_LISTEN_ENABLED)
         || (TcpIp_GetListenActiveConnStatOfSocketDyn(iterSocketIdx) == TCPIP_SOCK_CONN_ACTIVE))
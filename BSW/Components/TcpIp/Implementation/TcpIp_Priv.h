@@ -1682,6 +1682,25 @@ FUNC(void, TCPIP_CODE) TcpIp_VInitSocket(TcpIp_SocketDynIterType SocketIdx);
  *********************************************************************************************************************/
 FUNC(void, TCPIP_CODE) TcpIp_VDelSockAddrMapping(TcpIp_SocketDynIterType SocketIdx);
 
+# if (TCPIP_SOCKET_DEMUX_HASH == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_VSockDemuxUpdate()
+ *********************************************************************************************************************/
+/*! \brief         Updates the entries of a socket in the socket demultiplexing hash tables.
+ *  \details       Must be called after the connection state, the local port or the remote address of a socket changed.
+ *                 TCP sockets in state LISTEN_ENABLED or ACTIVE are linked into the connection table.
+ *                 Sockets in state LISTEN_ENABLED are linked into the binding table.
+ *  \param[in]     SocketIdx   Index of a UDP or TCP socket.
+ *                             \spec requires SocketIdx < TcpIp_GetSizeOfSocketDyn(); \endspec
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *********************************************************************************************************************/
+FUNC(void, TCPIP_CODE) TcpIp_VSockDemuxUpdate(
+  TcpIp_SocketDynIterType SocketIdx);
+# endif
+
 /**********************************************************************************************************************
  *  TcpIp_VSockIpAddrIsEqual()
  *********************************************************************************************************************/
@@ -171,12 +171,35 @@ continued and the mode is advanced to 'fast recover'. For details see RFC 5681 s
 
 # define TCPIP_TCP_CONG_CTRL_CWND_MAX                    0x40000000u
 
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+#  if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL != STD_ON)
+#   error "TcpIp_Tcp.c: TCPIP_TCP_CONG_CTRL_EXT requires TCPIP_SUPPORT_TCP_CONGESTION_CONTROL!"
+#  endif
+/* defines used by the extended congestion control algorithms (TcpIp_Tcp_CongCtrlExt) */
+#  define TCPIP_TCP_CONG_CTRL_EXT_IDX_INV                TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM
+#  define TCPIP_TCP_CONG_CTRL_EXT_RTT_INV                0xFFFFFFFFu
+#  define TCPIP_TCP_CUBIC_BETA_1024                      717u         /* multiplicative decrease 0.7 (RFC 8312 4.5) */
+#  define TCPIP_TCP_CUBIC_FRIENDLY_INC_1024              542u         /* 3 * (1 - beta) / (1 + beta) (RFC 8312 4.2) */
+#  define TCPIP_TCP_CUBIC_INV_C_MS3                      2500000000u  /* 1 / C [ms^3 per segment] with C = 0.4 */
+#  define TCPIP_TCP_CUBIC_DIST_MAX_MS                    100000u      /* limits |t - K| to avoid overflows */
+#  define TCPIP_TCP_DELAY_ALPHA_SEG                      2u           /* increase cwnd below this number of queued segments */
+#  define TCPIP_TCP_DELAY_BETA_SEG                       4u           /* decrease cwnd above this number of queued segments */
+#  define TCPIP_TCP_DELAY_GAMMA_SEG                      1u           /* leave slow start above this number of queued segments */
+#  define TCPIP_TCP_PACING_GAIN_SS_PERCENT               200u
+#  define TCPIP_TCP_PACING_GAIN_CA_PERCENT               120u
+# endif
+
+# if ((TCPIP_TCP_RX_BURST == STD_ON) && (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON))                                    /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+#  error "TcpIp_Tcp.c: TCPIP_TCP_RX_BURST is not supported in combination with multicore support!"
+# endif
+
 /* define used in variable RtoStateOfSocketTcpDyn */
 # define TCPIP_TCP_RTO_STATE_DEFAULT                0u
 # define TCPIP_TCP_RTO_STATE_FIRST_CALC_PROCEEDED   1u
 # define TCPIP_TCP_RTO_STATE_ACTIVE                 2u
 
 # define TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV          TcpIp_GetSizeOfTcpRetryQElement()
+# define TCPIP_TCP_OOO_ELE_IDX_INV                  TcpIp_GetSizeOfTcpOooQElement()
 # define TCPIP_TCP_RESET_CORE_SIZE                 (TcpIp_GetSizeOfRstTxQueueBuffer() / TcpIp_GetSizeOfApplicationIds())
 
 /**********************************************************************************************************************
@@ -206,6 +229,39 @@ continued and the mode is advanced to 'fast recover'. For details see RFC 5681 s
 # define TCPIP_TCP_HDR_OPTIONS_OFFSET             20u
 typedef TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType)      TcpIp_Tcp_TxRetrQueueTypeP2V;
 
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+/*! Reference to data passed by TcpIp_TcpTransmitPBuf(). The data occupies the range [BufIdx, BufIdx + Len) of the TCP
+    tx buffer of the socket, but it is read from DataPtr each time a segment containing it is (re)transmitted. */
+typedef struct
+{
+  TcpIp_Uint8P2C               DataPtr;       /*!< Referenced user data */
+  TcpIp_SizeOfTcpTxBufferType  BufIdx;        /*!< TCP tx buffer index of the first referenced byte */
+  TcpIp_SizeOfTcpTxBufferType  Len;           /*!< Number of referenced bytes (0: element is unused) */
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx;  /*!< TCP socket that holds the reference */
+} TcpIp_Tcp_TxDataRefType;
+# endif
+
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+/*! State of the extended congestion control of one TCP socket. Times are given in MainFunction cycles unless stated
+    otherwise, window sizes in bytes. */
+typedef struct
+{
+  uint32                       WMax;          /*!< CUBIC: window size before the last reduction */
+  uint32                       EpochStart;    /*!< CUBIC: start of the current congestion avoidance epoch */
+  uint32                       K;             /*!< CUBIC: time period [ms] to grow back to WMax */
+  uint32                       WEst;          /*!< CUBIC: estimated window of standard TCP (TCP-friendly region) */
+  uint32                       BaseRtt;       /*!< Delay-based: minimum RTT of the connection */
+  uint32                       RoundMinRtt;   /*!< Delay-based: minimum RTT of the current round */
+  uint32                       RoundTimeout;  /*!< Remaining time of the current round (one SRTT) */
+  sint32                       PacingCredit;  /*!< Number of bytes that may be sent in the current MainFunction cycle */
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx;  /*!< TCP socket that uses the context (TcpIp_GetSizeOfSocketTcpDyn(): unused) */
+  uint8                        Algorithm;     /*!< TCPIP_TCP_CONG_CTRL_ALGORITHM_* */
+  boolean                      PacingEnabled; /*!< TRUE if the transmission of new data is paced */
+  boolean                      EpochActive;   /*!< CUBIC: TRUE if EpochStart, K and WEst are valid */
+  boolean                      AppLimited;    /*!< TRUE if cwnd was not used up at the end of the last MainFunction */
+} TcpIp_Tcp_CongCtrlExtType;
+# endif
+
 /**********************************************************************************************************************
  *  LOCAL DATA
  *********************************************************************************************************************/
@@ -223,6 +279,22 @@ TCPIP_LOCAL VAR(TcpIp_SizeOfTcpOooQElementType, TCPIP_VAR_NO_INIT) TcpIp_Tcp_Ooo
 TCPIP_LOCAL VAR(TcpIp_SizeOfTcpOooQElementType, TCPIP_VAR_NO_INIT) TcpIp_Tcp_OooFirstFreeEleIdx;
 # endif
 
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+/* References to zero-copy tx data of all TCP sockets and the number of unused elements. */
+TCPIP_LOCAL VAR(TcpIp_Tcp_TxDataRefType, TCPIP_VAR_NO_INIT) TcpIp_Tcp_TxDataRef[TCPIP_TCP_ZERO_COPY_TX_REF_NUM];
+TCPIP_LOCAL VAR(uint8, TCPIP_VAR_NO_INIT)                   TcpIp_Tcp_TxDataRefNumFree;
+# endif
+
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+/* Extended congestion control contexts, assigned to the TCP sockets that use an algorithm other than Reno or pacing. */
+TCPIP_LOCAL VAR(TcpIp_Tcp_CongCtrlExtType, TCPIP_VAR_NO_INIT) TcpIp_Tcp_CongCtrlExt[TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM];
+# endif
+
+# if (TCPIP_TCP_RX_BURST == STD_ON)
+/* TCP sockets that received data in order during the current rx burst. */
+TCPIP_LOCAL VAR(TcpIp_SizeOfSocketTcpDynType, TCPIP_VAR_NO_INIT) TcpIp_Tcp_RxBurstSocket[TCPIP_TCP_RX_BURST_SOCK_NUM];
+# endif
+
 # define TCPIP_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 # include "TcpIp_MemMap.h"                                                                                              /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -247,6 +319,11 @@ TCPIP_LOCAL VAR(uint32, TCPIP_VAR_NO_INIT) TcpIp_Tcp_GlobalTimestamp;  /* MainFu
 TCPIP_LOCAL VAR(TcpIp_OsApplicationType, TCPIP_VAR_NO_INIT) TcpIp_Tcp_MainApplicationId;
 # endif
 
+# if (TCPIP_TCP_RX_BURST == STD_ON)
+TCPIP_LOCAL VAR(uint8, TCPIP_VAR_NO_INIT)   TcpIp_Tcp_RxBurstSocketNum;
+TCPIP_LOCAL VAR(boolean, TCPIP_VAR_NO_INIT) TcpIp_Tcp_RxBurstActive;
+# endif
+
 # define TCPIP_STOP_SEC_VAR_NO_INIT_8
 # include "TcpIp_MemMap.h"                                                                                              /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -747,6 +824,109 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuff
   TCPIP_P2V(uint8) IpPayloadPtr,
   uint8 TcpHeaderLen);
 
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCommitTxData
+ *********************************************************************************************************************/
+/*! \brief         Appends data that has been stored in (or reserved in) the tx buffer to the pending tx data.
+ *  \details       Updates the write index and fill level of the tx buffer and the tx request of the socket.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket.
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     TcpTxBufferDescIdx  Index of the tx buffer assigned to the socket.
+ *                                     \spec requires TcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); \endspec
+ *  \param[in]     Length              Number of bytes that have been written at the write index of the tx buffer.
+ *                                     CONSTRAINT: Length <= free space in the tx buffer
+ *  \pre           Called within critical section.
+ *  \context       TASK
+ *  \reentrant     TRUE for different socket indexes.
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCommitTxData(
+  TcpIp_SizeOfSocketTcpDynType    SocketTcpIdx,
+  TcpIp_SizeOfTcpTxBufferDescType TcpTxBufferDescIdx,
+  TcpIp_SizeOfTcpTxBufferType     Length);
+
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTxDataRefIsHeld
+ *********************************************************************************************************************/
+/*! \brief         Checks if a socket holds references to zero-copy tx data.
+ *  \details       -
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket.
+ *  \return        TRUE                At least one reference is held by the socket.
+ *  \return        FALSE               No reference is held by the socket.
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VTxDataRefIsHeld(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTxDataRefRelease
+ *********************************************************************************************************************/
+/*! \brief         Releases the zero-copy tx data references of a socket.
+ *  \details       If not all references shall be released, only the references whose data is completely
+ *                 acknowledged, i.e. whose last byte is no longer part of the pending tx data of the socket, are
+ *                 released.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket.
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     ReleaseAll          TRUE: Release all references of the socket (tx buffer cleared or released).
+ *                                     FALSE: Release only the references of acknowledged data.
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     FALSE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTxDataRefRelease(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  boolean                      ReleaseAll);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTxDataRefGetChunk
+ *********************************************************************************************************************/
+/*! \brief         Determines the location of the pending tx data at a tx buffer index.
+ *  \details       The data is either located in a user buffer referenced by the socket or in the tx buffer itself.
+ *                 Data in the tx buffer ends at the wraparound of the buffer or at the start of a referenced range.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket.
+ *  \param[in]     TcpTxBufferDescIdx  Index of the tx buffer assigned to the socket.
+ *                                     \spec requires TcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); \endspec
+ *  \param[in]     BufIdx              Tx buffer index of the first requested byte.
+ *  \param[in]     MaxLen              Maximum number of requested bytes.
+ *  \param[out]    SrcPtrPtr           Location of the first requested byte.
+ *  \return        Number of bytes that are stored consecutively at *SrcPtrPtr. [1..MaxLen]
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     FALSE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(TcpIp_SizeOfTcpTxBufferType, TCPIP_CODE) TcpIp_Tcp_VTxDataRefGetChunk(
+  TcpIp_SizeOfSocketTcpDynType    SocketTcpIdx,
+  TcpIp_SizeOfTcpTxBufferDescType TcpTxBufferDescIdx,
+  TcpIp_SizeOfTcpTxBufferType     BufIdx,
+  TcpIp_SizeOfTcpTxBufferType     MaxLen,
+  TCPIP_P2V(TcpIp_Uint8P2C)       SrcPtrPtr);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTransmitSegment_GatherDataToIpTxBuffer
+ *********************************************************************************************************************/
+/*! \brief         Copies TCP payload to the IP buffer reading referenced data directly from the user buffers.
+ *  \details       The checksum is calculated while copying, if requested by the IP tx request descriptor.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket.
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in,out] IpTxReqestDescrPtr  IP tx request descriptor holding the checksum calculation state.
+ *  \param[in]     StartDataIdx        Start index of the data in the TxBuffer that shall be sent
+ *  \param[in]     DataLen             Length of the data that shall be sent
+ *  \param[out]    TcpPayloadPtr       Pointer to the TCP payload in the IP tx buffer. At least DataLen bytes must be
+ *                                       available at TcpPayloadPtr.
+ *  \pre           DataLen > 0
+ *  \context       TASK
+ *  \reentrant     FALSE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_GatherDataToIpTxBuffer(
+  TcpIp_SizeOfSocketTcpDynType               SocketTcpIdx,
+  TCPIP_P2V(TcpIp_IpTxRequestDescriptorType) IpTxReqestDescrPtr,
+  TcpIp_SizeOfTcpTxBufferType                StartDataIdx,
+  TcpIp_SizeOfTcpTxBufferType                DataLen,
+  TCPIP_P2V(uint8)                           TcpPayloadPtr);
+# endif
+
 /**********************************************************************************************************************
  *  TcpIp_Tcp_VTransmitSegment_WriteHeaderElements
  *********************************************************************************************************************/
@@ -1297,6 +1477,23 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainRxDataForwarding(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
   uint16 MaxLenToForward);
 
+# if (TCPIP_TCP_RX_BURST == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VRxBurstNoteSocket
+ *********************************************************************************************************************/
+/*! \brief         Notes a socket for forwarding of its received data at the end of the current rx burst.
+ *  \details       Nothing is done outside of an rx burst or if the socket has no data to forward. If no more sockets
+ *                 can be noted, the data is forwarded by TcpIp_Tcp_MainFunctionRx() as usual.
+ *  \param[in]     SocketTcpIdx         Index of a TCP socket
+ *                                      \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \pre           -
+ *  \context       TASK|ISR2
+ *  \reentrant     FALSE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxBurstNoteSocket(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+# endif
+
 /**********************************************************************************************************************
  *  TcpIp_Tcp_VMainIdleTimeoutHandling
  *********************************************************************************************************************/
@@ -1473,6 +1670,237 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSetSsthreshEqu4(
  *********************************************************************************************************************/
 TCPIP_LOCAL FUNC(uint32, TCPIP_CODE) TcpIp_Tcp_VCalcFlightSize(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+
+#  if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtGetIdx
+ *********************************************************************************************************************/
+/*! \brief         Returns the extended congestion control context that is assigned to a socket.
+ *  \details       -
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \return        Index of the context or TCPIP_TCP_CONG_CTRL_EXT_IDX_INV if no context is assigned to the socket.
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(uint8, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtGetIdx(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtAssign
+ *********************************************************************************************************************/
+/*! \brief         Sets the congestion control algorithm and the pacing mode of a socket.
+ *  \details       A context is assigned to the socket unless the socket uses the default settings (Reno without
+ *                 pacing). The algorithm state is reset if the algorithm changes.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     Algorithm           Congestion control algorithm (TCPIP_TCP_CONG_CTRL_ALGORITHM_*)
+ *  \param[in]     PacingEnabled       TRUE if the transmission of new data shall be paced
+ *  \return        E_OK                Settings applied.
+ *  \return        E_NOT_OK            No free context available.
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtAssign(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint8                        Algorithm,
+  boolean                      PacingEnabled);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtReset
+ *********************************************************************************************************************/
+/*! \brief         Resets the algorithm state of an extended congestion control context.
+ *  \details       -
+ *  \param[in]     CtxPtr              Pointer to the context
+ *                                     \spec requires CtxPtr != NULL_PTR; \endspec
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE for different contexts
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtReset(
+  TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) CtxPtr);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtSetParameter
+ *********************************************************************************************************************/
+/*! \brief         Handles the parameters TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM and TCPIP_PARAMID_V_TCP_PACING.
+ *  \details       -
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     OptName             Parameter ID
+ *  \param[in]     OptValPtr           Pointer to the uint8 parameter value
+ *                                     \spec requires OptValPtr != NULL_PTR; \endspec
+ *  \return        E_OK                Parameter changed.
+ *  \return        E_NOT_OK            Invalid value or no free context available.
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtSetParameter(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint8                        OptName,
+  TCPIP_P2C(uint8)             OptValPtr);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtMain
+ *********************************************************************************************************************/
+/*! \brief         Cyclic handling of the extended congestion control of a socket.
+ *  \details       Refills the pacing budget of the socket. CUBIC: freezes the epoch while the socket is application
+ *                 limited. Delay-based: updates cwnd once per round trip time, as soon as RTT samples are available.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \return        TRUE                cwnd of the socket is controlled by an extended algorithm.
+ *  \return        FALSE               cwnd of the socket is controlled by the default algorithm (Reno).
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtMain(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtOnAck
+ *********************************************************************************************************************/
+/*! \brief         Handles newly acknowledged data of a socket in congestion avoidance.
+ *  \details       CUBIC: sums up the acknowledged bytes and grows cwnd as soon as one segment has been acknowledged.
+ *                 No growth while the socket is application limited (RFC 8312 section 5.8).
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     AckedBytes          Number of newly acknowledged bytes
+ *  \return        TRUE                cwnd of the socket is controlled by an extended algorithm.
+ *  \return        FALSE               cwnd of the socket is controlled by the default algorithm (Reno).
+ *  \pre           The socket is in state 'congestion avoidance'
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtOnAck(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       AckedBytes);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtUpdateAppLimited
+ *********************************************************************************************************************/
+/*! \brief         Checks if a socket that uses an extended algorithm is application limited.
+ *  \details       The socket is application limited if another full segment would have fit into cwnd after the
+ *                 transmission of pending data.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtUpdateAppLimited(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtCubicUpdate
+ *********************************************************************************************************************/
+/*! \brief         Updates cwnd of a socket in congestion avoidance according to CUBIC (RFC 8312).
+ *  \details       Called from the ACK path. Consumes the acknowledged bytes summed up in AckSumN.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in,out] CtxPtr              Pointer to the context of the socket
+ *                                     \spec requires CtxPtr != NULL_PTR; \endspec
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtCubicUpdate(
+  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) CtxPtr);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtDelayUpdate
+ *********************************************************************************************************************/
+/*! \brief         Updates cwnd of a socket according to the delay-based algorithm (TCP Vegas).
+ *  \details       Called once per round trip time. The amount of data queued in the network is estimated from the
+ *                 minimum RTT of the connection and the minimum RTT of the last round. In slow start the socket
+ *                 switches to congestion avoidance as soon as data is queued. In congestion avoidance cwnd is
+ *                 increased or decreased by one segment to keep the queued data between two and four segments.
+ *                 cwnd is not increased while the socket is application limited.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in,out] CtxPtr              Pointer to the context of the socket
+ *                                     \spec requires CtxPtr != NULL_PTR; \endspec
+ *  \pre           -
+ *  \context       TASK
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtDelayUpdate(
+  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) CtxPtr);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtOnLoss
+ *********************************************************************************************************************/
+/*! \brief         Sets ssthresh after a detected loss if the socket uses CUBIC.
+ *  \details       -
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     FlightSize          Amount of outstanding data when the loss was detected
+ *  \return        TRUE                ssthresh has been set.
+ *  \return        FALSE               The socket does not use CUBIC, ssthresh has to be set according to RFC 5681.
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtOnLoss(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       FlightSize);
+
+#   if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtRttSample
+ *********************************************************************************************************************/
+/*! \brief         Passes a round trip time measurement to the delay-based algorithm.
+ *  \details       -
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     ElementRtt          Measured round trip time [MainFunction cycles]
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtRttSample(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       ElementRtt);
+#   endif
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VPacingConsume
+ *********************************************************************************************************************/
+/*! \brief         Checks if new data may be sent by a socket according to its pacing budget.
+ *  \details       If data may be sent, the length of the segment is subtracted from the budget. The budget may become
+ *                 negative, so a segment is always allowed if any budget is left.
+ *  \param[in]     SocketTcpIdx        Index of a TCP socket
+ *                                     \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
+ *  \param[in]     SegLen              Length of the segment that shall be sent
+ *  \return        TRUE                Segment may be sent now.
+ *  \return        FALSE               Pacing budget of the current MainFunction cycle is exhausted.
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE for different sockets
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VPacingConsume(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       SegLen);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCubeRoot
+ *********************************************************************************************************************/
+/*! \brief         Calculates the integer cube root of a value.
+ *  \details       -
+ *  \param[in]     Value               Value
+ *  \return        Largest integer whose cube is less than or equal to Value.
+ *  \pre           -
+ *  \context       TASK|ISR
+ *  \reentrant     TRUE
+ *********************************************************************************************************************/
+TCPIP_LOCAL FUNC(uint32, TCPIP_CODE) TcpIp_Tcp_VCubeRoot(
+  uint64 Value);
+#  endif /* (TCPIP_TCP_CONG_CTRL_EXT == STD_ON) */
 # endif /* (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON) */
 
 # if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
@@ -2319,7 +2747,6 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
  *  \details       -
  *  \param[in]     SocketTcpIdx          Index of a TCP socket
  *                                       CONSTRAINT: [0..TcpIp_GetSizeOfSocketTcpDyn()-1]
- *  \param[in]     NumOooElementsToBeChecked   Number of ooo elements that shall be checked for combination
  *  \param[in]     CurrentOooElementPtr  Pointer to current ooo element
  *                                       \spec requires CurrentOooElementPtr != NULL_PTR; \endspec
  *  \param[in]     SegmentDescriptorPtr  Pointer to the segment descriptor for the received message
@@ -2329,7 +2756,6 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
  *********************************************************************************************************************/
 TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_CombineSegmentAndOooElements(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TcpIp_TcpOooQElementIterType   NumOooElementsToBeChecked,
   TCPIP_P2V(TcpIp_Tcp_RxPreBufEleType) CurrentOooElementPtr,
   TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr);
 
@@ -2374,59 +2800,42 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
 
 #  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateOooElementChangeOrder
+ *  TcpIp_Tcp_VOooChangeOrderSetNewest
  *********************************************************************************************************************/
-/*! \brief         Update the time-wise linkage of the socket's ooo elements after one element has been changed or
- *                 removed.
- *  \details       Called in context of TcpIp_Tcp_VRxIndicationStateOthers_Seventh.
+/*! \brief         Mark an ooo element as the most recently changed element of the socket.
+ *  \details       Moves the element to the front of the time-wise linkage of the socket's ooo elements. The linkage
+ *                 is used to order the SACK blocks according to RFC 2018, section 4.
  *  \param[in]     SocketTcpIdx            Index of a TCP socket.
  *                                         \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
- *  \param[in]     ChangedElementIdKnown   Indicates if the new last changed element is known
- *  \param[in]     ChangedEleIdx           Index of the changed ooo element. Parameter is only valid if parameter
- *                                         ChangedElementIdKnown is TRUE.
+ *  \param[in]     ChangedEleIdx           Index of the changed ooo element.
  *                                         \spec requires ChangedEleIdx < TcpIp_GetSizeOfTcpOooQElement(); \endspec
- *  \pre           -
- *  \context       TASK|ISR
- *  \reentrant     FALSE
- *********************************************************************************************************************/
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateOooElementChangeOrder(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  boolean ChangedElementIdKnown,
-  TcpIp_SizeOfTcpOooQElementType ChangedEleIdx);
-
-/**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateOooElementChangeOrder_IdentifyLastChangedElement
- *********************************************************************************************************************/
-/*! \brief         Identify the newest ooo element for this socket and store its index.
- *  \details       -
- *  \param[in]     SocketTcpIdx              Index of a TCP socket.
- *                                           \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
- *  \param[in]     ChangedElementIdKnown     Indicates if the new last changed element is known
- *  \param[in]     ChangedTcpOooQElementIdx  Index of the changed ooo element. Parameter is only valid if parameter
- *                                           ChangedElementIdKnown is TRUE.
- *                                           \spec requires ChangedTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); \endspec
- *  \pre           -
+ *  \param[in]     IsLinked                TRUE:  The element already is part of the time-wise linkage.
+ *                                         FALSE: The element is new and not yet part of the time-wise linkage.
+ *  \pre           The element must be part of the socket's ooo queue.
  *  \context       TASK|ISR
  *  \reentrant     FALSE
  *********************************************************************************************************************/
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateOooElementChangeOrder_IdentifyLastChangedElement(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  boolean ChangedElementIdKnown,
-  TcpIp_SizeOfTcpOooQElementType ChangedTcpOooQElementIdx);
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VOooChangeOrderSetNewest(
+  TcpIp_SizeOfSocketTcpDynType   SocketTcpIdx,
+  TcpIp_SizeOfTcpOooQElementType ChangedEleIdx,
+  boolean                        IsLinked);
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateOooElementChangeOrder_LinkElements
+ *  TcpIp_Tcp_VOooChangeOrderRemove
  *********************************************************************************************************************/
-/*! \brief         Renew the time-wise link between the socket's ooo elements.
+/*! \brief         Remove an ooo element from the time-wise linkage of the socket's ooo elements.
  *  \details       -
  *  \param[in]     SocketTcpIdx            Index of a TCP socket.
  *                                         \spec requires SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); \endspec
- *  \pre           -
+ *  \param[in]     RemovedEleIdx           Index of the ooo element that is removed from the socket's ooo queue.
+ *                                         \spec requires RemovedEleIdx < TcpIp_GetSizeOfTcpOooQElement(); \endspec
+ *  \pre           Must be called before the fill level of the socket's ooo queue is decremented.
  *  \context       TASK|ISR
  *  \reentrant     FALSE
  *********************************************************************************************************************/
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateOooElementChangeOrder_LinkElements(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx);
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VOooChangeOrderRemove(
+  TcpIp_SizeOfSocketTcpDynType   SocketTcpIdx,
+  TcpIp_SizeOfTcpOooQElementType RemovedEleIdx);
 #  endif /* TCPIP_SUPPORT_TCP_SELECTIVE_ACK */
 
 /**********************************************************************************************************************
@@ -2703,6 +3112,36 @@ FUNC(void, TCPIP_CODE) TcpIp_Tcp_Init(void)
   /* #20 Init the reset queue */
   TcpIp_Tcp_InitResetQueue();
 
+# if (TCPIP_TCP_RX_BURST == STD_ON)
+  TcpIp_Tcp_RxBurstSocketNum = 0u;
+  TcpIp_Tcp_RxBurstActive    = FALSE;
+# endif
+
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+  /* Mark all zero-copy tx data references as unused */
+  {
+    uint8_least txDataRefIdx;
+
+    for (txDataRefIdx = 0u; txDataRefIdx < TCPIP_TCP_ZERO_COPY_TX_REF_NUM; txDataRefIdx++)
+    {
+      TcpIp_Tcp_TxDataRef[txDataRefIdx].Len = 0u;
+    }
+    TcpIp_Tcp_TxDataRefNumFree = TCPIP_TCP_ZERO_COPY_TX_REF_NUM;
+  }
+# endif
+
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+  /* Mark all extended congestion control contexts as unused */
+  {
+    uint8_least ctxIdx;
+
+    for (ctxIdx = 0u; ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM; ctxIdx++)
+    {
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].SocketTcpIdx = TcpIp_GetSizeOfSocketTcpDyn();
+    }
+  }
+# endif
+
 # if (TCPIP_SUPPORT_TCP_RX_OOO == STD_ON)
   /* #30 Init the queue for out of order received segments */
   TcpIp_Tcp_OooNumFreeElements = TcpIp_GetSizeOfTcpOooQElement();
@@ -2952,6 +3391,9 @@ FUNC(void, TCPIP_CODE) TcpIp_Tcp_RxIndication(
               {
                 /* #130 The socket is in state SYNRECEIVED or the connection is established, process the segment */
                 TcpIp_Tcp_VRxIndicationStateOthers(socketTcpIdx, LocalAddrIdx, RxSockRemAddrPtr, &rxSockLocAddr, &segmentDescriptor);
+# if (TCPIP_TCP_RX_BURST == STD_ON)
+                TcpIp_Tcp_VRxBurstNoteSocket(socketTcpIdx);
+# endif
                 break;
               }
             } /* end checking sock states */
@@ -4182,7 +4624,16 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Fifth_3_Up
   else if (TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx) == TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE)
   {
     /* #30 Summarize incoming ACKs */
-    TcpIp_Tcp_VIncAckSumN(SocketTcpIdx, ackedBytes);
+#  if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+    if (TcpIp_Tcp_VCongCtrlExtOnAck(SocketTcpIdx, ackedBytes) == TRUE)
+    {
+      /* ACK handled by the extended algorithm. */
+    }
+    else
+#  endif
+    {
+      TcpIp_Tcp_VIncAckSumN(SocketTcpIdx, ackedBytes);
+    }
   }
   else   /* fast recover ('fast retransmit' is no 'stable' state) */
   {
@@ -5042,7 +5493,6 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_Re
  *
  *
  *
- *
  */
 /* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
 TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_RemoveFirstOooElement(
@@ -5054,39 +5504,19 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_Re
 
   /* ----- Implementation ----------------------------------------------- */
   /* #10 Determine new first ooo element. */
-  if (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 1u)
-  {
-    TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, TcpIp_GetAddrTcpOooQElement(freeTcpOooQElementIdx)->NextEleIdx);
-  }
-  else
-  {
-    /* There is only one ooo element, so after removing it there won't be any ooo element for this socket. */
-    TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, TcpIp_GetSizeOfTcpOooQElement());  /* invalid */
+  /* The list is terminated by an invalid index, so the first index becomes invalid if the only element is removed. */
+  TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, TcpIp_GetAddrTcpOooQElement(freeTcpOooQElementIdx)->NextEleIdx);
+
 #  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-          /* Reset the OooChangeCounter */
-    TcpIp_SetTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx, 0);
+  /* #20 Remove the element from the time-wise linkage of the ooo elements. */
+  TcpIp_Tcp_VOooChangeOrderRemove(SocketTcpIdx, freeTcpOooQElementIdx);
 #  endif
-  }
 
-  /* #20 Update ooo element relations. */
+  /* #30 Prepend the element to the list of free elements. */
   TcpIp_GetAddrTcpOooQElement(freeTcpOooQElementIdx)->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
   TcpIp_Tcp_OooFirstFreeEleIdx = freeTcpOooQElementIdx;
   TcpIp_DecTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
   TcpIp_Tcp_OooNumFreeElements++;
-
-#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  /* #30 Update SACK element change order. */
-  if (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 1u)
-  {
-    /* Update the time-wise linkage of the ooo elements */
-    TcpIp_Tcp_VUpdateOooElementChangeOrder(SocketTcpIdx, FALSE, 0);
-  }
-  else
-  {
-    /* Set the last remaining ooo element to be the last changed element */
-    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx));
-  }
-#  endif
 }
 
 
@@ -5101,6 +5531,7 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_Re
  *
  *
  *
+ *
  */
 TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_CheckCombination(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
@@ -5110,13 +5541,27 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
   boolean                        combinationIsPossible = FALSE;
   TcpIp_SizeOfTcpOooQElementType currentTcpOooQElementIdx   = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
   /*@ assert currentTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                             /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
-  TcpIp_TcpOooQElementIterType   numOooElementsToBeChecked = TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
   uint32                         segmentEndSeqNo = SegmentDescriptorPtr->SegSeq + SegmentDescriptorPtr->SegLen;
   TCPIP_P2V(TcpIp_Tcp_RxPreBufEleType) currentOooElementPtr = NULL_PTR;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Skip ooo elements that lie in front of the new segment (without having contact to the segment). */
-  while (numOooElementsToBeChecked > 0u)
+#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  {
+    /* #10 Start the search at the last changed ooo element if the segment does not start in front of it.
+           Segments following a lost segment typically extend this element, so the search ends immediately. All ooo
+           elements in front of it end before the segment starts, because there is a gap between all ooo elements. */
+    TcpIp_SizeOfTcpOooQElementType lastChangedTcpOooQElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
+    /*@ assert lastChangedTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                      /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
+
+    if (TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(SegmentDescriptorPtr->SegSeq, TcpIp_GetAddrTcpOooQElement(lastChangedTcpOooQElementIdx)->SeqNo))
+    {
+      currentTcpOooQElementIdx = lastChangedTcpOooQElementIdx;
+    }
+  }
+#  endif
+
+  /* #20 Skip ooo elements that lie in front of the new segment (without having contact to the segment). */
+  while (currentTcpOooQElementIdx != TCPIP_TCP_OOO_ELE_IDX_INV)
   {
     /*@ assert currentTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                           /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
     currentOooElementPtr = TcpIp_GetAddrTcpOooQElement(currentTcpOooQElementIdx);
@@ -5124,7 +5569,6 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
     if (TCPIP_TCP_SEQ1_BIGGER_SEQ2(SegmentDescriptorPtr->SegSeq, (currentOooElementPtr->SeqNo + currentOooElementPtr->LenByte)))
     {
       currentTcpOooQElementIdx = currentOooElementPtr->NextEleIdx;
-      numOooElementsToBeChecked--;
     }
     else
     {
@@ -5133,10 +5577,10 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
     }
   }
 
-  /* #20 If available, combine segment with one or more ooo elements. */
-  if (numOooElementsToBeChecked > 0u)
+  /* #30 If available, combine segment with one or more ooo elements. */
+  if (currentTcpOooQElementIdx != TCPIP_TCP_OOO_ELE_IDX_INV)
   {
-    /* #30 Combine segment with the first applicable ooo element. */
+    /* #40 Combine segment with the first applicable ooo element. */
 
     uint32 currentOooElementEndSeqNo;
 
@@ -5152,7 +5596,7 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
       /* The received segment somehow contacts the next ooo element. */
       combinationIsPossible = TRUE;
 
-      /* #40 If applicable, extend the ooo element to include the segment part that lies in front of the ooo element. */
+      /* #50 If applicable, extend the ooo element to include the segment part that lies in front of the ooo element. */
       if (TCPIP_TCP_SEQ1_SMALLER_SEQ2(SegmentDescriptorPtr->SegSeq, currentOooElementPtr->SeqNo))
       {
         /* The segment starts in front of the current ooo element */
@@ -5161,22 +5605,23 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
         currentOooElementPtr->SeqNo = SegmentDescriptorPtr->SegSeq;
       }
 
-      /* #50 Combine with next ooo element, depending on the kind of overlapping or contact. */
+      /* #60 Combine with next ooo element, depending on the kind of overlapping or contact. */
       if (TCPIP_TCP_SEQ1_BIGGER_SEQ2(segmentEndSeqNo, currentOooElementEndSeqNo))
       {
         /* The segment exceeds the current ooo element */
-        TcpIp_Tcp_VRxIndicationStateOthers_Seventh_CombineSegmentAndOooElements(SocketTcpIdx, numOooElementsToBeChecked,
-          currentOooElementPtr, SegmentDescriptorPtr);
-
-#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-      /* rescan the whole ooo list and update the 'next older element' relation */
-        TcpIp_Tcp_VUpdateOooElementChangeOrder(SocketTcpIdx, TRUE, currentTcpOooQElementIdx);
-#  endif
+        TcpIp_Tcp_VRxIndicationStateOthers_Seventh_CombineSegmentAndOooElements(SocketTcpIdx, currentOooElementPtr,
+          SegmentDescriptorPtr);
       }
       else
       {
         /* Segment ends inside of the current ooo element, so combination can be stopped. */
       }
+
+#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+      /* #70 Mark the element as the newest one. It contains the received segment, so it has to be reported in the
+             first SACK block (RFC 2018, section 4). */
+      TcpIp_Tcp_VOooChangeOrderSetNewest(SocketTcpIdx, currentTcpOooQElementIdx, TRUE);
+#  endif
     }
   }
 
@@ -5195,29 +5640,27 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
  *
  *
  *
- *
- *
  */
 /* PRQA S 6080 1 */ /* MD_MSR_STMIF */
 TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_CombineSegmentAndOooElements(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TcpIp_TcpOooQElementIterType   NumOooElementsToBeChecked,
   TCPIP_P2V(TcpIp_Tcp_RxPreBufEleType) CurrentOooElementPtr,
   TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
   uint32 currentOooElementEndSeqNo = CurrentOooElementPtr->SeqNo + CurrentOooElementPtr->LenByte;
   uint32                         segmentEndSeqNo = SegmentDescriptorPtr->SegSeq + SegmentDescriptorPtr->SegLen;
-  TcpIp_TcpOooQElementIterType   numOooElementsToBeCheckedLocal = NumOooElementsToBeChecked;
   boolean                        stopCombination = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
   /* #10 Combine segment with all applicable ooo elements. */
   while (stopCombination == FALSE)
   {
-    if (numOooElementsToBeCheckedLocal == 1u)
+    TcpIp_SizeOfTcpOooQElementType nextTcpOooQElementIdx = CurrentOooElementPtr->NextEleIdx;
+
+    if (nextTcpOooQElementIdx == TCPIP_TCP_OOO_ELE_IDX_INV)
     {
-      /* #20 There is exactly one ooo element left. Combine segment with the current ooo element. */
+      /* #20 The current ooo element is the last one. Combine segment with the current ooo element. */
       /* Segment exceeds the current ooo element. */
       CurrentOooElementPtr->LenByte += (uint16)(segmentEndSeqNo - currentOooElementEndSeqNo);
       /* This is the last ooo element, so combination can be stopped. */
@@ -5226,8 +5669,7 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_Co
     else
     {
       /* #30 There are more ooo elements to be checked. */
-      TcpIp_SizeOfTcpOooQElementType nextTcpOooQElementIdx        = CurrentOooElementPtr->NextEleIdx;
-        /*@ assert nextTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                          /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
+      /*@ assert nextTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                            /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
       TcpIp_Tcp_RxPreBufEleType     *nextOooElementPtr = TcpIp_GetAddrTcpOooQElement(nextTcpOooQElementIdx);
 
       /* #40 If the segment ends before the next ooo element starts, stop the combination. */
@@ -5245,54 +5687,33 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_Co
         if (TCPIP_TCP_SEQ1_SMALLER_OR_EQUAL_SEQ2(segmentEndSeqNo, nextOooElementEndSeqNo))
         {
           /* #50 The segment ends inside the next ooo element. Combine the segment with the ooo element, and stop further combination. */
-          /* combine the two elements and delete the second one */
           CurrentOooElementPtr->LenByte = (uint16)(nextOooElementEndSeqNo - CurrentOooElementPtr->SeqNo);
-          CurrentOooElementPtr->NextEleIdx = nextOooElementPtr->NextEleIdx;
-
-          /* Delete the next ooo element */
-          /* prepend the now free element to the free elements list */
-          TcpIp_DecTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
-          nextOooElementPtr->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
-          TcpIp_Tcp_OooFirstFreeEleIdx = nextTcpOooQElementIdx;
-          TcpIp_Tcp_OooNumFreeElements++;
-
           stopCombination = TRUE;
         }
-        else if ((numOooElementsToBeCheckedLocal == 2u)  /* no further ooo elements available */                        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        else if ((nextOooElementPtr->NextEleIdx == TCPIP_TCP_OOO_ELE_IDX_INV)  /* no further ooo elements available */     /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
           || (TCPIP_TCP_SEQ1_BIGGER_SEQ2(TcpIp_GetAddrTcpOooQElement(nextOooElementPtr->NextEleIdx)->SeqNo, segmentEndSeqNo))) /* There are further ooo elements, but the segment does not reach the next one. */
         {
           /* #60 The segment ends somewhere behind the next ooo element, or does not reach the next but one ooo element. Add the length exceeding the next ooo element, and stop further combination. */
-
-          /* Extend the current ooo element to include the whole segment, and delete the next ooo element. */
           CurrentOooElementPtr->LenByte = (uint16)(segmentEndSeqNo - CurrentOooElementPtr->SeqNo);
-          CurrentOooElementPtr->NextEleIdx = nextOooElementPtr->NextEleIdx;
-
-          /* Delete the next ooo element */
-          /* prepend the now free element to the free elements list */
-          TcpIp_DecTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
-          nextOooElementPtr->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
-          TcpIp_Tcp_OooFirstFreeEleIdx = nextTcpOooQElementIdx;
-          TcpIp_Tcp_OooNumFreeElements++;
-
           stopCombination = TRUE;
         }
         else
         {
           /* #70 The segment reaches another stored ooo element (the next but one ooo element). This will be handled in the next loop. */
-
-          /* Extend the current ooo element to include the whole segment, and delete the next ooo element. */
           CurrentOooElementPtr->LenByte = (uint16)(nextOooElementEndSeqNo - CurrentOooElementPtr->SeqNo);
-          CurrentOooElementPtr->NextEleIdx = nextOooElementPtr->NextEleIdx;
+        }
 
-          /* Delete the next ooo element */
-          /* prepend the now free element to the free elements list */
-          TcpIp_DecTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
-          nextOooElementPtr->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
-          TcpIp_Tcp_OooFirstFreeEleIdx = nextTcpOooQElementIdx;
-          TcpIp_Tcp_OooNumFreeElements++;
+        /* #80 Delete the next ooo element, it is now contained in the current ooo element. */
+        CurrentOooElementPtr->NextEleIdx = nextOooElementPtr->NextEleIdx;
+#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+        TcpIp_Tcp_VOooChangeOrderRemove(SocketTcpIdx, nextTcpOooQElementIdx);
+#  endif
 
-          numOooElementsToBeCheckedLocal--;
-        }
+        /* prepend the now free element to the free elements list */
+        TcpIp_DecTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
+        nextOooElementPtr->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
+        TcpIp_Tcp_OooFirstFreeEleIdx = nextTcpOooQElementIdx;
+        TcpIp_Tcp_OooNumFreeElements++;
       }
     }
   }  /* while */
@@ -5311,8 +5732,6 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_Co
  *
  *
  *
- *
- *
  */
 /* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
 TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh_InsertNewOooElement(
@@ -5327,19 +5746,12 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
   /* #10 Check if there are free ooo elements available. */
   if (TcpIp_Tcp_OooNumFreeElements > 0u)
   {
-
-#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-    TcpIp_SizeOfTcpOooQElementType oldLastChangedElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
-#  endif
-
     /* #20 Take a new element. */
     TcpIp_SizeOfTcpOooQElementType newTcpOooQElementIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
     /*@ assert newTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                               /* VCA_TCPIP_INDEX_WITHIN_OOO_FREELIST */
-    TcpIp_SizeOfTcpOooQElementType lastValidTcpOooQElementIdx = 0;  /* Init this variable 'lastValidTcpOooQElementIdx' to prevent MISRA checkers to issue the warning message 3353. The variable will always be set to a valid value before it is used */
+    TcpIp_SizeOfTcpOooQElementType prevTcpOooQElementIdx    = TCPIP_TCP_OOO_ELE_IDX_INV;
+    TcpIp_SizeOfTcpOooQElementType currentTcpOooQElementIdx = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
 
-    /* #30 Find insert position for new element. Elements in queue are ordered by sequence number. */
-    TcpIp_SizeOfTcpOooQElementType currentTcpOooQElementIdx   = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
-    TcpIp_TcpOooQElementIterType   numCheckedElements = 0;
     TcpIp_Tcp_OooNumFreeElements--;
     if (TcpIp_Tcp_OooNumFreeElements > 0u)
     {
@@ -5349,49 +5761,45 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
     TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->LenByte = SegmentDescriptorPtr->SegLen;
 
 #  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, newTcpOooQElementIdx);
+    {
+      /* #30 Start the search for the insert position at the last changed ooo element if the segment lies behind it. */
+      TcpIp_SizeOfTcpOooQElementType lastChangedTcpOooQElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
+      /*@ assert lastChangedTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                    /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
+
+      if (TCPIP_TCP_SEQ1_BIGGER_SEQ2(SegmentDescriptorPtr->SegSeq, TcpIp_GetAddrTcpOooQElement(lastChangedTcpOooQElementIdx)->SeqNo))
+      {
+        prevTcpOooQElementIdx    = lastChangedTcpOooQElementIdx;
+        currentTcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(lastChangedTcpOooQElementIdx)->NextEleIdx;
+      }
+    }
 #  endif
-    while (   (numCheckedElements < TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx))                             /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+
+    /* #40 Find insert position for new element. Elements in queue are ordered by sequence number. */
+    while (   (currentTcpOooQElementIdx != TCPIP_TCP_OOO_ELE_IDX_INV)                                                    /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
            && (TCPIP_TCP_SEQ1_BIGGER_SEQ2(SegmentDescriptorPtr->SegSeq, TcpIp_GetAddrTcpOooQElement(currentTcpOooQElementIdx)->SeqNo)))
     {
-      lastValidTcpOooQElementIdx = currentTcpOooQElementIdx;
+      prevTcpOooQElementIdx    = currentTcpOooQElementIdx;
       currentTcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(currentTcpOooQElementIdx)->NextEleIdx;
-      numCheckedElements++;
     }
-    /*@ assert lastValidTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                         /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
 
-    /* #40 Check where to insert the new element into the existing list. */
-    if (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) != numCheckedElements)
+    /* #50 Insert the element in front of the found element. If no element was found, the element is appended and
+           terminates the list. */
+    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->NextEleIdx = currentTcpOooQElementIdx;
+    if (prevTcpOooQElementIdx == TCPIP_TCP_OOO_ELE_IDX_INV)
     {
-      /* insert new element */
-      TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->NextEleIdx = currentTcpOooQElementIdx;
-      if (numCheckedElements == 0u)
-      {
-        /* #50 Prepend the element to the list. */
-        TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, newTcpOooQElementIdx);
-      }
-      else
-      {
-        /* #60 Insert the element somewhere inside the list. */
-        TcpIp_GetAddrTcpOooQElement(lastValidTcpOooQElementIdx)->NextEleIdx = newTcpOooQElementIdx;  /* variable is always initialized ! */
-      }
-      TcpIp_IncTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
+      /* Prepend the element to the list. */
+      TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, newTcpOooQElementIdx);
     }
     else
     {
-      /* #70 Append new element at the end of the list. */
-      TcpIp_GetAddrTcpOooQElement(lastValidTcpOooQElementIdx)->NextEleIdx = newTcpOooQElementIdx;
-      TcpIp_IncTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
+      /*@ assert prevTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                           /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
+      TcpIp_GetAddrTcpOooQElement(prevTcpOooQElementIdx)->NextEleIdx = newTcpOooQElementIdx;
     }
+    TcpIp_IncTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
 
 #  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-    /* #80 Update the 'next older element' relation. */
-    /* link the new element to the previous last changed element */
-    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->OlderEleIdx = oldLastChangedElementIdx;
-
-    /* set current element as the last changed one */
-    TcpIp_IncTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx);
-    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->ChangeCounterValue = TcpIp_GetTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx);
+    /* #60 Mark the new element as the newest one. */
+    TcpIp_Tcp_VOooChangeOrderSetNewest(SocketTcpIdx, newTcpOooQElementIdx, FALSE);
 #  endif
 
     segCouldBeStored = TRUE;
@@ -5433,16 +5841,15 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
     /*@ assert newTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                               /* VCA_TCPIP_INDEX_WITHIN_OOO_FREELIST */
 
 #  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+    /* The element is the only one, so there is no next older element it could be linked to. */
     TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, newTcpOooQElementIdx);
-    /* Set the ChangeCounterValue of the ooo element. There is no next older element it could be linked to. */
-    TcpIp_IncTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx);
-    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->ChangeCounterValue = TcpIp_GetTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx);
-    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->OlderEleIdx = TcpIp_GetSizeOfTcpOooQElement();
+    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->OlderEleIdx = TCPIP_TCP_OOO_ELE_IDX_INV;
 #  endif
     TcpIp_Tcp_OooFirstFreeEleIdx = TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->NextEleIdx;
     TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, newTcpOooQElementIdx);
-    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->SeqNo   = SegmentDescriptorPtr->SegSeq;
-    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->LenByte = SegmentDescriptorPtr->SegLen;
+    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->SeqNo      = SegmentDescriptorPtr->SegSeq;
+    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->LenByte    = SegmentDescriptorPtr->SegLen;
+    TcpIp_GetAddrTcpOooQElement(newTcpOooQElementIdx)->NextEleIdx = TCPIP_TCP_OOO_ELE_IDX_INV;  /* end of list */
     TcpIp_IncTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
     TcpIp_Tcp_OooNumFreeElements--;
     segCouldBeStored = TRUE;
@@ -5454,157 +5861,79 @@ TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VRxIndicationStateOthers_Seventh
 
 #  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateOooElementChangeOrder
- *********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateOooElementChangeOrder(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  boolean ChangedElementIdKnown,
-  TcpIp_SizeOfTcpOooQElementType ChangedEleIdx )
-{
-  /* ----- Implementation ----------------------------------------------- */
-  /* Do a total re-scan of all elements and link them by their age (change history). */
-
-  /* #10 Identify the last changed element. */
-  TcpIp_Tcp_VUpdateOooElementChangeOrder_IdentifyLastChangedElement(SocketTcpIdx, ChangedElementIdKnown, ChangedEleIdx);
-
-  /* #20 Link all ooo elements sorted by their change time. */
-  TcpIp_Tcp_VUpdateOooElementChangeOrder_LinkElements(SocketTcpIdx);
-}
-
-
-/**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateOooElementChangeOrder_IdentifyLastChangedElement
+ *  TcpIp_Tcp_VOooChangeOrderSetNewest
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateOooElementChangeOrder_IdentifyLastChangedElement(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  boolean ChangedElementIdKnown,
-  TcpIp_SizeOfTcpOooQElementType ChangedTcpOooQElementIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VOooChangeOrderSetNewest(
+  TcpIp_SizeOfSocketTcpDynType   SocketTcpIdx,
+  TcpIp_SizeOfTcpOooQElementType ChangedEleIdx,
+  boolean                        IsLinked)
 {
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Identify the last changed element. */
-  if (ChangedElementIdKnown == FALSE)
+  /* #10 Nothing to do if the element already is the newest one. This is the typical case if consecutive segments
+         are received behind a lost segment. */
+  if (ChangedEleIdx != TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx))
   {
-    /* #20 If the changed element id is unknown, then search for the last changed ooo element. */
-    /* No element of the ooo list was changed, but the ooo element with the smallest sequence number is removed (the gap
-       between this element and the already ACKed data was filled). */
-
-    /* take the first ooo element and set it as newest element */
-    TcpIp_SizeOfTcpOooQElementType newestTcpOooQElementIdx = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
-    uint32 newestEleChangeCounterValue          = TcpIp_GetAddrTcpOooQElement(newestTcpOooQElementIdx)->ChangeCounterValue;
-    /* ooo element index when iterating (by sequence number) through the socket's ooo elements */
-    /* go through the rest of the ooo array (by sequence), and search for the oldest element */
-    TcpIp_SizeOfTcpOooQElementType currentTcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(newestTcpOooQElementIdx)->NextEleIdx;
-    TcpIp_TcpOooQElementIterType oooElementIteratorLoopCount;  /* simple iteration variable */
-
-    /* The first element is already handled, so the other (OooQFillNum - 1) elements have to be handled */
-    for (oooElementIteratorLoopCount = 0;
-         oooElementIteratorLoopCount < (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) - 1u);
-         oooElementIteratorLoopCount++)
+    /* #20 Unlink the element from its current position in the time-wise linkage. */
+    if (IsLinked == TRUE)
     {
-      TCPIP_P2C(TcpIp_Tcp_RxPreBufEleType) currentOooElePtr = TcpIp_GetAddrTcpOooQElement(currentTcpOooQElementIdx);
-
-      if (currentOooElePtr->ChangeCounterValue > newestEleChangeCounterValue)
-      {
-        /* newer element found */
-        newestEleChangeCounterValue = currentOooElePtr->ChangeCounterValue;
-        newestTcpOooQElementIdx = currentTcpOooQElementIdx;
-      }
-      currentTcpOooQElementIdx = currentOooElePtr->NextEleIdx;
+      TcpIp_Tcp_VOooChangeOrderRemove(SocketTcpIdx, ChangedEleIdx);
     }
 
-    /* mark newestTcpOooQElementIdx as OooQElementLastChanged */
-    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, newestTcpOooQElementIdx);
-  }
-  else
-  {
-    /* #30 If the changed element id is known, set it as the last changed element. */
-    /* There are two scenarios where the changed element is known:
-       - One ooo element has been extended: An existing ooo element is extended (prepended or appended new data). This
-           can also be the (so far) oldest ooo element.
-       - Two ooo elements have been merged: The gap between two ooo elements is filled (first element is extended,
-           second element is deleted)
-    */
-
-    /* mark changed element as OooQElementLastChanged and set ChangeCounterValue */
-    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, ChangedTcpOooQElementIdx);
-    TcpIp_IncTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx);
-    TcpIp_GetAddrTcpOooQElement(ChangedTcpOooQElementIdx)->ChangeCounterValue = TcpIp_GetTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx);
+    /* #30 Link the element in front of the previously newest element. */
+    TcpIp_GetAddrTcpOooQElement(ChangedEleIdx)->OlderEleIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
+    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, ChangedEleIdx);
   }
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateOooElementChangeOrder_LinkElements
+ *  TcpIp_Tcp_VOooChangeOrderRemove
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateOooElementChangeOrder_LinkElements(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VOooChangeOrderRemove(
+  TcpIp_SizeOfSocketTcpDynType   SocketTcpIdx,
+  TcpIp_SizeOfTcpOooQElementType RemovedEleIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  /* Link all ooo elements sorted by their change time. */
-  TCPIP_P2V(TcpIp_Tcp_RxPreBufEleType) currentOldestAlignedElementPtr = NULL_PTR;
-  TcpIp_TcpOooQElementIterType         numRounds;  /* iteration variable for outer for-loop */
+  TcpIp_SizeOfTcpOooQElementType currentTcpOooQElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
+  TcpIp_SizeOfTcpOooQElementType olderTcpOooQElementIdx   = TcpIp_GetAddrTcpOooQElement(RemovedEleIdx)->OlderEleIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Update the time-wise links between the ooo elements. */
-  /* current oldest element that is already new aligned. Start value is the LastChangedIdx. */
-  TcpIp_SizeOfTcpOooQElementType currentOldestAlignedTcpOooQElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
-  /*@ assert currentOldestAlignedTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
-
-  /* For 'FillNum' elements (FillNum - 1) links have to be set */
-  for (numRounds = 0;
-       numRounds < (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) - 1u);
-       numRounds++)
+  /* #10 If the element is the newest one, the next older element becomes the newest one. */
+  if (currentTcpOooQElementIdx == RemovedEleIdx)
   {
-    /*@ assert currentOldestAlignedTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                              /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
-    uint32                         newestNotYetAlignedEleChangeCounterValue = 0;  /* change counter value of the newest
-                                     not yet aligned element. Set to oldest possible value. */
-    TcpIp_SizeOfTcpOooQElementType newestNotYetAlignedEleIdx = 0;  /* Idx of the newest not yet aligned element. Init to
-                                     prevent warning. Idx is always updated in each for-loop (assured by the number of
-                                     rounds in the for-loop). */
-    TcpIp_TcpOooQElementIterType   oooElementIteratorLoopCount;  /* iteration variable for inner for-loop */
-    TcpIp_SizeOfTcpOooQElementType currentTcpOooQElementIdx;  /* ooo element index when iterating (by sequence number)
-                                     through the socket's ooo elements */
-
-    currentOldestAlignedElementPtr = TcpIp_GetAddrTcpOooQElement(currentOldestAlignedTcpOooQElementIdx);
+    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, olderTcpOooQElementIdx);
+  }
+  else
+  {
+    /* #20 Otherwise search the next newer element and link it to the next older element. */
+    /* The linkage contains all ooo elements of the socket, so the number of steps is limited by OooQFillNum. */
+    TcpIp_TcpOooQElementIterType numCheckedElements = 0u;
 
-    /* #20 Go through ooo array (by sequence), and search for the newest element that is older than the last aligned element. */
-    currentTcpOooQElementIdx = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
-    for (oooElementIteratorLoopCount = 0; oooElementIteratorLoopCount < TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx); oooElementIteratorLoopCount++)
+    while (   (currentTcpOooQElementIdx != TCPIP_TCP_OOO_ELE_IDX_INV)                                                    /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+           && (numCheckedElements < TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx)))
     {
-      TCPIP_P2C(TcpIp_Tcp_RxPreBufEleType) currentOooElePtr = TcpIp_GetAddrTcpOooQElement(currentTcpOooQElementIdx);
-      if ((currentOooElePtr->ChangeCounterValue > newestNotYetAlignedEleChangeCounterValue)
-        && (currentOooElePtr->ChangeCounterValue < currentOldestAlignedElementPtr->ChangeCounterValue))
+      /*@ assert currentTcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                         /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
+      TCPIP_P2V(TcpIp_Tcp_RxPreBufEleType) currentOooElePtr = TcpIp_GetAddrTcpOooQElement(currentTcpOooQElementIdx);
+
+      if (currentOooElePtr->OlderEleIdx == RemovedEleIdx)
       {
-        /* newer element found */
-        newestNotYetAlignedEleChangeCounterValue = currentOooElePtr->ChangeCounterValue;
-        newestNotYetAlignedEleIdx = currentTcpOooQElementIdx;
+        currentOooElePtr->OlderEleIdx = olderTcpOooQElementIdx;
+        break;
       }
-      currentTcpOooQElementIdx = currentOooElePtr->NextEleIdx;
+      currentTcpOooQElementIdx = currentOooElePtr->OlderEleIdx;
+      numCheckedElements++;
     }
-
-    /* link oldest aligned element with the newest not yet aligned element */
-    currentOldestAlignedElementPtr->OlderEleIdx = newestNotYetAlignedEleIdx;
-    /* update the value for the oldest aligned element Idx */
-    currentOldestAlignedTcpOooQElementIdx = newestNotYetAlignedEleIdx;
   }
 }
 #  endif /* TCPIP_SUPPORT_TCP_SELECTIVE_ACK */
@@ -6405,22 +6734,10 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitInternal(
          * In this case 'Length' is updated and only the provided number of bytes will be transmitted. */
         if (TcpIp_Tcp_VCopyDataFromTcpUser(socketTcpIdx, DataPtr, &localLength) == E_OK)
         {
-          TcpIp_SizeOfTcpTxBufferType newTxBufferWriteIdx;
           TCPIP_VENTER_CRITICAL_SECTION();
 
           /* #70 Update the TX-buffer admin data and indicate that the request has been accepted. */
-          newTxBufferWriteIdx = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx,
-            TcpIp_GetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx),
-            (TcpIp_SizeOfTcpTxBufferType)localLength);
-
-          TcpIp_SetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, newTxBufferWriteIdx);
-
-          TcpIp_AddFillLevelOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, (TcpIp_SizeOfTcpTxBufferType)localLength);
-
-          TcpIp_SetTxReqDataLenByteOfSocketTcpDyn(socketTcpIdx, (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(socketTcpIdx) + (TcpIp_SizeOfTcpTxBufferType)localLength));
-          /* TxReqQueuedLen is not changed. If the retry-element already contained data then there already is a valid length, otherwise the length should already be '0' */
-          TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(socketTcpIdx, FALSE);
-          TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(socketTcpIdx, (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(socketTcpIdx) + (TcpIp_SizeOfTcpTxBufferType)localLength));
+          TcpIp_Tcp_VCommitTxData(socketTcpIdx, tcpTxBufferDescIdx, (TcpIp_SizeOfTcpTxBufferType)localLength);
 
           TCPIP_VLEAVE_CRITICAL_SECTION();
 
@@ -6451,40 +6768,41 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitInternal(
   return retVal;
 }
 
-
-
 /**********************************************************************************************************************
- *  TcpIp_Tcp_GetSockIsConnected
+ *  TcpIp_Tcp_VCommitTxData
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  */
-FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_GetSockIsConnected(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCommitTxData(
+  TcpIp_SizeOfSocketTcpDynType    SocketTcpIdx,
+  TcpIp_SizeOfTcpTxBufferDescType TcpTxBufferDescIdx,
+  TcpIp_SizeOfTcpTxBufferType     Length)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  boolean socketIsConnected = FALSE;
+  TcpIp_SizeOfTcpTxBufferType newTxBufferWriteIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(TCPIP_COND_INIT);
-  TCPIP_ASSERT(TCPIP_TCP_COND_VALID_TCPIDX(SocketTcpIdx));
+  /* #10 Advance the write index and the fill level of the tx buffer. */
+  newTxBufferWriteIdx = TcpIp_IncTxBufIdx(TcpTxBufferDescIdx,
+    TcpIp_GetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(TcpTxBufferDescIdx), Length);
 
-  /* #10 Check if the socket is connected */
-  if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) >= TCPIP_TCP_SOCK_STATE_ESTABLISHED)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) <  TCPIP_TCP_SOCK_STATE_CLOSED))
-  {
-    socketIsConnected = TRUE;
-  }
-  /* Else: socketIsConnected remains FALSE */
+  TcpIp_SetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(TcpTxBufferDescIdx, newTxBufferWriteIdx);
 
-  return socketIsConnected;
-}
+  TcpIp_AddFillLevelOfTcpTxBufferDescDyn(TcpTxBufferDescIdx, Length);
 
+  /* #20 Add the data to the tx request of the socket. */
+  TcpIp_SetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) + Length));
+  /* TxReqQueuedLen is not changed. If the retry-element already contained data then there already is a valid length, otherwise the length should already be '0' */
+  TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, FALSE);
+  TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + Length));
+}
 
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_MainFunctionRx
+ *  TcpIp_TcpTransmitPBufInternal()
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6492,265 +6810,280 @@ FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_GetSockIsConnected(
  *
  *
  *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionRx(TcpIp_OsApplicationType ApplId)
+/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitPBufInternal(
+  TcpIp_SizeOfSocketDynType  SocketIdx,
+  TCPIP_P2C(IpBase_PbufType) PbufPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketTcpDynType socketTcpIdx;
+  Std_ReturnType               retVal       = E_NOT_OK;
+  TcpIp_SizeOfSocketTcpDynType socketTcpIdx = TCPIP_SOCKET_IDX_TO_TCP_IDX(SocketIdx);
+  /*@ assert socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); */                                                           /* VCA_TCPIP_TCP_IDX_FROM_CHECKED_SOCKET_IDX */
+  uint32                       totLen       = PbufPtr[0].totLen;
+  uint32                       chainLen     = 0u;
+  uint32_least                 pbufIdx;
+  uint16_least                 refNum       = 0u;
+  boolean                      chainValid   = TRUE;
 
   /* ----- Implementation ----------------------------------------------- */
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_OFF)                                                                       /* COV_TCPIP_MULTICORE_SUPPORT_ALWAYS_OFF */
-  TCPIP_DUMMY_STATEMENT_CONST(ApplId);                                                                                  /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
+  TCPIP_ASSERT(TCPIP_SOCKET_IDX_IS_TCP(SocketIdx));
 
-  /* #10 Iterate over all TCP sockets. */
-  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
+  /* #10 Count the buffer segments of the chain. Each of them requires one reference.
+         The chain ends with the segment that completes the total length. The scan never exceeds the number of
+         references, so a chain that is shorter than its total length is not read beyond that limit.
+         Empty segments and segments with a different total length are rejected as inconsistent chain. */
+  for (pbufIdx = 0u;
+       (chainValid == TRUE) && (chainLen < totLen) && (refNum <= TCPIP_TCP_ZERO_COPY_TX_REF_NUM);
+       pbufIdx++)
   {
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
+    if ((PbufPtr[pbufIdx].len == 0u) || (PbufPtr[pbufIdx].totLen != totLen))
+    {
+      chainValid = FALSE;
+    }
+    else
+    {
+      chainLen += PbufPtr[pbufIdx].len;
+      refNum++;
+    }
+  }
 
-    /* Only process the socket assigned to corresponding application or main application if socket is unassigned */
-    if (ApplId == TcpIp_GetApplIdOfSocketDyn(socketIdx))
-# endif
+  TCPIP_VENTER_CRITICAL_SECTION();
+
+  /* #20 Check if the socket is in valid state for transmitting data and the maximum segment size is known. */
+  if (   (TcpIp_GetListenActiveConnStatOfSocketDyn(SocketIdx) != TCPIP_SOCK_CONN_NONE)                                  /* PRQA S 3415 4 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (   (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) == TCPIP_TCP_SOCK_STATE_ESTABLISHED)
+          || (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT))
+      && (TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(socketTcpIdx) > 0u)
+      && (chainValid == TRUE)
+      && (refNum <= TcpIp_Tcp_TxDataRefNumFree))
+  {
+    TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(socketTcpIdx);
+    /*@ assert tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); */                                                /* VCA_TCPIP_VALID_BUFFERIDX_LOCAL */
+    TcpIp_SizeOfTcpTxBufferType     tcpTxBufferFree = TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx)
+                                                    - TcpIp_GetFillLevelOfTcpTxBufferDescDyn(tcpTxBufferDescIdx);
+
+    /* #30 Accept the request only if the complete data fits into the tx buffer. The tx buffer space is reserved for
+           the referenced data although the data is not copied, so the buffer size still limits the pending data. */
+    if (totLen <= (uint32)tcpTxBufferFree)
     {
-      if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
+      TcpIp_SizeOfTcpTxBufferType bufIdx       = TcpIp_GetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx);
+      uint32                      remainingLen = totLen;
+      uint8_least                 txDataRefIdx = 0u;
+
+      /* #40 Store buffer position where the untransmitted data starts, if there is currently no data pending. */
+      if (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(socketTcpIdx) == 0u)
       {
-        /* #20 Remove ACKed segments from the retry queue. */
-        uint16 tmpRemIndLen = (uint16)TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(socketTcpIdx);
+        TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(socketTcpIdx, bufIdx);
+      }
 
-        TcpIp_Tcp_VFreeAckedReqAndRetrElements(socketTcpIdx, TcpIp_GetSndUnaOfSocketTcpDyn(socketTcpIdx));
+      /* #50 Store a reference to each of the counted buffer segments at its position in the tx buffer.
+             The last segment is cut to the total length of the chain. */
+      for (pbufIdx = 0u; pbufIdx < refNum; pbufIdx++)
+      {
+        TcpIp_SizeOfTcpTxBufferType segLen = (TcpIp_SizeOfTcpTxBufferType)PbufPtr[pbufIdx].len;
 
-        /* #30 Forward newly received data to upper layer. */
-        if (tmpRemIndLen > 0u)
+        if (segLen > remainingLen)
         {
-          TcpIp_Tcp_VMainRxDataForwarding(socketTcpIdx, tmpRemIndLen);
+          segLen = (TcpIp_SizeOfTcpTxBufferType)remainingLen;
+        }
+
+        while (TcpIp_Tcp_TxDataRef[txDataRefIdx].Len != 0u)
+        {
+          txDataRefIdx++;
         }
+        /* A reference is in use as soon as its length is set, so the length is written last. */
+        TcpIp_Tcp_TxDataRef[txDataRefIdx].DataPtr      = PbufPtr[pbufIdx].payload;
+        TcpIp_Tcp_TxDataRef[txDataRefIdx].BufIdx       = bufIdx;
+        TcpIp_Tcp_TxDataRef[txDataRefIdx].SocketTcpIdx = socketTcpIdx;
+        TcpIp_Tcp_TxDataRef[txDataRefIdx].Len          = segLen;
+        TcpIp_Tcp_TxDataRefNumFree--;
+
+        bufIdx = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx, bufIdx, segLen);
+        remainingLen -= segLen;
       }
+
+      /* #60 Update the TX-buffer admin data and indicate that the request has been accepted. */
+      TcpIp_Tcp_VCommitTxData(socketTcpIdx, tcpTxBufferDescIdx, (TcpIp_SizeOfTcpTxBufferType)totLen);
+      retVal = E_OK;
     }
   }
-}  /* TcpIp_Tcp_MainFunctionRx() */
+
+  TCPIP_VLEAVE_CRITICAL_SECTION();
+
+# if (TCPIP_SUPPORT_MEASUREMENT_DATA == STD_ON)
+  if (retVal != E_OK)
+  {
+    /* Increment the measurement data counter for dropped TCP message (due to insufficient Tx buffer) */
+    TcpIp_VIncMeasurementDataCounter(TCPIP_MEAS_VENDOR_SPECIFIC_DROP_INSUFF_TCP_TX_BUFFER);
+  }
+# endif
+
+  return retVal;
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_MainFunctionTx
+ *  TcpIp_Tcp_VTxDataRefIsHeld
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
  */
-/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionTx(TcpIp_OsApplicationType ApplId)
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VTxDataRefIsHeld(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SocketTcpDynIterType socketTcpIdx;
+  boolean     retVal = FALSE;
+  uint8_least txDataRefIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_OFF)                                                                       /* COV_TCPIP_MULTICORE_SUPPORT_ALWAYS_OFF */
-  TCPIP_DUMMY_STATEMENT_CONST(ApplId);                                                                                  /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
-
-  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-
-  TcpIp_Tcp_VTransmitResets(ApplId);  /* transmit resets from reset-queue */
-
-  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
-
-  /* #10 Iterate over all TCP sockets. */
-  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
+  /* #10 Search for a used reference of the socket, unless all references are unused. */
+  if (TcpIp_Tcp_TxDataRefNumFree < TCPIP_TCP_ZERO_COPY_TX_REF_NUM)
   {
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
-
-    /* Only process the socket assigned to corresponding application or main application if socket is unassigned */
-    if (ApplId == TcpIp_GetApplIdOfSocketDyn(socketIdx))
-# endif
+    for (txDataRefIdx = 0u; txDataRefIdx < TCPIP_TCP_ZERO_COPY_TX_REF_NUM; txDataRefIdx++)
     {
-      if (   (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
-          && (TcpIp_SocketIsOnHold(TCPIP_SOCKET_IDX_TO_ID(TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx))) == FALSE))        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      if (   (TcpIp_Tcp_TxDataRef[txDataRefIdx].Len != 0u)
+          && (TcpIp_Tcp_TxDataRef[txDataRefIdx].SocketTcpIdx == SocketTcpIdx))
       {
-        TCPIP_VENTER_CRITICAL_SECTION();
-
-        /* Send pending duplicated ACKs */
-        if (TcpIp_Tcp_SendDupAcks(socketTcpIdx) == E_OK)
-        {
-          /* #20 Adapt path MTU size if it was triggered before. */
-          TcpIp_Tcp_VMainPathMtuChg(socketTcpIdx);
-
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-          /* #30 Increase CWND based on received ACKs during one round trip time. */
-          if (TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(socketTcpIdx) == TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE)
-          {
-            /* If ACKs have to be summarized during one RTT, the timeout is handled here. */
-            if (TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(socketTcpIdx) > 0u)
-            {
-              TcpIp_DecAckSumTimeoutOfSocketTcpCongCtrlDyn(socketTcpIdx);
-              if (TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(socketTcpIdx) == 0u)
-              {
-                /* inc cwnd */
-                CANOE_WRITE_STRING_2("TcpIp_Tcp_MainFunction: socketTcpIdx %d: inc cwnd in congestion avoidance, AckSum is %d", socketTcpIdx, TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(socketTcpIdx));
-                TcpIp_Tcp_VIncCwnd(socketTcpIdx, TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(socketTcpIdx));
-              }
-            }
-          }
-# endif /* (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON) */
-
-          /* #40 Send pending TX data. */
-          TcpIp_Tcp_VMainTxDataHandling((TcpIp_SizeOfSocketTcpDynType)socketTcpIdx);
-        }
-        else
-        {
-          /* Do not continue with other steps of this socket, because some DUP ACKs are still pending. */
-        }
-        TCPIP_VLEAVE_CRITICAL_SECTION();
+        retVal = TRUE;
+        break;
       }
     }
   }
+
+  return retVal;
 }
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_SendDupAcks
+ *  TcpIp_Tcp_VTxDataRefRelease
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_SendDupAcks (TcpIp_SocketTcpDynIterType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTxDataRefRelease(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  boolean                      ReleaseAll)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_OK;
+  uint8_least txDataRefIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-
-  /* #10 Iterate over all pending DUP ACKs of this socket */
-  while (TcpIp_GetDupAckCountOfSocketTcpDyn(SocketTcpIdx) != 0u)
+  for (txDataRefIdx = 0u; txDataRefIdx < TCPIP_TCP_ZERO_COPY_TX_REF_NUM; txDataRefIdx++)
   {
-    /* #20 Try to transmit a ACK. */
-    if (TcpIp_Tcp_VTransmitSegment((TcpIp_SizeOfSocketTcpDynType)SocketTcpIdx, TCPIP_TCP_CODE_BIT_ACK,
-                                   TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u, 0u) == E_OK)
-    {
-      /* #30 Decrease ACK counter. */
-      TcpIp_DecDupAckCountOfSocketTcpDyn(SocketTcpIdx);
-    }
-    else
+    TcpIp_SizeOfTcpTxBufferType refLen = TcpIp_Tcp_TxDataRef[txDataRefIdx].Len;
+
+    /* #10 Iterate over all used references of the socket. */
+    if ((refLen != 0u) && (TcpIp_Tcp_TxDataRef[txDataRefIdx].SocketTcpIdx == SocketTcpIdx))
     {
-      /* #40 Break while, still pending ACKs will be send in the next main function. */
-      retVal = E_NOT_OK;
-      break;
+      boolean release = ReleaseAll;
+
+      /* #20 Release the reference if all references shall be released or if its last byte is not pending anymore.
+             Pending data is located in the range [TxReqDataBufStartIdx, TxReqDataBufStartIdx + TxReqDataLenByte) of
+             the tx buffer. */
+      if (release == FALSE)
+      {
+        TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+        TcpIp_SizeOfTcpTxBufferType     reqStartIdx = TcpIp_GetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx);
+        TcpIp_SizeOfTcpTxBufferType     lastIdx = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx,
+                                                    TcpIp_Tcp_TxDataRef[txDataRefIdx].BufIdx, refLen - 1u);
+        TcpIp_SizeOfTcpTxBufferType     lastOfs;
+
+        if (lastIdx >= reqStartIdx)
+        {
+          lastOfs = lastIdx - reqStartIdx;
+        }
+        else
+        {
+          lastOfs = (lastIdx + TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx)) - reqStartIdx;
+        }
+
+        release = (boolean)(lastOfs >= TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx));
+      }
+
+      if (release == TRUE)
+      {
+        TcpIp_Tcp_TxDataRef[txDataRefIdx].Len = 0u;
+        TcpIp_Tcp_TxDataRefNumFree++;
+      }
     }
   }
-
-  return retVal;
 }
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_MainFunctionState
+ *  TcpIp_Tcp_VTxDataRefGetChunk
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
- *
  */
-/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionState(TcpIp_OsApplicationType ApplId)
+TCPIP_LOCAL FUNC(TcpIp_SizeOfTcpTxBufferType, TCPIP_CODE) TcpIp_Tcp_VTxDataRefGetChunk(
+  TcpIp_SizeOfSocketTcpDynType    SocketTcpIdx,
+  TcpIp_SizeOfTcpTxBufferDescType TcpTxBufferDescIdx,
+  TcpIp_SizeOfTcpTxBufferType     BufIdx,
+  TcpIp_SizeOfTcpTxBufferType     MaxLen,
+  TCPIP_P2V(TcpIp_Uint8P2C)       SrcPtrPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketTcpDynType socketTcpIdx;
+  TcpIp_SizeOfTcpTxBufferType bufLen   = TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(TcpTxBufferDescIdx);
+  TcpIp_SizeOfTcpTxBufferType chunkLen = TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(TcpTxBufferDescIdx) - BufIdx;
+  uint8_least                 txDataRefIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_OFF)                                                                       /* COV_TCPIP_MULTICORE_SUPPORT_ALWAYS_OFF */
-  TCPIP_DUMMY_STATEMENT_CONST(ApplId);                                                                                  /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
-
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-  /* Only update the global timestamp in the main application */
-  if (ApplId == TcpIp_Tcp_MainApplicationId)
-# endif
+  /* #10 Assume the data is stored in the tx buffer up to its wraparound. */
+  if (chunkLen > MaxLen)
   {
-    TcpIp_Tcp_GlobalTimestamp++;
+    chunkLen = MaxLen;
   }
+  *SrcPtrPtr = TcpIp_GetAddrTcpTxBuffer(BufIdx);                                                                        /* TCPIP_CSL_INDEX_ACCEPTED */
 
-  /* #10 Iterate over all TCP sockets. */
-
-  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
+  for (txDataRefIdx = 0u; txDataRefIdx < TCPIP_TCP_ZERO_COPY_TX_REF_NUM; txDataRefIdx++)
   {
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON) || (TCPIP_SUPPORT_ASRTLS == STD_ON)                                    /* COV_TCPIP_MULTIPLE_UNSAFE_FEATURES */
-    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
-# endif
+    TcpIp_SizeOfTcpTxBufferType refLen = TcpIp_Tcp_TxDataRef[txDataRefIdx].Len;
 
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-    /* Only process the socket assigned to corresponding application or main application if socket is unassigned */
-    if (ApplId == TcpIp_GetApplIdOfSocketDyn(socketIdx))
-# endif
+    if ((refLen != 0u) && (TcpIp_Tcp_TxDataRef[txDataRefIdx].SocketTcpIdx == SocketTcpIdx))
     {
-      if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
+      TcpIp_SizeOfTcpTxBufferType refIdx = TcpIp_Tcp_TxDataRef[txDataRefIdx].BufIdx;
+      /* Distance from the start of the referenced range to BufIdx and vice versa, modulo the buffer length. */
+      TcpIp_SizeOfTcpTxBufferType ofsInRef  = (BufIdx >= refIdx) ? (BufIdx - refIdx) : ((BufIdx + bufLen) - refIdx);
+      TcpIp_SizeOfTcpTxBufferType distToRef = (refIdx >= BufIdx) ? (refIdx - BufIdx) : ((refIdx + bufLen) - BufIdx);
+
+      /* #20 Return the user data if BufIdx is located within a referenced range. The referenced data is linear, so
+             the chunk may extend across the wraparound of the tx buffer. */
+      if (ofsInRef < refLen)
       {
-        /* #20 Handle pending TCP socket state changes. */
-        TcpIp_Tcp_VMainStateHandling(socketTcpIdx);
+        *SrcPtrPtr = &TcpIp_Tcp_TxDataRef[txDataRefIdx].DataPtr[ofsInRef];
+        chunkLen = refLen - ofsInRef;
 
-        /* #30 Notify upper layer about socket state changes. */
-        if (TcpIp_GetEventIndicationPendingOfSocketTcpDyn(socketTcpIdx) != 0u)
+        if (chunkLen > MaxLen)
         {
-          /* In the current implementation only the event IPBASE_TCP_EVENT_FIN_RECEIVED can be pending, so no further
-           * differentiation for different events is necessary here.
-           * Also currently there is only one single place in the function
-           * TcpIp_Tcp_VRxIndicationStateOthers_EighthProcessFin_ProcessOrStoreFin where a pending element FIN_RECEIVED
-           * is set. */
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-          TcpIp_TlsConnectionIterType tlsConIdx = 0;
-          if (   (TcpIp_IsUseTlsOfSocketTcpDyn(socketTcpIdx))                                                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-              && (TcpIp_SocketIdxToTlsConIdx(socketIdx, &tlsConIdx) == E_OK))
-          {
-            /* #40 If TLS is used, check if there is new plaintext in TLS Rx AdHs buffer that has
-             * not been forwarded to the Ul. */
-              if (TcpIp_IsAdRxIndicationOfTlsConnectionDyn(tlsConIdx) == TRUE)
-              {
-                /* Do nothing, wait until all pending data or alerts have been forwarded to the upper layer. */
-              }
-#  if (TCPIP_SUPPORT_ASRTLS_VERSION_1_3 == STD_ON)
-              /* If TLS version is TLS 1.3, check also if there is new plaintext in TLS Rx Alert buffer that has
-               * not been forwarded to the Ul. */
-              else if (   (TcpIp_GetActiveVersionOfTlsConnectionDyn(tlsConIdx) == TCPIP_TLSVERSION_13)
-                       && (TcpIp_IsAlRxIndicationOfTlsConnectionDyn(tlsConIdx) == TRUE))
-              {
-                /* Do nothing, wait until all pending alerts have been forwarded to the upper layer. */
-              }
-#  endif /* (TCPIP_SUPPORT_ASRTLS_VERSION_1_3 == STD_ON) */
-              else
-              {
-                /* No application data nor alerts left which were not forwarded to Ul, so inform the Ul about the
-                 * TCP socket state change to FIN_RECEIVED. */
-                TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived(socketTcpIdx);
-              }
-          }
-          else
-# endif /* (TCPIP_SUPPORT_ASRTLS == STD_ON) */
-          {
-            TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived(socketTcpIdx);
-          }
+          chunkLen = MaxLen;
         }
-        /* #50 Handle TCP idle timeouts. */
-        TcpIp_Tcp_VMainIdleTimeoutHandling(socketTcpIdx);
+        break;
+      }
+      /* #30 Otherwise the data in the tx buffer ends at the start of the next referenced range. */
+      else if (distToRef < chunkLen)
+      {
+        chunkLen = distToRef;
+      }
+      else
+      {
+        /* Referenced range does not overlap the requested data. */
       }
     }
   }
+
+  return chunkLen;
 }
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived
+ *  TcpIp_Tcp_VTransmitSegment_GatherDataToIpTxBuffer
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6759,297 +7092,212 @@ FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionState(TcpIp_OsApplicationType ApplI
  *
  *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived(TcpIp_SocketTcpDynIterType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_GatherDataToIpTxBuffer(
+  TcpIp_SizeOfSocketTcpDynType               SocketTcpIdx,
+  TCPIP_P2V(TcpIp_IpTxRequestDescriptorType) IpTxReqestDescrPtr,
+  TcpIp_SizeOfTcpTxBufferType                StartDataIdx,
+  TcpIp_SizeOfTcpTxBufferType                DataLen,
+  TCPIP_P2V(uint8)                           TcpPayloadPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  TcpIp_SizeOfTcpTxBufferType     bufIdx             = StartDataIdx;
+  TcpIp_SizeOfTcpTxBufferType     copiedLen          = 0u;
+  boolean                         oddBytePending     = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
-
-  TCPIP_ASSERT((TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT)
-    || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_TIMEWAIT));
-
-  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT)
+  /* #10 Copy the data chunk by chunk, each chunk is either located in the tx buffer or in a user buffer. */
+  while (copiedLen < DataLen)
   {
-    /* #10 In CLOSEWAIT state signal 'FIN received' to the user. */
-    TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
-    /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                            /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+    TcpIp_Uint8P2C              srcPtr;
+    TcpIp_SizeOfTcpTxBufferType chunkLen = TcpIp_Tcp_VTxDataRefGetChunk(SocketTcpIdx, tcpTxBufferDescIdx, bufIdx,
+                                             DataLen - copiedLen, &srcPtr);
 
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_FIN_REC,
-      TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx));
-# else
-    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_FIN_REC, FALSE);
-# endif
-  }
-  else  /* TCPIP_TCP_SOCK_STATE_TIMEWAIT */
-  {
-    /* #20 In TIMEWAIT state signal 'connection closing' to the user. */
-    TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
-    /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                            /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+    if (IpTxReqestDescrPtr->ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
+    {
+      TcpIp_SizeOfTcpTxBufferType chunkOfs = 0u;
+      TcpIp_SizeOfTcpTxBufferType evenLen;
 
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONN_CLOSING,
-      TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx));
-# else
-    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONN_CLOSING, FALSE);
-# endif
-  }
-  /* all other possible values for SockState will not occur here:
+      /* #20 Complete the 16-bit word started by the last byte of the previous chunk.
+             IpBase_TcpIpChecksumCopyAdd() requires an even length, so all other words are added in one step. */
+      if (oddBytePending == TRUE)
+      {
+        TcpPayloadPtr[copiedLen] = srcPtr[0];                                                                           /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumAdd(&TcpPayloadPtr[copiedLen - 1u], 2u,
+          IpTxReqestDescrPtr->TmpChecksum, FALSE);
+        chunkOfs = 1u;
+        oddBytePending = FALSE;
+      }
 
-     TCPIP_TCP_SOCK_STATE_INVALID     -> this state is never used as SockState but only for SockStateNext
+      evenLen = (TcpIp_SizeOfTcpTxBufferType)((chunkLen - chunkOfs) & ~((TcpIp_SizeOfTcpTxBufferType)1u));
 
-     TCPIP_TCP_SOCK_STATE_LISTEN,
-     TCPIP_TCP_SOCK_STATE_SYNSENT,
-     TCPIP_TCP_SOCK_STATE_LASTACK,
-     TCPIP_TCP_SOCK_STATE_CLOSING,
-     TCPIP_TCP_SOCK_STATE_CLOSED      -> in these states there is no path that could set a pending event
+      if (evenLen > 0u)
+      {
+        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(&TcpPayloadPtr[copiedLen + chunkOfs],           /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+          &srcPtr[chunkOfs], evenLen, IpTxReqestDescrPtr->TmpChecksum, FALSE);
+      }
 
-     TCPIP_TCP_SOCK_STATE_SYNRCVD,
-     TCPIP_TCP_SOCK_STATE_ESTABLISHED -> these states are already enhanced to state TCPIP_TCP_SOCK_STATE_CLOSEWAIT
-                                         in the context of the RxIndication.
+      /* #30 Copy a remaining odd byte, it is added to the checksum together with the first byte of the next chunk. */
+      if ((chunkOfs + evenLen) < chunkLen)
+      {
+        TcpPayloadPtr[copiedLen + chunkLen - 1u] = srcPtr[chunkLen - 1u];                                               /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+        oddBytePending = TRUE;
+      }
+    }
+    else
+    {
+      /* PRQA S 0315 1 */ /* MD_MSR_VStdLibCopy */
+      IpBase_Copy(&TcpPayloadPtr[copiedLen], srcPtr, chunkLen);                                                         /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+    }
 
-     TCPIP_TCP_SOCK_STATE_FINWAIT1,
-     TCPIP_TCP_SOCK_STATE_FINWAIT2    -> these states are already enhanced to state TCPIP_TCP_SOCK_STATE_TIMEWAIT
-                                         in the context of the RxIndication.
-  */
+    copiedLen += chunkLen;
+    bufIdx = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx, bufIdx, chunkLen);
+  }
 
-  /* #30 Delete the pending event */
-  TcpIp_SetEventIndicationPendingOfSocketTcpDyn(SocketTcpIdx, 0);
+  /* #40 Add the last byte of the payload to the checksum, if it has not been added yet. */
+  if (oddBytePending == TRUE)
+  {
+    IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumAdd(&TcpPayloadPtr[DataLen - 1u], 1u,
+      IpTxReqestDescrPtr->TmpChecksum, FALSE);
+  }
 }
+# endif
+
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VDuplicateSocket
+ *  TcpIp_Tcp_GetSockIsConnected
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(TcpIp_SizeOfSocketTcpDynType, TCPIP_CODE) TcpIp_Tcp_VDuplicateSocket(
-  TcpIp_SizeOfSocketTcpDynType      ListenSocketTcpIdx,
-  TcpIp_LocalAddrIterType           LocalAddrIdx,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr)
+FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_GetSockIsConnected(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketTcpDynType  newSocketTcpIdx = TCPIP_TCP_INV_IDX;
-  TcpIp_SizeOfSocketDynType     listenSocketIdx = TcpIp_GetSizeOfSocketTcpDyn();
-  TcpIp_SocketTcpDynIterType    socketTcpIdx;
-  TcpIp_SocketTcpDynIterType    derivedConnCnt = 0;  /* number of sockets that have already been derived from the listen socket */
+  boolean socketIsConnected = FALSE;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(ListenSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
-
-  listenSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(ListenSocketTcpIdx);
-
-  /* #10 Count TCP sockets that have the current listen socket as master. */
-  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
-  {
-    if (TcpIp_GetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(socketTcpIdx) == ListenSocketTcpIdx)
-    {
-      derivedConnCnt++;
-    }
-  }
-
-  /* #20 Check if the limit for listen sockets is already reached */
-  if (derivedConnCnt < TcpIp_GetMaxNumListenSocketsOfSocketTcpDyn(ListenSocketTcpIdx))
-  {
-    /* The maximum number of sockets derived from the current listen socket is not yet reached */
-    TcpIp_SocketIdType newSocketId = 0u;
-
-    /* #30 Take a new TCP socket if available */
-    if (TcpIp_GetSocketForUser(RxSockRemAddrPtr->DomainAndPort.domain, TCPIP_IPPROTO_TCP, &newSocketId, TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(listenSocketIdx)) == E_OK)
-    {
-      /* socket could be allocated */
-      newSocketTcpIdx = TCPIP_SOCKET_IDX_TO_TCP_IDX(TCPIP_SOCKET_ID_TO_IDX(newSocketId));
-      /*@ assert newSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); */                                                    /* VCA_TCPIP_AWA_CSL_IDX_FROM_PREVIOUS_FUNCTION_CALL */
-
-      /* #40 Assign buffers and init/copy variables for the new derived socket */
-      if (TcpIp_Tcp_VAssignBuffersToDuplicatedSocket(newSocketTcpIdx, ListenSocketTcpIdx) == E_OK)
-      {
-        TcpIp_SetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(newSocketTcpIdx, ListenSocketTcpIdx);  /* set master socket index for this new socket */
-
-        TcpIp_Tcp_VInitVarsOfDuplicatedSocket(newSocketTcpIdx, ListenSocketTcpIdx, LocalAddrIdx, RxSockRemAddrPtr);
+  TCPIP_ASSERT(TCPIP_COND_INIT);
+  TCPIP_ASSERT(TCPIP_TCP_COND_VALID_TCPIDX(SocketTcpIdx));
 
-        TcpIp_Tcp_VAcceptedSocketStateHandling(ListenSocketTcpIdx, newSocketTcpIdx);
-      }
-      else
-      {
-        /* #50 No matching buffer available -> release the new socket and cancel this attempt to accept a connection */
-        (void)TcpIp_Close(newSocketId, FALSE);
-        newSocketTcpIdx = TCPIP_TCP_INV_IDX;
-      }
-    }
-    else
-    {
-      /* no free sockets available */
-    }
-  }
-  else
+  /* #10 Check if the socket is connected */
+  if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) >= TCPIP_TCP_SOCK_STATE_ESTABLISHED)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) <  TCPIP_TCP_SOCK_STATE_CLOSED))
   {
-    /* no more connection may be accepted on this listen socket */
+    socketIsConnected = TRUE;
   }
+  /* Else: socketIsConnected remains FALSE */
 
-  return newSocketTcpIdx;
+  return socketIsConnected;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VAssignBuffersToDuplicatedSocket
+ *  TcpIp_Tcp_MainFunctionRx
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignBuffersToDuplicatedSocket(
-  TcpIp_SizeOfSocketTcpDynType NewSocketTcpIdx,
-  TcpIp_SizeOfSocketTcpDynType ListenSocketTcpIdx)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionRx(TcpIp_OsApplicationType ApplId)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_NOT_OK;
+  TcpIp_SizeOfSocketTcpDynType socketTcpIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Assign an RxBuffer to the duplicated socket. */
-  TCPIP_ASSERT(TcpIp_GetRequestedRxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx) > 0u);
-  retVal = TcpIp_Tcp_VAssignRxBuffer(NewSocketTcpIdx, TcpIp_GetRequestedRxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx));
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_OFF)                                                                       /* COV_TCPIP_MULTICORE_SUPPORT_ALWAYS_OFF */
+  TCPIP_DUMMY_STATEMENT_CONST(ApplId);                                                                                  /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
 
-  /* #20 Assign a TxBuffer to the duplicated socket. */
-  if (retVal == E_OK)
+  /* #10 Iterate over all TCP sockets. */
+  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
   {
-    TCPIP_ASSERT(TcpIp_GetRequestedTxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx) > 0u);
-    retVal = TcpIp_Tcp_VAssignTxBuffer(NewSocketTcpIdx, TcpIp_GetRequestedTxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx));
-  }
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
 
-  return retVal;
-}
+    /* Only process the socket assigned to corresponding application or main application if socket is unassigned */
+    if (ApplId == TcpIp_GetApplIdOfSocketDyn(socketIdx))
+# endif
+    {
+      if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
+      {
+        /* #20 Remove ACKed segments from the retry queue. */
+        uint16 tmpRemIndLen = (uint16)TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(socketTcpIdx);
+
+        TcpIp_Tcp_VFreeAckedReqAndRetrElements(socketTcpIdx, TcpIp_GetSndUnaOfSocketTcpDyn(socketTcpIdx));
 
+        /* #30 Forward newly received data to upper layer. */
+        if (tmpRemIndLen > 0u)
+        {
+          TcpIp_Tcp_VMainRxDataForwarding(socketTcpIdx, tmpRemIndLen);
+        }
+      }
+    }
+  }
+}  /* TcpIp_Tcp_MainFunctionRx() */
 
+# if (TCPIP_TCP_RX_BURST == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VInitVarsOfDuplicatedSocket
+ *  TcpIp_Tcp_RxBurstBegin
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
- *
- *
- *
- *
+ */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_RxBurstBegin(void)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Note sockets that receive data in order from now on. */
+  TcpIp_Tcp_RxBurstActive = TRUE;
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_RxBurstEnd
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
  *
  *
  *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitVarsOfDuplicatedSocket(
-  TcpIp_SizeOfSocketTcpDynType      NewSocketTcpIdx,
-  TcpIp_SizeOfSocketTcpDynType      ListenSocketTcpIdx,
-  TcpIp_LocalAddrIterType           LocalAddrIdx,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr)
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_RxBurstEnd(void)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketDynType   newSocketIdx    = TCPIP_TCP_IDX_TO_SOCKET_IDX(NewSocketTcpIdx);
-  TcpIp_SizeOfSocketDynType   listenSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(ListenSocketTcpIdx);
+  uint8_least burstSocketIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* Copy EthframePrio from Listen socket to new created socket. */
-  TcpIp_VCopySocketSpecificFramePriority(newSocketIdx, listenSocketIdx);
-  /* #10 Set rx- and tx-window related variables */
-  TcpIp_SetRcvNxtOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetRcvNxtOfSocketTcpDyn(ListenSocketTcpIdx));
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
-  TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
-  TcpIp_SetEnabledOfSocketTcpNagleDyn(NewSocketTcpIdx, TcpIp_IsEnabledOfSocketTcpNagleDyn(ListenSocketTcpIdx));
-# endif
-
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-  TcpIp_Tcp_VKeepAliveCopyParameters(ListenSocketTcpIdx, NewSocketTcpIdx);
-# endif
+  TcpIp_Tcp_RxBurstActive = FALSE;
 
-  TcpIp_SetIssOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_Tcp_GlobalTimestamp * (250u * TCPIP_MAIN_FCT_PERIOD_MSEC));  /* inc iss every 4 microseconds */
-  TcpIp_SetSndUnaOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(NewSocketTcpIdx));  /* ISS */
-  TcpIp_SetSndNxtOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(NewSocketTcpIdx));  /* ISS */
-  TcpIp_SetSndWl2OfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(NewSocketTcpIdx));  /* ISS */
-
-  /* #20 Set local family and port, other address related variables and MSS. */
-  TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->DomainAndPort.domain = RxSockRemAddrPtr->DomainAndPort.domain;
-  TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->DomainAndPort.port   = TcpIp_GetAddrLocSockOfSocketDyn(listenSocketIdx)->DomainAndPort.port;
-# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
-  if (TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->sa_family == IPBASE_AF_INET)
-  {
-    TcpIp_LocalAddrV4IterType  ipV4AddrIdx = TCPIP_LOCAL_ADDR_IDX_TO_IPV4(LocalAddrIdx);
-    IpBase_AddrInType         *ipV4AddrPtr = &(TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->SockAddrIn.sin_addr);
-    (void)IpV4_Ip_GetLocNetAddr(ipV4AddrIdx, ipV4AddrPtr);
-    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV4);
-  }
-# endif
-# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
-  if (TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->sa_family == IPBASE_AF_INET6)
+  /* #10 Forward the data of all noted sockets, each in one piece (or two, if the rx buffer wraps around). */
+  for (burstSocketIdx = 0u; burstSocketIdx < TcpIp_Tcp_RxBurstSocketNum; burstSocketIdx++)
   {
-    TcpIp_LocalAddrV6IterType  ipV6AddrIdx = TCPIP_LOCAL_ADDR_IDX_TO_IPV6(LocalAddrIdx);                                /* PRQA S 2897 */ /* MD_TCPIP_2897 */
-    IpBase_AddrIn6Type        *ipV6AddrPtr = &(TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->SockAddrIn6.sin6_addr);
-    (void)IpV6_GetLocalAddress(ipV6AddrIdx, ipV6AddrPtr, NULL_PTR);
-    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV6);
-  }
-# endif
-  (void)IpBase_CopySockAddr(&TcpIp_GetAddrRemSockOfSocketDyn(newSocketIdx)->SockAddr, &RxSockRemAddrPtr->SockAddr);     /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
-
-  TcpIp_SetSockIsServerOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_IsSockIsServerOfSocketTcpDyn(ListenSocketTcpIdx));
-  TcpIp_SetTxIpAddrIdxOfSocketDyn(newSocketIdx, (TcpIp_TxIpAddrIdxOfSocketDynType)TCPIP_LOCAL_ADDR_IDX_TO_IPVX(LocalAddrIdx));
-  /* Use LocalAddrIdx that received the SYN, the welcome socket could have an ANY/Broadcase/All-Node binding */
-  TcpIp_SetLocalAddrBindIdxOfSocketDyn(newSocketIdx, (TcpIp_SizeOfLocalAddrType)LocalAddrIdx);
-
-  /* #30 Init TxMssAgreed with default value */
-  /* The TCP header options are not yet evaluated for this received connection request, so default value is applied. */
-  TcpIp_SetTxMssAgreedOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx));
-
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-  /* #40 Set the default cwnd */
-  TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(NewSocketTcpIdx, TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx)));
-  TcpIp_SetCwndOfSocketTcpCongCtrlDyn(NewSocketTcpIdx,
-    ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx) * (uint32) TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(NewSocketTcpIdx)));
-# endif
-
-  /* #50 Set values for activated options. */
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  TcpIp_SetSackOptActiveOfSocketTcpDyn(NewSocketTcpIdx, FALSE);
-# endif
-
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-  TcpIp_SetTimestampOptActiveOfSocketTcpTsOptDyn(NewSocketTcpIdx, FALSE);
-  TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(NewSocketTcpIdx, 0);
-# endif
-
-  /* #60 Reset one-time option values */
-  TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(NewSocketTcpIdx, 0);
-  TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(NewSocketTcpIdx, 0);
+    TcpIp_SizeOfSocketTcpDynType socketTcpIdx = TcpIp_Tcp_RxBurstSocket[burstSocketIdx];
 
-  /* #70 Copy socket state from the listen socket */
-  TcpIp_SetSockStateOfSocketTcpDyn(    NewSocketTcpIdx, TcpIp_GetSockStateOfSocketTcpDyn(    ListenSocketTcpIdx));
-  TcpIp_SetSockStateNextOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetSockStateNextOfSocketTcpDyn(ListenSocketTcpIdx));
-
-  /* Copy Retransmit default Timeout */
-  TcpIp_SetRetransmitTimeoutDefaultOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(ListenSocketTcpIdx));
-
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-  TcpIp_Tcp_VInitTimeStampCalculation(NewSocketTcpIdx);
-# endif
+    /* #20 Skip sockets that were closed in the meantime or whose data was already forwarded. */
+    if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
+    {
+      uint16 tmpRemIndLen = (uint16)TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(socketTcpIdx);
 
-# if(TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
-  TcpIp_SetUseTlsOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_IsUseTlsOfSocketTcpDyn(ListenSocketTcpIdx));
-# endif
+      if (tmpRemIndLen > 0u)
+      {
+        TcpIp_Tcp_VMainRxDataForwarding(socketTcpIdx, tmpRemIndLen);
+      }
+    }
+  }
 
-  TcpIp_SetMslOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetMslOfSocketTcpDyn(ListenSocketTcpIdx));
+  TcpIp_Tcp_RxBurstSocketNum = 0u;
 }
-
+# endif
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VAcceptedSocketStateHandling
+ *  TcpIp_Tcp_MainFunctionTx
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7057,38 +7305,91 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitVarsOfDuplicatedSocket(
  *
  *
  *
+ *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VAcceptedSocketStateHandling(
-  TcpIp_SizeOfSocketTcpDynType ListenSocketTcpIdx,
-  TcpIp_SizeOfSocketTcpDynType AcceptSocketTcpIdx)
+/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionTx(TcpIp_OsApplicationType ApplId)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketDynType acceptSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(AcceptSocketTcpIdx);
-  TcpIp_SizeOfSocketDynType listenSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(ListenSocketTcpIdx);
-  TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(listenSocketIdx);
-  /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                              /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+  TcpIp_SocketTcpDynIterType socketTcpIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Trigger sending of SYN and ACK (will be sent in MainFunction) */
-  TcpIp_Tcp_VSendFlags(AcceptSocketTcpIdx, (TCPIP_TCP_CODE_BIT_SYN | TCPIP_TCP_CODE_BIT_ACK));
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_OFF)                                                                       /* COV_TCPIP_MULTICORE_SUPPORT_ALWAYS_OFF */
+  TCPIP_DUMMY_STATEMENT_CONST(ApplId);                                                                                  /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
 
-  /* #20 Set the socket to state 'active' */
-  TcpIp_VSockTcpStateChg(acceptSocketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONN_ESTAB, FALSE);  /* set socket to 'active' */
+  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
 
-# if defined(TCPIP_SPECIAL_TCP_ACCEPTING_FCT)                                                                           /* COV_TCPIP_RUNTIME_TEST */
-  /* #30 Inform the socket owner about an ongoing connection establishment, only if this feature is enabled. */
-  /* It can be enabled that the listen socket owner is informed about an ongoing acceptance of an incoming connection
-  request. Since the same callback function is used as for the final indication of the acceptance of an incoming
-  connection, only the second call of this callback means that the new connection is really fully accepted. */
+  TcpIp_Tcp_VTransmitResets(ApplId);  /* transmit resets from reset-queue */
+
+  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
+
+  /* #10 Iterate over all TCP sockets. */
+  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
   {
-    (void)TCPIP_SPECIAL_TCP_ACCEPTING_FCT(listenSocketIdx, acceptSocketIdx, &TcpIp_GetAddrRemSockOfSocketDyn(acceptSocketIdx)->TcpIpSockAddr); /* PRQA S 0310 */ /* MD_TCPIP_Rule11.3_0310_3305_SockAddrBaseType */
-  }
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
+
+    /* Only process the socket assigned to corresponding application or main application if socket is unassigned */
+    if (ApplId == TcpIp_GetApplIdOfSocketDyn(socketIdx))
 # endif
-}
+    {
+      if (   (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
+          && (TcpIp_SocketIsOnHold(TCPIP_SOCKET_IDX_TO_ID(TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx))) == FALSE))        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      {
+        TCPIP_VENTER_CRITICAL_SECTION();
+
+        /* Send pending duplicated ACKs */
+        if (TcpIp_Tcp_SendDupAcks(socketTcpIdx) == E_OK)
+        {
+          /* #20 Adapt path MTU size if it was triggered before. */
+          TcpIp_Tcp_VMainPathMtuChg(socketTcpIdx);
+
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+          /* #30 Increase CWND based on received ACKs during one round trip time. */
+#  if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+          /* Sockets using an extended algorithm update CWND in their own way. */
+          if (TcpIp_Tcp_VCongCtrlExtMain((TcpIp_SizeOfSocketTcpDynType)socketTcpIdx) == TRUE)
+          {
+            /* CWND already updated. */
+          }
+          else
+#  endif
+          if (TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(socketTcpIdx) == TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE)
+          {
+            /* If ACKs have to be summarized during one RTT, the timeout is handled here. */
+            if (TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(socketTcpIdx) > 0u)
+            {
+              TcpIp_DecAckSumTimeoutOfSocketTcpCongCtrlDyn(socketTcpIdx);
+              if (TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(socketTcpIdx) == 0u)
+              {
+                /* inc cwnd */
+                CANOE_WRITE_STRING_2("TcpIp_Tcp_MainFunction: socketTcpIdx %d: inc cwnd in congestion avoidance, AckSum is %d", socketTcpIdx, TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(socketTcpIdx));
+                TcpIp_Tcp_VIncCwnd(socketTcpIdx, TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(socketTcpIdx));
+                TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(socketTcpIdx, 0);
+              }
+            }
+          }
+# endif /* (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON) */
 
+          /* #40 Send pending TX data. */
+          TcpIp_Tcp_VMainTxDataHandling((TcpIp_SizeOfSocketTcpDynType)socketTcpIdx);
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+          TcpIp_Tcp_VCongCtrlExtUpdateAppLimited((TcpIp_SizeOfSocketTcpDynType)socketTcpIdx);
+# endif
+        }
+        else
+        {
+          /* Do not continue with other steps of this socket, because some DUP ACKs are still pending. */
+        }
+        TCPIP_VLEAVE_CRITICAL_SECTION();
+      }
+    }
+  }
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_Open
+ *  TcpIp_Tcp_SendDupAcks
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7099,59 +7400,36 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VAcceptedSocketStateHandling(
  *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_Open(
-  TcpIp_SocketTcpDynIterType        SocketTcpIdx,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) SockAddrPtr,
-  boolean                           ActiveOpen)
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_SendDupAcks (TcpIp_SocketTcpDynIterType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType          retVal    = E_OK;
-  TcpIp_SocketDynIterType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  Std_ReturnType retVal = E_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
-  TCPIP_ASSERT(SockAddrPtr != NULL_PTR);
 
-  /* #10 Check if socket is already open. */
-  if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)                                /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN))
+  /* #10 Iterate over all pending DUP ACKs of this socket */
+  while (TcpIp_GetDupAckCountOfSocketTcpDyn(SocketTcpIdx) != 0u)
   {
-    /* RFC: 'error: connection already exists' */
-    /* Windows: WSAEISCONN - 10056 - 'Socket is already connected' */
-    retVal = E_NOT_OK;
-  }
-  /* #20 Check if buffers are assigned to the socket. */
-  else if (   (TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) >= TcpIp_GetSizeOfTcpTxBufferDesc())             /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-           || (TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) >= TcpIp_GetSizeOfTcpRxBufferDesc()))
-  {
-    /* one or both buffers assignments are missing, so it is not possible to open a connection */
-    retVal = E_NOT_OK;
-  }
-  else
-  {
-    /* #30 Set the remote socket address */
-    (void)IpBase_CopySockAddr(&TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->SockAddr, &SockAddrPtr->SockAddr);           /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
-
-    /* init variables for this socket */
-    TcpIp_SetRcvNxtOfSocketTcpDyn(SocketTcpIdx, 0);
-
-    /* #40 Open the TCP socket */
-    if (ActiveOpen == TCPIP_TCP_ACTIVE_OPEN)
+    /* #20 Try to transmit a ACK. */
+    if (TcpIp_Tcp_VTransmitSegment((TcpIp_SizeOfSocketTcpDynType)SocketTcpIdx, TCPIP_TCP_CODE_BIT_ACK,
+                                   TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u, 0u) == E_OK)
     {
-      TcpIp_Tcp_OpenActive(SocketTcpIdx, SockAddrPtr->sa_family);
+      /* #30 Decrease ACK counter. */
+      TcpIp_DecDupAckCountOfSocketTcpDyn(SocketTcpIdx);
     }
     else
     {
-      TcpIp_Tcp_OpenPassive(SocketTcpIdx);
+      /* #40 Break while, still pending ACKs will be send in the next main function. */
+      retVal = E_NOT_OK;
+      break;
     }
   }
 
   return retVal;
 }
 
-
 /**********************************************************************************************************************
- *  TcpIp_Tcp_OpenActive
+ *  TcpIp_Tcp_MainFunctionState
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7161,60 +7439,95 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_Open(
  *
  *
  *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_OpenActive(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx,
-  TcpIp_DomainType           Domain)
+/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_MainFunctionState(TcpIp_OsApplicationType ApplId)
 {
-  /* ----- Implementation ----------------------------------------------- */
-
-  /* Socket is opened actively */
-  /* Connect (active open) */
-  /*
-  RFC:
-  - select an initial send sequence number (ISS)
-  - send a SYN segment of the form <SEQ=ISS><CTL=SYN>
-  - set SND.UNA to ISS, SND.NXT to ISS + 1, enter SYN-SENT state, and return.
-  */
-  /* #10 Trigger sending SYN and set socket state */
-  TcpIp_Tcp_VSendFlags(SocketTcpIdx, TCPIP_TCP_CODE_BIT_SYN);
-
-  TcpIp_SetSockIsServerOfSocketTcpDyn( SocketTcpIdx, FALSE);
-  TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_SYNSENT);
-  TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_SYNSENT);
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfSocketTcpDynType socketTcpIdx;
 
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-  /* #20 Reset keep alive timer if feature is supported */
-  TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
+  /* ----- Implementation ----------------------------------------------- */
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_OFF)                                                                       /* COV_TCPIP_MULTICORE_SUPPORT_ALWAYS_OFF */
+  TCPIP_DUMMY_STATEMENT_CONST(ApplId);                                                                                  /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
 # endif
 
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  /* #30 Activate 'selective ack' option if supported */
-  TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(   SocketTcpIdx, (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) | (TcpIp_TxOneTimeOptsOfSocketTcpDynType)TCPIP_TCP_OPT_FLAG_SACK_PERMIT));
-  TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx) + (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u)));  /* option + 2x NOP */
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+  /* Only update the global timestamp in the main application */
+  if (ApplId == TcpIp_Tcp_MainApplicationId)
 # endif
-
-  /* #40 Set maximum segment length depending on used address family */
-  if (Domain == IPBASE_AF_INET)
   {
-    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV4);
+    TcpIp_Tcp_GlobalTimestamp++;
   }
-  else
+
+  /* #10 Iterate over all TCP sockets. */
+
+  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
   {
-    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV6);
-  }
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON) || (TCPIP_SUPPORT_ASRTLS == STD_ON)                                    /* COV_TCPIP_MULTIPLE_UNSAFE_FEATURES */
+    TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
+# endif
 
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-  /* #50 Set default cwnd if supported */
-  TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)));
-  TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx) * (uint32) TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx)));
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+    /* Only process the socket assigned to corresponding application or main application if socket is unassigned */
+    if (ApplId == TcpIp_GetApplIdOfSocketDyn(socketIdx))
 # endif
-}
+    {
+      if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)
+      {
+        /* #20 Handle pending TCP socket state changes. */
+        TcpIp_Tcp_VMainStateHandling(socketTcpIdx);
 
+        /* #30 Notify upper layer about socket state changes. */
+        if (TcpIp_GetEventIndicationPendingOfSocketTcpDyn(socketTcpIdx) != 0u)
+        {
+          /* In the current implementation only the event IPBASE_TCP_EVENT_FIN_RECEIVED can be pending, so no further
+           * differentiation for different events is necessary here.
+           * Also currently there is only one single place in the function
+           * TcpIp_Tcp_VRxIndicationStateOthers_EighthProcessFin_ProcessOrStoreFin where a pending element FIN_RECEIVED
+           * is set. */
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+          TcpIp_TlsConnectionIterType tlsConIdx = 0;
+          if (   (TcpIp_IsUseTlsOfSocketTcpDyn(socketTcpIdx))                                                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+              && (TcpIp_SocketIdxToTlsConIdx(socketIdx, &tlsConIdx) == E_OK))
+          {
+            /* #40 If TLS is used, check if there is new plaintext in TLS Rx AdHs buffer that has
+             * not been forwarded to the Ul. */
+              if (TcpIp_IsAdRxIndicationOfTlsConnectionDyn(tlsConIdx) == TRUE)
+              {
+                /* Do nothing, wait until all pending data or alerts have been forwarded to the upper layer. */
+              }
+#  if (TCPIP_SUPPORT_ASRTLS_VERSION_1_3 == STD_ON)
+              /* If TLS version is TLS 1.3, check also if there is new plaintext in TLS Rx Alert buffer that has
+               * not been forwarded to the Ul. */
+              else if (   (TcpIp_GetActiveVersionOfTlsConnectionDyn(tlsConIdx) == TCPIP_TLSVERSION_13)
+                       && (TcpIp_IsAlRxIndicationOfTlsConnectionDyn(tlsConIdx) == TRUE))
+              {
+                /* Do nothing, wait until all pending alerts have been forwarded to the upper layer. */
+              }
+#  endif /* (TCPIP_SUPPORT_ASRTLS_VERSION_1_3 == STD_ON) */
+              else
+              {
+                /* No application data nor alerts left which were not forwarded to Ul, so inform the Ul about the
+                 * TCP socket state change to FIN_RECEIVED. */
+                TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived(socketTcpIdx);
+              }
+          }
+          else
+# endif /* (TCPIP_SUPPORT_ASRTLS == STD_ON) */
+          {
+            TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived(socketTcpIdx);
+          }
+        }
+        /* #50 Handle TCP idle timeouts. */
+        TcpIp_Tcp_VMainIdleTimeoutHandling(socketTcpIdx);
+      }
+    }
+  }
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_OpenPassive
+ *  TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7222,43 +7535,69 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_OpenActive(
  *
  *
  *
- *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_OpenPassive(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_NotifyUlAboutSocketStateChangeToFinReceived(TcpIp_SocketTcpDynIterType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  /* Socket is opened passively */
-  /* Listen (passive open) */
-  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx;
-  TcpIp_SizeOfTcpRxBufferDescType tcpRxBufferDescIdx;
+  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Set socket state */
-  TcpIp_SetSockIsServerOfSocketTcpDyn( SocketTcpIdx, TRUE);
-  TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_LISTEN);
-  TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
 
-  /* Buffers have been assinged to this listen socket before, release those buffers but remember the buffer sizes. */
-  /* tx buffer */
-  /* #20 remember TxBuffer size */
-  tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-  TCPIP_ASSERT(tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc());
-  TcpIp_SetRequestedTxBufferSizeOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx));
+  TCPIP_ASSERT((TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT)
+    || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_TIMEWAIT));
 
-  /* #30 remember RxBuffer size */
-  tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-  TCPIP_ASSERT(tcpRxBufferDescIdx < TcpIp_GetSizeOfTcpRxBufferDesc());
-  TcpIp_SetRequestedRxBufferSizeOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx));
+  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT)
+  {
+    /* #10 In CLOSEWAIT state signal 'FIN received' to the user. */
+    TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
+    /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                            /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
 
-  /* #40 Release already assigned Tx- and RxBuffer. */
-  TcpIp_Tcp_VReleaseAssignedBuffers(SocketTcpIdx);
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_FIN_REC,
+      TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx));
+# else
+    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_FIN_REC, FALSE);
+# endif
+  }
+  else  /* TCPIP_TCP_SOCK_STATE_TIMEWAIT */
+  {
+    /* #20 In TIMEWAIT state signal 'connection closing' to the user. */
+    TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
+    /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                            /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONN_CLOSING,
+      TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx));
+# else
+    TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONN_CLOSING, FALSE);
+# endif
+  }
+  /* all other possible values for SockState will not occur here:
+
+     TCPIP_TCP_SOCK_STATE_INVALID     -> this state is never used as SockState but only for SockStateNext
+
+     TCPIP_TCP_SOCK_STATE_LISTEN,
+     TCPIP_TCP_SOCK_STATE_SYNSENT,
+     TCPIP_TCP_SOCK_STATE_LASTACK,
+     TCPIP_TCP_SOCK_STATE_CLOSING,
+     TCPIP_TCP_SOCK_STATE_CLOSED      -> in these states there is no path that could set a pending event
+
+     TCPIP_TCP_SOCK_STATE_SYNRCVD,
+     TCPIP_TCP_SOCK_STATE_ESTABLISHED -> these states are already enhanced to state TCPIP_TCP_SOCK_STATE_CLOSEWAIT
+                                         in the context of the RxIndication.
+
+     TCPIP_TCP_SOCK_STATE_FINWAIT1,
+     TCPIP_TCP_SOCK_STATE_FINWAIT2    -> these states are already enhanced to state TCPIP_TCP_SOCK_STATE_TIMEWAIT
+                                         in the context of the RxIndication.
+  */
+
+  /* #30 Delete the pending event */
+  TcpIp_SetEventIndicationPendingOfSocketTcpDyn(SocketTcpIdx, 0);
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_Close
+ *  TcpIp_Tcp_VDuplicateSocket
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7268,200 +7607,110 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_OpenPassive(
  *
  *
  *
- *
- *
- *
- *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_Close(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(TcpIp_SizeOfSocketTcpDynType, TCPIP_CODE) TcpIp_Tcp_VDuplicateSocket(
+  TcpIp_SizeOfSocketTcpDynType      ListenSocketTcpIdx,
+  TcpIp_LocalAddrIterType           LocalAddrIdx,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfSocketTcpDynType  newSocketTcpIdx = TCPIP_TCP_INV_IDX;
+  TcpIp_SizeOfSocketDynType     listenSocketIdx = TcpIp_GetSizeOfSocketTcpDyn();
+  TcpIp_SocketTcpDynIterType    socketTcpIdx;
+  TcpIp_SocketTcpDynIterType    derivedConnCnt = 0;  /* number of sockets that have already been derived from the listen socket */
+
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(TCPIP_TCP_COND_VALID_TCPIDX(SocketTcpIdx));
+  TCPIP_ASSERT(ListenSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
 
-  TCPIP_VENTER_CRITICAL_SECTION();
+  listenSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(ListenSocketTcpIdx);
 
-  /* #10 Proceed the socket closure dependent on the current socket state. */
-  switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
+  /* #10 Count TCP sockets that have the current listen socket as master. */
+  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
   {
-  case TCPIP_TCP_SOCK_STATE_CLOSED:
+    if (TcpIp_GetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(socketTcpIdx) == ListenSocketTcpIdx)
     {
-      /* #20 Close socket in state CLOSED */
-      /* This TCP socket was previously requested and buffers might have been assigned, but the socket is still in state
-      CLOSED. -> Release all resources assigned to this socket. */
-      TcpIp_Tcp_VReleaseAssignedBuffers(SocketTcpIdx);
-      TcpIp_SetRequestedRxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
-      TcpIp_SetRequestedTxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
-
-      break;
+      derivedConnCnt++;
     }
-  case TCPIP_TCP_SOCK_STATE_LISTEN:
-    {
-      /* #30 Close socket in state LISTEN */
-      /* RFC: Any outstanding RECEIVEs are returned with 'error: closing'
-      responses. Delete TCB, enter CLOSED state, and return. */
-
-      /* delete/clear TCB element */
-      TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
-      /* only server sockets can be in state 'listen' */
-      TcpIp_Tcp_VHandleListenSocketClose(SocketTcpIdx);
-
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_SYNRCVD:
-    {
-      /* #40 Close socket in state SYNRCVD */
-
-      /* RFC: issue sending of FIN segment (eventually put this request in send queue) */
-
-      /* send FIN */
-      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN));
-
-      TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
-      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
-
-      /* Set SndNxtAfterFin to include the FIN flag */
-      TcpIp_SetSndNxtAfterFinOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx) + 1u);
-
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_SYNSENT:
-    {
-      /* #50 Close socket in state SYNSENT */
-      /* RFC: Delete the TCB and return 'error: closing' responses to any
-      queued SENDs, or RECEIVEs. */
+  }
 
-      /* delete/clear TCB element */
-      TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
+  /* #20 Check if the limit for listen sockets is already reached */
+  if (derivedConnCnt < TcpIp_GetMaxNumListenSocketsOfSocketTcpDyn(ListenSocketTcpIdx))
+  {
+    /* The maximum number of sockets derived from the current listen socket is not yet reached */
+    TcpIp_SocketIdType newSocketId = 0u;
 
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_ESTABLISHED:
+    /* #30 Take a new TCP socket if available */
+    if (TcpIp_GetSocketForUser(RxSockRemAddrPtr->DomainAndPort.domain, TCPIP_IPPROTO_TCP, &newSocketId, TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(listenSocketIdx)) == E_OK)
     {
-      /* #60 Close socket in state ESTABLISHED */
-      /* RFC: Queue this until all preceding SENDs have been segmentized, then
-      form a FIN segment and send it. In any case, enter FIN-WAIT-1 state. */
-
-      /* send FINACK */
-      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN | TCPIP_TCP_CODE_BIT_ACK));
-
-      TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
-      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
+      /* socket could be allocated */
+      newSocketTcpIdx = TCPIP_SOCKET_IDX_TO_TCP_IDX(TCPIP_SOCKET_ID_TO_IDX(newSocketId));
+      /*@ assert newSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); */                                                    /* VCA_TCPIP_AWA_CSL_IDX_FROM_PREVIOUS_FUNCTION_CALL */
 
-      /* Set SetSndNxtAfterFin depending on data that has to be sent before the FIN. */
-      TcpIp_Tcp_VCalcSndNxtAfterFinInEstablished(SocketTcpIdx);
+      /* #40 Assign buffers and init/copy variables for the new derived socket */
+      if (TcpIp_Tcp_VAssignBuffersToDuplicatedSocket(newSocketTcpIdx, ListenSocketTcpIdx) == E_OK)
+      {
+        TcpIp_SetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(newSocketTcpIdx, ListenSocketTcpIdx);  /* set master socket index for this new socket */
 
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_FINWAIT1:
-  case TCPIP_TCP_SOCK_STATE_FINWAIT2:
-    {
-      /* #70 Close socket in state FINWAIT1 or FINWAIT2 */
-      /* RFC: 'error: connection closing' */
-      /* An 'ok' response would be acceptable, too, as long as a second FIN is not emitted. */
-      TcpIp_SetLastSockError(TCPIP_SOCK_ERR_10101);
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_CLOSEWAIT:
-    {
-      /* #80 Close socket in state CLOSEWAIT */
-      /* send FIN */
-      TcpIp_Tcp_VSendFlags(SocketTcpIdx, TCPIP_TCP_CODE_BIT_FIN);
+        TcpIp_Tcp_VInitVarsOfDuplicatedSocket(newSocketTcpIdx, ListenSocketTcpIdx, LocalAddrIdx, RxSockRemAddrPtr);
 
-      /* State TCPIP_TCP_SOCK_STATE_LASTACK will be set in TcpIp_Tcp_VTransmitSegment()
-       * if last segment with FIN is sent */
-      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_LASTACK);
-      break;
+        TcpIp_Tcp_VAcceptedSocketStateHandling(ListenSocketTcpIdx, newSocketTcpIdx);
+      }
+      else
+      {
+        /* #50 No matching buffer available -> release the new socket and cancel this attempt to accept a connection */
+        (void)TcpIp_Close(newSocketId, FALSE);
+        newSocketTcpIdx = TCPIP_TCP_INV_IDX;
+      }
     }
-  default:
+    else
     {
-      /* #90 Close socket in all other states */
-      /* states: TCPIP_TCP_SOCK_STATE_CLOSING, TCPIP_TCP_SOCK_STATE_LASTACK, TCPIP_TCP_SOCK_STATE_TIMEWAIT */
-      /* RFC: 'error: connection closing' */
-      TcpIp_SetLastSockError(TCPIP_SOCK_ERR_10101);
-
-      /* ignore request silently, closing is already in progress or finished */
-      break;
+      /* no free sockets available */
     }
   }
+  else
+  {
+    /* no more connection may be accepted on this listen socket */
+  }
 
-  TCPIP_VLEAVE_CRITICAL_SECTION();
-
+  return newSocketTcpIdx;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_Abort
+ *  TcpIp_Tcp_VAssignBuffersToDuplicatedSocket
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_Abort(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignBuffersToDuplicatedSocket(
+  TcpIp_SizeOfSocketTcpDynType NewSocketTcpIdx,
+  TcpIp_SizeOfSocketTcpDynType ListenSocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketDynType socketIdx = TcpIp_GetSizeOfSocketDyn();
+  Std_ReturnType retVal = E_NOT_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(TCPIP_TCP_COND_VALID_TCPIDX(SocketTcpIdx));
-
-  socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-
-
-  /* send RST, delete TCB, enter CLOSED state, and return */
+  /* #10 Assign an RxBuffer to the duplicated socket. */
+  TCPIP_ASSERT(TcpIp_GetRequestedRxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx) > 0u);
+  retVal = TcpIp_Tcp_VAssignRxBuffer(NewSocketTcpIdx, TcpIp_GetRequestedRxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx));
 
-  /* #10 Proceed the socket closure dependent on the current socket state. */
-  switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
+  /* #20 Assign a TxBuffer to the duplicated socket. */
+  if (retVal == E_OK)
   {
-  case TCPIP_TCP_SOCK_STATE_CLOSED:
-    {
-      /* #20 Nothing to do for sockets already in state 'CLOSED'. */
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_LISTEN:
-    {
-      /* #30 Only server sockets can be in state 'LISTEN'. -> close not yet fully accepted connections that are related
-        to this server socket. */
-      TcpIp_Tcp_VHandleListenSocketClose(SocketTcpIdx);
-      break;
-    }
-  case TCPIP_TCP_SOCK_STATE_SYNSENT:
-  case TCPIP_TCP_SOCK_STATE_CLOSING:
-  case TCPIP_TCP_SOCK_STATE_LASTACK:
-  case TCPIP_TCP_SOCK_STATE_TIMEWAIT:
-    {
-      break;
-    }
-  default:
-    {
-      TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
-      /* @ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                          /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
-
-      /* #40 For all other socket states send a RST. */
-      TcpIp_Tcp_VSendReset(SocketTcpIdx, txIpAddrIdx,
-        (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)),
-        (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
-      TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u);
-      break;
-    }
+    TCPIP_ASSERT(TcpIp_GetRequestedTxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx) > 0u);
+    retVal = TcpIp_Tcp_VAssignTxBuffer(NewSocketTcpIdx, TcpIp_GetRequestedTxBufferSizeOfSocketTcpDyn(ListenSocketTcpIdx));
   }
-  /* #50 Close the socket and release all assigned resources. */
 
-  TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+  return retVal;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleListenSocketClose
+ *  TcpIp_Tcp_VInitVarsOfDuplicatedSocket
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7470,199 +7719,165 @@ FUNC(void, TCPIP_CODE) TcpIp_Tcp_Abort(
  *
  *
  *
+ *
+ *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleListenSocketClose(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitVarsOfDuplicatedSocket(
+  TcpIp_SizeOfSocketTcpDynType      NewSocketTcpIdx,
+  TcpIp_SizeOfSocketTcpDynType      ListenSocketTcpIdx,
+  TcpIp_LocalAddrIterType           LocalAddrIdx,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketTcpDynType localSocketTcpIdx;
+  TcpIp_SizeOfSocketDynType   newSocketIdx    = TCPIP_TCP_IDX_TO_SOCKET_IDX(NewSocketTcpIdx);
+  TcpIp_SizeOfSocketDynType   listenSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(ListenSocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Search for all sockets that have this socket as master socket. */
-  for (localSocketTcpIdx = 0; localSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); localSocketTcpIdx++)
+  /* Copy EthframePrio from Listen socket to new created socket. */
+  TcpIp_VCopySocketSpecificFramePriority(newSocketIdx, listenSocketIdx);
+  /* #10 Set rx- and tx-window related variables */
+  TcpIp_SetRcvNxtOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetRcvNxtOfSocketTcpDyn(ListenSocketTcpIdx));
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
+  TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
+  TcpIp_SetEnabledOfSocketTcpNagleDyn(NewSocketTcpIdx, TcpIp_IsEnabledOfSocketTcpNagleDyn(ListenSocketTcpIdx));
+# endif
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
   {
-    if (TcpIp_GetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(localSocketTcpIdx) == SocketTcpIdx)                    /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-    {
-      /* #20 Close socket, if state is lower than established. */
-      if (TcpIp_GetSockStateOfSocketTcpDyn(localSocketTcpIdx) < TCPIP_TCP_SOCK_STATE_ESTABLISHED)
-      {
-        /* #30 For state SYNRCVD send RST to Client. */
-        if (TcpIp_GetSockStateOfSocketTcpDyn(localSocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD)
-        {
-          /* Send RST to client to close halfopen connection */
-          TcpIp_SocketDynIterType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(localSocketTcpIdx);
-          TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
-          /* @ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                      /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
-
-          TcpIp_Tcp_VSendReset(localSocketTcpIdx, txIpAddrIdx,
-            (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)),
-            (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
-            TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u);
-        }
+    uint8 ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(ListenSocketTcpIdx);
 
-        /* Matching TCP sockets in state Listen can't have other sockets as master listen socket. */
-        /* For other states, no special actions are required */
-
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(localSocketTcpIdx, TCPIP_TCP_STATE_RESET);
-      }
-      /* #40 Otherwise: Just delete reference to master listen socket. */
-      else
-      {
-        /* Reset the referenced MasterListenSocketIdx since this would not be valid any more after closing this referenced listen socket. */
-        TcpIp_SetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(localSocketTcpIdx, TCPIP_NO_SOCKETTCPDYNMASTERLISTENSOCKETIDXOFSOCKETTCPDYN);
-      }
+    /* Inherit the congestion control settings. If no context is available, the new socket falls back to Reno. */
+    if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
+    {
+      (void)TcpIp_Tcp_VCongCtrlExtAssign(NewSocketTcpIdx, TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm,
+                                         TcpIp_Tcp_CongCtrlExt[ctxIdx].PacingEnabled);
     }
   }
-}
+# endif
 
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+  TcpIp_Tcp_VKeepAliveCopyParameters(ListenSocketTcpIdx, NewSocketTcpIdx);
+# endif
 
-/**********************************************************************************************************************
- *  TcpIp_Tcp_VCalcSndNxtAfterFinInEstablished
- *********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCalcSndNxtAfterFinInEstablished(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
-{
-  /* ----- Implementation ----------------------------------------------- */
-  /* #10 Set SetSndNxtAfterFin depending on data that has to be sent before the FIN. */
-  /* Tx sequence number that follows the FIN */
-  uint32 sndNxtAfterFin = 0u;
-  TcpIp_SizeOfTcpRetryQElementType lastTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
-  if (lastTcpRetryQElementIdx != TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
-  {
-    TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) RetryQueueElePtr = TcpIp_GetAddrTcpRetryQElement(lastTcpRetryQElementIdx);
-    /* In state ESTABLISHED the last retry queue element never contains a FIN flag. So take the elements sequence number
-    and add the element length and the not queued data length plus the FIN flag. */
-    sndNxtAfterFin = RetryQueueElePtr->SeqNo + RetryQueueElePtr->SizeTotByte
-                     + TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + 1u;
+  TcpIp_SetIssOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_Tcp_GlobalTimestamp * (250u * TCPIP_MAIN_FCT_PERIOD_MSEC));  /* inc iss every 4 microseconds */
+  TcpIp_SetSndUnaOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(NewSocketTcpIdx));  /* ISS */
+  TcpIp_SetSndNxtOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(NewSocketTcpIdx));  /* ISS */
+  TcpIp_SetSndWl2OfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(NewSocketTcpIdx));  /* ISS */
+
+  /* #20 Set local family and port, other address related variables and MSS. */
+  TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->DomainAndPort.domain = RxSockRemAddrPtr->DomainAndPort.domain;
+  TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->DomainAndPort.port   = TcpIp_GetAddrLocSockOfSocketDyn(listenSocketIdx)->DomainAndPort.port;
+# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
+  if (TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->sa_family == IPBASE_AF_INET)
+  {
+    TcpIp_LocalAddrV4IterType  ipV4AddrIdx = TCPIP_LOCAL_ADDR_IDX_TO_IPV4(LocalAddrIdx);
+    IpBase_AddrInType         *ipV4AddrPtr = &(TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->SockAddrIn.sin_addr);
+    (void)IpV4_Ip_GetLocNetAddr(ipV4AddrIdx, ipV4AddrPtr);
+    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV4);
   }
-  else
+# endif
+# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+  if (TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->sa_family == IPBASE_AF_INET6)
   {
-    /* there is no retry queue element for this socket */
-    /* add not queued len + FIN to SndNxt */
-    sndNxtAfterFin =   TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx)
-      + TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + 1u;
+    TcpIp_LocalAddrV6IterType  ipV6AddrIdx = TCPIP_LOCAL_ADDR_IDX_TO_IPV6(LocalAddrIdx);                                /* PRQA S 2897 */ /* MD_TCPIP_2897 */
+    IpBase_AddrIn6Type        *ipV6AddrPtr = &(TcpIp_GetAddrLocSockOfSocketDyn(newSocketIdx)->SockAddrIn6.sin6_addr);
+    (void)IpV6_GetLocalAddress(ipV6AddrIdx, ipV6AddrPtr, NULL_PTR);
+    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV6);
   }
+# endif
+  (void)IpBase_CopySockAddr(&TcpIp_GetAddrRemSockOfSocketDyn(newSocketIdx)->SockAddr, &RxSockRemAddrPtr->SockAddr);     /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
 
-  TcpIp_SetSndNxtAfterFinOfSocketTcpDyn(SocketTcpIdx, sndNxtAfterFin);
-}
+  TcpIp_SetSockIsServerOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_IsSockIsServerOfSocketTcpDyn(ListenSocketTcpIdx));
+  TcpIp_SetTxIpAddrIdxOfSocketDyn(newSocketIdx, (TcpIp_TxIpAddrIdxOfSocketDynType)TCPIP_LOCAL_ADDR_IDX_TO_IPVX(LocalAddrIdx));
+  /* Use LocalAddrIdx that received the SYN, the welcome socket could have an ANY/Broadcase/All-Node binding */
+  TcpIp_SetLocalAddrBindIdxOfSocketDyn(newSocketIdx, (TcpIp_SizeOfLocalAddrType)LocalAddrIdx);
 
+  /* #30 Init TxMssAgreed with default value */
+  /* The TCP header options are not yet evaluated for this received connection request, so default value is applied. */
+  TcpIp_SetTxMssAgreedOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx));
 
-/**********************************************************************************************************************
- *  TcpIp_Tcp_ResetSocket
- *********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_ResetSocket(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
-{
-  /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SocketDynIterType           socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-  TcpIp_OsApplicationType applId = TcpIp_Tcp_GetApplIdOfSocket(SocketTcpIdx);
-  TcpIp_TcpRstHandlingIterType tcpRstHandlingIdx = TcpIp_Tcp_GetRstHandlingOfApplId(applId);
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+  /* #40 Set the default cwnd */
+  TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(NewSocketTcpIdx, TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx)));
+  TcpIp_SetCwndOfSocketTcpCongCtrlDyn(NewSocketTcpIdx,
+    ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(NewSocketTcpIdx) * (uint32) TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(NewSocketTcpIdx)));
+# endif
 
-  /* ----- Implementation ----------------------------------------------- */
-  /* #10 Mark all reset queue elements related to the given socket as 'invalid'. */
-  if(tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandlingDyn())
-  {
-    TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-    if (0u < TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx))
-    {
-      TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
+  /* #50 Set values for activated options. */
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  TcpIp_SetSackOptActiveOfSocketTcpDyn(NewSocketTcpIdx, FALSE);
+# endif
 
-      for (rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
-        rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
-        rstTxQueueBufferIdx++)
-      {
-        TCPIP_P2V(TcpIp_Tcp_RstTxQueueType) rstQueuePtr = TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx);
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+  TcpIp_SetTimestampOptActiveOfSocketTcpTsOptDyn(NewSocketTcpIdx, FALSE);
+  TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(NewSocketTcpIdx, 0);
+# endif
 
-        /* Remove reset element from the queue. */
-        if (TcpIp_VSockAddrIpAndPortIsEqual(&rstQueuePtr->LocSock, TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)) == TRUE)
-        {
-          rstQueuePtr->RemSock.sa_family = IPBASE_AF_UNSPEC;
-          TcpIp_DecRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx);
-        }
-      }
-    }
-    TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
-  }
+  /* #60 Reset one-time option values */
+  TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(NewSocketTcpIdx, 0);
+  TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(NewSocketTcpIdx, 0);
 
-  TCPIP_ASSERT(TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED);
+  /* #70 Copy socket state from the listen socket */
+  TcpIp_SetSockStateOfSocketTcpDyn(    NewSocketTcpIdx, TcpIp_GetSockStateOfSocketTcpDyn(    ListenSocketTcpIdx));
+  TcpIp_SetSockStateNextOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetSockStateNextOfSocketTcpDyn(ListenSocketTcpIdx));
+
+  /* Copy Retransmit default Timeout */
+  TcpIp_SetRetransmitTimeoutDefaultOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(ListenSocketTcpIdx));
 
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+  TcpIp_Tcp_VInitTimeStampCalculation(NewSocketTcpIdx);
+# endif
 
-  /* #20 Close the socket and release all assigned resources */
-  TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+# if(TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
+  TcpIp_SetUseTlsOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_IsUseTlsOfSocketTcpDyn(ListenSocketTcpIdx));
+# endif
+
+  TcpIp_SetMslOfSocketTcpDyn(NewSocketTcpIdx, TcpIp_GetMslOfSocketTcpDyn(ListenSocketTcpIdx));
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VReleaseAssignedBuffers
+ *  TcpIp_Tcp_VAcceptedSocketStateHandling
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VReleaseAssignedBuffers(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VAcceptedSocketStateHandling(
+  TcpIp_SizeOfSocketTcpDynType ListenSocketTcpIdx,
+  TcpIp_SizeOfSocketTcpDynType AcceptSocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_TcpRxBufferDescIterType tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-  TcpIp_TcpTxBufferDescIterType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  TcpIp_SizeOfSocketDynType acceptSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(AcceptSocketTcpIdx);
+  TcpIp_SizeOfSocketDynType listenSocketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(ListenSocketTcpIdx);
+  TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(listenSocketIdx);
+  /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                              /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Release RX buffer */
-  if (tcpRxBufferDescIdx < TcpIp_GetSizeOfTcpRxBufferDesc())
-  {
-    TCPIP_ASSERT(SocketTcpIdx == TcpIp_GetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx));
-
-    TcpIp_SetFillLevelOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, 0);
-    TcpIp_SetTcpRxBufferWriteIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, TcpIp_GetTcpRxBufferStartIdxOfTcpRxBufferDesc(tcpRxBufferDescIdx));
-
-    TcpIp_SetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, TcpIp_GetSizeOfSocketTcpDyn());  /* invalid socket index */
-    TcpIp_SetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSizeOfTcpRxBufferDesc());  /* invalid buffer index */
-  }
-  else
-  {
-    TCPIP_ASSERT(tcpRxBufferDescIdx == TcpIp_GetSizeOfTcpRxBufferDesc());
-  }
-
-  /* #20 Release TX buffer */
-  if (tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc())  /* valid buffer index */
-  {
-    TCPIP_ASSERT(SocketTcpIdx == TcpIp_GetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx));
-
-    TcpIp_SetFillLevelOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, 0);
-    TcpIp_SetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
-    /* no read position required for TX buffer */
+  /* #10 Trigger sending of SYN and ACK (will be sent in MainFunction) */
+  TcpIp_Tcp_VSendFlags(AcceptSocketTcpIdx, (TCPIP_TCP_CODE_BIT_SYN | TCPIP_TCP_CODE_BIT_ACK));
 
-    TcpIp_SetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, TcpIp_GetSizeOfSocketTcpDyn());  /* invalid socket index */
-    TcpIp_SetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSizeOfTcpTxBufferDesc());        /* invalid buffer index */
+  /* #20 Set the socket to state 'active' */
+  TcpIp_VSockTcpStateChg(acceptSocketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONN_ESTAB, FALSE);  /* set socket to 'active' */
 
-    /* no assigned buffer variable */
-  }
-  else
+# if defined(TCPIP_SPECIAL_TCP_ACCEPTING_FCT)                                                                           /* COV_TCPIP_RUNTIME_TEST */
+  /* #30 Inform the socket owner about an ongoing connection establishment, only if this feature is enabled. */
+  /* It can be enabled that the listen socket owner is informed about an ongoing acceptance of an incoming connection
+  request. Since the same callback function is used as for the final indication of the acceptance of an incoming
+  connection, only the second call of this callback means that the new connection is really fully accepted. */
   {
-    TCPIP_ASSERT(tcpTxBufferDescIdx == TcpIp_GetSizeOfTcpTxBufferDesc());
+    (void)TCPIP_SPECIAL_TCP_ACCEPTING_FCT(listenSocketIdx, acceptSocketIdx, &TcpIp_GetAddrRemSockOfSocketDyn(acceptSocketIdx)->TcpIpSockAddr); /* PRQA S 0310 */ /* MD_TCPIP_Rule11.3_0310_3305_SockAddrBaseType */
   }
-
+# endif
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VAssignRxBuffer
+ *  TcpIp_Tcp_Open
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7670,65 +7885,62 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VReleaseAssignedBuffers(
  *
  *
  *
+ *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignRxBuffer(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint32                       RequestedBufferSize)
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_Open(
+  TcpIp_SocketTcpDynIterType        SocketTcpIdx,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) SockAddrPtr,
+  boolean                           ActiveOpen)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_NOT_OK;
+  Std_ReturnType          retVal    = E_OK;
+  TcpIp_SocketDynIterType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if there is already a buffer assigned to this socket. */
-  if (TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) >= TcpIp_GetSizeOfTcpRxBufferDesc())
-  {
-    TCPIP_ASSERT(TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) == TcpIp_GetSizeOfTcpRxBufferDesc());
-
-    /* #20 Check that the socket is in state CLOSED. */
-    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)
-    {
-      TcpIp_TcpRxBufferDescIterType tcpRxBufferDescIdx;
-
-      TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();     /* lock cross core interrupts */
-
-      /* #30 Choose a matching rx buffer and assign it to the socket. */
-      for (tcpRxBufferDescIdx = 0; tcpRxBufferDescIdx < TcpIp_GetSizeOfTcpRxBufferDesc(); tcpRxBufferDescIdx++)
-      {
-        if (   (TcpIp_GetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx) == TcpIp_GetSizeOfSocketTcpDyn())      /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-            && (RequestedBufferSize == TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx)))
-        {
-          /* found a free and matching buffer */
-          /* the buffer size is never '0', this is assuerd by the configuration */
-          TcpIp_SetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, SocketTcpIdx);
-          TcpIp_SetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, (TcpIp_SizeOfTcpRxBufferDescType)tcpRxBufferDescIdx);
+  TCPIP_ASSERT(SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
+  TCPIP_ASSERT(SockAddrPtr != NULL_PTR);
 
-          TcpIp_SetRcvWndOfSocketTcpDyn(SocketTcpIdx, (uint16)RequestedBufferSize);
+  /* #10 Check if socket is already open. */
+  if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)                                /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN))
+  {
+    /* RFC: 'error: connection already exists' */
+    /* Windows: WSAEISCONN - 10056 - 'Socket is already connected' */
+    retVal = E_NOT_OK;
+  }
+  /* #20 Check if buffers are assigned to the socket. */
+  else if (   (TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) >= TcpIp_GetSizeOfTcpTxBufferDesc())             /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+           || (TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) >= TcpIp_GetSizeOfTcpRxBufferDesc()))
+  {
+    /* one or both buffers assignments are missing, so it is not possible to open a connection */
+    retVal = E_NOT_OK;
+  }
+  else
+  {
+    /* #30 Set the remote socket address */
+    (void)IpBase_CopySockAddr(&TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->SockAddr, &SockAddrPtr->SockAddr);           /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
 
-          retVal = E_OK;
-          break;  /* stop the for-loop */
-        }
-      }
+    /* init variables for this socket */
+    TcpIp_SetRcvNxtOfSocketTcpDyn(SocketTcpIdx, 0);
 
-      TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();     /* unlock cross core interrupts */
+    /* #40 Open the TCP socket */
+    if (ActiveOpen == TCPIP_TCP_ACTIVE_OPEN)
+    {
+      TcpIp_Tcp_OpenActive(SocketTcpIdx, SockAddrPtr->sa_family);
     }
     else
     {
-      /* buffer may only be assigned in state 'Closed' */
-      /* -> nothing to do, return value already is negative */
+      TcpIp_Tcp_OpenPassive(SocketTcpIdx);
     }
   }
-  else
-  {
-    /* a buffer is already assigned, an updated assignment is not supported -> E_NOT_OK */
-  }
 
   return retVal;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VAssignTxBuffer
+ *  TcpIp_Tcp_OpenActive
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7736,164 +7948,106 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignRxBuffer(
  *
  *
  *
+ *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignTxBuffer(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint32                       RequestedBufferSize)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_OpenActive(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx,
+  TcpIp_DomainType           Domain)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_NOT_OK;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if there is already a buffer assigned to this socket. */
-  if (TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) == TcpIp_GetSizeOfTcpTxBufferDesc())
-  {
-    /* #20 Check that the socket is in state CLOSED. */
-    if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_ESTABLISHED))
-    {
-      /* The buffer is not yet assigned to a socket */
-      TcpIp_TcpTxBufferDescIterType  tcpTxBufferDescIdx;
 
+  /* Socket is opened actively */
+  /* Connect (active open) */
+  /*
+  RFC:
+  - select an initial send sequence number (ISS)
+  - send a SYN segment of the form <SEQ=ISS><CTL=SYN>
+  - set SND.UNA to ISS, SND.NXT to ISS + 1, enter SYN-SENT state, and return.
+  */
+  /* #10 Trigger sending SYN and set socket state */
+  TcpIp_Tcp_VSendFlags(SocketTcpIdx, TCPIP_TCP_CODE_BIT_SYN);
 
-      TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();     /* lock cross core interrupts */
+  TcpIp_SetSockIsServerOfSocketTcpDyn( SocketTcpIdx, FALSE);
+  TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_SYNSENT);
+  TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_SYNSENT);
 
-      /* #30 Choose a matching tx buffer and assign it to the socket. */
-      for (tcpTxBufferDescIdx = 0; tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); tcpTxBufferDescIdx++)
-      {
-        if (   (TcpIp_GetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx) == TcpIp_GetSizeOfSocketTcpDyn())  /* invalid socket idx */ /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-            && (RequestedBufferSize == TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx)))
-        {
-          /* found a free and matching buffer */
-          /* the buffer size is never '0', this is assuerd by the configuration */
-          TcpIp_SetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, SocketTcpIdx);
-          TcpIp_SetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, (TcpIp_SizeOfTcpTxBufferDescType)tcpTxBufferDescIdx);
-          TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-          TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx));  /* init to tx buffer size */
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+  /* #20 Reset keep alive timer if feature is supported */
+  TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
 # endif
-          retVal = E_OK;
-          break;  /* stop the for-loop */
-        }
-      }
 
-      TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();     /* unlock cross core interrupts */
-    }
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  /* #30 Activate 'selective ack' option if supported */
+  TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(   SocketTcpIdx, (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) | (TcpIp_TxOneTimeOptsOfSocketTcpDynType)TCPIP_TCP_OPT_FLAG_SACK_PERMIT));
+  TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx) + (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u)));  /* option + 2x NOP */
+# endif
+
+  /* #40 Set maximum segment length depending on used address family */
+  if (Domain == IPBASE_AF_INET)
+  {
+    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV4);
   }
   else
   {
-    /* a buffer is already assigned, an updated assignment is not supported -> E_NOT_OK */
+    TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_TX_MSS_IPV6);
   }
 
-  return retVal;
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+  /* #50 Set default cwnd if supported */
+  TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)));
+  TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx) * (uint32) TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx)));
+# endif
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_ChangeParameter
+ *  TcpIp_Tcp_OpenPassive
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ *
+ *
+ *
  */
 /* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_ChangeParameter(
-  TcpIp_SizeOfSocketDynType    SocketIdx,
-  uint8                        OptName,
-  TCPIP_P2C(uint8)             OptValPtr)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_OpenPassive(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_NOT_OK;
+  /* Socket is opened passively */
+  /* Listen (passive open) */
+  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx;
+  TcpIp_SizeOfTcpRxBufferDescType tcpRxBufferDescIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(SocketIdx < TcpIp_GetSizeOfSocketDyn());
-
-  /* #10 Set the chosen socket option if socket is a TCP-socket */
-
-  if (TCPIP_SOCKET_IDX_IS_TCP(SocketIdx))
-  {
-    TcpIp_SizeOfSocketTcpDynType socketTcpIdx = TCPIP_SOCKET_IDX_TO_TCP_IDX(SocketIdx);
-    switch (OptName)
-    {
-      case TCPIP_PARAMID_TCP_RXWND_MAX:
-      {
-        uint32 requestedBufferSize = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
-        retVal = TcpIp_Tcp_VAssignRxBuffer(socketTcpIdx, requestedBufferSize);
-        break;
-      }
-
-      case TCPIP_PARAMID_V_TCP_TXBUFSIZE:
-      {
-        uint32 requestedBufferSize = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
-        retVal = TcpIp_Tcp_VAssignTxBuffer(socketTcpIdx, requestedBufferSize);
-        break;
-      }
-
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
-      case TCPIP_PARAMID_TCP_NAGLE:
-      {
-        if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)
-        {
-          boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                              /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
-          TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
-          TcpIp_SetEnabledOfSocketTcpNagleDyn(socketTcpIdx, enabled);
-          retVal = E_OK;
-        }
-        break;
-      }
-# endif
-
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-      case TCPIP_PARAMID_TCP_KEEPALIVE:
-      case TCPIP_PARAMID_TCP_KEEPALIVE_INTERVAL:
-      case TCPIP_PARAMID_TCP_KEEPALIVE_PROBES_MAX:
-      case TCPIP_PARAMID_TCP_KEEPALIVE_TIME:
-      {
-        retVal = TcpIp_Tcp_VSetSockOpt_KeepAliveOptions(socketTcpIdx, OptName, OptValPtr);
-        break;
-      }
-# endif
-
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-      case TCPIP_PARAMID_V_TCP_UTOUPDATE:
-      case TCPIP_PARAMID_V_TCP_UTOENABLED:
-      case TCPIP_PARAMID_V_TCP_UTOCHANGEABLE:
-      {
-        TcpIp_Tcp_VSetSockOpt_UserTimeoutOptions(socketTcpIdx, OptName, OptValPtr);
-        retVal = E_OK;
-        break;
-      }
-# endif /* (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) */
-
-      case TCPIP_PARAMID_TCP_MSL:
-      {
-        retVal = TcpIp_Tcp_SetMsl(socketTcpIdx, OptValPtr);
-        break;
-      }
+  /* #10 Set socket state */
+  TcpIp_SetSockIsServerOfSocketTcpDyn( SocketTcpIdx, TRUE);
+  TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_LISTEN);
+  TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
 
-      case TCPIP_PARAMID_TCP_RETRANSMIT_TIMEOUT:
-      {
-        retVal = TcpIp_Tcp_SetRetransmissionTimeout(socketTcpIdx, OptValPtr);
-        break;
-      }
+  /* Buffers have been assinged to this listen socket before, release those buffers but remember the buffer sizes. */
+  /* tx buffer */
+  /* #20 remember TxBuffer size */
+  tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  TCPIP_ASSERT(tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc());
+  TcpIp_SetRequestedTxBufferSizeOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx));
 
-      default:
-      {
-        /* Unknown TCP socket option. Do nothing, return E_NOT_OK */
-      }
-      break;
-    }
-  }
+  /* #30 remember RxBuffer size */
+  tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  TCPIP_ASSERT(tcpRxBufferDescIdx < TcpIp_GetSizeOfTcpRxBufferDesc());
+  TcpIp_SetRequestedRxBufferSizeOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx));
 
-  return retVal;
+  /* #40 Release already assigned Tx- and RxBuffer. */
+  TcpIp_Tcp_VReleaseAssignedBuffers(SocketTcpIdx);
 }
 
 
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_SetSockOpt_VKeepAliveOptions
+ *  TcpIp_Tcp_Close
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7902,77 +8056,132 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_ChangeParameter(
  *
  *
  *
+ *
+ *
+ *
+ *
+ *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VSetSockOpt_KeepAliveOptions(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint8                        OptName,
-  TCPIP_P2C(uint8)             OptValPtr)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_Close(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_NOT_OK;
-
   /* ----- Implementation ----------------------------------------------- */
-  switch (OptName)
+  TCPIP_ASSERT(TCPIP_TCP_COND_VALID_TCPIDX(SocketTcpIdx));
+
+  TCPIP_VENTER_CRITICAL_SECTION();
+
+  /* #10 Proceed the socket closure dependent on the current socket state. */
+  switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
   {
-    case TCPIP_PARAMID_TCP_KEEPALIVE:
+  case TCPIP_TCP_SOCK_STATE_CLOSED:
     {
-      /* #10 Enable the keep alive feature. */
-      boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                                  /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
-      TcpIp_SetEnabledOfSocketTcpKeepAliveDyn(SocketTcpIdx, enabled);
-      retVal = E_OK;
+      /* #20 Close socket in state CLOSED */
+      /* This TCP socket was previously requested and buffers might have been assigned, but the socket is still in state
+      CLOSED. -> Release all resources assigned to this socket. */
+      TcpIp_Tcp_VReleaseAssignedBuffers(SocketTcpIdx);
+      TcpIp_SetRequestedRxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
+      TcpIp_SetRequestedTxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
+
       break;
     }
-    case TCPIP_PARAMID_TCP_KEEPALIVE_INTERVAL:
+  case TCPIP_TCP_SOCK_STATE_LISTEN:
     {
-      /* #20 Set the keep alive interval. */
-      uint32 requestedValue = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
+      /* #30 Close socket in state LISTEN */
+      /* RFC: Any outstanding RECEIVEs are returned with 'error: closing'
+      responses. Delete TCB, enter CLOSED state, and return. */
+
+      /* delete/clear TCB element */
+      TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
+      /* only server sockets can be in state 'listen' */
+      TcpIp_Tcp_VHandleListenSocketClose(SocketTcpIdx);
 
-      if (requestedValue <= TCPIP_MAX_SEC_IN_UINT32_CYCLE_VAR)
-      {
-        TcpIp_SetProbeIntervalOfSocketTcpKeepAliveDyn(SocketTcpIdx, requestedValue * TCPIP_CYCLES_PER_SECOND);
-        TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
-        retVal = E_OK;
-      }
       break;
     }
-    case TCPIP_PARAMID_TCP_KEEPALIVE_PROBES_MAX:
+  case TCPIP_TCP_SOCK_STATE_SYNRCVD:
     {
-      /* #30 Set the maximum number of keep alive probes that shall be sent. */
-      uint16 requestedValue = TCPIP_GET_UINT16_RAW(OptValPtr, 0u);
+      /* #40 Close socket in state SYNRCVD */
+
+      /* RFC: issue sending of FIN segment (eventually put this request in send queue) */
+
+      /* send FIN */
+      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN));
+
+      TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
+      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
+
+      /* Set SndNxtAfterFin to include the FIN flag */
+      TcpIp_SetSndNxtAfterFinOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx) + 1u);
 
-      TcpIp_SetProbesMaxOfSocketTcpKeepAliveDyn(SocketTcpIdx, requestedValue);
-      TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
-      retVal = E_OK;
       break;
     }
-    case TCPIP_PARAMID_TCP_KEEPALIVE_TIME:
+  case TCPIP_TCP_SOCK_STATE_SYNSENT:
     {
-      /* #40 Set the maximum time keep alive probes shall be sent before the connection will be closed. */
-      uint32 requestedValue = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
+      /* #50 Close socket in state SYNSENT */
+      /* RFC: Delete the TCB and return 'error: closing' responses to any
+      queued SENDs, or RECEIVEs. */
+
+      /* delete/clear TCB element */
+      TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
 
-      if (requestedValue <= TCPIP_MAX_SEC_IN_UINT32_CYCLE_VAR)
-      {
-        TcpIp_SetTimeoutOfSocketTcpKeepAliveDyn(SocketTcpIdx, requestedValue * TCPIP_CYCLES_PER_SECOND);
-        TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
-        retVal = E_OK;
-      }
       break;
     }
-    default:                                                                                                            /* COV_TCPIP_MISRA */
+  case TCPIP_TCP_SOCK_STATE_ESTABLISHED:
     {
-      /* Not supported value for 'OptName' used */
+      /* #60 Close socket in state ESTABLISHED */
+      /* RFC: Queue this until all preceding SENDs have been segmentized, then
+      form a FIN segment and send it. In any case, enter FIN-WAIT-1 state. */
+
+      /* send FINACK */
+      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN | TCPIP_TCP_CODE_BIT_ACK));
+
+      TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
+      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_FINWAIT1);
+
+      /* Set SetSndNxtAfterFin depending on data that has to be sent before the FIN. */
+      TcpIp_Tcp_VCalcSndNxtAfterFinInEstablished(SocketTcpIdx);
+
+      break;
+    }
+  case TCPIP_TCP_SOCK_STATE_FINWAIT1:
+  case TCPIP_TCP_SOCK_STATE_FINWAIT2:
+    {
+      /* #70 Close socket in state FINWAIT1 or FINWAIT2 */
+      /* RFC: 'error: connection closing' */
+      /* An 'ok' response would be acceptable, too, as long as a second FIN is not emitted. */
+      TcpIp_SetLastSockError(TCPIP_SOCK_ERR_10101);
+      break;
+    }
+  case TCPIP_TCP_SOCK_STATE_CLOSEWAIT:
+    {
+      /* #80 Close socket in state CLOSEWAIT */
+      /* send FIN */
+      TcpIp_Tcp_VSendFlags(SocketTcpIdx, TCPIP_TCP_CODE_BIT_FIN);
+
+      /* State TCPIP_TCP_SOCK_STATE_LASTACK will be set in TcpIp_Tcp_VTransmitSegment()
+       * if last segment with FIN is sent */
+      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_LASTACK);
+      break;
+    }
+  default:
+    {
+      /* #90 Close socket in all other states */
+      /* states: TCPIP_TCP_SOCK_STATE_CLOSING, TCPIP_TCP_SOCK_STATE_LASTACK, TCPIP_TCP_SOCK_STATE_TIMEWAIT */
+      /* RFC: 'error: connection closing' */
+      TcpIp_SetLastSockError(TCPIP_SOCK_ERR_10101);
+
+      /* ignore request silently, closing is already in progress or finished */
       break;
     }
   }
 
-  return retVal;
+  TCPIP_VLEAVE_CRITICAL_SECTION();
+
 }
-# endif
 
 
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSetSockOpt_UserTimeoutOptions
+ *  TcpIp_Tcp_Abort
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7981,320 +8190,272 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VSetSockOpt_KeepAliveOpti
  *
  *
  *
+ *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSetSockOpt_UserTimeoutOptions(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint8                        OptName,
-  TCPIP_P2C(uint8)             OptValPtr)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_Abort(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfSocketDynType socketIdx = TcpIp_GetSizeOfSocketDyn();
+
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Proceed dependent on the option name */
-  switch (OptName)
+  TCPIP_ASSERT(TCPIP_TCP_COND_VALID_TCPIDX(SocketTcpIdx));
+
+  socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+
+
+  /* send RST, delete TCB, enter CLOSED state, and return */
+
+  /* #10 Proceed the socket closure dependent on the current socket state. */
+  switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
   {
-  case TCPIP_PARAMID_V_TCP_UTOUPDATE:
+  case TCPIP_TCP_SOCK_STATE_CLOSED:
     {
-      /* #20 Set the time used for the user timeout. */
-      uint16 requestedValue = TCPIP_GET_UINT16_RAW(OptValPtr, 0u);
-
-      TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, ((((uint32) requestedValue & TCPIP_TCP_OPT_USER_TIMEOUT_VALUE_MASK)
-                                                * 1000u) / TCPIP_MAIN_FCT_PERIOD_MSEC));  /* update timeout value */
-      if ((requestedValue & TCPIP_TCP_OPT_USER_TIMEOUT_FLAG_GRANULARITY_MINUTES) != 0u)
-      {
-        /* user timeout value has granularity of minutes (60s per minute) */
-        TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, (TcpIp_GetUtoOfSocketTcpUtoDyn(SocketTcpIdx) * 60u));
-      }
-      TcpIp_SetUtoAdvOfSocketTcpUtoDyn(SocketTcpIdx, requestedValue);
-      TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, FALSE);  /* diable change by received option */
-      TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) | (TcpIp_TxOneTimeOptsOfSocketTcpDynType)TCPIP_TCP_OPT_FLAG_USER_TIMEOUT));
+      /* #20 Nothing to do for sockets already in state 'CLOSED'. */
       break;
     }
-  case TCPIP_PARAMID_V_TCP_UTOENABLED:
+  case TCPIP_TCP_SOCK_STATE_LISTEN:
     {
-      /* #30 Enable the sending of the user timeout option. */
-      boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                                  /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
-      TcpIp_SetUtoEnabledOfSocketTcpUtoDyn(SocketTcpIdx, enabled);  /* enable or disable option handling */
-      if (enabled == FALSE)
-      {
-        TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, TRUE);  /* set to default */
-      }
+      /* #30 Only server sockets can be in state 'LISTEN'. -> close not yet fully accepted connections that are related
+        to this server socket. */
+      TcpIp_Tcp_VHandleListenSocketClose(SocketTcpIdx);
       break;
     }
-  case TCPIP_PARAMID_V_TCP_UTOCHANGEABLE:
+  case TCPIP_TCP_SOCK_STATE_SYNSENT:
+  case TCPIP_TCP_SOCK_STATE_CLOSING:
+  case TCPIP_TCP_SOCK_STATE_LASTACK:
+  case TCPIP_TCP_SOCK_STATE_TIMEWAIT:
     {
-      /* #40 Enable user timeout update triggered by a received user timeout option. */
-      boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                                  /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
-      TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, enabled);  /* enable or disable timeout value update upon received timeout option */
       break;
     }
-  default:                                                                                                              /* COV_TCPIP_MISRA */
+  default:
     {
-      /* Not supported value for 'OptName' used */
+      TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
+      /* @ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                          /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
+
+      /* #40 For all other socket states send a RST. */
+      TcpIp_Tcp_VSendReset(SocketTcpIdx, txIpAddrIdx,
+        (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)),
+        (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
+      TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u);
       break;
     }
   }
+  /* #50 Close the socket and release all assigned resources. */
+
+  TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
 }
-# endif
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VCheckRecChecksum
+ *  TcpIp_Tcp_VHandleListenSocketClose
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
+ *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCheckRecChecksum(
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockLocAddrPtr,
-  TCPIP_P2C(uint8)                  DataPtr,
-  uint16                            LenByte)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleListenSocketClose(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType  retVal = E_OK;
+  TcpIp_SizeOfSocketTcpDynType localSocketTcpIdx;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Calc the TCP checksum */
-  uint16_least checksum = (uint16_least)TcpIp_VCalcPseudoHdrAndChecksum(RxSockRemAddrPtr, RxSockLocAddrPtr, DataPtr, LenByte, TCPIP_SOCK_PROT_TCP);
-
-  /* #20 Check if the calculated checksum is 0 (=OK). */
-  if (checksum == 0u)
-  {
-    /* checksum is valid -> OK */
-  }
-  else
+  /* #10 Search for all sockets that have this socket as master socket. */
+  for (localSocketTcpIdx = 0; localSocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); localSocketTcpIdx++)
   {
-    /* checksum is invalid */
-    retVal = E_NOT_OK;
-  }
+    if (TcpIp_GetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(localSocketTcpIdx) == SocketTcpIdx)                    /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+    {
+      /* #20 Close socket, if state is lower than established. */
+      if (TcpIp_GetSockStateOfSocketTcpDyn(localSocketTcpIdx) < TCPIP_TCP_SOCK_STATE_ESTABLISHED)
+      {
+        /* #30 For state SYNRCVD send RST to Client. */
+        if (TcpIp_GetSockStateOfSocketTcpDyn(localSocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD)
+        {
+          /* Send RST to client to close halfopen connection */
+          TcpIp_SocketDynIterType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(localSocketTcpIdx);
+          TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
+          /* @ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                      /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
 
-  return retVal;
+          TcpIp_Tcp_VSendReset(localSocketTcpIdx, txIpAddrIdx,
+            (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)),
+            (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
+            TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u);
+        }
+
+        /* Matching TCP sockets in state Listen can't have other sockets as master listen socket. */
+        /* For other states, no special actions are required */
+
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(localSocketTcpIdx, TCPIP_TCP_STATE_RESET);
+      }
+      /* #40 Otherwise: Just delete reference to master listen socket. */
+      else
+      {
+        /* Reset the referenced MasterListenSocketIdx since this would not be valid any more after closing this referenced listen socket. */
+        TcpIp_SetSocketTcpDynMasterListenSocketIdxOfSocketTcpDyn(localSocketTcpIdx, TCPIP_NO_SOCKETTCPDYNMASTERLISTENSOCKETIDXOFSOCKETTCPDYN);
+      }
+    }
+  }
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSendFlags
+ *  TcpIp_Tcp_VCalcSndNxtAfterFinInEstablished
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendFlags(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx,
-  uint8                      Flags)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCalcSndNxtAfterFinInEstablished(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Add the requested flags to the already previously requested ones. */
-  TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) | Flags));
-
-  TCPIP_ASSERT((Flags & TCPIP_TCP_CODE_BIT_RST) == 0u);
-
-  /* #20 Set the next send sequence number in case a SYN flag shall be sent */
-  if ((Flags & TCPIP_TCP_CODE_BIT_SYN) != 0u)
+  /* #10 Set SetSndNxtAfterFin depending on data that has to be sent before the FIN. */
+  /* Tx sequence number that follows the FIN */
+  uint32 sndNxtAfterFin = 0u;
+  TcpIp_SizeOfTcpRetryQElementType lastTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
+  if (lastTcpRetryQElementIdx != TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
   {
-    TcpIp_SetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx));
+    TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) RetryQueueElePtr = TcpIp_GetAddrTcpRetryQElement(lastTcpRetryQElementIdx);
+    /* In state ESTABLISHED the last retry queue element never contains a FIN flag. So take the elements sequence number
+    and add the element length and the not queued data length plus the FIN flag. */
+    sndNxtAfterFin = RetryQueueElePtr->SeqNo + RetryQueueElePtr->SizeTotByte
+                     + TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + 1u;
   }
-
-
-  /* #30 Reset the nagle timeout, if nagle algorithm (with timeout) is enabled and one of the flags FIN, SYN or ACK is set. */
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
-  if (    (TcpIp_IsEnabledOfSocketTcpNagleDyn(SocketTcpIdx) == TRUE)
-      && ((TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & TCPIP_TCP_CODE_BIT_MASK_FSA) != 0u))                          /* PRQA S 3415 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+  else
   {
-    TcpIp_SetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx, 0);
+    /* there is no retry queue element for this socket */
+    /* add not queued len + FIN to SndNxt */
+    sndNxtAfterFin =   TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx)
+      + TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + 1u;
   }
-# endif
+
+  TcpIp_SetSndNxtAfterFinOfSocketTcpDyn(SocketTcpIdx, sndNxtAfterFin);
 }
 
+
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSendReset
+ *  TcpIp_Tcp_ResetSocket
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
  */
-/* PRQA S 6050, 6060 1 */ /* MD_MSR_STCAL, MD_MSR_STPAR */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendReset(
-  TcpIp_SocketTcpDynIterType        SocketTcpIdx,
-  TcpIp_LocalAddrIterType           IpAddrIdx,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RemSockPtr,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) LocSockPtr,
-  uint32                            SeqNo,
-  uint32                            AckNo,
-  uint8                             Flags)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_ResetSocket(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  /* Get the current AppId before we enter the critical section */
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-  TcpIp_OsApplicationType applId = GetApplicationID();
-# else
-  TcpIp_OsApplicationType applId = TCPIP_SINGLECORE_APPLID;
-# endif
-  TcpIp_TcpRstHandlingIterType tcpRstHandlingIdx = TcpIp_GetSizeOfTcpRstHandlingDyn();
+  TcpIp_SocketDynIterType           socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  TcpIp_OsApplicationType applId = TcpIp_Tcp_GetApplIdOfSocket(SocketTcpIdx);
+  TcpIp_TcpRstHandlingIterType tcpRstHandlingIdx = TcpIp_Tcp_GetRstHandlingOfApplId(applId);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Delete the tx request for this socket if it is not in state LISTEN. */
-  if (SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn())
+  /* #10 Mark all reset queue elements related to the given socket as 'invalid'. */
+  if(tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandlingDyn())
   {
-    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)
+    TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+    if (0u < TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx))
     {
-      /* - reset length to send */
-      TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
+      TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
 
-      if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_SYNRCVD)
+      for (rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
+        rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
+        rstTxQueueBufferIdx++)
       {
-        TcpIp_SetRcvNxtOfSocketTcpDyn(SocketTcpIdx, AckNo);
-      }
-      TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
-    }
-  }
-
-
-  tcpRstHandlingIdx = TcpIp_Tcp_GetRstHandlingOfApplId(applId);
-  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-  /* #20 Add an element to the reset queue if the queue is not already full. */
-  if (   (TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx) < TCPIP_TCP_RESET_CORE_SIZE)
-      && (tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandlingDyn()))
-  {
-    /* #30 Find free buffer item. */
-    TCPIP_P2V(TcpIp_Tcp_RstTxQueueType) tcpResetQElementPtr = NULL_PTR;
-    TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
-
-    for(rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
-      rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
-      rstTxQueueBufferIdx++)
-    {
-      tcpResetQElementPtr = TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx);
+        TCPIP_P2V(TcpIp_Tcp_RstTxQueueType) rstQueuePtr = TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx);
 
-      if (tcpResetQElementPtr->RemSock.sa_family == IPBASE_AF_UNSPEC)
-      {
-        break;
+        /* Remove reset element from the queue. */
+        if (TcpIp_VSockAddrIpAndPortIsEqual(&rstQueuePtr->LocSock, TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)) == TRUE)
+        {
+          rstQueuePtr->RemSock.sa_family = IPBASE_AF_UNSPEC;
+          TcpIp_DecRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx);
+        }
       }
     }
+    TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
+  }
 
-    if (   (rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx))
-        && (tcpResetQElementPtr != NULL_PTR))
-    {
-      /*@ assert tcpResetQElementPtr == TcpIp_GetAddrRstTxQueueBuffer($range(0, TcpIp_GetSizeOfRstTxQueueBuffer() - 1)); */ /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RESETQELE_IDX */
+  TCPIP_ASSERT(TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED);
 
-      tcpResetQElementPtr->SeqNo = SeqNo;
-      tcpResetQElementPtr->AckNo = AckNo;
-      tcpResetQElementPtr->Flags = Flags;
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-    /* Store the AppId in case of multicore use-case to identify the core */
-      tcpResetQElementPtr->ApplId = applId;
-# endif
-      tcpResetQElementPtr->IpAddrIdx = (uint8)IpAddrIdx;
-      (void)IpBase_CopySockAddr(&tcpResetQElementPtr->LocSock.SockAddr, &LocSockPtr->SockAddr);                         /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
-      (void)IpBase_CopySockAddr(&tcpResetQElementPtr->RemSock.SockAddr, &RemSockPtr->SockAddr);                         /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
 
-# if (TCPIP_SUPPORT_IPSEC == STD_ON)
-      if (TCPIP_LOCAL_ADDR_IDX_IS_IPV4(IpAddrIdx))
-      {
-        /* Update the local socket address information in Tcp Reset socket, if it is Ipv4 */
-        (void)IpV4_Ip_GetLocNetAddr(IpAddrIdx, &(TcpIp_GetAddrLocSockOfIpV4SocketDyn(TcpIp_GetIpV4SocketDynTcpRstIdxOfIpV4General(TCPIP_IPV4GENERAL_IDX))->SockAddrIn.sin_addr));
-        TcpIp_GetAddrLocSockOfIpV4SocketDyn(TcpIp_GetIpV4SocketDynTcpRstIdxOfIpV4General(TCPIP_IPV4GENERAL_IDX))->SockAddrIn.sin_port = LocSockPtr->SockAddrIn.sin_port;
-      }
-# endif
-      TcpIp_IncRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx);
-    }
-  }
-  else
-  {
-    /* queue is too short, or there is a problem with sending the elements */
-    /* do nothing but ignore this request */
-  }
-  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
+  /* #20 Close the socket and release all assigned resources */
+  TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VFinalizeTxSegment
+ *  TcpIp_Tcp_VReleaseAssignedBuffers
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VReleaseAssignedBuffers(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  /* Accumulated DataLenByte may not exceed max payload length (minus TCP header length) of lower layer !! */
-  /* TCP flags that shall be set in this segment. */
-  uint8          segmentFlags = 0u;
-  Std_ReturnType retVal = E_OK;
+  TcpIp_TcpRxBufferDescIterType tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  TcpIp_TcpTxBufferDescIterType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Defer sending a FIN flag if pending TX data exceeds size of this segment. FIN flag must be set in last segment
-  containing data. */
-  if (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) > TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx))
-  {
-    segmentFlags = (uint8)(TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & ~TCPIP_TCP_CODE_BIT_FIN);
-  }
-  else
+  /* #10 Release RX buffer */
+  if (tcpRxBufferDescIdx < TcpIp_GetSizeOfTcpRxBufferDesc())
   {
-    segmentFlags = TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx);
-  }
+    TCPIP_ASSERT(SocketTcpIdx == TcpIp_GetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx));
 
-  TCPIP_ASSERT_MSG(TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) <= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx), "segmenting is currently not supported."); /* this should never happen, this case is filtered in earlier steps */
+    TcpIp_SetFillLevelOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, 0);
+    TcpIp_SetTcpRxBufferWriteIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, TcpIp_GetTcpRxBufferStartIdxOfTcpRxBufferDesc(tcpRxBufferDescIdx));
 
-  /* #20 Set flags and trigger the KeepAlive mechanism if there is something to send. */
-  if (   (segmentFlags == 0u)                                                                                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == 0u))
-  {
-    /* neither data nor flags to send -> do nothing.
-     * ACK-only segments will be sent later if required and are not managed in the retry queue.
-     */
-    /* return E_OK */
+    TcpIp_SetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, TcpIp_GetSizeOfSocketTcpDyn());  /* invalid socket index */
+    TcpIp_SetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSizeOfTcpRxBufferDesc());  /* invalid buffer index */
   }
   else
   {
+    TCPIP_ASSERT(tcpRxBufferDescIdx == TcpIp_GetSizeOfTcpRxBufferDesc());
+  }
 
-    retVal = TcpIp_Tcp_VFinalizeTxSegment_SetFlagsAndKeepAlive(SocketTcpIdx, &segmentFlags);
+  /* #20 Release TX buffer */
+  if (tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc())  /* valid buffer index */
+  {
+    TCPIP_ASSERT(SocketTcpIdx == TcpIp_GetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx));
 
-    if (retVal == E_OK)
-    {
-      TCPIP_VENTER_CRITICAL_SECTION();
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+    TcpIp_Tcp_VTxDataRefRelease((TcpIp_SizeOfSocketTcpDynType)SocketTcpIdx, TRUE);
+# endif
 
-      /* #30 If data is available for sending, create a new tx element and trigger sending. */
-      if (   (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == 0u)
-          && (segmentFlags == TCPIP_TCP_CODE_BIT_ACK))
-      {
-        /* Only ACK segment shall be sent. This will be done at end of TcpIp_Tcp_VTransmit(). */
-      }
-      else
-      {
-        TcpIp_Tcp_TxRetrQueueType *newRetryQElementPtr;
+    TcpIp_SetFillLevelOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, 0);
+    TcpIp_SetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
+    /* no read position required for TX buffer */
 
-        /* Create new retry queue element and append it the queue. */
-        TcpIp_Tcp_VFinalizeTxSegment_CreateRetryQElement(SocketTcpIdx, &newRetryQElementPtr, segmentFlags);
+    TcpIp_SetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, TcpIp_GetSizeOfSocketTcpDyn());  /* invalid socket index */
+    TcpIp_SetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSizeOfTcpTxBufferDesc());        /* invalid buffer index */
 
-        /* Queue data for sending (mark data to be queued and reduce length of not queued data)  */
-        TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSending(SocketTcpIdx, newRetryQElementPtr, segmentFlags);
-      }
-      TCPIP_VLEAVE_CRITICAL_SECTION();
-    }
+    /* no assigned buffer variable */
+  }
+  else
+  {
+    TCPIP_ASSERT(tcpTxBufferDescIdx == TcpIp_GetSizeOfTcpTxBufferDesc());
   }
 
-  return retVal;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VFinalizeTxSegment_SetFlagsAndKeepAlive
+ *  TcpIp_Tcp_VAssignRxBuffer
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8302,56 +8463,65 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment(
  *
  *
  *
- *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_SetFlagsAndKeepAlive(
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignRxBuffer(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(uint8) SegmentFlagsPtr)
+  uint32                       RequestedBufferSize)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_OK;
+  Std_ReturnType retVal = E_NOT_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-  if ((*SegmentFlagsPtr & TCPIP_TCP_CODE_BIT_RST) != 0u)
-  {
-    /* #10 If a reset is issued, RST shall be the only flag that is sent. */
-    *SegmentFlagsPtr = TCPIP_TCP_CODE_BIT_RST;
-    TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
-  }
-  else if (   (*SegmentFlagsPtr != TCPIP_TCP_CODE_BIT_SYN)                                                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-           && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED))
-  {
-    /* #20 An ACK flag is required in every segment except for SYN. */
-    *SegmentFlagsPtr |= TCPIP_TCP_CODE_BIT_ACK;
-  }
-  else
+  /* #10 Check if there is already a buffer assigned to this socket. */
+  if (TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) >= TcpIp_GetSizeOfTcpRxBufferDesc())
   {
-    /* nothing to do */
-  }
+    TCPIP_ASSERT(TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) == TcpIp_GetSizeOfTcpRxBufferDesc());
 
-  /* #30 If no free retry queue elements are available the function returns with an error. */
-  if (TcpIp_Tcp_NumFreeRetryQEle == 0u)
-  {
-    retVal = E_NOT_OK;
+    /* #20 Check that the socket is in state CLOSED. */
+    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)
+    {
+      TcpIp_TcpRxBufferDescIterType tcpRxBufferDescIdx;
+
+      TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();     /* lock cross core interrupts */
+
+      /* #30 Choose a matching rx buffer and assign it to the socket. */
+      for (tcpRxBufferDescIdx = 0; tcpRxBufferDescIdx < TcpIp_GetSizeOfTcpRxBufferDesc(); tcpRxBufferDescIdx++)
+      {
+        if (   (TcpIp_GetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx) == TcpIp_GetSizeOfSocketTcpDyn())      /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+            && (RequestedBufferSize == TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx)))
+        {
+          /* found a free and matching buffer */
+          /* the buffer size is never '0', this is assuerd by the configuration */
+          TcpIp_SetSocketTcpDynIdxOfTcpRxBufferDescDyn(tcpRxBufferDescIdx, SocketTcpIdx);
+          TcpIp_SetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, (TcpIp_SizeOfTcpRxBufferDescType)tcpRxBufferDescIdx);
+
+          TcpIp_SetRcvWndOfSocketTcpDyn(SocketTcpIdx, (uint16)RequestedBufferSize);
+
+          retVal = E_OK;
+          break;  /* stop the for-loop */
+        }
+      }
+
+      TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();     /* unlock cross core interrupts */
+    }
+    else
+    {
+      /* buffer may only be assigned in state 'Closed' */
+      /* -> nothing to do, return value already is negative */
+    }
   }
   else
   {
-    /* since we only need one RetrQueue element, we can proceed this request */
-
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-  /* #40 Trigger the keep alive timer to be reset. */
-    TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
-# endif
+    /* a buffer is already assigned, an updated assignment is not supported -> E_NOT_OK */
   }
-  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
 
   return retVal;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VFinalizeTxSegment_CreateRetryQElement
+ *  TcpIp_Tcp_VAssignTxBuffer
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8361,175 +8531,171 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_SetFla
  *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_CreateRetryQElement(
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VAssignTxBuffer(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueTypeP2V) AddedRetryQElementPtr,
-  uint8 SegmentFlags)
+  uint32                       RequestedBufferSize)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfTcpRetryQElementType newTcpRetryQElementIdx = TcpIp_Tcp_FirstFreeRetrQueueEle;
-  TcpIp_SizeOfTcpRetryQElementType lastTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
-  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) newRetryQElementPtr = NULL_PTR;
+  Std_ReturnType retVal = E_NOT_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Take the first element from the free-list. */
-  TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
-
-  /*@ assert newTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                             /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-  newRetryQElementPtr     = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx);
-  *AddedRetryQElementPtr  = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx);
-  if (TcpIp_Tcp_NumFreeRetryQEle > 1u)
-  {
-    TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx = newRetryQElementPtr->EleNext;
-    /*@ assert tcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                              /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-
-    TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    TcpIp_Tcp_FirstFreeRetrQueueEle = tcpRetryQElementIdx;
-  }
-  else
+  /* #10 Check if there is already a buffer assigned to this socket. */
+  if (TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) == TcpIp_GetSizeOfTcpTxBufferDesc())
   {
-    TcpIp_Tcp_FirstFreeRetrQueueEle = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    TcpIp_Tcp_LastFreeRetrQueueEle  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-  }
-  TcpIp_Tcp_NumFreeRetryQEle--;
-
-  TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+    /* #20 Check that the socket is in state CLOSED. */
+    if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_ESTABLISHED))
+    {
+      /* The buffer is not yet assigned to a socket */
+      TcpIp_TcpTxBufferDescIterType  tcpTxBufferDescIdx;
 
-  /* #20 Append the (free) element to the sockets RetryQueue. */
-  if (lastTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement())
-  {
-    /* there already is a retry list for this socket */
-    TcpIp_GetAddrTcpRetryQElement(lastTcpRetryQElementIdx)->EleNext = newTcpRetryQElementIdx;
-    newRetryQElementPtr->ElePrev           = lastTcpRetryQElementIdx;
-    newRetryQElementPtr->EleNext           = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    newRetryQElementPtr->SocketTcpIdx      = SocketTcpIdx;
-    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx,  newTcpRetryQElementIdx);
-  }
-  else
-  {
-    /* there is no retry list for this socket, yet */
-    newRetryQElementPtr->ElePrev           = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    newRetryQElementPtr->EleNext           = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    newRetryQElementPtr->SocketTcpIdx      = SocketTcpIdx;
-    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, newTcpRetryQElementIdx);
-    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx, newTcpRetryQElementIdx);
-  }
 
-  /* #30 Set further struct elements of the RetryQElement */
-  newRetryQElementPtr->SeqNo               = TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
-  newRetryQElementPtr->Flags               = SegmentFlags;
+      TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();     /* lock cross core interrupts */
 
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-  newRetryQElementPtr->UserTimeoutTs       = TcpIp_Tcp_GlobalTimestamp + TcpIp_GetUtoOfSocketTcpUtoDyn(SocketTcpIdx);
-# else
-  newRetryQElementPtr->UserTimeoutTs       = TcpIp_Tcp_GlobalTimestamp + TcpIp_GetUserTimeoutDefCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX);
+      /* #30 Choose a matching tx buffer and assign it to the socket. */
+      for (tcpTxBufferDescIdx = 0; tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); tcpTxBufferDescIdx++)
+      {
+        if (   (TcpIp_GetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx) == TcpIp_GetSizeOfSocketTcpDyn())  /* invalid socket idx */ /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+            && (RequestedBufferSize == TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx)))
+        {
+          /* found a free and matching buffer */
+          /* the buffer size is never '0', this is assuerd by the configuration */
+          TcpIp_SetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, SocketTcpIdx);
+          TcpIp_SetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx, (TcpIp_SizeOfTcpTxBufferDescType)tcpTxBufferDescIdx);
+          TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+          TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx));  /* init to tx buffer size */
 # endif
+          retVal = E_OK;
+          break;  /* stop the for-loop */
+        }
+      }
 
-# if ((TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) || (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON))
-  /* Only two types of one time options are supported -
-   * - User timeout
-   * - Selective acknowledgment
-   */
-  if (   (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) != 0u)                                                     /* PRQA S 3415 5 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) <=
-         ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx) - (uint32) TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx))))
-  {
-    newRetryQElementPtr->OneTimeOptions    = TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx);
-    newRetryQElementPtr->OneTimeOptionsLen = TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx);
-    TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx, 0);  /* clear global flags and len */
-    TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, 0);
+      TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();     /* unlock cross core interrupts */
+    }
   }
   else
-# endif
   {
-    newRetryQElementPtr->OneTimeOptions    = 0;
-    newRetryQElementPtr->OneTimeOptionsLen = 0;
+    /* a buffer is already assigned, an updated assignment is not supported -> E_NOT_OK */
   }
 
-  newRetryQElementPtr->TransmitCounter     = 0;
-  newRetryQElementPtr->TimeStamp           = TcpIp_Tcp_GlobalTimestamp;
-  newRetryQElementPtr->SizeTotByte         = TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx);
-
-  newRetryQElementPtr->SackFlag            = 0;
-  /* The struct element newRetryQElementPtr->DataBufStartIdx does not have to be set since it is set in a subsequent function. */
-
+  return retVal;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSending
+ *  TcpIp_Tcp_ChangeParameter
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSending(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) NewRetryQElementPtr,
-  uint8 SegmentFlags)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_ChangeParameter(
+  TcpIp_SizeOfSocketDynType    SocketIdx,
+  uint8                        OptName,
+  TCPIP_P2C(uint8)             OptValPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfTcpTxBufferType unqueuedReqDataSize = 0u;
-
-  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-  /*@ assert tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); */                                                  /* VCA_TCPIP_VALID_BUFFERIDX_LOCAL */
+  Std_ReturnType retVal = E_NOT_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc());
-  TCPIP_ASSERT(TcpIp_GetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx) == SocketTcpIdx);
-  TCPIP_ASSERT(TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx) > 0u);
+  TCPIP_ASSERT(SocketIdx < TcpIp_GetSizeOfSocketDyn());
 
-  /* #10 Advance the buffer start index (taking care of wraparound). */
-  NewRetryQElementPtr->DataBufStartIdx = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx,
-    TcpIp_GetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx), TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx));
+  /* #10 Set the chosen socket option if socket is a TCP-socket */
 
-  /* #20 Inc the queued len of the requested data. */
-  unqueuedReqDataSize = (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) - TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx));
+  if (TCPIP_SOCKET_IDX_IS_TCP(SocketIdx))
+  {
+    TcpIp_SizeOfSocketTcpDynType socketTcpIdx = TCPIP_SOCKET_IDX_TO_TCP_IDX(SocketIdx);
+    switch (OptName)
+    {
+      case TCPIP_PARAMID_TCP_RXWND_MAX:
+      {
+        uint32 requestedBufferSize = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
+        retVal = TcpIp_Tcp_VAssignRxBuffer(socketTcpIdx, requestedBufferSize);
+        break;
+      }
 
-  TCPIP_ASSERT(TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)       <= unqueuedReqDataSize);
-  TCPIP_ASSERT(TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) == unqueuedReqDataSize);
+      case TCPIP_PARAMID_V_TCP_TXBUFSIZE:
+      {
+        uint32 requestedBufferSize = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
+        retVal = TcpIp_Tcp_VAssignTxBuffer(socketTcpIdx, requestedBufferSize);
+        break;
+      }
 
-  if (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == unqueuedReqDataSize)
-  {
-    TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, TRUE);
-  }
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
+      case TCPIP_PARAMID_TCP_NAGLE:
+      {
+        if (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)
+        {
+          boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                              /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
+          TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
+          TcpIp_SetEnabledOfSocketTcpNagleDyn(socketTcpIdx, enabled);
+          retVal = E_OK;
+        }
+        break;
+      }
+# endif
 
-  TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx,
-    (TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)));
-  TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx,
-    (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) - TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)));
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+      case TCPIP_PARAMID_TCP_KEEPALIVE:
+      case TCPIP_PARAMID_TCP_KEEPALIVE_INTERVAL:
+      case TCPIP_PARAMID_TCP_KEEPALIVE_PROBES_MAX:
+      case TCPIP_PARAMID_TCP_KEEPALIVE_TIME:
+      {
+        retVal = TcpIp_Tcp_VSetSockOpt_KeepAliveOptions(socketTcpIdx, OptName, OptValPtr);
+        break;
+      }
+# endif
 
-  TcpIp_IncRetryQFillNumOfSocketTcpDyn(SocketTcpIdx);
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+      case TCPIP_PARAMID_V_TCP_UTOUPDATE:
+      case TCPIP_PARAMID_V_TCP_UTOENABLED:
+      case TCPIP_PARAMID_V_TCP_UTOCHANGEABLE:
+      {
+        TcpIp_Tcp_VSetSockOpt_UserTimeoutOptions(socketTcpIdx, OptName, OptValPtr);
+        retVal = E_OK;
+        break;
+      }
+# endif /* (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) */
 
-  /* #30 Update TxNextSendSeqNo and reset flags and tx length. */
-  TcpIp_SetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx,
-    (TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)));
+      case TCPIP_PARAMID_TCP_MSL:
+      {
+        retVal = TcpIp_Tcp_SetMsl(socketTcpIdx, OptValPtr);
+        break;
+      }
 
-  if ((TCPIP_TCP_CODE_BIT_SYN & SegmentFlags) != 0u)
-  {
-    TcpIp_IncTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
-  }
+      case TCPIP_PARAMID_TCP_RETRANSMIT_TIMEOUT:
+      {
+        retVal = TcpIp_Tcp_SetRetransmissionTimeout(socketTcpIdx, OptValPtr);
+        break;
+      }
 
-  if ((TCPIP_TCP_CODE_BIT_FIN & SegmentFlags) != 0u)
-  {
-    TcpIp_IncTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
-  }
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+      case TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM:
+      case TCPIP_PARAMID_V_TCP_PACING:
+      {
+        retVal = TcpIp_Tcp_VCongCtrlExtSetParameter(socketTcpIdx, OptName, OptValPtr);
+        break;
+      }
+# endif
 
-  /* #40 Clear pending flags if they were set in this segment. The ACK flag will be handled later in VTransmit(). */
-  TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx,
-    (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & (uint8)~(SegmentFlags & ~TCPIP_TCP_CODE_BIT_ACK)));
+      default:
+      {
+        /* Unknown TCP socket option. Do nothing, return E_NOT_OK */
+      }
+      break;
+    }
+  }
 
-  TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
+  return retVal;
 }
 
 
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment
+ *  TcpIp_Tcp_SetSockOpt_VKeepAliveOptions
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8538,90 +8704,77 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSend
  *
  *
  *
- *
- *
  */
-/* PRQA S 6060 1 */ /* MD_MSR_STPAR */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment(
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VSetSockOpt_KeepAliveOptions(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint8                        Flags,
-  uint32                       SeqNo,
-  uint8                        OneTimeOptions,
-  TcpIp_SizeOfTcpTxBufferType  DataStartIdx,
-  TcpIp_SizeOfTcpTxBufferType  DataLenByte)
+  uint8                        OptName,
+  TCPIP_P2C(uint8)             OptValPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType                   retValue = E_NOT_OK;
-  uint8                            headerLenByte = 0u;
-  /* Init the variable 'sackNum' to prevent MISRA checkers to issue the warning message 3353. The variable will always be set to a valid value before it is used */
-  uint8                            sackNum = 0;  /* number of SACK elements to be sent */
-  uint16                           ipPayloadLen = 0u;
-  TcpIp_IpTxRequestDescriptorType  ipTxReqestDescr;
-  uint8                           *ipPayloadPtr;
-  TcpIp_SizeOfTcpTxBufferType      dataLenByteLocal = DataLenByte;
+  Std_ReturnType retVal = E_NOT_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Calculate TCP header length (based on required options). */
-  TcpIp_Tcp_VTransmitSegment_CalcHeaderLen(SocketTcpIdx, Flags, OneTimeOptions, &sackNum, &headerLenByte);
-
-  ipPayloadLen = (uint16)dataLenByteLocal + headerLenByte;
-  ipTxReqestDescr.TmpChecksum = 0;
-
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-  CANOE_WRITE_STRING_3("TcpIp_Tcp_VTransmitSegment: SocketTcpIdx %d: TcpIp_Tcp_Cwnd is now %d, call IP ProvTxBuffer with length %d", SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx), ipPayloadLen);
-# endif
-
-
-  /* #20 Request a tx buffer from IP */
-  retValue = TcpIp_Tcp_VTransmitSegment_RequestIpTxBuffer(SocketTcpIdx, &ipTxReqestDescr, &ipPayloadLen, &ipPayloadPtr);
-
-  if (retValue == E_OK)
+  switch (OptName)
   {
-    /*@ assert $external(ipPayloadPtr) && $lengthOf(ipPayloadPtr) >= ipPayloadLen; */                                   /* VCA_TCPIP_IP_BUFFER_PTR */
-
-    /* #30 Copy TCP payload to the ip buffer. */
-    TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuffer(SocketTcpIdx, &ipTxReqestDescr, DataStartIdx, dataLenByteLocal,     /* VCA_TCPIP_IP_BUFFER_PTR */
-                                                    ipPayloadPtr, headerLenByte);
-
-    /* #40 Write the TCP header elements. */
-    TcpIp_Tcp_VTransmitSegment_WriteHeaderElements(SocketTcpIdx, ipPayloadPtr, dataLenByteLocal, SeqNo, Flags);         /* VCA_TCPIP_IP_BUFFER_PTR */
-
-    /* #50 write the TCP header options. */
-    TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions(SocketTcpIdx, ipPayloadPtr, OneTimeOptions, sackNum, Flags);          /* VCA_TCPIP_IP_BUFFER_PTR */
-
-    dataLenByteLocal  += headerLenByte;
-  /* If checksum shall be calculated partial, add the TCP header */
-    if (ipTxReqestDescr.ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
+    case TCPIP_PARAMID_TCP_KEEPALIVE:
     {
-      ipTxReqestDescr.TmpChecksum = IpBase_TcpIpChecksumAdd(&ipPayloadPtr[0], headerLenByte,
-        ipTxReqestDescr.TmpChecksum, FALSE);
+      /* #10 Enable the keep alive feature. */
+      boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                                  /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
+      TcpIp_SetEnabledOfSocketTcpKeepAliveDyn(SocketTcpIdx, enabled);
+      retVal = E_OK;
+      break;
     }
-    /* else: checksum will be calculated by lower layer, value is already set to '0' */
-
-    TCPIP_ASSERT(TcpIp_GetAddrRemSockOfSocketDyn(TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx))->sa_family == ipTxReqestDescr.AddressFamily);
+    case TCPIP_PARAMID_TCP_KEEPALIVE_INTERVAL:
+    {
+      /* #20 Set the keep alive interval. */
+      uint32 requestedValue = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
 
-    /* #60 Transmit the segment. */
-    retValue = TcpIp_VIpTransmit(&ipTxReqestDescr, (uint16)dataLenByteLocal, TCPIP_PROTOCOL_TCP, 0u, 0u);
+      if (requestedValue <= TCPIP_MAX_SEC_IN_UINT32_CYCLE_VAR)
+      {
+        TcpIp_SetProbeIntervalOfSocketTcpKeepAliveDyn(SocketTcpIdx, requestedValue * TCPIP_CYCLES_PER_SECOND);
+        TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
+        retVal = E_OK;
+      }
+      break;
+    }
+    case TCPIP_PARAMID_TCP_KEEPALIVE_PROBES_MAX:
+    {
+      /* #30 Set the maximum number of keep alive probes that shall be sent. */
+      uint16 requestedValue = TCPIP_GET_UINT16_RAW(OptValPtr, 0u);
 
-    if (retValue == E_OK)
+      TcpIp_SetProbesMaxOfSocketTcpKeepAliveDyn(SocketTcpIdx, requestedValue);
+      TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
+      retVal = E_OK;
+      break;
+    }
+    case TCPIP_PARAMID_TCP_KEEPALIVE_TIME:
     {
-      /* If FIN was received state is TCPIP_TCP_SOCK_STATE_CLOSEWAIT.
-       * Switch to new state TCPIP_TCP_SOCK_STATE_LASTACK if we have send FIN with the last segment. */
-      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT)                         /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-          && (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_LASTACK)
-          && ((Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u))
+      /* #40 Set the maximum time keep alive probes shall be sent before the connection will be closed. */
+      uint32 requestedValue = TCPIP_GET_UINT32_RAW(OptValPtr, 0u);
+
+      if (requestedValue <= TCPIP_MAX_SEC_IN_UINT32_CYCLE_VAR)
       {
-        TcpIp_SetSockStateOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_LASTACK);
+        TcpIp_SetTimeoutOfSocketTcpKeepAliveDyn(SocketTcpIdx, requestedValue * TCPIP_CYCLES_PER_SECOND);
+        TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
+        retVal = E_OK;
       }
+      break;
+    }
+    default:                                                                                                            /* COV_TCPIP_MISRA */
+    {
+      /* Not supported value for 'OptName' used */
+      break;
     }
   }
 
-  return retValue;
+  return retVal;
 }
+# endif
 
 
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment_CalcHeaderLen
+ *  TcpIp_Tcp_VSetSockOpt_UserTimeoutOptions
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8630,357 +8783,320 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment(
  *
  *
  *
- *
- *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_CalcHeaderLen(
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSetSockOpt_UserTimeoutOptions(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint8            Flags,
-  uint8            OneTimeOptions,
-  TCPIP_P2V(uint8) SackNumPtr,
-  TCPIP_P2V(uint8) HeaderLenBytePtr
- )
+  uint8                        OptName,
+  TCPIP_P2C(uint8)             OptValPtr)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  uint8 headerLenByte = 0u;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* Init this variable 'sackNum' to prevent MISRA checkers to issue the warning message 3353. The variable will always be set to a valid value before it is used */
-  *SackNumPtr = 0;  /* number of SACK elements to be sent */
-
-# if ((TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_OFF)    && (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_OFF))
-  TCPIP_DUMMY_STATEMENT_CONST(SocketTcpIdx);                                                                            /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
-# if ((TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_OFF) && (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_OFF))
-  TCPIP_DUMMY_STATEMENT_CONST(OneTimeOptions);                                                                          /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
-
-  /* #10 Calculate TCP header length. */
-  headerLenByte = TCPIP_TCP_HDR_LEN_BYTE;
-  if ((TCPIP_TCP_CODE_BIT_SYN & Flags) != 0u)
-  {
-    /* #20 For segment containing the SYN flag, add the length for the option 'max segment size'. */
-    headerLenByte += TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE;
-  }
-
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-  if (   (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)                                          /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT))
-  {
-    /* #30 If the timestamp option is enabled for this socket, add the length for the option 'timestamp'. */
-    headerLenByte += (TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u);
-  }
-# endif
-
-  /* #40 Add the length of options only sent in this segment if available. */
-  /* Only two types of one time options are supported -
-   * - User timeout
-   * - Selective acknowledgment
-   */
-  /* there are additional options to send -> additional length */
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_USER_TIMEOUT) != 0u)
-  {
-    /* #50 Add the length for the option 'user timeout'. */
-    headerLenByte += TCPIP_TCP_OPT_LEN_USER_TIMEOUT;
-  }
-# endif
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  /* only allowed in the SYN messages */
-  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_SACK_PERMIT) != 0u)
-  {
-    /* #60 Add the length for the option 'selective acknowledgment permit'. */
-    headerLenByte += (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u);  /* including 2x NOP */
-  }
-# endif
-
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  /* #70 Add the length for the option 'selective acknowledgment'. */
-  if (   (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 0u)                                                  /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_IsSackOptActiveOfSocketTcpDyn(SocketTcpIdx) == TRUE))
+  /* #10 Proceed dependent on the option name */
+  switch (OptName)
   {
-    uint8 headerRemaining = 0u;
-    uint8 sackNumMax      = 0u;
-    uint8 oooNum          = TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
-    headerLenByte        += 4u;  /* 2* NOP + kind + len */
-    headerRemaining       = (uint8)(TCPIP_TCP_HDR_LEN_MAX_BYTE - headerLenByte);
-    sackNumMax            = headerRemaining / TCPIP_TCP_SACK_ELEMENT_LEN;
+  case TCPIP_PARAMID_V_TCP_UTOUPDATE:
+    {
+      /* #20 Set the time used for the user timeout. */
+      uint16 requestedValue = TCPIP_GET_UINT16_RAW(OptValPtr, 0u);
 
-    /* set currently number of used SACK elements */
-    if (sackNumMax >= oooNum)
+      TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, ((((uint32) requestedValue & TCPIP_TCP_OPT_USER_TIMEOUT_VALUE_MASK)
+                                                * 1000u) / TCPIP_MAIN_FCT_PERIOD_MSEC));  /* update timeout value */
+      if ((requestedValue & TCPIP_TCP_OPT_USER_TIMEOUT_FLAG_GRANULARITY_MINUTES) != 0u)
+      {
+        /* user timeout value has granularity of minutes (60s per minute) */
+        TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, (TcpIp_GetUtoOfSocketTcpUtoDyn(SocketTcpIdx) * 60u));
+      }
+      TcpIp_SetUtoAdvOfSocketTcpUtoDyn(SocketTcpIdx, requestedValue);
+      TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, FALSE);  /* diable change by received option */
+      TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) | (TcpIp_TxOneTimeOptsOfSocketTcpDynType)TCPIP_TCP_OPT_FLAG_USER_TIMEOUT));
+      break;
+    }
+  case TCPIP_PARAMID_V_TCP_UTOENABLED:
     {
-      *SackNumPtr = oooNum;
+      /* #30 Enable the sending of the user timeout option. */
+      boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                                  /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
+      TcpIp_SetUtoEnabledOfSocketTcpUtoDyn(SocketTcpIdx, enabled);  /* enable or disable option handling */
+      if (enabled == FALSE)
+      {
+        TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, TRUE);  /* set to default */
+      }
+      break;
     }
-    else
+  case TCPIP_PARAMID_V_TCP_UTOCHANGEABLE:
     {
-      *SackNumPtr = sackNumMax;
+      /* #40 Enable user timeout update triggered by a received user timeout option. */
+      boolean enabled = (boolean)(OptValPtr[0] == 1u);                                                                  /* PRQA S 4304 */ /* MD_MSR_AutosarBoolean */
+      TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, enabled);  /* enable or disable timeout value update upon received timeout option */
+      break;
+    }
+  default:                                                                                                              /* COV_TCPIP_MISRA */
+    {
+      /* Not supported value for 'OptName' used */
+      break;
     }
-
-    headerLenByte += (uint8)(*SackNumPtr * TCPIP_TCP_SACK_ELEMENT_LEN);  /* SACK elements */
   }
-# endif
-
-  *HeaderLenBytePtr = headerLenByte;
 }
+# endif
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment_RequestIpTxBuffer
+ *  TcpIp_Tcp_VCheckRecChecksum
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_RequestIpTxBuffer(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(TcpIp_IpTxRequestDescriptorType) IpTxReqestDescrPtr,
-  TCPIP_P2V(uint16) TgtLenPtr,
-  TCPIP_P2V(TcpIp_Uint8P2V) PayloadPtr)
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCheckRecChecksum(
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockLocAddrPtr,
+  TCPIP_P2C(uint8)                  DataPtr,
+  uint16                            LenByte)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal = E_OK;
-  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  Std_ReturnType  retVal = E_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check which IP version is used. */
-# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
-#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
-  if (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->sa_family == IPBASE_AF_INET)
-#  endif
-  {
-    /* #20 Request a buffer from IpV4. */
-    TcpIp_LocalAddrV4IterType ipV4AddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
-    /*@ assert ipV4AddrIdx < TcpIp_GetSizeOfLocalAddrV4(); */                                                           /* VCA_TCPIP_TX_IPAADR_IDX */
+  /* #10 Calc the TCP checksum */
+  uint16_least checksum = (uint16_least)TcpIp_VCalcPseudoHdrAndChecksum(RxSockRemAddrPtr, RxSockLocAddrPtr, DataPtr, LenByte, TCPIP_SOCK_PROT_TCP);
 
-    /* Store the transport protocol information in the tx descriptor */
-    IpTxReqestDescrPtr->XptProtocol = IPV4_IP_PROTOCOL_TCP;
+  /* #20 Check if the calculated checksum is 0 (=OK). */
+  if (checksum == 0u)
+  {
+    /* checksum is valid -> OK */
+  }
+  else
+  {
+    /* checksum is invalid */
+    retVal = E_NOT_OK;
+  }
 
-    if (IpV4_Ip_ProvideTxBuffer(&ipV4AddrIdx, socketIdx, &TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->SockAddrIn,
-        PayloadPtr, TgtLenPtr, IpTxReqestDescrPtr, FALSE) != BUFREQ_OK)
-    {
-      /* stop trying to get more buffers */
-      retVal = E_NOT_OK;
-    }
-    else
-    {
-      /* #30 If this is a SYN segment, store the local source address used for this socket. */
-      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-          || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD))
-      {
-        /* Store source address used in received or sent SYN segment. The source address must not change until the TCP
-        connection is closed. Return value is ignored because IpV4_Ip_ProvideTxBuffer would have failed if no IP address
-        is configured. */
-        (void)IpV4_Ip_GetLocNetAddr(ipV4AddrIdx, &TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->SockAddrIn.sin_addr);
-        TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->sa_family = IPBASE_AF_INET;
+  return retVal;
+}
 
-        /* If a client socket is used without TcpIp_Bind() call, the bound local addr idx is not known before.
-           In this case we search for an address to send the SYN and expect the SYN-ACK at the same IP-Address. */
-        if (  (TcpIp_GetLocalAddrBindIdxOfSocketDyn(socketIdx) == TCPIP_LOCALADDRID_ANY)
-            &&(TCPIP_LOCAL_ADDR_IDX_IS_IPV4(ipV4AddrIdx) == TRUE))
-        {
-          TcpIp_SetLocalAddrBindIdxOfSocketDyn(socketIdx, TCPIP_IPV4_TO_LOCAL_ADDR_IDX(ipV4AddrIdx));
-        }
-      }
-    }
-  }
-#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
-  else
-#  endif
-# endif
-# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
-  {
-    /* #40 Request a buffer from IpV6. */
-    TcpIp_LocalAddrV6IterType ipV6AddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
 
-    if (IpV6_ProvideTxBuffer(&ipV6AddrIdx, socketIdx,
-        &(TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->SockAddrIn6.sin6_addr),
-        PayloadPtr, TgtLenPtr, IpTxReqestDescrPtr, TCPIP_PROTOCOL_TCP, FALSE) != BUFREQ_OK )
-    {
-      /* stop trying to get more buffers */
-      retVal = E_NOT_OK;
-    }
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VSendFlags
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendFlags(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx,
+  uint8                      Flags)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Add the requested flags to the already previously requested ones. */
+  TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) | Flags));
 
-    if (retVal == E_OK)
-    {
-      /* #50 If this is a SYN segment, store the local source address used for this socket. */
-      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-          || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD))
-      {
-        /* Determine the identifier of the ip address that has been selected by the IpV6.
-        * If IpV6_ProvideTxBuffer has been called with an AutoSelect ip address identifier,
-        * this address identifier will be replaced by an identifier for a specific source address.
-        */
-        TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->sa_family = IPBASE_AF_INET6;
-        /* Return value is ignored because IpV6_ProvideTxBuffer would have failed if no IP address is configured. */
-        (void)IpV6_GetLocalAddress(ipV6AddrIdx, &(TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->SockAddrIn6.sin6_addr), NULL_PTR);
+  TCPIP_ASSERT((Flags & TCPIP_TCP_CODE_BIT_RST) == 0u);
 
-        /* If a client socket is used without TcpIp_Bind() call, the bound local addr idx is not known before.
-           In this case we search for an address to send the SYN and expect the SYN-ACK at the same IP-Address. */
-        if (TcpIp_GetLocalAddrBindIdxOfSocketDyn(socketIdx) == TCPIP_LOCALADDRID_ANY)
-        {
-          TcpIp_SetLocalAddrBindIdxOfSocketDyn(socketIdx, TCPIP_IPV6_TO_LOCAL_ADDR_IDX(ipV6AddrIdx));
-        }
-      }
-    }
+  /* #20 Set the next send sequence number in case a SYN flag shall be sent */
+  if ((Flags & TCPIP_TCP_CODE_BIT_SYN) != 0u)
+  {
+    TcpIp_SetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx));
   }
-# endif
 
-  return retVal;
-}
 
+  /* #30 Reset the nagle timeout, if nagle algorithm (with timeout) is enabled and one of the flags FIN, SYN or ACK is set. */
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
+  if (    (TcpIp_IsEnabledOfSocketTcpNagleDyn(SocketTcpIdx) == TRUE)
+      && ((TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & TCPIP_TCP_CODE_BIT_MASK_FSA) != 0u))                          /* PRQA S 3415 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+  {
+    TcpIp_SetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx, 0);
+  }
+# endif
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuffer
+ *  TcpIp_Tcp_VSendReset
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
  */
-/* PRQA S 6060 1 */ /* MD_MSR_STPAR */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuffer(
-  TcpIp_SizeOfSocketTcpDynType    SocketTcpIdx,
-  TCPIP_P2V(TcpIp_IpTxRequestDescriptorType) IpTxReqestDescrPtr,
-  TcpIp_SizeOfTcpTxBufferType StartDataIdx,
-  TcpIp_SizeOfTcpTxBufferType DataLen,
-  TCPIP_P2V(uint8) IpPayloadPtr,
-  uint8 TcpHeaderLen)
+/* PRQA S 6050, 6060 1 */ /* MD_MSR_STCAL, MD_MSR_STPAR */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendReset(
+  TcpIp_SocketTcpDynIterType        SocketTcpIdx,
+  TcpIp_LocalAddrIterType           IpAddrIdx,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RemSockPtr,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) LocSockPtr,
+  uint32                            SeqNo,
+  uint32                            AckNo,
+  uint8                             Flags)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  /* Get the current AppId before we enter the critical section */
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+  TcpIp_OsApplicationType applId = GetApplicationID();
+# else
+  TcpIp_OsApplicationType applId = TCPIP_SINGLECORE_APPLID;
+# endif
+  TcpIp_TcpRstHandlingIterType tcpRstHandlingIdx = TcpIp_GetSizeOfTcpRstHandlingDyn();
+
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if there is data to send. */
-  if (DataLen > 0u)
+  /* #10 Delete the tx request for this socket if it is not in state LISTEN. */
+  if (SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn())
   {
-    uint8  *tcpPayloadPtr = NULL_PTR;
-    TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-    TcpIp_SizeOfTcpTxBufferType remLenAtEnd = 0u;
+    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)
+    {
+      /* - reset length to send */
+      TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
 
-    TCPIP_ASSERT(tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc());
-    TCPIP_ASSERT(StartDataIdx >= TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
-    TCPIP_ASSERT(StartDataIdx <  TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
-    TCPIP_ASSERT(TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx) > 0u);
+      if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_SYNRCVD)
+      {
+        TcpIp_SetRcvNxtOfSocketTcpDyn(SocketTcpIdx, AckNo);
+      }
+      TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
+    }
+  }
 
-    remLenAtEnd = TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx) - StartDataIdx;
 
-    tcpPayloadPtr = &IpPayloadPtr[TcpHeaderLen];  /* first byte following the TCP header */
+  tcpRstHandlingIdx = TcpIp_Tcp_GetRstHandlingOfApplId(applId);
+  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+  /* #20 Add an element to the reset queue if the queue is not already full. */
+  if (   (TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx) < TCPIP_TCP_RESET_CORE_SIZE)
+      && (tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandlingDyn()))
+  {
+    /* #30 Find free buffer item. */
+    TCPIP_P2V(TcpIp_Tcp_RstTxQueueType) tcpResetQElementPtr = NULL_PTR;
+    TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
 
-    /* #20 Copy TCP payload to the ip buffer taking care of a wraparound in the TCP buffer. */
-    if (DataLen > remLenAtEnd)
+    for(rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
+      rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
+      rstTxQueueBufferIdx++)
     {
-      /* message is in end and start of circular buffer (split into two parts) */
-      /* circular buffer: |DataPart2|xxxxxxxxxxx|DataPart1|  */
-      TcpIp_SizeOfTcpTxBufferType len1;
-      TcpIp_SizeOfTcpTxBufferType len2;
-      TCPIP_P2C(uint8) src1Ptr;
-      TCPIP_P2C(uint8) src2Ptr;
-
-      len1    = remLenAtEnd;
-      len2    = DataLen - len1;
-      src1Ptr = TcpIp_GetAddrTcpTxBuffer(StartDataIdx);                                                                 /* TCPIP_CSL_INDEX_ACCEPTED */
-      src2Ptr = TcpIp_GetAddrTcpTxBuffer(TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
-
-      /* copy the two data fragments */
-      if (IpTxReqestDescrPtr->ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
-      {
-        const uint8 remaining = (uint8)(len1 % 2u);
-        /* Copy and calculate checksum */
-        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(tcpPayloadPtr, src1Ptr, len1 - remaining,         /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
-          IpTxReqestDescrPtr->TmpChecksum, FALSE);
-        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(&tcpPayloadPtr[len1 + remaining],                 /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
-          &src2Ptr[remaining], len2 - remaining, IpTxReqestDescrPtr->TmpChecksum, FALSE);
+      tcpResetQElementPtr = TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx);
 
-        /* For odd numbers, the IpBase CRC algorithm can't calculate the checksum, so the copy is done seperately. */
-        /* This requirement comes from IpBase_TcpIpChecksumCopyAdd() */
-        if (remaining == 1u)
-        {
-          tcpPayloadPtr[len1 - 1u] = src1Ptr[len1 - 1u];                                                                /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
-          tcpPayloadPtr[len1     ] = src2Ptr[0];                                                                        /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
-          IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumAdd(&tcpPayloadPtr[len1 - 1u], 2u,
-            IpTxReqestDescrPtr->TmpChecksum, FALSE);
-        }
-      }
-      else
+      if (tcpResetQElementPtr->RemSock.sa_family == IPBASE_AF_UNSPEC)
       {
-        /* PRQA S 0315 2 */ /* MD_MSR_VStdLibCopy */
-        IpBase_Copy(tcpPayloadPtr, src1Ptr, len1);                                                                      /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
-        IpBase_Copy(&tcpPayloadPtr[len1], src2Ptr, len2);                                                               /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+        break;
       }
     }
-    else
+
+    if (   (rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx))
+        && (tcpResetQElementPtr != NULL_PTR))
     {
-      /* message is in the circular buffer in one block (unsplit) */
-       TCPIP_P2C(uint8) srcPtr  = TcpIp_GetAddrTcpTxBuffer(StartDataIdx);                                               /* TCPIP_CSL_INDEX_ACCEPTED */
+      /*@ assert tcpResetQElementPtr == TcpIp_GetAddrRstTxQueueBuffer($range(0, TcpIp_GetSizeOfRstTxQueueBuffer() - 1)); */ /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RESETQELE_IDX */
 
-      /* copy this data (fragment) */
-      /* since the data is in one block, no Pbuf copy mechanism is necessary */
-      if (IpTxReqestDescrPtr->ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
-      {
-        /* Copy and calculate checksum */
-        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(tcpPayloadPtr, srcPtr, (uint16_least)DataLen,     /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
-          IpTxReqestDescrPtr->TmpChecksum, FALSE);
-      }
-      else
+      tcpResetQElementPtr->SeqNo = SeqNo;
+      tcpResetQElementPtr->AckNo = AckNo;
+      tcpResetQElementPtr->Flags = Flags;
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+    /* Store the AppId in case of multicore use-case to identify the core */
+      tcpResetQElementPtr->ApplId = applId;
+# endif
+      tcpResetQElementPtr->IpAddrIdx = (uint8)IpAddrIdx;
+      (void)IpBase_CopySockAddr(&tcpResetQElementPtr->LocSock.SockAddr, &LocSockPtr->SockAddr);                         /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
+      (void)IpBase_CopySockAddr(&tcpResetQElementPtr->RemSock.SockAddr, &RemSockPtr->SockAddr);                         /* VCA_TCPIP_SOCKET_ADDRESS_COPY */
+
+# if (TCPIP_SUPPORT_IPSEC == STD_ON)
+      if (TCPIP_LOCAL_ADDR_IDX_IS_IPV4(IpAddrIdx))
       {
-        /* PRQA S 0315 1 */ /* MD_MSR_VStdLibCopy */
-        IpBase_Copy(tcpPayloadPtr, srcPtr, (uint16_least)DataLen);                                                      /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+        /* Update the local socket address information in Tcp Reset socket, if it is Ipv4 */
+        (void)IpV4_Ip_GetLocNetAddr(IpAddrIdx, &(TcpIp_GetAddrLocSockOfIpV4SocketDyn(TcpIp_GetIpV4SocketDynTcpRstIdxOfIpV4General(TCPIP_IPV4GENERAL_IDX))->SockAddrIn.sin_addr));
+        TcpIp_GetAddrLocSockOfIpV4SocketDyn(TcpIp_GetIpV4SocketDynTcpRstIdxOfIpV4General(TCPIP_IPV4GENERAL_IDX))->SockAddrIn.sin_port = LocSockPtr->SockAddrIn.sin_port;
       }
-
+# endif
+      TcpIp_IncRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx);
     }
-  }  /* if (DataLenByte > 0) */
+  }
+  else
+  {
+    /* queue is too short, or there is a problem with sending the elements */
+    /* do nothing but ignore this request */
+  }
+  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment_WriteHeaderElements
+ *  TcpIp_Tcp_VFinalizeTxSegment
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ *
+ *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderElements(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(uint8) TcpHdrPtr,
-  TcpIp_SizeOfTcpTxBufferType DataLen,
-  uint32 SeqNo,
-  uint8 Flags)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  /* Accumulated DataLenByte may not exceed max payload length (minus TCP header length) of lower layer !! */
+  /* TCP flags that shall be set in this segment. */
+  uint8          segmentFlags = 0u;
+  Std_ReturnType retVal = E_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Write the TCP header elements */
-  TCPIP_PUT_UINT16_RAW(TcpHdrPtr, TCPIP_TCP_HDR_SOURCE_PORT_OFFSET, TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->DomainAndPort.port);
-  TCPIP_PUT_UINT16_RAW(TcpHdrPtr, TCPIP_TCP_HDR_TARGET_PORT_OFFSET, TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->DomainAndPort.port);
+  /* #10 Defer sending a FIN flag if pending TX data exceeds size of this segment. FIN flag must be set in last segment
+  containing data. */
+  if (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) > TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx))
+  {
+    segmentFlags = (uint8)(TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & ~TCPIP_TCP_CODE_BIT_FIN);
+  }
+  else
+  {
+    segmentFlags = TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx);
+  }
 
-  TCPIP_PUT_UINT32(TcpHdrPtr, TCPIP_TCP_HDR_SEQ_NUM_OFFSET, SeqNo);
-  TCPIP_PUT_UINT32(TcpHdrPtr, TCPIP_TCP_HDR_ACK_NUM_OFFSET, TcpIp_GetRcvNxtOfSocketTcpDyn(SocketTcpIdx));  /* acknowledge received bytes */
+  TCPIP_ASSERT_MSG(TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) <= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx), "segmenting is currently not supported."); /* this should never happen, this case is filtered in earlier steps */
 
-  TcpHdrPtr[TCPIP_TCP_HDR_DATA_OFFSET_OFFSET] = TCPIP_TCP_HDR_DEFAULT_DATA_OFFSET_BYTE_VALUE;
-  if (DataLen > 0u)
+  /* #20 Set flags and trigger the KeepAlive mechanism if there is something to send. */
+  if (   (segmentFlags == 0u)                                                                                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == 0u))
   {
-    TcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = (Flags | (uint8)TCPIP_TCP_CODE_BIT_PSH);
+    /* neither data nor flags to send -> do nothing.
+     * ACK-only segments will be sent later if required and are not managed in the retry queue.
+     */
+    /* return E_OK */
   }
   else
   {
-    TcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = Flags;
+
+    retVal = TcpIp_Tcp_VFinalizeTxSegment_SetFlagsAndKeepAlive(SocketTcpIdx, &segmentFlags);
+
+    if (retVal == E_OK)
+    {
+      TCPIP_VENTER_CRITICAL_SECTION();
+
+      /* #30 If data is available for sending, create a new tx element and trigger sending. */
+      if (   (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == 0u)
+          && (segmentFlags == TCPIP_TCP_CODE_BIT_ACK))
+      {
+        /* Only ACK segment shall be sent. This will be done at end of TcpIp_Tcp_VTransmit(). */
+      }
+      else
+      {
+        TcpIp_Tcp_TxRetrQueueType *newRetryQElementPtr;
+
+        /* Create new retry queue element and append it the queue. */
+        TcpIp_Tcp_VFinalizeTxSegment_CreateRetryQElement(SocketTcpIdx, &newRetryQElementPtr, segmentFlags);
+
+        /* Queue data for sending (mark data to be queued and reduce length of not queued data)  */
+        TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSending(SocketTcpIdx, newRetryQElementPtr, segmentFlags);
+      }
+      TCPIP_VLEAVE_CRITICAL_SECTION();
+    }
   }
-  TCPIP_PUT_UINT16(TcpHdrPtr, TCPIP_TCP_HDR_WINDOW_OFFSET,     TcpIp_GetRcvWndOfSocketTcpDyn(SocketTcpIdx));
-  TCPIP_PUT_UINT16(TcpHdrPtr, TCPIP_TCP_HDR_CHECKSUM_OFFSET,   TCPIP_TCP_EMPTY_CHKSUM);
-  TCPIP_PUT_UINT16(TcpHdrPtr, TCPIP_TCP_HDR_URGENT_PTR_OFFSET, TCPIP_TCP_EMPTY_URG_PTR);
+
+  return retVal;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions
+ *  TcpIp_Tcp_VFinalizeTxSegment_SetFlagsAndKeepAlive
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8990,129 +9106,54 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderElement
  *
  *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions(
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_SetFlagsAndKeepAlive(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(uint8) TcpHdrPtr,
-  uint8 OneTimeOptions,
-  uint8 SackNum,
-  uint8 Flags)
+  TCPIP_P2V(uint8) SegmentFlagsPtr)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  uint8 *hdrOptPtr = &TcpHdrPtr[TCPIP_TCP_HDR_LEN_BYTE];
-  uint8  hdrOptLen = 0;
+  Std_ReturnType retVal = E_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-# if ((TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_OFF) && (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_OFF))
-  TCPIP_DUMMY_STATEMENT_CONST(OneTimeOptions);                                                                          /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
-
-  if ((TCPIP_TCP_CODE_BIT_SYN & Flags) != 0u)
+  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+  if ((*SegmentFlagsPtr & TCPIP_TCP_CODE_BIT_RST) != 0u)
   {
-    /* #10 Append the 'maximum segment size' option to the header if this is a SYN message. */
-    hdrOptPtr[TCPIP_TCP_OPT_OFS_KIND]   = TCPIP_TCP_OPT_ID_MAX_SEG_SIZE;
-    hdrOptPtr[TCPIP_TCP_OPT_OFS_LENGTH] = TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE;
-    {
-      TcpIp_SizeOfTcpRxBufferDescType tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-
-      /* max size depends on socket rx buffer size and ETH rx message size (minus header) */
-      uint16 maxLen = TcpIp_GetRxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX);
-
-# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
-      TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-      if (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->sa_family == IPBASE_AF_INET6)
-      {
-        /* Fixed IPv6 header requires 20 bytes more than already considered IPv4 header. So TCP MSS has to be reduced by 20 bytes. */
-        maxLen -= (TCPIP_IPV6_HDR_LEN_BYTE - TCPIP_IPV4_HDR_LEN_BYTE);
-      }
-#  if (TCPIP_SUPPORT_IPSEC == STD_ON)
-      else
-#  endif
-# endif
-# if (TCPIP_SUPPORT_IPSEC == STD_ON)
-      {
-        /* If IPsec is enabled, always decrement IPsec AH header bytes from Rx MSS */
-        maxLen -= TCPIP_IPSEC_HDR_LEN_MAX;
-      }
-# endif
-
-      if (maxLen > TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx))
-      {
-        /* MSS is limited by small TCP RX buffer */
-        maxLen = (uint16)TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx);
-      }
-      TCPIP_PUT_UINT16(hdrOptPtr, TCPIP_TCP_OPT_OFS_VALUE, maxLen);  /* local max for this socket (for rx) */           /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-    }
-
-    hdrOptLen += TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE;
-    hdrOptPtr  = &hdrOptPtr[hdrOptLen];
+    /* #10 If a reset is issued, RST shall be the only flag that is sent. */
+    *SegmentFlagsPtr = TCPIP_TCP_CODE_BIT_RST;
+    TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
   }
-
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-  if (   (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)                                          /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT))
+  else if (   (*SegmentFlagsPtr != TCPIP_TCP_CODE_BIT_SYN)                                                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+           && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED))
   {
-    /* #20 Append the 'timestamp' option to the header if enabled */
-    uint8 *tempHdrOptPtr;
-    uint8 thisOptLen;
-
-    /*@ assert $lengthOf(hdrOptPtr) >= TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u; */                                             /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-
-    /* add two NOP elements */
-    hdrOptPtr[0] = TCPIP_TCP_OPT_ID_NOP;
-    hdrOptPtr[1] = TCPIP_TCP_OPT_ID_NOP;
-
-    /* add timestamp header */
-    tempHdrOptPtr = &hdrOptPtr[2u * TCPIP_TCP_NOP_ELEMENT_LEN];
-    tempHdrOptPtr[TCPIP_TCP_OPT_OFS_KIND]   = TCPIP_TCP_OPT_ID_TIMESTAMP;  /* Kind */
-    tempHdrOptPtr[TCPIP_TCP_OPT_OFS_LENGTH] = TCPIP_TCP_OPT_LEN_TIMESTAMP;  /* OptLen */
-    TCPIP_PUT_UINT32(tempHdrOptPtr,  TCPIP_TCP_OPT_OFS_VALUE, TcpIp_Tcp_GlobalTimestamp);                               /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-    TCPIP_PUT_UINT32(tempHdrOptPtr, (TCPIP_TCP_OPT_OFS_VALUE + TCPIP_TCP_TIMESTAMP_ELEMENT_LEN),                        /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-      TcpIp_GetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx));
-
-    thisOptLen = (TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u);
-    hdrOptLen += thisOptLen;
-    hdrOptPtr  = &hdrOptPtr[thisOptLen];
+    /* #20 An ACK flag is required in every segment except for SYN. */
+    *SegmentFlagsPtr |= TCPIP_TCP_CODE_BIT_ACK;
   }
-# endif
-
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_USER_TIMEOUT) != 0u)
+  else
   {
-    /* #30 Append the 'user timeout' option to the header if enabled */
-    uint8  thisOptLen = (TCPIP_TCP_OPT_LEN_USER_TIMEOUT);
-
-    hdrOptPtr[TCPIP_TCP_OPT_OFS_KIND]   = TCPIP_TCP_OPT_ID_USER_TIMEOUT;  /* Kind */
-    hdrOptPtr[TCPIP_TCP_OPT_OFS_LENGTH] = TCPIP_TCP_OPT_LEN_USER_TIMEOUT;  /* OptLen */
-    TCPIP_PUT_UINT16(hdrOptPtr, TCPIP_TCP_OPT_OFS_VALUE, TcpIp_GetUtoAdvOfSocketTcpUtoDyn(SocketTcpIdx));               /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-
-    hdrOptLen += thisOptLen;
-    hdrOptPtr  = &hdrOptPtr[thisOptLen];
+    /* nothing to do */
   }
-# endif
 
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  /* #30 If no free retry queue elements are available the function returns with an error. */
+  if (TcpIp_Tcp_NumFreeRetryQEle == 0u)
   {
-    /* #40 Append the 'selective acknowledgment' option to the header if enabled */
-    hdrOptLen += TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions_Sack(SocketTcpIdx, hdrOptPtr, OneTimeOptions, SackNum);
+    retVal = E_NOT_OK;
   }
-# else
-  TCPIP_DUMMY_STATEMENT_CONST(SackNum);                                                                                 /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-  TCPIP_DUMMY_STATEMENT_CONST(hdrOptPtr);                                                                               /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
-
-  if (hdrOptLen > 0u)
+  else
   {
-    /* there were some options added */
-    TCPIP_ASSERT_MSG((hdrOptLen % 4u) == 0, "Total option length must always be a multiple of 4.");
-    TcpHdrPtr[TCPIP_TCP_HDR_DATA_OFFSET_OFFSET] += (uint8)((hdrOptLen / 4u) << 4);
+    /* since we only need one RetrQueue element, we can proceed this request */
+
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+  /* #40 Trigger the keep alive timer to be reset. */
+    TcpIp_Tcp_VKeepAliveTrigger(SocketTcpIdx);
+# endif
   }
+  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
+
+  return retVal;
 }
 
 
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions_Sack
+ *  TcpIp_Tcp_VFinalizeTxSegment_CreateRetryQElement
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9121,81 +9162,104 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions
  *
  *
  */
-TCPIP_LOCAL FUNC(uint8, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions_Sack(
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_CreateRetryQElement(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(uint8) TcpHdrOptPtr,
-  uint8 OneTimeOptions,
-  uint8 SackNum)
+  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueTypeP2V) AddedRetryQElementPtr,
+  uint8 SegmentFlags)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  uint8 hdrOptLen = 0;
-  TCPIP_P2V(uint8) locHdrOptPtr = TcpHdrOptPtr;
+  TcpIp_SizeOfTcpRetryQElementType newTcpRetryQElementIdx = TcpIp_Tcp_FirstFreeRetrQueueEle;
+  TcpIp_SizeOfTcpRetryQElementType lastTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
+  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) newRetryQElementPtr = NULL_PTR;
 
   /* ----- Implementation ----------------------------------------------- */
-  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_SACK_PERMIT) != 0u)
-  {
-    /* #10 Append the 'selective acknowledgment permit' option to the header */
-    uint8  thisOptLen = (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u);
-    /* add SACK permit option */
-    locHdrOptPtr[0] = TCPIP_TCP_OPT_ID_SACK_PERMIT;   /* Kind */                                                        /* VCA_TCPIP_WRITE_SACK_OPT */
-    locHdrOptPtr[1] = TCPIP_TCP_OPT_LEN_SACK_PERMIT;  /* OptLen */                                                      /* VCA_TCPIP_WRITE_SACK_OPT */
+  /* #10 Take the first element from the free-list. */
+  TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
 
-    locHdrOptPtr[2] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
-    locHdrOptPtr[3] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
+  /*@ assert newTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                             /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+  newRetryQElementPtr     = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx);
+  *AddedRetryQElementPtr  = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx);
+  if (TcpIp_Tcp_NumFreeRetryQEle > 1u)
+  {
+    TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx = newRetryQElementPtr->EleNext;
+    /*@ assert tcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                              /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
 
-    hdrOptLen += thisOptLen;
-    locHdrOptPtr  = &locHdrOptPtr[thisOptLen];
+    TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    TcpIp_Tcp_FirstFreeRetrQueueEle = tcpRetryQElementIdx;
   }
-
-  if (   (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 0u)                                                  /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_IsSackOptActiveOfSocketTcpDyn(SocketTcpIdx) == TRUE))
+  else
   {
-    /* #20 Append 'selective acknowledgment' option to the header */
-    /* send list with SackNum (1..4) elements */
-    uint8                         thisOptLen   = 0u;
-    uint8                        *seqPtr       = NULL_PTR;
-    TcpIp_TcpOooQElementIterType  tcpOooQElementIdx    = 0u;
-    uint8_least                   sackNumAdded = 0u;
+    TcpIp_Tcp_FirstFreeRetrQueueEle = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    TcpIp_Tcp_LastFreeRetrQueueEle  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+  }
+  TcpIp_Tcp_NumFreeRetryQEle--;
 
-    /* add SACK option */
-    locHdrOptPtr[0] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
-    locHdrOptPtr[1] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
+  TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
 
-    locHdrOptPtr[2] = TCPIP_TCP_OPT_ID_SACK;  /* Kind */                                                                /* VCA_TCPIP_WRITE_SACK_OPT */
-    locHdrOptPtr[3] = (uint8)(TCPIP_TCP_OPT_LEN_SACK + (SackNum * TCPIP_TCP_SACK_ELEMENT_LEN));  /* OptLen */ /* variable SackNum is always initialized ! */ /* VCA_TCPIP_WRITE_SACK_OPT */
+  /* #20 Append the (free) element to the sockets RetryQueue. */
+  if (lastTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement())
+  {
+    /* there already is a retry list for this socket */
+    TcpIp_GetAddrTcpRetryQElement(lastTcpRetryQElementIdx)->EleNext = newTcpRetryQElementIdx;
+    newRetryQElementPtr->ElePrev           = lastTcpRetryQElementIdx;
+    newRetryQElementPtr->EleNext           = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    newRetryQElementPtr->SocketTcpIdx      = SocketTcpIdx;
+    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx,  newTcpRetryQElementIdx);
+  }
+  else
+  {
+    /* there is no retry list for this socket, yet */
+    newRetryQElementPtr->ElePrev           = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    newRetryQElementPtr->EleNext           = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    newRetryQElementPtr->SocketTcpIdx      = SocketTcpIdx;
+    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, newTcpRetryQElementIdx);
+    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx, newTcpRetryQElementIdx);
+  }
 
-    /* #30 Add SACK elements */
-    /* Add elements with element order according to RFC 2018, section 4:
-      'The first SACK block (...) MUST specify the contiguous block of data containing the segment which triggered this ACK, ...'
-      'The SACK option SHOULD be filled out by repeating the most recently reported SACK blocks ...' */
-    TCPIP_ASSERT(TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx) < TcpIp_GetSizeOfTcpOooQElement());
-    tcpOooQElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
+  /* #30 Set further struct elements of the RetryQElement */
+  newRetryQElementPtr->SeqNo               = TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
+  newRetryQElementPtr->Flags               = SegmentFlags;
 
-    seqPtr = &locHdrOptPtr[4];
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+  newRetryQElementPtr->UserTimeoutTs       = TcpIp_Tcp_GlobalTimestamp + TcpIp_GetUtoOfSocketTcpUtoDyn(SocketTcpIdx);
+# else
+  newRetryQElementPtr->UserTimeoutTs       = TcpIp_Tcp_GlobalTimestamp + TcpIp_GetUserTimeoutDefCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX);
+# endif
 
-    /* SackNum is already calculated in function TcpIp_Tcp_VTransmitSegment_CalcHeaderLen and considers the number of
-       elements in the out of order queue. */
-    while (sackNumAdded < SackNum)
-    {
-      TCPIP_PUT_UINT32(seqPtr, 0,  TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->SeqNo);                              /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-      TCPIP_PUT_UINT32(seqPtr, 4, (TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->SeqNo + TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->LenByte)); /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
-      seqPtr  = &seqPtr[TCPIP_TCP_SACK_ELEMENT_LEN];
+# if ((TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) || (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON))
+  /* Only two types of one time options are supported -
+   * - User timeout
+   * - Selective acknowledgment
+   */
+  if (   (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) != 0u)                                                     /* PRQA S 3415 5 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) <=
+         ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx) - (uint32) TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx))))
+  {
+    newRetryQElementPtr->OneTimeOptions    = TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx);
+    newRetryQElementPtr->OneTimeOptionsLen = TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx);
+    TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx, 0);  /* clear global flags and len */
+    TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, 0);
+  }
+  else
+# endif
+  {
+    newRetryQElementPtr->OneTimeOptions    = 0;
+    newRetryQElementPtr->OneTimeOptionsLen = 0;
+  }
 
-      tcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->OlderEleIdx;
-      sackNumAdded++;
-    }
+  newRetryQElementPtr->TransmitCounter     = 0;
+  newRetryQElementPtr->TimeStamp           = TcpIp_Tcp_GlobalTimestamp;
+  newRetryQElementPtr->SizeTotByte         = TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx);
 
-    thisOptLen = (uint8)(TCPIP_TCP_OPT_LEN_SACK + 2u + (SackNum * TCPIP_TCP_SACK_ELEMENT_LEN));
-    hdrOptLen += thisOptLen;
-  }
+  newRetryQElementPtr->SackFlag            = 0;
+  /* The struct element newRetryQElementPtr->DataBufStartIdx does not have to be set since it is set in a subsequent function. */
 
-  return hdrOptLen;
 }
-# endif
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmit
+ *  TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSending
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9204,141 +9268,70 @@ TCPIP_LOCAL FUNC(uint8, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderOption
  *
  *
  *
- *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmit(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinalizeTxSegment_QueueDataForSending(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) NewRetryQElementPtr,
+  uint8 SegmentFlags)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retValue = E_OK;
-
-  /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check user timeout of oldest element in retry queue and close connection if timeout has exceeded. */
-  if (TcpIp_Tcp_VCloseConnectionIfNotAcked(SocketTcpIdx) != E_OK)
-  {
-    /* Sent data has not been answered too long and therefore the connection has been closed */
-    retValue = E_NOT_OK;
-  }
-  else
-  {
-    boolean setNewRtoPending = FALSE;
-    boolean dataSegmentSent  = FALSE;
+  TcpIp_SizeOfTcpTxBufferType unqueuedReqDataSize = 0u;
 
-    /* #20 Iterate over all elements in retry queue and send them if necessary. */
-    TcpIp_Tcp_VSendPendingElements(SocketTcpIdx, &dataSegmentSent, &setNewRtoPending);
+  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  /*@ assert tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); */                                                  /* VCA_TCPIP_VALID_BUFFERIDX_LOCAL */
 
-    /* #30 Update retransmit timing. */
-    if (setNewRtoPending == TRUE)
-    {
-      uint32 newTimeout = 0u;
+  /* ----- Implementation ----------------------------------------------- */
+  TCPIP_ASSERT(tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc());
+  TCPIP_ASSERT(TcpIp_GetSocketTcpDynIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx) == SocketTcpIdx);
+  TCPIP_ASSERT(TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx) > 0u);
 
-      /* only for the first RetrQueue element */
-      TcpIp_TcpRetryQElementIterType tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-      if ((tcpRetryQElementIdx == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV) || (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TransmitCounter == 1u))/* PRQA S 3415 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      {
-        /* first setting of the retransmit timer */
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-        newTimeout = TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx);
-# else
-        newTimeout = TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx);
-# endif
-      }
-      else
-      {
-        /* there has been at least one retransmission already */
-        /* #40 Exponential backoff, double the timeout each time until maximum value is reached. */
-        newTimeout = (TcpIp_GetRtoReloadValueOfSocketTcpDyn(SocketTcpIdx) * 2u);
-        if (newTimeout > TcpIp_GetRetransTimeoutMaxOfTcpConfig(TCPIP_TCPCONFIG_IDX))
-        {
-          newTimeout = TcpIp_GetRetransTimeoutMaxOfTcpConfig(TCPIP_TCPCONFIG_IDX);
-        }
-      }
-      TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, newTimeout);
-      TcpIp_SetRtoReloadValueOfSocketTcpDyn(SocketTcpIdx, newTimeout);
+  /* #10 Advance the buffer start index (taking care of wraparound). */
+  NewRetryQElementPtr->DataBufStartIdx = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx,
+    TcpIp_GetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx), TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx));
 
-      /* setNewRtoPending = FALSE; */
-    }
+  /* #20 Inc the queued len of the requested data. */
+  unqueuedReqDataSize = (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) - TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx));
 
-    if (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) > 0u)
-    {
-      TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) - 1u));
-    }
+  TCPIP_ASSERT(TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)       <= unqueuedReqDataSize);
+  TCPIP_ASSERT(TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) == unqueuedReqDataSize);
 
-    /* #50 Send an ACK if no data has been sent but sending an ACK has been requested. */
-    if (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_CODE_BIT_ACK)
-    {
-      if (dataSegmentSent == FALSE)
-      {
-        /* an ACK shall be sent */
-        if (TcpIp_Tcp_VTransmitSegment(SocketTcpIdx, TCPIP_TCP_CODE_BIT_ACK, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u, 0u) == E_OK)
-        {
-          TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
-        }
-      }
-      else
-      {
-        /* ACK was already sent with data segment. */
-        TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
-      }
-    }
+  if (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == unqueuedReqDataSize)
+  {
+    TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, TRUE);
   }
 
-  return retValue;
-}
-
+  TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx,
+    (TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)));
+  TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx,
+    (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) - TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)));
 
-/**********************************************************************************************************************
- *  TcpIp_Tcp_VCloseConnectionIfNotAcked
- *********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCloseConnectionIfNotAcked(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
-{
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType                 retValue  = E_OK;
-  TcpIp_SizeOfSocketDynType      socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  TcpIp_IncRetryQFillNumOfSocketTcpDyn(SocketTcpIdx);
 
-  /* ----- Implementation ----------------------------------------------- */
-  TCPIP_VENTER_CRITICAL_SECTION();
+  /* #30 Update TxNextSendSeqNo and reset flags and tx length. */
+  TcpIp_SetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx,
+    (TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx)));
 
-  /* #10 Access the first RetryQueue element of the socket. */
-  if (TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+  if ((TCPIP_TCP_CODE_BIT_SYN & SegmentFlags) != 0u)
   {
-    /* #20 Close the connection if timeout has expired */
-    if (TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx))->UserTimeoutTs == TcpIp_Tcp_GlobalTimestamp)
-    {
-      TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
-      /*@ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                           /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
-
-      /* The first element in the RetryQueue has not been ACKed too long (UserTimeout), so cancel the connection */
-
-      /* send reset */
-      TcpIp_Tcp_VSendReset(SocketTcpIdx, txIpAddrIdx, (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)),
-        (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
-        TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx))->SeqNo, 0u, 0u);
-
-      /* enter CLOSED state, delete/clear TCB */
-      TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+    TcpIp_IncTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
+  }
 
-      retValue = E_NOT_OK;
-    }
+  if ((TCPIP_TCP_CODE_BIT_FIN & SegmentFlags) != 0u)
+  {
+    TcpIp_IncTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
   }
 
-  TCPIP_VLEAVE_CRITICAL_SECTION();
+  /* #40 Clear pending flags if they were set in this segment. The ACK flag will be handled later in VTransmit(). */
+  TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx,
+    (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & (uint8)~(SegmentFlags & ~TCPIP_TCP_CODE_BIT_ACK)));
 
-  return retValue;
+  TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSendPendingElements
+ *  TcpIp_Tcp_VTransmitSegment
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9349,117 +9342,88 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCloseConnectionIfNotAcke
  *
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements(
+/* PRQA S 6060 1 */ /* MD_MSR_STPAR */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(boolean) DataSegmentSentPtr,
-  TCPIP_P2V(boolean) SetNewRtoPendingPtr)
+  uint8                        Flags,
+  uint32                       SeqNo,
+  uint8                        OneTimeOptions,
+  TcpIp_SizeOfTcpTxBufferType  DataStartIdx,
+  TcpIp_SizeOfTcpTxBufferType  DataLenByte)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_TcpRetryQElementIterType tcpRetryQElementIdx = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+  Std_ReturnType                   retValue = E_NOT_OK;
+  uint8                            headerLenByte = 0u;
+  /* Init the variable 'sackNum' to prevent MISRA checkers to issue the warning message 3353. The variable will always be set to a valid value before it is used */
+  uint8                            sackNum = 0;  /* number of SACK elements to be sent */
+  uint16                           ipPayloadLen = 0u;
+  TcpIp_IpTxRequestDescriptorType  ipTxReqestDescr;
+  uint8                           *ipPayloadPtr;
+  TcpIp_SizeOfTcpTxBufferType      dataLenByteLocal = DataLenByte;
 
   /* ----- Implementation ----------------------------------------------- */
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-  uint16 retrQueueEleCount = 0;
-# endif
+  /* #10 Calculate TCP header length (based on required options). */
+  TcpIp_Tcp_VTransmitSegment_CalcHeaderLen(SocketTcpIdx, Flags, OneTimeOptions, &sackNum, &headerLenByte);
 
-  /* #10 Get RetryQueue element index */
-  /* If the retry queue is not empty the first element index in the queue is taken, if it is empty the first element
-     index equals TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV. */
-  tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-
-  /* #20 Iterate over all elements in retry queue and send them if necessary. */
-  while (tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)                                                       /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
-  {
-    TcpIp_Tcp_TxRetrQueueType *txRetrQueueElePtr;
+  ipPayloadLen = (uint16)dataLenByteLocal + headerLenByte;
+  ipTxReqestDescr.TmpChecksum = 0;
 
-    txRetrQueueElePtr = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx);
 # if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-    retrQueueEleCount++;
+  CANOE_WRITE_STRING_3("TcpIp_Tcp_VTransmitSegment: SocketTcpIdx %d: TcpIp_Tcp_Cwnd is now %d, call IP ProvTxBuffer with length %d", SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx), ipPayloadLen);
 # endif
 
-    /* Each segment in the queue must have payload data or be a SYN/FIN segment. */
-    TCPIP_ASSERT((txRetrQueueElePtr->SizeTotByte > 0) || ((txRetrQueueElePtr->Flags & (TCPIP_TCP_CODE_BIT_SYN | TCPIP_TCP_CODE_BIT_FIN)) != 0u));
 
+  /* #20 Request a tx buffer from IP */
+  retValue = TcpIp_Tcp_VTransmitSegment_RequestIpTxBuffer(SocketTcpIdx, &ipTxReqestDescr, &ipPayloadLen, &ipPayloadPtr);
 
-    /* #30 Check if the element should be (re-)transmitted */
-    if (   (txRetrQueueElePtr->TransmitCounter == 0u)  /* counter is 0 (new un-sent element) */                         /* PRQA S 3415 4 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        || (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) == 0u)  /* global timeout expired */
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-        || (TcpIp_IsFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx) == TRUE)  /* fast retransmit pending */
-# endif
-       )
-    {
-      /* Segment was not transmitted or has to be retransmitted due to a retransmit timeout or a fast retransmit condition. */
+  if (retValue == E_OK)
+  {
+    /*@ assert $external(ipPayloadPtr) && $lengthOf(ipPayloadPtr) >= ipPayloadLen; */                                   /* VCA_TCPIP_IP_BUFFER_PTR */
 
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-      /* #40 Udate cwnd parameters. */
-      TcpIp_Tcp_VUpdateCwndParamsForTransmission(SocketTcpIdx, txRetrQueueElePtr);
+    /* #30 Copy TCP payload to the ip buffer. */
+    TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuffer(SocketTcpIdx, &ipTxReqestDescr, DataStartIdx, dataLenByteLocal,     /* VCA_TCPIP_IP_BUFFER_PTR */
+                                                    ipPayloadPtr, headerLenByte);
 
-      /* #50 Check if the segment can be sent according to cwnd conditions. */
-      if (   (TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx) > 0u)                                        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-          && (retrQueueEleCount > TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx)))
-      {
-        /* cwnd is set to an initial value, so only a limited number of segments may be sent */
-        /* limit exceeded -> skip this element and the following ones */
-        break;                                                                                                          /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
-      }
+    /* #40 Write the TCP header elements. */
+    TcpIp_Tcp_VTransmitSegment_WriteHeaderElements(SocketTcpIdx, ipPayloadPtr, dataLenByteLocal, SeqNo, Flags);         /* VCA_TCPIP_IP_BUFFER_PTR */
 
-      if (TCPIP_TCP_SEQ1_BIGGER_SEQ2((txRetrQueueElePtr->SeqNo + txRetrQueueElePtr->SizeTotByte),
-           (   TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx))->SeqNo
-            +  TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx)
-            + ((uint32) TcpIp_GetDupAckCntOfSocketTcpCongCtrlDyn(SocketTcpIdx) * (uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)))))
-          /* (current element end sequence number) > (first element sequence number + cwnd + (DupAckCnt * SMSS)) */
-          /* cwnd is increased according to RFC 5681, section 3.2
-          '4.  For each additional duplicate ACK received (after the third), cwnd MUST be incremented by SMSS.'. */
-      {
-        /* Element does not fit into cwnd, so it can't be sent. Stop sending elements following the current one, since they won't fit into cwnd, neither. */
-        /* skip this element and the following ones */
-        break;                                                                                                          /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
-      }
-# endif
-      {
-        /* try to send the segment */
+    /* #50 write the TCP header options. */
+    TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions(SocketTcpIdx, ipPayloadPtr, OneTimeOptions, sackNum, Flags);          /* VCA_TCPIP_IP_BUFFER_PTR */
 
-        /* #60 Stop checking further queue elements if the current one does not fit into the send window. */
-        if (TcpIp_Tcp_VSendPendingElements_CheckIfSegmentFitsInWindow(SocketTcpIdx, txRetrQueueElePtr) == FALSE)
-        {
-          break;                                                                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
-        }
+    dataLenByteLocal  += headerLenByte;
+  /* If checksum shall be calculated partial, add the TCP header */
+    if (ipTxReqestDescr.ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
+    {
+      ipTxReqestDescr.TmpChecksum = IpBase_TcpIpChecksumAdd(&ipPayloadPtr[0], headerLenByte,
+        ipTxReqestDescr.TmpChecksum, FALSE);
+    }
+    /* else: checksum will be calculated by lower layer, value is already set to '0' */
 
-        /* #70 Transmit the segment and update SndNxt value */
-        if (TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt(SocketTcpIdx, txRetrQueueElePtr, DataSegmentSentPtr) == E_OK)
-        {
-          /* transmission was successful */
+    TCPIP_ASSERT(TcpIp_GetAddrRemSockOfSocketDyn(TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx))->sa_family == ipTxReqestDescr.AddressFamily);
 
-          /* #80 Update Retransmit Timing and eventually remove segment from RetryQueue */
-          TcpIp_Tcp_VSendPendingElements_UpdateRetransmitTiming(SocketTcpIdx, txRetrQueueElePtr, SetNewRtoPendingPtr);
-        }
-        else
-        {
-          /* This is an error condition, caused by the lower layer (IP, EthIf...).
-             E.g. IP next hop is currently unreachable or no ethernet TX buffer is available.
-             Stop trying to send following elements in retry queue because this might lead to out of order transmission.
-             Retry transmission starting with this segment in next MainFunction. */
-          break;                                                                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
-        }
-      }
-    }
-    else
+    /* #60 Transmit the segment. */
+    retValue = TcpIp_VIpTransmit(&ipTxReqestDescr, (uint16)dataLenByteLocal, TCPIP_PROTOCOL_TCP, 0u, 0u);
+
+    if (retValue == E_OK)
     {
-      /* nothing to do, skip this element */
+      /* If FIN was received state is TCPIP_TCP_SOCK_STATE_CLOSEWAIT.
+       * Switch to new state TCPIP_TCP_SOCK_STATE_LASTACK if we have send FIN with the last segment. */
+      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSEWAIT)                         /* PRQA S 3415 3 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          && (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_LASTACK)
+          && ((Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u))
+      {
+        TcpIp_SetSockStateOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_LASTACK);
+      }
     }
+  }
 
-    tcpRetryQElementIdx = txRetrQueueElePtr->EleNext;
-  }  /* while ( all RetrQueue elements ) */
+  return retValue;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSendPendingElements_CheckIfSegmentFitsInWindow
+ *  TcpIp_Tcp_VTransmitSegment_CalcHeaderLen
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9469,313 +9433,365 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements(
  *
  *
  *
+ *
+ *
  */
-/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements_CheckIfSegmentFitsInWindow(
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_CalcHeaderLen(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr)
+  uint8            Flags,
+  uint8            OneTimeOptions,
+  TCPIP_P2V(uint8) SackNumPtr,
+  TCPIP_P2V(uint8) HeaderLenBytePtr
+ )
 {
   /* ----- Local Variables ---------------------------------------------- */
-  uint32   dataLen             = TxRetrQueueElePtr->SizeTotByte;
-  boolean  segmentFitsInWindow = TRUE;
+  uint8 headerLenByte = 0u;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check that the length of the current retry queue element is not 0. */
-  if (dataLen > 0u)
+  /* Init this variable 'sackNum' to prevent MISRA checkers to issue the warning message 3353. The variable will always be set to a valid value before it is used */
+  *SackNumPtr = 0;  /* number of SACK elements to be sent */
+
+# if ((TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_OFF)    && (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_OFF))
+  TCPIP_DUMMY_STATEMENT_CONST(SocketTcpIdx);                                                                            /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
+# if ((TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_OFF) && (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_OFF))
+  TCPIP_DUMMY_STATEMENT_CONST(OneTimeOptions);                                                                          /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
+
+  /* #10 Calculate TCP header length. */
+  headerLenByte = TCPIP_TCP_HDR_LEN_BYTE;
+  if ((TCPIP_TCP_CODE_BIT_SYN & Flags) != 0u)
   {
-    /* #20 Check if tx window is not 0. */
-    if (TcpIp_GetSndWndOfSocketTcpDyn(SocketTcpIdx) > 0u)
+    /* #20 For segment containing the SYN flag, add the length for the option 'max segment size'. */
+    headerLenByte += TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE;
+  }
+
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+  if (   (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)                                          /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT))
+  {
+    /* #30 If the timestamp option is enabled for this socket, add the length for the option 'timestamp'. */
+    headerLenByte += (TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u);
+  }
+# endif
+
+  /* #40 Add the length of options only sent in this segment if available. */
+  /* Only two types of one time options are supported -
+   * - User timeout
+   * - Selective acknowledgment
+   */
+  /* there are additional options to send -> additional length */
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_USER_TIMEOUT) != 0u)
+  {
+    /* #50 Add the length for the option 'user timeout'. */
+    headerLenByte += TCPIP_TCP_OPT_LEN_USER_TIMEOUT;
+  }
+# endif
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  /* only allowed in the SYN messages */
+  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_SACK_PERMIT) != 0u)
+  {
+    /* #60 Add the length for the option 'selective acknowledgment permit'. */
+    headerLenByte += (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u);  /* including 2x NOP */
+  }
+# endif
+
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  /* #70 Add the length for the option 'selective acknowledgment'. */
+  if (   (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 0u)                                                  /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_IsSackOptActiveOfSocketTcpDyn(SocketTcpIdx) == TRUE))
+  {
+    uint8 headerRemaining = 0u;
+    uint8 sackNumMax      = 0u;
+    uint8 oooNum          = TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
+    headerLenByte        += 4u;  /* 2* NOP + kind + len */
+    headerRemaining       = (uint8)(TCPIP_TCP_HDR_LEN_MAX_BYTE - headerLenByte);
+    sackNumMax            = headerRemaining / TCPIP_TCP_SACK_ELEMENT_LEN;
+
+    /* set currently number of used SACK elements */
+    if (sackNumMax >= oooNum)
     {
-      /* #30 Check if tx window is big enough for the current element */
-      if ((TCPIP_TCP_SEQ1_BIGGER_SEQ2((TxRetrQueueElePtr->SeqNo + dataLen),
-        (TcpIp_GetSndWl2OfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetSndWndOfSocketTcpDyn(SocketTcpIdx)))))
-      {
-        /* tx window is too small for sending this message */
-        segmentFitsInWindow = FALSE;
-      }
+      *SackNumPtr = oooNum;
     }
     else
     {
-      /* #40 The send window has size '0' (is closed), check if a zero window probe already exists, otherwise create one. */
-      /* Hint: A zero window probe element (which always has size '1') always is the first element in the retry queue. */
-      if (TxRetrQueueElePtr->ElePrev == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
-      {
-        /* The current retry queue element is the first retry queue element of this socket */
-        if (TxRetrQueueElePtr->SizeTotByte == 1u)
-        {
-          /* this is a zero window probe, just go ahead, so nothing here */
-        }
-        else if (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) == 0u)
-        {
-          uint32 sndNxt = 0u;
-          /* The first element in the TxRetrQueue has to be split into 1 byte and the rest.
-             It is important here, that 'TcpIp_Tcp_VSplitFirstRetrQueueEle' does not remove the first element from
-             the retry queue. Otherwise iteration in 'TcpIp_Tcp_VSendPendingElements' would continue iteration over the
-             free list. */
-          TcpIp_Tcp_VSplitFirstRetrQueueEle(SocketTcpIdx);
-          dataLen = TxRetrQueueElePtr->SizeTotByte;
-
-          /* Increment the TransmitCounter to ensure exponential backoff of the zero window probes starting from the
-             first message. The sndNxt value has to be incremented by the size of the zero window probe (1 byte) to
-             replace the normal processing during the first transmission in function
-             TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt. */
-          TxRetrQueueElePtr->TransmitCounter++;
-          sndNxt = TxRetrQueueElePtr->SeqNo + 1u;
-          TcpIp_SetSndNxtOfSocketTcpDyn(SocketTcpIdx, sndNxt);
-        }
-        else
-        {
-          segmentFitsInWindow = FALSE;
-        }
-      }
-      else
-      {
-        /* this is not a zero window probe element */
-        segmentFitsInWindow = FALSE;
-      }
+      *SackNumPtr = sackNumMax;
     }
 
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-    /* #50 Check if segment fits in cwnd */
-    if (TCPIP_TCP_SEQ1_BIGGER_SEQ2((TxRetrQueueElePtr->SeqNo + dataLen), (TcpIp_GetSndWl2OfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx))))
-    {
-      /* cwnd does not allow to send this segment */
-      /* This could prevent a zero window probe element from being sent if cwnd = 0. */
-      segmentFitsInWindow = FALSE;
-    }
-# else
-    TCPIP_DUMMY_STATEMENT_CONST(dataLen);                                                                               /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-# endif
+    headerLenByte += (uint8)(*SackNumPtr * TCPIP_TCP_SACK_ELEMENT_LEN);  /* SACK elements */
   }
+# endif
 
-  return segmentFitsInWindow;
+  *HeaderLenBytePtr = headerLenByte;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSendPendingElements_UpdateRetransmitTiming
+ *  TcpIp_Tcp_VTransmitSegment_RequestIpTxBuffer
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
+ *
+ *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements_UpdateRetransmitTiming(
-  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
-  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr,
-  TCPIP_P2V(boolean)                   SetNewRtoPendingPtr)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_RequestIpTxBuffer(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(TcpIp_IpTxRequestDescriptorType) IpTxReqestDescrPtr,
+  TCPIP_P2V(uint16) TgtLenPtr,
+  TCPIP_P2V(TcpIp_Uint8P2V) PayloadPtr)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType retVal = E_OK;
+  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Update the idle timeout */
+  /* #10 Check which IP version is used. */
+# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
+#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
+  if (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->sa_family == IPBASE_AF_INET)
+#  endif
+  {
+    /* #20 Request a buffer from IpV4. */
+    TcpIp_LocalAddrV4IterType ipV4AddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
+    /*@ assert ipV4AddrIdx < TcpIp_GetSizeOfLocalAddrV4(); */                                                           /* VCA_TCPIP_TX_IPAADR_IDX */
 
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-  TcpIp_SetIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx) + 2u));  /* reset the idle timer on each sent segment */
-# else
-  TCPIP_DUMMY_STATEMENT_CONST(SocketTcpIdx);                                                                            /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+    /* Store the transport protocol information in the tx descriptor */
+    IpTxReqestDescrPtr->XptProtocol = IPV4_IP_PROTOCOL_TCP;
+
+    if (IpV4_Ip_ProvideTxBuffer(&ipV4AddrIdx, socketIdx, &TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->SockAddrIn,
+        PayloadPtr, TgtLenPtr, IpTxReqestDescrPtr, FALSE) != BUFREQ_OK)
+    {
+      /* stop trying to get more buffers */
+      retVal = E_NOT_OK;
+    }
+    else
+    {
+      /* #30 If this is a SYN segment, store the local source address used for this socket. */
+      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD))
+      {
+        /* Store source address used in received or sent SYN segment. The source address must not change until the TCP
+        connection is closed. Return value is ignored because IpV4_Ip_ProvideTxBuffer would have failed if no IP address
+        is configured. */
+        (void)IpV4_Ip_GetLocNetAddr(ipV4AddrIdx, &TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->SockAddrIn.sin_addr);
+        TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->sa_family = IPBASE_AF_INET;
+
+        /* If a client socket is used without TcpIp_Bind() call, the bound local addr idx is not known before.
+           In this case we search for an address to send the SYN and expect the SYN-ACK at the same IP-Address. */
+        if (  (TcpIp_GetLocalAddrBindIdxOfSocketDyn(socketIdx) == TCPIP_LOCALADDRID_ANY)
+            &&(TCPIP_LOCAL_ADDR_IDX_IS_IPV4(ipV4AddrIdx) == TRUE))
+        {
+          TcpIp_SetLocalAddrBindIdxOfSocketDyn(socketIdx, TCPIP_IPV4_TO_LOCAL_ADDR_IDX(ipV4AddrIdx));
+        }
+      }
+    }
+  }
+#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
+  else
+#  endif
 # endif
+# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+  {
+    /* #40 Request a buffer from IpV6. */
+    TcpIp_LocalAddrV6IterType ipV6AddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
 
-  TCPIP_VENTER_CRITICAL_SECTION();
+    if (IpV6_ProvideTxBuffer(&ipV6AddrIdx, socketIdx,
+        &(TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->SockAddrIn6.sin6_addr),
+        PayloadPtr, TgtLenPtr, IpTxReqestDescrPtr, TCPIP_PROTOCOL_TCP, FALSE) != BUFREQ_OK )
+    {
+      /* stop trying to get more buffers */
+      retVal = E_NOT_OK;
+    }
 
-  /* #20 Update the transmit counter */
+    if (retVal == E_OK)
+    {
+      /* #50 If this is a SYN segment, store the local source address used for this socket. */
+      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD))
+      {
+        /* Determine the identifier of the ip address that has been selected by the IpV6.
+        * If IpV6_ProvideTxBuffer has been called with an AutoSelect ip address identifier,
+        * this address identifier will be replaced by an identifier for a specific source address.
+        */
+        TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->sa_family = IPBASE_AF_INET6;
+        /* Return value is ignored because IpV6_ProvideTxBuffer would have failed if no IP address is configured. */
+        (void)IpV6_GetLocalAddress(ipV6AddrIdx, &(TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->SockAddrIn6.sin6_addr), NULL_PTR);
 
-  /* reload retransmission timeout only for retransmissions of the first element in the RetrQueue */
-  if (TxRetrQueueElePtr->ElePrev == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
-  {
-    /* trigger reset of RTO */
-    *SetNewRtoPendingPtr = TRUE;
+        /* If a client socket is used without TcpIp_Bind() call, the bound local addr idx is not known before.
+           In this case we search for an address to send the SYN and expect the SYN-ACK at the same IP-Address. */
+        if (TcpIp_GetLocalAddrBindIdxOfSocketDyn(socketIdx) == TCPIP_LOCALADDRID_ANY)
+        {
+          TcpIp_SetLocalAddrBindIdxOfSocketDyn(socketIdx, TCPIP_IPV6_TO_LOCAL_ADDR_IDX(ipV6AddrIdx));
+        }
+      }
+    }
   }
-  TxRetrQueueElePtr->TransmitCounter++;
+# endif
 
-  TCPIP_VLEAVE_CRITICAL_SECTION();
+  return retVal;
 }
 
 
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateCwndParamsForTransmission
+ *  TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuffer
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
- *
- *
- *
- *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateCwndParamsForTransmission(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr)
+/* PRQA S 6060 1 */ /* MD_MSR_STPAR */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_CopyDataToIpTxBuffer(
+  TcpIp_SizeOfSocketTcpDynType    SocketTcpIdx,
+  TCPIP_P2V(TcpIp_IpTxRequestDescriptorType) IpTxReqestDescrPtr,
+  TcpIp_SizeOfTcpTxBufferType StartDataIdx,
+  TcpIp_SizeOfTcpTxBufferType DataLen,
+  TCPIP_P2V(uint8) IpPayloadPtr,
+  uint8 TcpHeaderLen)
 {
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Adjust congestion control parameters. */
-
-  /* #20 Check if the current element has already been sent at least once. */
-  if (TxRetrQueueElePtr->TransmitCounter > 0u)
+  /* #10 Check if there is data to send. */
+  if (DataLen > 0u)
   {
-    /* Segment has to be retransmitted. */
+    uint8  *tcpPayloadPtr = NULL_PTR;
+    TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+    TcpIp_SizeOfTcpTxBufferType remLenAtEnd = 0u;
 
-    /* #30 Check if the 'fast retransmit' mechanism has to be applied. */
-    if (TcpIp_IsFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx) == TRUE)
+    TCPIP_ASSERT(tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc());
+    TCPIP_ASSERT(StartDataIdx >= TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
+    TCPIP_ASSERT(StartDataIdx <  TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
+    TCPIP_ASSERT(TcpIp_GetTcpTxBufferLengthOfTcpTxBufferDesc(tcpTxBufferDescIdx) > 0u);
+
+    remLenAtEnd = TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx) - StartDataIdx;
+
+    tcpPayloadPtr = &IpPayloadPtr[TcpHeaderLen];  /* first byte following the TCP header */
+
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+    /* #15 Gather the TCP payload from the user buffers if the socket holds references to zero-copy tx data. */
+    if (TcpIp_Tcp_VTxDataRefIsHeld(SocketTcpIdx) == TRUE)
     {
-      TcpIp_SetFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx, FALSE);  /* reset value */
+      TcpIp_Tcp_VTransmitSegment_GatherDataToIpTxBuffer(SocketTcpIdx, IpTxReqestDescrPtr, StartDataIdx, DataLen,
+        tcpPayloadPtr);
     }
     else
+# endif
+    /* #20 Copy TCP payload to the ip buffer taking care of a wraparound in the TCP buffer. */
+    if (DataLen > remLenAtEnd)
     {
-      /* this is a re-transmit -> we probably have congestion */
-      /* same handling for SYN and non-SYN messages */
-      TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));   /* cwnd = LW = 1*SMSS */
+      /* message is in end and start of circular buffer (split into two parts) */
+      /* circular buffer: |DataPart2|xxxxxxxxxxx|DataPart1|  */
+      TcpIp_SizeOfTcpTxBufferType len1;
+      TcpIp_SizeOfTcpTxBufferType len2;
+      TCPIP_P2C(uint8) src1Ptr;
+      TCPIP_P2C(uint8) src2Ptr;
 
-      /* #40 Check if the segment has the SYN flag set */
-      if ((TCPIP_TCP_CODE_BIT_SYN & TxRetrQueueElePtr->Flags) == 0u)
+      len1    = remLenAtEnd;
+      len2    = DataLen - len1;
+      src1Ptr = TcpIp_GetAddrTcpTxBuffer(StartDataIdx);                                                                 /* TCPIP_CSL_INDEX_ACCEPTED */
+      src2Ptr = TcpIp_GetAddrTcpTxBuffer(TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
+
+      /* copy the two data fragments */
+      if (IpTxReqestDescrPtr->ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
       {
-        /* #50 Set the slow start threshold if the segment has been sent once. */
-        if (1u == TxRetrQueueElePtr->TransmitCounter)
+        const uint8 remaining = (uint8)(len1 % 2u);
+        /* Copy and calculate checksum */
+        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(tcpPayloadPtr, src1Ptr, len1 - remaining,         /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+          IpTxReqestDescrPtr->TmpChecksum, FALSE);
+        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(&tcpPayloadPtr[len1 + remaining],                 /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+          &src2Ptr[remaining], len2 - remaining, IpTxReqestDescrPtr->TmpChecksum, FALSE);
+
+        /* For odd numbers, the IpBase CRC algorithm can't calculate the checksum, so the copy is done seperately. */
+        /* This requirement comes from IpBase_TcpIpChecksumCopyAdd() */
+        if (remaining == 1u)
         {
-          TcpIp_Tcp_VSetSsthreshEqu4(SocketTcpIdx);  /* ssthresh = max[FlightSize / 2, 2*SMSS] */
-          CANOE_WRITE_STRING_1("TcpIp_Tcp_VUpdateCwndParamsForTransmission: ssthresh was set to %d", TcpIp_GetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx));
+          tcpPayloadPtr[len1 - 1u] = src1Ptr[len1 - 1u];                                                                /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+          tcpPayloadPtr[len1     ] = src2Ptr[0];                                                                        /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+          IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumAdd(&tcpPayloadPtr[len1 - 1u], 2u,
+            IpTxReqestDescrPtr->TmpChecksum, FALSE);
         }
       }
       else
       {
-        /* SYN flag is set in this message */
-        /* #60 Trigger reset of RTO for this connection on transition to state 'ESTABLISHED' (set to 3s). */
-        TcpIp_SetRtoResetPendingOfSocketTcpTsOptDyn(SocketTcpIdx, TRUE);
-
-        /* #70 Set the segment number limit to '1'. */
-        TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx, 1u);
+        /* PRQA S 0315 2 */ /* MD_MSR_VStdLibCopy */
+        IpBase_Copy(tcpPayloadPtr, src1Ptr, len1);                                                                      /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+        IpBase_Copy(&tcpPayloadPtr[len1], src2Ptr, len2);                                                               /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
       }
+    }
+    else
+    {
+      /* message is in the circular buffer in one block (unsplit) */
+       TCPIP_P2C(uint8) srcPtr  = TcpIp_GetAddrTcpTxBuffer(StartDataIdx);                                               /* TCPIP_CSL_INDEX_ACCEPTED */
 
-      /* RFC 6582, 3.2 4) */
+      /* copy this data (fragment) */
+      /* since the data is in one block, no Pbuf copy mechanism is necessary */
+      if (IpTxReqestDescrPtr->ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
       {
-        /* #80 Check TransmitCounter of all retry queue elements for this socket not to be '0'. */
-        /* index of the previous retry queue element */
-        TcpIp_SizeOfTcpRetryQElementType prevTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-        TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        while (   (tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
-               && (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TransmitCounter > 0u))
-        {
-          prevTcpRetryQElementIdx = tcpRetryQElementIdx;
-          tcpRetryQElementIdx     = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext;
-        }
-        /* #90 Set the RECOVER variable of the congestion control mechanism to the sequence number of the first element
-        that has not yet been sent (or to the sequence number that follows the last segment that has been sent at least
-        once). */
-        TCPIP_ASSERT(prevTcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
-        /* This code section is only called if at least on element of the retry queue has been sent at least once.
-        Elements in the retry queue are in the order of their sequence number, so it can not occur that an element in
-        the retry queue has already been sent while one of its predecessors in the queue has never been sent before. */
-        /* PRQA S 2843 1 */ /* MD_TCPIP_2843 */
-        TcpIp_SetRecoverOfSocketTcpCongCtrlDyn(SocketTcpIdx, ((TcpIp_GetAddrTcpRetryQElement(prevTcpRetryQElementIdx)->SeqNo
-                                                               + TcpIp_GetAddrTcpRetryQElement(prevTcpRetryQElementIdx)->SizeTotByte)
-                                                               - 1u));
+        /* Copy and calculate checksum */
+        IpTxReqestDescrPtr->TmpChecksum = IpBase_TcpIpChecksumCopyAdd(tcpPayloadPtr, srcPtr, (uint16_least)DataLen,     /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
+          IpTxReqestDescrPtr->TmpChecksum, FALSE);
+      }
+      else
+      {
+        /* PRQA S 0315 1 */ /* MD_MSR_VStdLibCopy */
+        IpBase_Copy(tcpPayloadPtr, srcPtr, (uint16_least)DataLen);                                                      /* VCA_TCPIP_MEMCPY_WITH_CHECKED_PTR_AND_LEN */
       }
 
-      /* #100 Eventually exit fast recovery procedure */
-      TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
     }
-  }
-  else
-  {
-    /* this is a new element that shall be sent */
-  }
+  }  /* if (DataLenByte > 0) */
 }
-# endif /* TCPIP_SUPPORT_TCP_CONGESTION_CONTROL */
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt
+ *  TcpIp_Tcp_VTransmitSegment_WriteHeaderElements
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
- *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt(
-  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
-  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr,
-  TCPIP_P2V(boolean)                   DataSegmentSentPtr)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderElements(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(uint8) TcpHdrPtr,
+  TcpIp_SizeOfTcpTxBufferType DataLen,
+  uint32 SeqNo,
+  uint8 Flags)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType  retValue = E_NOT_OK;
+  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 If this is the first element of the retry queue, delete SACK-flag (always retransmit the first element in the RetrQueue). */
-  if (TxRetrQueueElePtr->ElePrev == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
-  {
-    TxRetrQueueElePtr->SackFlag = 0;  /* delete SACK-flag, always retransmit the first element in the RetrQueue */
-  }
-
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  /* #20 Check if this element has already been noted in a selective acknowledgment message. */
-  if (TxRetrQueueElePtr->SackFlag == 0u)
-# endif
-  {
-    /* #30 Transmit the segment. */
-    if (TcpIp_Tcp_VTransmitSegment(SocketTcpIdx, TxRetrQueueElePtr->Flags, TxRetrQueueElePtr->SeqNo,
-      TxRetrQueueElePtr->OneTimeOptions, TxRetrQueueElePtr->DataBufStartIdx, TxRetrQueueElePtr->SizeTotByte) == E_OK)
-    {
-      retValue = E_OK;
-      *DataSegmentSentPtr = TRUE;
-
-      /* #40 If the segment has never been sent before, update the SendNxt variable. */
-      if (TxRetrQueueElePtr->TransmitCounter == 0u)
-      {
-        /* 'When the sender creates a segment and transmits it the sender advances SND.NXT.'
-        * [RFC793 3.7. Data Communication]
-        */
-        uint32 sndNxt = TxRetrQueueElePtr->SeqNo + TxRetrQueueElePtr->SizeTotByte;
-
-        if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_SYN) != 0u)
-        {
-          sndNxt++;
-        }
+  /* #10 Write the TCP header elements */
+  TCPIP_PUT_UINT16_RAW(TcpHdrPtr, TCPIP_TCP_HDR_SOURCE_PORT_OFFSET, TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)->DomainAndPort.port);
+  TCPIP_PUT_UINT16_RAW(TcpHdrPtr, TCPIP_TCP_HDR_TARGET_PORT_OFFSET, TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->DomainAndPort.port);
 
-        if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
-        {
-          sndNxt++;
-        }
+  TCPIP_PUT_UINT32(TcpHdrPtr, TCPIP_TCP_HDR_SEQ_NUM_OFFSET, SeqNo);
+  TCPIP_PUT_UINT32(TcpHdrPtr, TCPIP_TCP_HDR_ACK_NUM_OFFSET, TcpIp_GetRcvNxtOfSocketTcpDyn(SocketTcpIdx));  /* acknowledge received bytes */
 
-        if (TCPIP_TCP_SEQ1_BIGGER_SEQ2(sndNxt, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx)))
-        {
-          TcpIp_SetSndNxtOfSocketTcpDyn(SocketTcpIdx, sndNxt);
-        }
-        else
-        {
-          /* Avoid setting Tcp_SndNxt to smaller value if segment was recreated due to PathMTU change (TransmitCounter is reset to 0 in that case). */
-        }
-      }
-    }
+  TcpHdrPtr[TCPIP_TCP_HDR_DATA_OFFSET_OFFSET] = TCPIP_TCP_HDR_DEFAULT_DATA_OFFSET_BYTE_VALUE;
+  if (DataLen > 0u)
+  {
+    TcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = (Flags | (uint8)TCPIP_TCP_CODE_BIT_PSH);
   }
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
   else
   {
-    /* #50 This element has already been noted in a selective acknowledgment message, skip this retry once */
-    TxRetrQueueElePtr->SackFlag = 0; /* clear the SACK flag so that the retry will be issued the next time the retransmit-timeout occurs */
-    retValue = E_OK;
+    TcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = Flags;
   }
-# endif
-
-  return retValue;
+  TCPIP_PUT_UINT16(TcpHdrPtr, TCPIP_TCP_HDR_WINDOW_OFFSET,     TcpIp_GetRcvWndOfSocketTcpDyn(SocketTcpIdx));
+  TCPIP_PUT_UINT16(TcpHdrPtr, TCPIP_TCP_HDR_CHECKSUM_OFFSET,   TCPIP_TCP_EMPTY_CHKSUM);
+  TCPIP_PUT_UINT16(TcpHdrPtr, TCPIP_TCP_HDR_URGENT_PTR_OFFSET, TCPIP_TCP_EMPTY_URG_PTR);
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitResetElement
+ *  TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9786,116 +9802,128 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegmentAndUpdate
  *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(BufReq_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitResetElement(
-  TcpIp_TcpRstHandlingIterType TcpRstHandlingIdx,
-  TcpIp_RstTxQueueBufferIterType RstTxQueueBufferIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(uint8) TcpHdrPtr,
+  uint8 OneTimeOptions,
+  uint8 SackNum,
+  uint8 Flags)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  uint8 *tcpHdrPtr = NULL_PTR;
-  uint16 tgtLen = TCPIP_TCP_HDR_LEN_BYTE;
-  TcpIp_IpTxRequestDescriptorType ipTxReqestDescr;
-  TCPIP_P2V(TcpIp_Tcp_RstTxQueueType) rstQueuePtr = TcpIp_GetAddrRstTxQueueBuffer(RstTxQueueBufferIdx);
-  BufReq_ReturnType retVal = BUFREQ_OK;
+  uint8 *hdrOptPtr = &TcpHdrPtr[TCPIP_TCP_HDR_LEN_BYTE];
+  uint8  hdrOptLen = 0;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 For IPv4 sockets request buffer for an IPv4 packet */
-# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
-#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
-  if (rstQueuePtr->RemSock.sa_family == IPBASE_AF_INET)
-#  endif
+# if ((TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_OFF) && (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_OFF))
+  TCPIP_DUMMY_STATEMENT_CONST(OneTimeOptions);                                                                          /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
+
+  if ((TCPIP_TCP_CODE_BIT_SYN & Flags) != 0u)
   {
-    /* V4 */
-    TcpIp_LocalAddrV4IterType ipV4AddrIdx = rstQueuePtr->IpAddrIdx; /* required because IpAddrIdx is uint8 */
+    /* #10 Append the 'maximum segment size' option to the header if this is a SYN message. */
+    hdrOptPtr[TCPIP_TCP_OPT_OFS_KIND]   = TCPIP_TCP_OPT_ID_MAX_SEG_SIZE;
+    hdrOptPtr[TCPIP_TCP_OPT_OFS_LENGTH] = TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE;
+    {
+      TcpIp_SizeOfTcpRxBufferDescType tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
 
-    /* Store the transport protocol information in the tx descriptor */
-    ipTxReqestDescr.XptProtocol = IPV4_IP_PROTOCOL_TCP;
+      /* max size depends on socket rx buffer size and ETH rx message size (minus header) */
+      uint16 maxLen = TcpIp_GetRxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX);
 
-    if (IpV4_Ip_ProvideTxBuffer(&ipV4AddrIdx,
-                                TcpIp_GetIpV4SocketDynTcpRstIdxOfIpV4General(TCPIP_IPV4GENERAL_IDX),
-                                &rstQueuePtr->RemSock.SockAddrIn, &tcpHdrPtr, &tgtLen, &ipTxReqestDescr, FALSE) != BUFREQ_OK)
-    {
-      retVal = BUFREQ_E_BUSY;  /* No buffer could be provided */                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_c */
-    }
+# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+      TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+      if (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->sa_family == IPBASE_AF_INET6)
+      {
+        /* Fixed IPv6 header requires 20 bytes more than already considered IPv4 header. So TCP MSS has to be reduced by 20 bytes. */
+        maxLen -= (TCPIP_IPV6_HDR_LEN_BYTE - TCPIP_IPV4_HDR_LEN_BYTE);
+      }
+#  if (TCPIP_SUPPORT_IPSEC == STD_ON)
+      else
+#  endif
+# endif
+# if (TCPIP_SUPPORT_IPSEC == STD_ON)
+      {
+        /* If IPsec is enabled, always decrement IPsec AH header bytes from Rx MSS */
+        maxLen -= TCPIP_IPSEC_HDR_LEN_MAX;
+      }
+# endif
 
-    /* For the RST packet that checksum shall calculated at once. */
-    if (ipTxReqestDescr.ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
-    {
-      ipTxReqestDescr.ChecksumHwCalced = TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COMPLETE;
+      if (maxLen > TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx))
+      {
+        /* MSS is limited by small TCP RX buffer */
+        maxLen = (uint16)TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx);
+      }
+      TCPIP_PUT_UINT16(hdrOptPtr, TCPIP_TCP_OPT_OFS_VALUE, maxLen);  /* local max for this socket (for rx) */           /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
     }
-    ipTxReqestDescr.TmpChecksum = 0u;
 
-    rstQueuePtr->IpAddrIdx = (TcpIp_SizeOfLocalAddrV4Type)ipV4AddrIdx;
+    hdrOptLen += TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE;
+    hdrOptPtr  = &hdrOptPtr[hdrOptLen];
   }
-#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
-  else
-#  endif
-# endif
-  /* #20 For IPv6 sockets request buffer for an IPv6 packet */
-# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+  if (   (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)                                          /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT))
   {
-    /* V6 */
-    TcpIp_LocalAddrV6IterType ipV6AddrIdx = rstQueuePtr->IpAddrIdx; /* required because IpAddrIdx is uint8 */
+    /* #20 Append the 'timestamp' option to the header if enabled */
+    uint8 *tempHdrOptPtr;
+    uint8 thisOptLen;
 
-    if (IpV6_ProvideTxBuffer(&ipV6AddrIdx, TcpIp_GetIpV6SocketDynTcpRstIdxOfIpV6General(TCPIP_IPV6GENERAL_IDX),
-                             &(rstQueuePtr->RemSock.SockAddrIn6.sin6_addr),
-                             &tcpHdrPtr, &tgtLen, &ipTxReqestDescr, TCPIP_PROTOCOL_TCP, FALSE) != BUFREQ_OK)
-    {
-      retVal = BUFREQ_E_BUSY;  /* No buffer could be provided */                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_c */
-    }
+    /*@ assert $lengthOf(hdrOptPtr) >= TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u; */                                             /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
 
-    /* For the RST packet that checksum shall calculated at once. */
-    if (ipTxReqestDescr.ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
-    {
-      ipTxReqestDescr.ChecksumHwCalced = TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COMPLETE;
-    }
-    ipTxReqestDescr.TmpChecksum = 0u;
+    /* add two NOP elements */
+    hdrOptPtr[0] = TCPIP_TCP_OPT_ID_NOP;
+    hdrOptPtr[1] = TCPIP_TCP_OPT_ID_NOP;
 
-    rstQueuePtr->IpAddrIdx = (TcpIp_SizeOfLocalAddrV6Type)ipV6AddrIdx;
+    /* add timestamp header */
+    tempHdrOptPtr = &hdrOptPtr[2u * TCPIP_TCP_NOP_ELEMENT_LEN];
+    tempHdrOptPtr[TCPIP_TCP_OPT_OFS_KIND]   = TCPIP_TCP_OPT_ID_TIMESTAMP;  /* Kind */
+    tempHdrOptPtr[TCPIP_TCP_OPT_OFS_LENGTH] = TCPIP_TCP_OPT_LEN_TIMESTAMP;  /* OptLen */
+    TCPIP_PUT_UINT32(tempHdrOptPtr,  TCPIP_TCP_OPT_OFS_VALUE, TcpIp_Tcp_GlobalTimestamp);                               /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
+    TCPIP_PUT_UINT32(tempHdrOptPtr, (TCPIP_TCP_OPT_OFS_VALUE + TCPIP_TCP_TIMESTAMP_ELEMENT_LEN),                        /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
+      TcpIp_GetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx));
+
+    thisOptLen = (TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u);
+    hdrOptLen += thisOptLen;
+    hdrOptPtr  = &hdrOptPtr[thisOptLen];
   }
 # endif
-  if (retVal == BUFREQ_OK)
+
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_USER_TIMEOUT) != 0u)
   {
-    /*@ assert $external(tcpHdrPtr) && ($lengthOf(tcpHdrPtr) >= TCPIP_TCP_HDR_LEN_BYTE); */                             /* VCA_TCPIP_IP_BUFFER_PTR */
-    /* #30 Write values to packet */
-    TCPIP_PUT_UINT16_RAW(tcpHdrPtr, TCPIP_TCP_HDR_SOURCE_PORT_OFFSET, rstQueuePtr->LocSock.DomainAndPort.port);
-    TCPIP_PUT_UINT16_RAW(tcpHdrPtr, TCPIP_TCP_HDR_TARGET_PORT_OFFSET, rstQueuePtr->RemSock.DomainAndPort.port);
-    TCPIP_PUT_UINT32(tcpHdrPtr, TCPIP_TCP_HDR_SEQ_NUM_OFFSET, rstQueuePtr->SeqNo);
-    TCPIP_PUT_UINT32(tcpHdrPtr, TCPIP_TCP_HDR_ACK_NUM_OFFSET, rstQueuePtr->AckNo);
+    /* #30 Append the 'user timeout' option to the header if enabled */
+    uint8  thisOptLen = (TCPIP_TCP_OPT_LEN_USER_TIMEOUT);
 
-    tcpHdrPtr[TCPIP_TCP_HDR_DATA_OFFSET_OFFSET] = TCPIP_TCP_HDR_DEFAULT_DATA_OFFSET_BYTE_VALUE;
-    if (rstQueuePtr->Flags == 0u)
-    {
-      tcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = TCPIP_TCP_CODE_BIT_RST;
-    }
-    else
-    {
-      tcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = (uint8)(TCPIP_TCP_CODE_BIT_RST | rstQueuePtr->Flags);
-    }
-    TCPIP_PUT_UINT16(tcpHdrPtr, TCPIP_TCP_HDR_WINDOW_OFFSET, 0u); /* byte order has to be considered if this value is not 0 */
-    TCPIP_PUT_UINT16(tcpHdrPtr, TCPIP_TCP_HDR_CHECKSUM_OFFSET, TCPIP_TCP_EMPTY_CHKSUM); /* checksum will be set by IP layer or hardware later */
-    TCPIP_PUT_UINT16(tcpHdrPtr, TCPIP_TCP_HDR_URGENT_PTR_OFFSET, 0u);
+    hdrOptPtr[TCPIP_TCP_OPT_OFS_KIND]   = TCPIP_TCP_OPT_ID_USER_TIMEOUT;  /* Kind */
+    hdrOptPtr[TCPIP_TCP_OPT_OFS_LENGTH] = TCPIP_TCP_OPT_LEN_USER_TIMEOUT;  /* OptLen */
+    TCPIP_PUT_UINT16(hdrOptPtr, TCPIP_TCP_OPT_OFS_VALUE, TcpIp_GetUtoAdvOfSocketTcpUtoDyn(SocketTcpIdx));               /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
 
-    /* checksum will be calculated by lower layer, value is already set to '0' */
+    hdrOptLen += thisOptLen;
+    hdrOptPtr  = &hdrOptPtr[thisOptLen];
+  }
+# endif
 
-    TCPIP_ASSERT(rstQueuePtr->RemSock.sa_family == ipTxReqestDescr.AddressFamily);
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  {
+    /* #40 Append the 'selective acknowledgment' option to the header if enabled */
+    hdrOptLen += TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions_Sack(SocketTcpIdx, hdrOptPtr, OneTimeOptions, SackNum);
+  }
+# else
+  TCPIP_DUMMY_STATEMENT_CONST(SackNum);                                                                                 /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+  TCPIP_DUMMY_STATEMENT_CONST(hdrOptPtr);                                                                               /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
 
-    /* #40 Transmit packet */
-    if (TcpIp_VIpTransmit(&ipTxReqestDescr, TCPIP_TCP_HDR_LEN_BYTE, TCPIP_PROTOCOL_TCP, 0u, 0u) == E_OK)
-    {
-      rstQueuePtr->RemSock.sa_family = IPBASE_AF_UNSPEC;
-      TcpIp_DecRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(TcpRstHandlingIdx);
-    }
-    else
-    {
-      retVal = BUFREQ_E_NOT_OK;
-    }
+  if (hdrOptLen > 0u)
+  {
+    /* there were some options added */
+    TCPIP_ASSERT_MSG((hdrOptLen % 4u) == 0, "Total option length must always be a multiple of 4.");
+    TcpHdrPtr[TCPIP_TCP_HDR_DATA_OFFSET_OFFSET] += (uint8)((hdrOptLen / 4u) << 4);
   }
+}
 
-  return retVal;
-}
 
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VTransmitResets
+ *  TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions_Sack
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9903,73 +9931,176 @@ TCPIP_LOCAL FUNC(BufReq_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitResetElement(
  *
  *
  *
+ */
+TCPIP_LOCAL FUNC(uint8, TCPIP_CODE) TcpIp_Tcp_VTransmitSegment_WriteHeaderOptions_Sack(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(uint8) TcpHdrOptPtr,
+  uint8 OneTimeOptions,
+  uint8 SackNum)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint8 hdrOptLen = 0;
+  TCPIP_P2V(uint8) locHdrOptPtr = TcpHdrOptPtr;
+
+  /* ----- Implementation ----------------------------------------------- */
+  if ((OneTimeOptions & TCPIP_TCP_OPT_FLAG_SACK_PERMIT) != 0u)
+  {
+    /* #10 Append the 'selective acknowledgment permit' option to the header */
+    uint8  thisOptLen = (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u);
+    /* add SACK permit option */
+    locHdrOptPtr[0] = TCPIP_TCP_OPT_ID_SACK_PERMIT;   /* Kind */                                                        /* VCA_TCPIP_WRITE_SACK_OPT */
+    locHdrOptPtr[1] = TCPIP_TCP_OPT_LEN_SACK_PERMIT;  /* OptLen */                                                      /* VCA_TCPIP_WRITE_SACK_OPT */
+
+    locHdrOptPtr[2] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
+    locHdrOptPtr[3] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
+
+    hdrOptLen += thisOptLen;
+    locHdrOptPtr  = &locHdrOptPtr[thisOptLen];
+  }
+
+  if (   (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 0u)                                                  /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_IsSackOptActiveOfSocketTcpDyn(SocketTcpIdx) == TRUE))
+  {
+    /* #20 Append 'selective acknowledgment' option to the header */
+    /* send list with SackNum (1..4) elements */
+    uint8                         thisOptLen   = 0u;
+    uint8                        *seqPtr       = NULL_PTR;
+    TcpIp_TcpOooQElementIterType  tcpOooQElementIdx    = 0u;
+    uint8_least                   sackNumAdded = 0u;
+
+    /* add SACK option */
+    locHdrOptPtr[0] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
+    locHdrOptPtr[1] = TCPIP_TCP_OPT_ID_NOP;                                                                             /* VCA_TCPIP_WRITE_SACK_OPT */
+
+    locHdrOptPtr[2] = TCPIP_TCP_OPT_ID_SACK;  /* Kind */                                                                /* VCA_TCPIP_WRITE_SACK_OPT */
+    locHdrOptPtr[3] = (uint8)(TCPIP_TCP_OPT_LEN_SACK + (SackNum * TCPIP_TCP_SACK_ELEMENT_LEN));  /* OptLen */ /* variable SackNum is always initialized ! */ /* VCA_TCPIP_WRITE_SACK_OPT */
+
+    /* #30 Add SACK elements */
+    /* Add elements with element order according to RFC 2018, section 4:
+      'The first SACK block (...) MUST specify the contiguous block of data containing the segment which triggered this ACK, ...'
+      'The SACK option SHOULD be filled out by repeating the most recently reported SACK blocks ...' */
+    TCPIP_ASSERT(TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx) < TcpIp_GetSizeOfTcpOooQElement());
+    tcpOooQElementIdx = TcpIp_GetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx);
+
+    seqPtr = &locHdrOptPtr[4];
+
+    /* SackNum is already calculated in function TcpIp_Tcp_VTransmitSegment_CalcHeaderLen and considers the number of
+       elements in the out of order queue. */
+    while (sackNumAdded < SackNum)
+    {
+      TCPIP_PUT_UINT32(seqPtr, 0,  TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->SeqNo);                              /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
+      TCPIP_PUT_UINT32(seqPtr, 4, (TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->SeqNo + TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->LenByte)); /* VCA_TCPIP_TCP_HEADER_OPT_PTR */
+      seqPtr  = &seqPtr[TCPIP_TCP_SACK_ELEMENT_LEN];
+
+      tcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->OlderEleIdx;
+      sackNumAdded++;
+    }
+
+    thisOptLen = (uint8)(TCPIP_TCP_OPT_LEN_SACK + 2u + (SackNum * TCPIP_TCP_SACK_ELEMENT_LEN));
+    hdrOptLen += thisOptLen;
+  }
+
+  return hdrOptLen;
+}
+# endif
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTransmit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
  *
  *
  *
  *
  */
-/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitResets(
-  TcpIp_OsApplicationType ApplId)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmit(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  BufReq_ReturnType            retValue          = BUFREQ_OK;
-  TcpIp_TcpRstHandlingIterType tcpRstHandlingIdx = TcpIp_Tcp_GetRstHandlingOfApplId(ApplId);
+  Std_ReturnType retValue = E_OK;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if there are any pending resets. */
-  if (   (tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandling())
-      && (0u < TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx)))
+  /* #10 Check user timeout of oldest element in retry queue and close connection if timeout has exceeded. */
+  if (TcpIp_Tcp_VCloseConnectionIfNotAcked(SocketTcpIdx) != E_OK)
   {
-    TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
-    uint8 skipedElements = 0;
+    /* Sent data has not been answered too long and therefore the connection has been closed */
+    retValue = E_NOT_OK;
+  }
+  else
+  {
+    boolean setNewRtoPending = FALSE;
+    boolean dataSegmentSent  = FALSE;
 
-    /* #20 Iterate over all buffer items. */
-    for(rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
-      rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
-      rstTxQueueBufferIdx++)
+    /* #20 Iterate over all elements in retry queue and send them if necessary. */
+    TcpIp_Tcp_VSendPendingElements(SocketTcpIdx, &dataSegmentSent, &setNewRtoPending);
+
+    /* #30 Update retransmit timing. */
+    if (setNewRtoPending == TRUE)
     {
-      /*@ assert rstTxQueueBufferIdx < TcpIp_GetSizeOfRstTxQueueBuffer(); */                                            /* VCA_TCPIP_CSL03_START_END */
-      TCPIP_P2C(TcpIp_Tcp_RstTxQueueType) rstQueuePtr = TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx);
+      uint32 newTimeout = 0u;
 
-      /* #30 Skip item if empty. */
-      if (rstQueuePtr->RemSock.sa_family != IPBASE_AF_UNSPEC)
+      /* only for the first RetrQueue element */
+      TcpIp_TcpRetryQElementIterType tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+      if ((tcpRetryQElementIdx == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV) || (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TransmitCounter == 1u))/* PRQA S 3415 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
       {
-        retValue = BUFREQ_E_NOT_OK;
-        /* #40 Skip item if ctr is on other core. */
-# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
-        if (ApplId == rstQueuePtr->ApplId)
+        /* first setting of the retransmit timer */
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+        newTimeout = TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx);
+# else
+        newTimeout = TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx);
 # endif
+      }
+      else
+      {
+        /* there has been at least one retransmission already */
+        /* #40 Exponential backoff, double the timeout each time until maximum value is reached. */
+        newTimeout = (TcpIp_GetRtoReloadValueOfSocketTcpDyn(SocketTcpIdx) * 2u);
+        if (newTimeout > TcpIp_GetRetransTimeoutMaxOfTcpConfig(TCPIP_TCPCONFIG_IDX))
         {
-          /* #50 Verify that core is not OnHold. */
-          if (TcpIp_LocalAddrIdxIsOnHold(rstQueuePtr->IpAddrIdx) == FALSE)
-          {
-            /* #60 Transmit reset item. */
-            retValue = TcpIp_Tcp_VTransmitResetElement(tcpRstHandlingIdx, rstTxQueueBufferIdx);
-          }
+          newTimeout = TcpIp_GetRetransTimeoutMaxOfTcpConfig(TCPIP_TCPCONFIG_IDX);
         }
+      }
+      TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, newTimeout);
+      TcpIp_SetRtoReloadValueOfSocketTcpDyn(SocketTcpIdx, newTimeout);
 
-/* coding -v34 */ /* VCR_TCPIP_E_NOT_OK */
-        if (retValue == BUFREQ_E_NOT_OK)
-/* coding +v34 */
-        {
-          skipedElements++;
-        }
+      /* setNewRtoPending = FALSE; */
+    }
 
-        /* #70 Break loop if no more items can be transmitted. */
-        if (  (skipedElements >= TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx))
-            ||(retValue == BUFREQ_E_BUSY))
+    if (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) > 0u)
+    {
+      TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) - 1u));
+    }
+
+    /* #50 Send an ACK if no data has been sent but sending an ACK has been requested. */
+    if (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_CODE_BIT_ACK)
+    {
+      if (dataSegmentSent == FALSE)
+      {
+        /* an ACK shall be sent */
+        if (TcpIp_Tcp_VTransmitSegment(SocketTcpIdx, TCPIP_TCP_CODE_BIT_ACK, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u, 0u) == E_OK)
         {
-          break;
+          TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
         }
       }
+      else
+      {
+        /* ACK was already sent with data segment. */
+        TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
+      }
     }
   }
+
+  return retValue;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VCloseSocketAndReleaseResources
+ *  TcpIp_Tcp_VCloseConnectionIfNotAcked
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -9977,36 +10108,48 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitResets(
  *
  *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCloseSocketAndReleaseResources(
-  TcpIp_SocketTcpDynIterType         SocketTcpIdx,
-  TcpIp_StateType                    State)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCloseConnectionIfNotAcked(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SocketDynIterType           socketIdx     = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  Std_ReturnType                 retValue  = E_OK;
+  TcpIp_SizeOfSocketDynType      socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-  boolean                           socketUsesTls = TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx);
-# endif
-  /* Store socket owner index for notification before it is reset by TcpIp_VDelSockAddrMapping() below. */
-  TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
-  /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                              /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+  TCPIP_VENTER_CRITICAL_SECTION();
 
-  /* #10 Enter CLOSED state, delete/clear TCB */
-  TcpIp_Tcp_VRestartSock(SocketTcpIdx);
-  TcpIp_VDelSockAddrMapping(socketIdx);
+  /* #10 Access the first RetryQueue element of the socket. */
+  if (TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+  {
+    /* #20 Close the connection if timeout has expired */
+    if (TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx))->UserTimeoutTs == TcpIp_Tcp_GlobalTimestamp)
+    {
+      TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
+      /*@ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                           /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
 
-  /* #20 Signal a 'connection reset' to the user */
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-  TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, State, socketUsesTls);
-# else
-  TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, State, FALSE);
-# endif
+      /* The first element in the RetryQueue has not been ACKed too long (UserTimeout), so cancel the connection */
+
+      /* send reset */
+      TcpIp_Tcp_VSendReset(SocketTcpIdx, txIpAddrIdx, (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)),
+        (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
+        TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx))->SeqNo, 0u, 0u);
+
+      /* enter CLOSED state, delete/clear TCB */
+      TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+
+      retValue = E_NOT_OK;
+    }
+  }
+
+  TCPIP_VLEAVE_CRITICAL_SECTION();
+
+  return retValue;
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VRestartSock
+ *  TcpIp_Tcp_VSendPendingElements
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10017,70 +10160,127 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCloseSocketAndReleaseResources(
  *
  *
  *
+ *
+ *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRestartSock(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(boolean) DataSegmentSentPtr,
+  TCPIP_P2V(boolean) SetNewRtoPendingPtr)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_TcpRetryQElementIterType tcpRetryQElementIdx = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+
   /* ----- Implementation ----------------------------------------------- */
-  TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_CLOSED);
-  TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+  uint16 retrQueueEleCount = 0;
+# endif
 
-# if (TCPIP_SUPPORT_TCP_RX_OOO == STD_ON)
-  TCPIP_ASSERT(TcpIp_HasSocketTcpOooDyn() == TRUE);
-  /* #10 Check if there are out of order elements queued for this socket. */
-  if (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 0u)
+  /* #10 Get RetryQueue element index */
+  /* If the retry queue is not empty the first element index in the queue is taken, if it is empty the first element
+     index equals TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV. */
+  tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+
+  /* #20 Iterate over all elements in retry queue and send them if necessary. */
+  while (tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)                                                       /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
   {
-    /* #20 If there are free ooo elements in the global free elements list, link the last element of the sockets ooo list
-    with the first element of the global free elements list. */
+    TcpIp_Tcp_TxRetrQueueType *txRetrQueueElePtr;
 
-    TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
+    txRetrQueueElePtr = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx);
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+    retrQueueEleCount++;
+# endif
 
-    if (TcpIp_Tcp_OooNumFreeElements > 0u)
+    /* Each segment in the queue must have payload data or be a SYN/FIN segment. */
+    TCPIP_ASSERT((txRetrQueueElePtr->SizeTotByte > 0) || ((txRetrQueueElePtr->Flags & (TCPIP_TCP_CODE_BIT_SYN | TCPIP_TCP_CODE_BIT_FIN)) != 0u));
+
+
+    /* #30 Check if the element should be (re-)transmitted */
+    if (   (txRetrQueueElePtr->TransmitCounter == 0u)  /* counter is 0 (new un-sent element) */                         /* PRQA S 3415 4 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        || (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) == 0u)  /* global timeout expired */
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+        || (TcpIp_IsFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx) == TRUE)  /* fast retransmit pending */
+# endif
+       )
     {
-      TcpIp_TcpOooQElementIterType currentCount;
-      TcpIp_TcpOooQElementPtrType elePtr = NULL_PTR;
+      /* Segment was not transmitted or has to be retransmitted due to a retransmit timeout or a fast retransmit condition. */
 
-      /*  goto last element of the socket's ooo-list */
-      TcpIp_TcpOooQElementIterType tcpOooQElementIdx = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
-      for (currentCount = 0;
-           currentCount < (TcpIp_TcpOooQElementIterType)(TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) - 1u);
-           currentCount++)
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+      /* #40 Udate cwnd parameters. */
+      TcpIp_Tcp_VUpdateCwndParamsForTransmission(SocketTcpIdx, txRetrQueueElePtr);
+
+      /* #50 Check if the segment can be sent according to cwnd conditions. */
+      if (   (TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx) > 0u)                                        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          && (retrQueueEleCount > TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx)))
       {
-        tcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->NextEleIdx;
+        /* cwnd is set to an initial value, so only a limited number of segments may be sent */
+        /* limit exceeded -> skip this element and the following ones */
+        break;                                                                                                          /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
       }
-      /* last element in socket ooo list reached, now link it to the free-list */
-      /*@ assert tcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                                /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-      elePtr = TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx);
-      /*@ assert elePtr != NULL_PTR; */                                                                                 /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
-      elePtr->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
-    }
 
-    /* #30 Integrate the sockets ooo list elements into the global list of free elements. */
-    /* prepend ooo-list elements to the global list of free elements */
-    TcpIp_Tcp_OooFirstFreeEleIdx  = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
-    TcpIp_Tcp_OooNumFreeElements += TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
+      if (TCPIP_TCP_SEQ1_BIGGER_SEQ2((txRetrQueueElePtr->SeqNo + txRetrQueueElePtr->SizeTotByte),
+           (   TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx))->SeqNo
+            +  TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx)
+            + ((uint32) TcpIp_GetDupAckCntOfSocketTcpCongCtrlDyn(SocketTcpIdx) * (uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)))))
+          /* (current element end sequence number) > (first element sequence number + cwnd + (DupAckCnt * SMSS)) */
+          /* cwnd is increased according to RFC 5681, section 3.2
+          '4.  For each additional duplicate ACK received (after the third), cwnd MUST be incremented by SMSS.'. */
+      {
+        /* Element does not fit into cwnd, so it can't be sent. Stop sending elements following the current one, since they won't fit into cwnd, neither. */
+        /* skip this element and the following ones */
+        break;                                                                                                          /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
+      }
+# endif
+      {
+        /* try to send the segment */
 
-    TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+        /* #60 Stop checking further queue elements if the current one does not fit into the send window. */
+        if (TcpIp_Tcp_VSendPendingElements_CheckIfSegmentFitsInWindow(SocketTcpIdx, txRetrQueueElePtr) == FALSE)
+        {
+          break;                                                                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
+        }
 
-    /* reset size of socket's ooo-list */
-    TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, TcpIp_GetSizeOfTcpOooQElement());
-    TcpIp_SetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx, 0);
-  }
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+        /* Stop sending new segments if the pacing budget of this MainFunction cycle is used up. Retransmissions are
+           not paced. */
+        if (   (txRetrQueueElePtr->TransmitCounter == 0u)
+            && (TcpIp_Tcp_VPacingConsume(SocketTcpIdx, txRetrQueueElePtr->SizeTotByte) == FALSE))
+        {
+          break;                                                                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
+        }
 # endif
 
-  /* #40 Release TCP assigned rx and tx buffer */
-  TcpIp_Tcp_VReleaseAssignedBuffers(SocketTcpIdx);
-  TcpIp_SetRequestedRxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetRequestedTxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
+        /* #70 Transmit the segment and update SndNxt value */
+        if (TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt(SocketTcpIdx, txRetrQueueElePtr, DataSegmentSentPtr) == E_OK)
+        {
+          /* transmission was successful */
 
-  /* #50 Init the socket variables */
-  TcpIp_Tcp_VInitSock(SocketTcpIdx);
+          /* #80 Update Retransmit Timing and eventually remove segment from RetryQueue */
+          TcpIp_Tcp_VSendPendingElements_UpdateRetransmitTiming(SocketTcpIdx, txRetrQueueElePtr, SetNewRtoPendingPtr);
+        }
+        else
+        {
+          /* This is an error condition, caused by the lower layer (IP, EthIf...).
+             E.g. IP next hop is currently unreachable or no ethernet TX buffer is available.
+             Stop trying to send following elements in retry queue because this might lead to out of order transmission.
+             Retry transmission starting with this segment in next MainFunction. */
+          break;                                                                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_b */
+        }
+      }
+    }
+    else
+    {
+      /* nothing to do, skip this element */
+    }
+
+    tcpRetryQElementIdx = txRetrQueueElePtr->EleNext;
+  }  /* while ( all RetrQueue elements ) */
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VInitSock
+ *  TcpIp_Tcp_VSendPendingElements_CheckIfSegmentFitsInWindow
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10090,150 +10290,1671 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRestartSock(
  *
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitSock(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements_CheckIfSegmentFitsInWindow(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32   dataLen             = TxRetrQueueElePtr->SizeTotByte;
+  boolean  segmentFitsInWindow = TRUE;
+
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
+  /* #10 Check that the length of the current retry queue element is not 0. */
+  if (dataLen > 0u)
+  {
+    /* #20 Check if tx window is not 0. */
+    if (TcpIp_GetSndWndOfSocketTcpDyn(SocketTcpIdx) > 0u)
+    {
+      /* #30 Check if tx window is big enough for the current element */
+      if ((TCPIP_TCP_SEQ1_BIGGER_SEQ2((TxRetrQueueElePtr->SeqNo + dataLen),
+        (TcpIp_GetSndWl2OfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetSndWndOfSocketTcpDyn(SocketTcpIdx)))))
+      {
+        /* tx window is too small for sending this message */
+        segmentFitsInWindow = FALSE;
+      }
+    }
+    else
+    {
+      /* #40 The send window has size '0' (is closed), check if a zero window probe already exists, otherwise create one. */
+      /* Hint: A zero window probe element (which always has size '1') always is the first element in the retry queue. */
+      if (TxRetrQueueElePtr->ElePrev == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+      {
+        /* The current retry queue element is the first retry queue element of this socket */
+        if (TxRetrQueueElePtr->SizeTotByte == 1u)
+        {
+          /* this is a zero window probe, just go ahead, so nothing here */
+        }
+        else if (TcpIp_GetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx) == 0u)
+        {
+          uint32 sndNxt = 0u;
+          /* The first element in the TxRetrQueue has to be split into 1 byte and the rest.
+             It is important here, that 'TcpIp_Tcp_VSplitFirstRetrQueueEle' does not remove the first element from
+             the retry queue. Otherwise iteration in 'TcpIp_Tcp_VSendPendingElements' would continue iteration over the
+             free list. */
+          TcpIp_Tcp_VSplitFirstRetrQueueEle(SocketTcpIdx);
+          dataLen = TxRetrQueueElePtr->SizeTotByte;
 
-  /* #10 Init rx and tx window */
-  TcpIp_SetIssOfSocketTcpDyn(SocketTcpIdx, TcpIp_Tcp_GlobalTimestamp * (250u * TCPIP_MAIN_FCT_PERIOD_MSEC));  /* inc iss every 4 microseconds */
-  TcpIp_SetSndUnaOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(SocketTcpIdx));  /* ISS */
-  TcpIp_SetSndNxtOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(SocketTcpIdx));  /* ISS */
-  TcpIp_SetRcvWndOfSocketTcpDyn(SocketTcpIdx,  0);
+          /* Increment the TransmitCounter to ensure exponential backoff of the zero window probes starting from the
+             first message. The sndNxt value has to be incremented by the size of the zero window probe (1 byte) to
+             replace the normal processing during the first transmission in function
+             TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt. */
+          TxRetrQueueElePtr->TransmitCounter++;
+          sndNxt = TxRetrQueueElePtr->SeqNo + 1u;
+          TcpIp_SetSndNxtOfSocketTcpDyn(SocketTcpIdx, sndNxt);
+        }
+        else
+        {
+          segmentFitsInWindow = FALSE;
+        }
+      }
+      else
+      {
+        /* this is not a zero window probe element */
+        segmentFitsInWindow = FALSE;
+      }
+    }
 
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+    /* #50 Check if segment fits in cwnd */
+    if (TCPIP_TCP_SEQ1_BIGGER_SEQ2((TxRetrQueueElePtr->SeqNo + dataLen), (TcpIp_GetSndWl2OfSocketTcpDyn(SocketTcpIdx) + TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx))))
+    {
+      /* cwnd does not allow to send this segment */
+      /* This could prevent a zero window probe element from being sent if cwnd = 0. */
+      segmentFitsInWindow = FALSE;
+    }
+# else
+    TCPIP_DUMMY_STATEMENT_CONST(dataLen);                                                                               /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
+  }
 
-  /* init the tx request variables */
-  TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
+  return segmentFitsInWindow;
+}
 
-  TcpIp_SetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, TRUE);
 
-  /* Init rx buffer */
-  TcpIp_SetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx, 0);
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VSendPendingElements_UpdateRetransmitTiming
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSendPendingElements_UpdateRetransmitTiming(
+  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr,
+  TCPIP_P2V(boolean)                   SetNewRtoPendingPtr)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Update the idle timeout */
 
-  /* #20 Init/delete tx queue */
-  TcpIp_Tcp_VDelTxQueue(SocketTcpIdx);
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+  TcpIp_SetIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx) + 2u));  /* reset the idle timer on each sent segment */
+# else
+  TCPIP_DUMMY_STATEMENT_CONST(SocketTcpIdx);                                                                            /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+# endif
 
-  TCPIP_ASSERT(TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) == TcpIp_GetSizeOfTcpRxBufferDesc());
-  TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx, 0);
+  TCPIP_VENTER_CRITICAL_SECTION();
 
-  TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, 0); /* set MSS to zero. This value will be overwritten by the MSS option of a received SYN or the default MSS for IPv4/IpV6 */
-  TcpIp_SetTxMssAgreedOfSocketTcpDyn(SocketTcpIdx, 0);
+  /* #20 Update the transmit counter */
 
-  TcpIp_SetPathMtuNewSizeOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetPathMtuChangedOfSocketTcpDyn(SocketTcpIdx, FALSE);
+  /* reload retransmission timeout only for retransmissions of the first element in the RetrQueue */
+  if (TxRetrQueueElePtr->ElePrev == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+  {
+    /* trigger reset of RTO */
+    *SetNewRtoPendingPtr = TRUE;
+  }
+  TxRetrQueueElePtr->TransmitCounter++;
 
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
-  TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
-  TcpIp_SetEnabledOfSocketTcpNagleDyn(SocketTcpIdx, TRUE);
-  TcpIp_SetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx, 0);
-# endif
+  TCPIP_VLEAVE_CRITICAL_SECTION();
+}
 
-  /* #30 Init variables for tx options */
-  TcpIp_SetTxOptLenOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, 0);
 
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-  TcpIp_SetUtoEnabledOfSocketTcpUtoDyn(SocketTcpIdx, FALSE);  /* RFC 5482 defines default = FALSE */
-  TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, TRUE);
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VUpdateCwndParamsForTransmission
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateCwndParamsForTransmission(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Adjust congestion control parameters. */
+
+  /* #20 Check if the current element has already been sent at least once. */
+  if (TxRetrQueueElePtr->TransmitCounter > 0u)
+  {
+    /* Segment has to be retransmitted. */
+
+    /* #30 Check if the 'fast retransmit' mechanism has to be applied. */
+    if (TcpIp_IsFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx) == TRUE)
+    {
+      TcpIp_SetFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx, FALSE);  /* reset value */
+    }
+    else
+    {
+      /* this is a re-transmit -> we probably have congestion */
+      /* same handling for SYN and non-SYN messages */
+      TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));   /* cwnd = LW = 1*SMSS */
+
+      /* #40 Check if the segment has the SYN flag set */
+      if ((TCPIP_TCP_CODE_BIT_SYN & TxRetrQueueElePtr->Flags) == 0u)
+      {
+        /* #50 Set the slow start threshold if the segment has been sent once. */
+        if (1u == TxRetrQueueElePtr->TransmitCounter)
+        {
+          TcpIp_Tcp_VSetSsthreshEqu4(SocketTcpIdx);  /* ssthresh = max[FlightSize / 2, 2*SMSS] */
+          CANOE_WRITE_STRING_1("TcpIp_Tcp_VUpdateCwndParamsForTransmission: ssthresh was set to %d", TcpIp_GetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx));
+        }
+      }
+      else
+      {
+        /* SYN flag is set in this message */
+        /* #60 Trigger reset of RTO for this connection on transition to state 'ESTABLISHED' (set to 3s). */
+        TcpIp_SetRtoResetPendingOfSocketTcpTsOptDyn(SocketTcpIdx, TRUE);
+
+        /* #70 Set the segment number limit to '1'. */
+        TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx, 1u);
+      }
+
+      /* RFC 6582, 3.2 4) */
+      {
+        /* #80 Check TransmitCounter of all retry queue elements for this socket not to be '0'. */
+        /* index of the previous retry queue element */
+        TcpIp_SizeOfTcpRetryQElementType prevTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+        TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+        /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        while (   (tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+               && (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TransmitCounter > 0u))
+        {
+          prevTcpRetryQElementIdx = tcpRetryQElementIdx;
+          tcpRetryQElementIdx     = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext;
+        }
+        /* #90 Set the RECOVER variable of the congestion control mechanism to the sequence number of the first element
+        that has not yet been sent (or to the sequence number that follows the last segment that has been sent at least
+        once). */
+        TCPIP_ASSERT(prevTcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
+        /* This code section is only called if at least on element of the retry queue has been sent at least once.
+        Elements in the retry queue are in the order of their sequence number, so it can not occur that an element in
+        the retry queue has already been sent while one of its predecessors in the queue has never been sent before. */
+        /* PRQA S 2843 1 */ /* MD_TCPIP_2843 */
+        TcpIp_SetRecoverOfSocketTcpCongCtrlDyn(SocketTcpIdx, ((TcpIp_GetAddrTcpRetryQElement(prevTcpRetryQElementIdx)->SeqNo
+                                                               + TcpIp_GetAddrTcpRetryQElement(prevTcpRetryQElementIdx)->SizeTotByte)
+                                                               - 1u));
+      }
+
+      /* #100 Eventually exit fast recovery procedure */
+      TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
+    }
+  }
+  else
+  {
+    /* this is a new element that shall be sent */
+  }
+}
+# endif /* TCPIP_SUPPORT_TCP_CONGESTION_CONTROL */
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitSegmentAndUpdateSndNxt(
+  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr,
+  TCPIP_P2V(boolean)                   DataSegmentSentPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType  retValue = E_NOT_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 If this is the first element of the retry queue, delete SACK-flag (always retransmit the first element in the RetrQueue). */
+  if (TxRetrQueueElePtr->ElePrev == TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+  {
+    TxRetrQueueElePtr->SackFlag = 0;  /* delete SACK-flag, always retransmit the first element in the RetrQueue */
+  }
+
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  /* #20 Check if this element has already been noted in a selective acknowledgment message. */
+  if (TxRetrQueueElePtr->SackFlag == 0u)
 # endif
+  {
+    /* #30 Transmit the segment. */
+    if (TcpIp_Tcp_VTransmitSegment(SocketTcpIdx, TxRetrQueueElePtr->Flags, TxRetrQueueElePtr->SeqNo,
+      TxRetrQueueElePtr->OneTimeOptions, TxRetrQueueElePtr->DataBufStartIdx, TxRetrQueueElePtr->SizeTotByte) == E_OK)
+    {
+      retValue = E_OK;
+      *DataSegmentSentPtr = TRUE;
 
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-  TcpIp_Tcp_VKeepAliveReset(SocketTcpIdx);
+      /* #40 If the segment has never been sent before, update the SendNxt variable. */
+      if (TxRetrQueueElePtr->TransmitCounter == 0u)
+      {
+        /* 'When the sender creates a segment and transmits it the sender advances SND.NXT.'
+        * [RFC793 3.7. Data Communication]
+        */
+        uint32 sndNxt = TxRetrQueueElePtr->SeqNo + TxRetrQueueElePtr->SizeTotByte;
+
+        if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_SYN) != 0u)
+        {
+          sndNxt++;
+        }
+
+        if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
+        {
+          sndNxt++;
+        }
+
+        if (TCPIP_TCP_SEQ1_BIGGER_SEQ2(sndNxt, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx)))
+        {
+          TcpIp_SetSndNxtOfSocketTcpDyn(SocketTcpIdx, sndNxt);
+        }
+        else
+        {
+          /* Avoid setting Tcp_SndNxt to smaller value if segment was recreated due to PathMTU change (TransmitCounter is reset to 0 in that case). */
+        }
+      }
+    }
+  }
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  else
+  {
+    /* #50 This element has already been noted in a selective acknowledgment message, skip this retry once */
+    TxRetrQueueElePtr->SackFlag = 0; /* clear the SACK flag so that the retry will be issued the next time the retransmit-timeout occurs */
+    retValue = E_OK;
+  }
 # endif
 
-  /* #40 Init retransmission timing values */
-  TcpIp_SetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRetransTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX));
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-  TcpIp_SetTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx, FALSE);
-  TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx, 0);
+  return retValue;
+}
 
-  TcpIp_SetSRttOfSocketTcpTsOptDyn(SocketTcpIdx, 0);
-  TcpIp_SetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx, 0);
-  TcpIp_SetRtoStateOfSocketTcpTsOptDyn(SocketTcpIdx, TCPIP_TCP_RTO_STATE_FIRST_CALC_PROCEEDED);
-  TcpIp_SetRtoResetPendingOfSocketTcpTsOptDyn(SocketTcpIdx, FALSE);
 
-  TcpIp_Tcp_VInitTimeStampCalculation(SocketTcpIdx);
-# else
-  TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));
-  TcpIp_SetRtoReloadValueOfSocketTcpDyn(   SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));
-# endif
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTransmitResetElement
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(BufReq_ReturnType, TCPIP_CODE) TcpIp_Tcp_VTransmitResetElement(
+  TcpIp_TcpRstHandlingIterType TcpRstHandlingIdx,
+  TcpIp_RstTxQueueBufferIterType RstTxQueueBufferIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint8 *tcpHdrPtr = NULL_PTR;
+  uint16 tgtLen = TCPIP_TCP_HDR_LEN_BYTE;
+  TcpIp_IpTxRequestDescriptorType ipTxReqestDescr;
+  TCPIP_P2V(TcpIp_Tcp_RstTxQueueType) rstQueuePtr = TcpIp_GetAddrRstTxQueueBuffer(RstTxQueueBufferIdx);
+  BufReq_ReturnType retVal = BUFREQ_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 For IPv4 sockets request buffer for an IPv4 packet */
+# if (TCPIP_SUPPORT_IPV4 == STD_ON)                                                                                     /* COV_TCPIP_IPV4_ALWAYS_ON */
+#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
+  if (rstQueuePtr->RemSock.sa_family == IPBASE_AF_INET)
+#  endif
+  {
+    /* V4 */
+    TcpIp_LocalAddrV4IterType ipV4AddrIdx = rstQueuePtr->IpAddrIdx; /* required because IpAddrIdx is uint8 */
+
+    /* Store the transport protocol information in the tx descriptor */
+    ipTxReqestDescr.XptProtocol = IPV4_IP_PROTOCOL_TCP;
+
+    if (IpV4_Ip_ProvideTxBuffer(&ipV4AddrIdx,
+                                TcpIp_GetIpV4SocketDynTcpRstIdxOfIpV4General(TCPIP_IPV4GENERAL_IDX),
+                                &rstQueuePtr->RemSock.SockAddrIn, &tcpHdrPtr, &tgtLen, &ipTxReqestDescr, FALSE) != BUFREQ_OK)
+    {
+      retVal = BUFREQ_E_BUSY;  /* No buffer could be provided */                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_c */
+    }
+
+    /* For the RST packet that checksum shall calculated at once. */
+    if (ipTxReqestDescr.ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
+    {
+      ipTxReqestDescr.ChecksumHwCalced = TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COMPLETE;
+    }
+    ipTxReqestDescr.TmpChecksum = 0u;
+
+    rstQueuePtr->IpAddrIdx = (TcpIp_SizeOfLocalAddrV4Type)ipV4AddrIdx;
+  }
+#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
+  else
+#  endif
+# endif
+  /* #20 For IPv6 sockets request buffer for an IPv6 packet */
+# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+  {
+    /* V6 */
+    TcpIp_LocalAddrV6IterType ipV6AddrIdx = rstQueuePtr->IpAddrIdx; /* required because IpAddrIdx is uint8 */
+
+    if (IpV6_ProvideTxBuffer(&ipV6AddrIdx, TcpIp_GetIpV6SocketDynTcpRstIdxOfIpV6General(TCPIP_IPV6GENERAL_IDX),
+                             &(rstQueuePtr->RemSock.SockAddrIn6.sin6_addr),
+                             &tcpHdrPtr, &tgtLen, &ipTxReqestDescr, TCPIP_PROTOCOL_TCP, FALSE) != BUFREQ_OK)
+    {
+      retVal = BUFREQ_E_BUSY;  /* No buffer could be provided */                                                        /* PRQA S 0771 */ /* MD_TCPIP_TCP_15.4_0771_c */
+    }
+
+    /* For the RST packet that checksum shall calculated at once. */
+    if (ipTxReqestDescr.ChecksumHwCalced == TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COPY)
+    {
+      ipTxReqestDescr.ChecksumHwCalced = TCPIP_IP_PROTOCOL_CHECKSUM_CHECK_COMPLETE;
+    }
+    ipTxReqestDescr.TmpChecksum = 0u;
+
+    rstQueuePtr->IpAddrIdx = (TcpIp_SizeOfLocalAddrV6Type)ipV6AddrIdx;
+  }
+# endif
+  if (retVal == BUFREQ_OK)
+  {
+    /*@ assert $external(tcpHdrPtr) && ($lengthOf(tcpHdrPtr) >= TCPIP_TCP_HDR_LEN_BYTE); */                             /* VCA_TCPIP_IP_BUFFER_PTR */
+    /* #30 Write values to packet */
+    TCPIP_PUT_UINT16_RAW(tcpHdrPtr, TCPIP_TCP_HDR_SOURCE_PORT_OFFSET, rstQueuePtr->LocSock.DomainAndPort.port);
+    TCPIP_PUT_UINT16_RAW(tcpHdrPtr, TCPIP_TCP_HDR_TARGET_PORT_OFFSET, rstQueuePtr->RemSock.DomainAndPort.port);
+    TCPIP_PUT_UINT32(tcpHdrPtr, TCPIP_TCP_HDR_SEQ_NUM_OFFSET, rstQueuePtr->SeqNo);
+    TCPIP_PUT_UINT32(tcpHdrPtr, TCPIP_TCP_HDR_ACK_NUM_OFFSET, rstQueuePtr->AckNo);
+
+    tcpHdrPtr[TCPIP_TCP_HDR_DATA_OFFSET_OFFSET] = TCPIP_TCP_HDR_DEFAULT_DATA_OFFSET_BYTE_VALUE;
+    if (rstQueuePtr->Flags == 0u)
+    {
+      tcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = TCPIP_TCP_CODE_BIT_RST;
+    }
+    else
+    {
+      tcpHdrPtr[TCPIP_TCP_HDR_CODE_BITS_OFFSET] = (uint8)(TCPIP_TCP_CODE_BIT_RST | rstQueuePtr->Flags);
+    }
+    TCPIP_PUT_UINT16(tcpHdrPtr, TCPIP_TCP_HDR_WINDOW_OFFSET, 0u); /* byte order has to be considered if this value is not 0 */
+    TCPIP_PUT_UINT16(tcpHdrPtr, TCPIP_TCP_HDR_CHECKSUM_OFFSET, TCPIP_TCP_EMPTY_CHKSUM); /* checksum will be set by IP layer or hardware later */
+    TCPIP_PUT_UINT16(tcpHdrPtr, TCPIP_TCP_HDR_URGENT_PTR_OFFSET, 0u);
+
+    /* checksum will be calculated by lower layer, value is already set to '0' */
+
+    TCPIP_ASSERT(rstQueuePtr->RemSock.sa_family == ipTxReqestDescr.AddressFamily);
+
+    /* #40 Transmit packet */
+    if (TcpIp_VIpTransmit(&ipTxReqestDescr, TCPIP_TCP_HDR_LEN_BYTE, TCPIP_PROTOCOL_TCP, 0u, 0u) == E_OK)
+    {
+      rstQueuePtr->RemSock.sa_family = IPBASE_AF_UNSPEC;
+      TcpIp_DecRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(TcpRstHandlingIdx);
+    }
+    else
+    {
+      retVal = BUFREQ_E_NOT_OK;
+    }
+  }
+
+  return retVal;
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VTransmitResets
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VTransmitResets(
+  TcpIp_OsApplicationType ApplId)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  BufReq_ReturnType            retValue          = BUFREQ_OK;
+  TcpIp_TcpRstHandlingIterType tcpRstHandlingIdx = TcpIp_Tcp_GetRstHandlingOfApplId(ApplId);
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if there are any pending resets. */
+  if (   (tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandling())
+      && (0u < TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx)))
+  {
+    TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
+    uint8 skipedElements = 0;
+
+    /* #20 Iterate over all buffer items. */
+    for(rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
+      rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
+      rstTxQueueBufferIdx++)
+    {
+      /*@ assert rstTxQueueBufferIdx < TcpIp_GetSizeOfRstTxQueueBuffer(); */                                            /* VCA_TCPIP_CSL03_START_END */
+      TCPIP_P2C(TcpIp_Tcp_RstTxQueueType) rstQueuePtr = TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx);
+
+      /* #30 Skip item if empty. */
+      if (rstQueuePtr->RemSock.sa_family != IPBASE_AF_UNSPEC)
+      {
+        retValue = BUFREQ_E_NOT_OK;
+        /* #40 Skip item if ctr is on other core. */
+# if (TCPIP_MULTICORE_SUPPORT_ENABLED == STD_ON)                                                                        /* COV_TCPIP_MULTICORE_SUPPORT_NEVER_ON */
+        if (ApplId == rstQueuePtr->ApplId)
+# endif
+        {
+          /* #50 Verify that core is not OnHold. */
+          if (TcpIp_LocalAddrIdxIsOnHold(rstQueuePtr->IpAddrIdx) == FALSE)
+          {
+            /* #60 Transmit reset item. */
+            retValue = TcpIp_Tcp_VTransmitResetElement(tcpRstHandlingIdx, rstTxQueueBufferIdx);
+          }
+        }
+
+/* coding -v34 */ /* VCR_TCPIP_E_NOT_OK */
+        if (retValue == BUFREQ_E_NOT_OK)
+/* coding +v34 */
+        {
+          skipedElements++;
+        }
+
+        /* #70 Break loop if no more items can be transmitted. */
+        if (  (skipedElements >= TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx))
+            ||(retValue == BUFREQ_E_BUSY))
+        {
+          break;
+        }
+      }
+    }
+  }
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCloseSocketAndReleaseResources
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCloseSocketAndReleaseResources(
+  TcpIp_SocketTcpDynIterType         SocketTcpIdx,
+  TcpIp_StateType                    State)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SocketDynIterType           socketIdx     = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+
+  /* ----- Implementation ----------------------------------------------- */
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+  boolean                           socketUsesTls = TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx);
+# endif
+  /* Store socket owner index for notification before it is reset by TcpIp_VDelSockAddrMapping() below. */
+  TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
+  /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                              /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+
+  /* #10 Enter CLOSED state, delete/clear TCB */
+  TcpIp_Tcp_VRestartSock(SocketTcpIdx);
+  TcpIp_VDelSockAddrMapping(socketIdx);
+
+  /* #20 Signal a 'connection reset' to the user */
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+  TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, State, socketUsesTls);
+# else
+  TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, State, FALSE);
+# endif
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VRestartSock
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRestartSock(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  TcpIp_SetSockStateOfSocketTcpDyn(    SocketTcpIdx, TCPIP_TCP_SOCK_STATE_CLOSED);
+  TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
+
+# if (TCPIP_SUPPORT_TCP_RX_OOO == STD_ON)
+  TCPIP_ASSERT(TcpIp_HasSocketTcpOooDyn() == TRUE);
+  /* #10 Check if there are out of order elements queued for this socket. */
+  if (TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) > 0u)
+  {
+    /* #20 If there are free ooo elements in the global free elements list, link the last element of the sockets ooo list
+    with the first element of the global free elements list. */
+
+    TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
+
+    if (TcpIp_Tcp_OooNumFreeElements > 0u)
+    {
+      TcpIp_TcpOooQElementIterType currentCount;
+      TcpIp_TcpOooQElementPtrType elePtr = NULL_PTR;
+
+      /*  goto last element of the socket's ooo-list */
+      TcpIp_TcpOooQElementIterType tcpOooQElementIdx = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
+      for (currentCount = 0;
+           currentCount < (TcpIp_TcpOooQElementIterType)(TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx) - 1u);
+           currentCount++)
+      {
+        tcpOooQElementIdx = TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx)->NextEleIdx;
+      }
+      /* last element in socket ooo list reached, now link it to the free-list */
+      /*@ assert tcpOooQElementIdx < TcpIp_GetSizeOfTcpOooQElement(); */                                                /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+      elePtr = TcpIp_GetAddrTcpOooQElement(tcpOooQElementIdx);
+      /*@ assert elePtr != NULL_PTR; */                                                                                 /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_OOO_ELE_IDX */
+      elePtr->NextEleIdx = TcpIp_Tcp_OooFirstFreeEleIdx;
+    }
+
+    /* #30 Integrate the sockets ooo list elements into the global list of free elements. */
+    /* prepend ooo-list elements to the global list of free elements */
+    TcpIp_Tcp_OooFirstFreeEleIdx  = TcpIp_GetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx);
+    TcpIp_Tcp_OooNumFreeElements += TcpIp_GetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx);
+
+    TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+
+    /* reset size of socket's ooo-list */
+    TcpIp_SetTcpOooQElementFirstIdxOfSocketTcpOooDyn(SocketTcpIdx, TCPIP_TCP_OOO_ELE_IDX_INV);
+    TcpIp_SetTcpOooQFillNumOfSocketTcpOooDyn(SocketTcpIdx, 0);
+#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+    TcpIp_SetTcpOooQElementLastChangedIdxOfSocketTcpOooDyn(SocketTcpIdx, TCPIP_TCP_OOO_ELE_IDX_INV);
+#  endif
+  }
+# endif
+
+  /* #40 Release TCP assigned rx and tx buffer */
+  TcpIp_Tcp_VReleaseAssignedBuffers(SocketTcpIdx);
+  TcpIp_SetRequestedRxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetRequestedTxBufferSizeOfSocketTcpDyn(SocketTcpIdx, 0);
+
+  /* #50 Init the socket variables */
+  TcpIp_Tcp_VInitSock(SocketTcpIdx);
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VInitSock
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitSock(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  TCPIP_ASSERT(SocketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn());
+
+  /* #10 Init rx and tx window */
+  TcpIp_SetIssOfSocketTcpDyn(SocketTcpIdx, TcpIp_Tcp_GlobalTimestamp * (250u * TCPIP_MAIN_FCT_PERIOD_MSEC));  /* inc iss every 4 microseconds */
+  TcpIp_SetSndUnaOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(SocketTcpIdx));  /* ISS */
+  TcpIp_SetSndNxtOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(SocketTcpIdx));  /* ISS */
+  TcpIp_SetRcvWndOfSocketTcpDyn(SocketTcpIdx,  0);
+
+
+  /* init the tx request variables */
+  TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, 0);
+
+  TcpIp_SetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, TRUE);
+
+  /* Init rx buffer */
+  TcpIp_SetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx, 0);
+
+  /* #20 Init/delete tx queue */
+  TcpIp_Tcp_VDelTxQueue(SocketTcpIdx);
+
+  TCPIP_ASSERT(TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) == TcpIp_GetSizeOfTcpRxBufferDesc());
+  TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx, 0);
+
+  TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, 0); /* set MSS to zero. This value will be overwritten by the MSS option of a received SYN or the default MSS for IPv4/IpV6 */
+  TcpIp_SetTxMssAgreedOfSocketTcpDyn(SocketTcpIdx, 0);
+
+  TcpIp_SetPathMtuNewSizeOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetPathMtuChangedOfSocketTcpDyn(SocketTcpIdx, FALSE);
+
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
+  TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
+  TcpIp_SetEnabledOfSocketTcpNagleDyn(SocketTcpIdx, TRUE);
+  TcpIp_SetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx, 0);
+# endif
+
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+  /* Fall back to the default congestion control (Reno without pacing). */
+  (void)TcpIp_Tcp_VCongCtrlExtAssign(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO, FALSE);
+# endif
+
+  /* #30 Init variables for tx options */
+  TcpIp_SetTxOptLenOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, 0);
+
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+  TcpIp_SetUtoEnabledOfSocketTcpUtoDyn(SocketTcpIdx, FALSE);  /* RFC 5482 defines default = FALSE */
+  TcpIp_SetUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx, TRUE);
+# endif
+
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+  TcpIp_Tcp_VKeepAliveReset(SocketTcpIdx);
+# endif
+
+  /* #40 Init retransmission timing values */
+  TcpIp_SetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRetransTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+  TcpIp_SetTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx, FALSE);
+  TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx, 0);
+
+  TcpIp_SetSRttOfSocketTcpTsOptDyn(SocketTcpIdx, 0);
+  TcpIp_SetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx, 0);
+  TcpIp_SetRtoStateOfSocketTcpTsOptDyn(SocketTcpIdx, TCPIP_TCP_RTO_STATE_FIRST_CALC_PROCEEDED);
+  TcpIp_SetRtoResetPendingOfSocketTcpTsOptDyn(SocketTcpIdx, FALSE);
+
+  TcpIp_Tcp_VInitTimeStampCalculation(SocketTcpIdx);
+# else
+  TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));
+  TcpIp_SetRtoReloadValueOfSocketTcpDyn(   SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));
+# endif
+
+  /* #50 Init user timeout values */
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+  TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, TcpIp_GetUserTimeoutDefCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+  TcpIp_SetUtoAdvOfSocketTcpUtoDyn(SocketTcpIdx, 0);
+  TcpIp_SetUtoRemoteOfSocketTcpUtoDyn(SocketTcpIdx, 0);
+# endif
+
+  /* #60 Init selective ACK variables */
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+  TcpIp_SetSackOptActiveOfSocketTcpDyn(SocketTcpIdx, FALSE);
+# endif
+
+  /* #70 Init congestion control variables. */
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+  /* Congestion control according to RFC 5681 and RFC 6582 */
+  /* congestion window (CWND) will be set when socket is opened, because it depends on IP version. */
+  TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
+  TcpIp_SetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
+  TcpIp_SetDupAckCntOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
+  TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
+  TcpIp_SetRecoverOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(SocketTcpIdx));
+  TcpIp_SetFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx, FALSE);
+# endif
+
+  TcpIp_SetSendLastHsAckOfSocketTcpDyn(SocketTcpIdx, FALSE);
+
+  TcpIp_SetEventIndicationPendingOfSocketTcpDyn(SocketTcpIdx, 0);
+  TcpIp_SetRstReceivedOfSocketTcpDyn(SocketTcpIdx, FALSE);
+
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+  TcpIp_SetUseTlsOfSocketTcpDyn(SocketTcpIdx, FALSE);
+# endif
+
+  TcpIp_SetMslOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetMslOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+
+  /* Init Dup ACK counter */
+  TcpIp_SetDupAckCountOfSocketTcpDyn(SocketTcpIdx, 0u);
+}
+
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VInitTimeStampCalculation
+ *********************************************************************************************************************/
+ /*!
+  * Internal comment removed.
+ *
+ *
+  */
+  /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitTimeStampCalculation(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+  {
+    /* #10 Init timestamp values */
+    TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));  /* set to RTOMin (instead of 3s like in RFC 2988 or 1s in RFC 6298) */
+    TcpIp_SetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));  /* set to RTOMin (instead of 3s like in RFC 2988 or 1s in RFC 6298) */
+
+    TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx));
+    TcpIp_SetRtoReloadValueOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx));
+  }
+# endif /* TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON */
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VDelTxQueue
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VDelTxQueue(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfTcpRetryQElementType firstTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if a buffer is assigned to the socket */
+  if (firstTcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+  {
+    /* The TxRetrQueue is not empty. The complete list shall be deleted in one block, so the first element already has
+    the previous element index marked as invalid as well as the next element index of the last list element is marked
+    as invalid. */
+    TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx        = firstTcpRetryQElementIdx;
+    TcpIp_SizeOfTcpRetryQElementType locLastTcpRetryQElementIdx = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    TcpIp_SizeOfTcpRetryQElementType eleNum        = 1u;
+
+    /* #20 Count the number of elements in the tx retry queue of this socket */
+    while (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+    {
+      tcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext;
+      eleNum++;
+    }
+    locLastTcpRetryQElementIdx = tcpRetryQElementIdx;
+    /*@ assert locLastTcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV; */                                       /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+
+    TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
+
+    /* #30 Append the sockets retry queue elements to the global free elements list. */
+    if (TcpIp_Tcp_LastFreeRetrQueueEle < TcpIp_GetSizeOfTcpRetryQElement())
+    {
+      /* free elements list is not emptry */
+      /* link last element of the free elements list with the first element of the socket's RetrQueue */
+      TcpIp_GetAddrTcpRetryQElement(TcpIp_Tcp_LastFreeRetrQueueEle)->EleNext = firstTcpRetryQElementIdx;
+      TcpIp_GetAddrTcpRetryQElement(firstTcpRetryQElementIdx)->ElePrev = TcpIp_Tcp_LastFreeRetrQueueEle;
+    }
+    else
+    {
+      /* Take the whole socket's list and use it as the new free elements list. */
+      TcpIp_Tcp_FirstFreeRetrQueueEle = firstTcpRetryQElementIdx;
+    }
+
+    /* mark the last element of the socket's RetrQueue as the global last element of the free elements list */
+    TcpIp_GetAddrTcpRetryQElement(locLastTcpRetryQElementIdx)->EleNext = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    TcpIp_Tcp_LastFreeRetrQueueEle = locLastTcpRetryQElementIdx;
+
+    /* in-/decrease number of (global) free element counters */
+    TcpIp_Tcp_NumFreeRetryQEle += eleNum;
+    TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, 0);
+
+    TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+
+    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
+    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn( SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
+  }
+  else
+  {
+    /* no queue elements available -> do nothing */
+  }
+
+  /* #40 Delete data from the tx buffer if available */
+  TcpIp_Tcp_VClearTxBuffer(SocketTcpIdx);
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6030, 6050, 6080 1 */ /* MD_MSR_STCYC, MD_MSR_STCAL, MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockLocAddrPtr,
+  TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType retVal      = E_OK;
+  uint8          byteIdx     = 0;
+  boolean        endOptFound = FALSE;
+  uint8          hdrOptLen   = SegmentDescriptorPtr->HdrLen - (uint8)TCPIP_TCP_HDR_LEN_BYTE;
+  TCPIP_P2C(uint8)  hdrOptPtr = &(SegmentDescriptorPtr->HdrPtr)[TCPIP_TCP_HDR_LEN_BYTE];
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Go through header bytes to identify the contained options */
+  while (   (byteIdx < hdrOptLen)
+         && (endOptFound == FALSE)
+         && (retVal == E_OK))
+  {
+    uint8          optKind = hdrOptPtr[byteIdx /* + TCPIP_TCP_OPT_OFS_KIND */];
+    uint8          optLen    = 0u;
+    Std_ReturnType optStatus = E_NOT_OK;  /* determines if the option could be processed (could be evaluated, or unknown option is syntactically valid) */
+
+    /* #20 Handle END and NOP option. */
+    if (optKind <= TCPIP_TCP_OPT_ID_NOP)
+    {
+      /* END or NOP */
+      if (optKind == TCPIP_TCP_OPT_ID_NOP)
+      {
+        /* option 'No-Operation'
+        -> skip this byte */
+      }
+      else  /* TCPIP_TCP_OPT_ID_END */
+      {
+        /* option 'End of Option List'
+        -> stop evaluation of options */
+        endOptFound = TRUE;
+      }
+
+      optLen = 1;
+      optStatus = E_OK;
+    }
+    else
+    {
+      /* #30 Check if the remaining options length is at least 2 bytes */
+      if ((uint8)(hdrOptLen - byteIdx) >= 2u)  /* value '0' is already excluded by the while-loop */
+      {
+        optLen = hdrOptPtr[byteIdx + TCPIP_TCP_OPT_OFS_LENGTH];
+
+        /* #40 Check if the option fits into the overall options length */
+        if ((byteIdx + optLen) <= hdrOptLen)
+        {
+          /* #50 Handle the various TCP options */
+          switch (optKind)
+          {
+          case TCPIP_TCP_OPT_ID_MAX_SEG_SIZE:
+            {
+              /* option 'Maximum Segment Size', option length is 4 byte */
+              optStatus = TcpIp_Tcp_VHandleTcpOptions_MaxSegSize(SocketTcpIdx, &hdrOptPtr[byteIdx], optLen);
+              break;
+            }
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+          case TCPIP_TCP_OPT_ID_SACK_PERMIT:
+            {
+              /* option 'SACK Permitted', option length is 2 byte */
+              optStatus = TcpIp_Tcp_VHandleTcpOptions_SackPermit(SocketTcpIdx, optLen);
+              break;
+            }
+          case TCPIP_TCP_OPT_ID_SACK:
+            {
+              /* option 'SACK', option length is 2 + n*8 byte */
+              optStatus = TcpIp_Tcp_VHandleTcpOptions_Sack(SocketTcpIdx, &hdrOptPtr[byteIdx], optLen);
+              break;
+            }
+# endif
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+          case TCPIP_TCP_OPT_ID_TIMESTAMP:
+            {
+              /* option 'Timestamp', option length is 10 byte */
+              optStatus = TcpIp_Tcp_VHandleTcpOptions_Timestamp(SocketTcpIdx, SegmentDescriptorPtr, &hdrOptPtr[byteIdx], optLen);
+              break;
+            }
+# endif /* (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) */
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+          case TCPIP_TCP_OPT_ID_USER_TIMEOUT:
+            {
+              /* option 'User Timeout' */
+              optStatus = TcpIp_Tcp_VHandleTcpOptions_UserTimeout(SocketTcpIdx, &hdrOptPtr[byteIdx], optLen);
+              break;
+            }
+# endif /* (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) */
+          default:
+            {
+              /* unknown option */
+              optStatus = TcpIp_Tcp_VHandleTcpOptions_Default(byteIdx, optLen, hdrOptLen);
+              break;
+            }
+          }  /* switch */
+        }
+        else
+        {
+          /* Error, according to optLen this option exceeds the overall options length. */
+          optStatus = E_NOT_OK;
+        }
+      }
+      else
+      {
+        /* Error, only 1 byte of remaining options length while at least 2 bytes are needed for a valid option. */
+        optLen = 0;
+        optStatus = E_NOT_OK;
+      }
+    }
+
+    /* #60 Close the connection if reading the option resulted in an error, or advance the read position */
+    if (optStatus == E_OK)
+    {
+      /* advance the read position to the start of the next option */
+      byteIdx += optLen;
+    }
+    else
+    {
+      /* erroneous option */
+      TCPIP_DUMMY_STATEMENT_CONST(optLen);                                                                              /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
+      /* -> drop message and send RST */
+      TcpIp_Tcp_VHandleTcpOptions_ResetConnection(SocketTcpIdx, RxSockRemAddrPtr, RxSockLocAddrPtr, SegmentDescriptorPtr);
+
+      retVal = E_NOT_OK;
+    }
+  }  /* while */
+
+  /* #70 Reserve a part of the tx length for options that are sent during an active communication. */
+# if ((TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) || (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON))
+  if (retVal == E_OK)
+  {
+    /* timestamp option and SACK option both have to be negotiated during the handshake within the same message */
+    TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen(SocketTcpIdx);
+  }
+# endif
+
+  return retVal;
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_MaxSegSize
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_MaxSegSize(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(uint8) OptPtr,
+  uint8 OptLen)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType optStatus = E_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* option 'Maximum Segment Size', option length is 4 byte */
+
+  /* #10 Check if the received option length matches the expected length */
+  if (OptLen == TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE)
+  {
+    /* #20 Check if the option is received only in the correct connection state */
+    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_SOCK_STATE_SYNRCVD)
+    {
+      uint16 maxLen = TCPIP_GET_UINT16(OptPtr, TCPIP_TCP_OPT_OFS_VALUE);
+
+      /* #30 Set largest possible segment size and reduce it if necessary. */
+      TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+      {
+# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
+        TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+        if(TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->sa_family == IPBASE_AF_INET6)
+        {
+          /* Fixed IPv6 header requires 20 bytes more than already considered IPv4 header. So TCP MSS has to be reduced by 20 bytes. */
+          TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx,
+            (TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)
+              - (TcpIp_TxMaxSegLenByteOfSocketTcpDynType)(TCPIP_IPV6_HDR_LEN_BYTE - TCPIP_IPV4_HDR_LEN_BYTE)));
+        }
+#  if (TCPIP_SUPPORT_IPSEC == STD_ON)
+        else
+#  endif
+# endif
+# if (TCPIP_SUPPORT_IPSEC == STD_ON)
+        {
+          /* If IPsec is enabled, always decrement IPsec AH header bytes from Tx MSS */
+          TcpIp_SubTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TCPIP_IPSEC_HDR_LEN_MAX);
+        }
+# endif
+      }
+
+      if (maxLen < TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx))
+      {
+        /* Received MSS is smaller than largest possible segment size the ECU can send.
+        * -> Use received MSS value.
+        */
+        TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, maxLen);
+      }
+
+      /* Init SockMtuSize with received MaxSegLen */
+      TcpIp_SetTxMssAgreedOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));
+
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+      /* resize cwnd */
+      TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(maxLen));
+      TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, ((uint32) maxLen * TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx)));
+# endif
+    }
+    else
+    {
+      /* this option may not be received or evaluated in this state -> ignore it */
+    }
+  }
+  else
+  {
+    /* erroneous option */
+    optStatus = E_NOT_OK;
+  }
+
+  return optStatus;
+}
+
+
+# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_SackPermit
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_SackPermit(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint8 OptLen)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType optStatus = E_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if the received option length matches the expected length and is received only in the correct connection state */
+  if (   (OptLen == TCPIP_TCP_OPT_LEN_SACK_PERMIT)                                                                      /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_SOCK_STATE_SYNRCVD))
+  {
+    /* received the permission to use the SACK option */
+    /* #20 Activate the usage of the SACK option. */
+    TcpIp_SetSackOptActiveOfSocketTcpDyn(SocketTcpIdx, TRUE);
+
+    /* #30 Trigger sending of 'SACK PERMIT' option for passive open */
+    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_LISTEN)
+    {
+      TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(   SocketTcpIdx, (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) | (TcpIp_TxOneTimeOptsOfSocketTcpDynType)TCPIP_TCP_OPT_FLAG_SACK_PERMIT));
+      TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx) + (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u)));  /* option + 2x NOP */
+    }
+  }
+  else
+  {
+    /* erroneous option or received in the wrong TCP socket state */
+    optStatus = E_NOT_OK;
+  }
+
+  return optStatus;
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_Sack
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Sack(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(uint8) OptPtr,
+  uint8 OptLen)
+{
+  /* option 'SACK', option length is 2 + n*8 byte */
+  Std_ReturnType optStatus = E_OK;
+  uint8          remOptLen = (uint8)(OptLen - TCPIP_TCP_OPT_LEN_SACK);
+
+  /* #10 Check if the received option length matches the expected length and is received only in the correct connection state */
+  if (   ((remOptLen % TCPIP_TCP_SACK_ELEMENT_LEN) == 0u)  /* remOptLen is a multiple of 8 bytes */                     /* PRQA S 3415 6 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) >= TCPIP_TCP_SOCK_STATE_ESTABLISHED))
+  {
+    /* (OptLen - 2) is a multiple of 8 (=TCPIP_TCP_SACK_ELEMENT_LEN), so the option has a valid length. */
+    uint8 sackEleNum = (uint8)(remOptLen / TCPIP_TCP_SACK_ELEMENT_LEN);  /* Number of received sequence number pairs,
+                                                                    an empty sack option is also handled to be valid. */
+
+    CANOE_WRITE_STRING_1("TcpIp_Tcp_VHandleTcpOptions: Received SACK option with %d elements", sackEleNum);
+
+    /* #20 Mark elements in TxRetrQueue as selective acknowledged (sACKed) */
+    if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 0u)
+    {
+      uint16 seqNrPairOfs = TCPIP_TCP_OPT_OFS_VALUE;
+
+      while (sackEleNum > 0u)
+      {
+        uint32                           leftEdge  = TCPIP_GET_UINT32(OptPtr, seqNrPairOfs);
+        uint32                           rightEdge = TCPIP_GET_UINT32(OptPtr, seqNrPairOfs + TCPIP_TCP_SEQU_NUM_LEN);
+        TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx;
+
+        for (tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+             tcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement();
+             tcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext)
+        {
+          /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          if (   TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(  TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SeqNo, leftEdge)
+              && TCPIP_TCP_SEQ1_SMALLER_OR_EQUAL_SEQ2((TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SeqNo + TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SizeTotByte), rightEdge))
+          {
+            /* element is in the sequence number range of this SACK element -> mark as 'sacked' */
+            TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SackFlag = 1;
+          }
+        }
+
+        sackEleNum--;
+        seqNrPairOfs += TCPIP_TCP_SACK_ELEMENT_LEN;
+      }
+    }
+  }
+  else
+  {
+    /* erroneous option */
+    optStatus = E_NOT_OK;
+  }
+
+  return optStatus;
+}
+# endif
+
+
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_Timestamp
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Timestamp(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr,
+  TCPIP_P2C(uint8) OptPtr,
+  uint8 OptLen)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType optStatus = E_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if the received option length matches the expected length and is received only in the correct connection state */
+  if (OptLen == TCPIP_TCP_OPT_LEN_TIMESTAMP)
+  {
+    /* #20 Read received timestamp value */
+    uint32 tsVal = TCPIP_GET_UINT32(OptPtr, TCPIP_TCP_OPT_OFS_VALUE);
+
+    if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_LISTEN)                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT))
+    {
+      /* #30 Activate the usage of the timestamp option and take over the timestamp */
+      TcpIp_SetTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx, TRUE);
+
+      TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx, tsVal);
+    }
+
+    if (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)
+    {
+      if (SegmentDescriptorPtr->SegSeq == TcpIp_GetRcvNxtOfSocketTcpDyn(SocketTcpIdx))
+      {
+        /* only take over the timestamp from the most recent segment that advanced the window */
+        TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx, tsVal);
+      }
+
+      /* #40 Read received timestamp echo reply */
+      /* This is the timestamp that was earlier sent by this ECU -> evaluate RTT */
+      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)                            /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+          && (TCPIP_TCP_SEQ1_SMALLER_SEQ2(TcpIp_GetSndUnaOfSocketTcpDyn(SocketTcpIdx), SegmentDescriptorPtr->SegAck)))
+      {
+        uint32                      tsEcr = TCPIP_GET_UINT32(OptPtr, TCPIP_TCP_OPT_OFS_VALUE + 4u);
+        uint32                      elementRtt;
+        TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx;
+
+        elementRtt = TcpIp_Tcp_GlobalTimestamp - tsEcr;
+
+        if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD)
+        {
+          TcpIp_Tcp_VUpdateRttVars(SocketTcpIdx, elementRtt);
+        }
+
+        /* #50 Search for corresponding element in the TxRetrQueue. If element was already retransmitted, discard this timestamp echo reply. */
+        for (tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+             tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+             tcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext)
+        {
+          if (tsEcr == TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TimeStamp)
+          {
+            /* the element was not yet retransmitted, so the tsEcr may be used for the RRTM */
+            CANOE_WRITE_STRING_3("TcpIp_Tcp_VHandleTcpOptions: RetrQueue element found with matching Timestamp %d, acknowledged data size is %d, current segment RTT is %d)", tsEcr, (SegmentDescriptorPtr->SegAck - TcpIp_GetSndUnaOfSocketTcpDyn(SocketTcpIdx)), elementRtt);
+
+            /* use elementRtt for connection RTT calculation */
+            TcpIp_Tcp_VUpdateRttVars(SocketTcpIdx, elementRtt);
+
+            break;  /* don't search for further elements, there is no benefit in finding more matching elements */
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    /* erroneous option */
+    optStatus = E_NOT_OK;
+  }
+
+  return optStatus;
+}
+# endif /* (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) */
+
+
+# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_UserTimeout
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_UserTimeout(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(uint8) OptPtr,
+  uint8 OptLen)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  /* option 'User Timeout' */
+  Std_ReturnType optStatus = E_OK;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if the received option length matches the expected length. */
+  if (OptLen == TCPIP_TCP_OPT_LEN_USER_TIMEOUT)
+  {
+    /* #20 Check if changeing the user timeout value is possible */
+    if (   (TcpIp_IsUtoEnabledOfSocketTcpUtoDyn(SocketTcpIdx)    == TRUE)                                               /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        && (TcpIp_IsUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx) == TRUE))
+    {
+      uint32 timeoutRecCycles;
+      uint16 optVal = TCPIP_GET_UINT16(OptPtr, TCPIP_TCP_OPT_OFS_VALUE);
+
+      TcpIp_SetUtoRemoteOfSocketTcpUtoDyn(SocketTcpIdx, optVal);
+
+      /* #30 Determine the new user timeout value and set the Uto */
+      if ((optVal & TCPIP_TCP_OPT_USER_TIMEOUT_FLAG_GRANULARITY_MINUTES) == 0u)
+      {
+        /* granularity is seconds (= 1000ms) */
+        timeoutRecCycles = (((uint32) optVal) * 1000u) / TCPIP_MAIN_FCT_PERIOD_MSEC;
+      }
+      else
+      {
+        /* granularity is minutes (= 60000ms) */
+        timeoutRecCycles = (((uint32) optVal & TCPIP_TCP_OPT_USER_TIMEOUT_VALUE_MASK) * 60000u) / TCPIP_MAIN_FCT_PERIOD_MSEC;
+      }
+
+      if (timeoutRecCycles > 0u)
+      {
+        if (timeoutRecCycles < TcpIp_GetUserTimeoutMinCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX))
+        {
+          TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, TcpIp_GetUserTimeoutMinCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+        }
+        else if (timeoutRecCycles > TcpIp_GetUserTimeoutMaxCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX))
+        {
+          TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, TcpIp_GetUserTimeoutMaxCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+        }
+        else
+        {
+          TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, timeoutRecCycles);
+        }
+      }
+      else
+      {
+        /* reserved for future usage -> ignore this option */
+      }
+    }
+  }
+  else
+  {
+    /* erroneous option */
+    optStatus = E_NOT_OK;
+  }
+
+  return optStatus;
+}
+# endif /* (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) */
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_Default
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Default(
+  uint8 ByteIdx,
+  uint8 OptLen,
+  uint8 AllOptionsLen)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType optStatus = E_OK;
+  uint8 remLen = (uint8)(AllOptionsLen - ByteIdx);
+
+  /* ----- Implementation ----------------------------------------------- */
+
+  /* #10 Check if the general option format is ok, then ignore the option, otherwise indicate an error. */
+  if ((remLen >= OptLen) && (OptLen >= 2u))
+  {
+    /* unknown options will be ignored */
+  }
+  else
+  {
+    /* error in option */
+    optStatus = E_NOT_OK;
+  }
+
+  return optStatus;
+}
+
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_ResetConnection
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_ResetConnection(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr,
+  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockLocAddrPtr,
+  TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  TcpIp_SizeOfLocalAddrType ipAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
+  /*@ assert ipAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                                 /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* An erroneous option has been received -> send RST and close connection */
+
+  /* #10 Trigger sending a RST. */
+  TcpIp_Tcp_VSendReset(SocketTcpIdx, ipAddrIdx,
+    RxSockRemAddrPtr, RxSockLocAddrPtr, SegmentDescriptorPtr->SegAck, 0u, 0u);
+
+  /* #20 Close the socket. */
+  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)
+  {
+    /* enter CLOSED state, delete/clear TCB */
+    TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+  }
+
+}
+
+# if ((TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) || (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON))
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  /* timestamp option and SACK option both have to be negotiated during the handshake within the same message */
+
+  uint8 blockedOptLen = 0;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if we are in the a connection state bigger than SynRcvd */
+  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_SOCK_STATE_SYNRCVD)
+  {
+    /* #20 Add the needed length per option */
+#  if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+    if (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)
+    {
+      blockedOptLen = (TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u);  /* including 2* NOP */
+    }
+#  endif
+#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
+    if (TcpIp_IsSackOptActiveOfSocketTcpDyn(SocketTcpIdx) == TRUE)
+    {
+      blockedOptLen = TCPIP_TCP_HDR_OPT_LEN_MAX_BYTE;  /* maximum TCP option length */ /* overwrite len set for timestamp option */
+    }
+#  endif
+
+    if (blockedOptLen > 0u)
+    {
+      /* #30 Set the new maximum segment length */
+      TcpIp_SetTxOptLenOfSocketTcpDyn(SocketTcpIdx, blockedOptLen);
+
+#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
+      if (TcpIp_GetAddrRemSockOfSocketDyn(TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx))->sa_family == IPBASE_AF_INET6)
+      {
+        /* If IPv6 is enabled, also consider the extra length of IPv6 header */
+        blockedOptLen += (TCPIP_IPV6_HDR_LEN_BYTE - TCPIP_IPV4_HDR_LEN_BYTE);
+      }
+#  endif
+#  if (TCPIP_SUPPORT_IPV6 == STD_ON) && (TCPIP_SUPPORT_IPSEC == STD_ON)                                                 /* COV_TCPIP_IPV6_SUPPORT_ALWAYS_OFF */
+      else
+#  endif
+#  if (TCPIP_SUPPORT_IPSEC == STD_ON)
+      {
+        /* If IPsec is enabled, also consider the IPsec header length in following calculation */
+        blockedOptLen += TCPIP_IPSEC_HDR_LEN_MAX;
+      }
+#  endif
+
+      if ((blockedOptLen + TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)) > TcpIp_GetTxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX))
+      {
+        TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX) - blockedOptLen));
+      }
+    }
+  }
+}
+# endif
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VAddrResTimeout
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_VAddrResTimeout(
+  TCPIP_P2C(TcpIp_SockAddrBaseType) DestAddrPtr)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfSocketTcpDynType   socketTcpIdx;
+  TcpIp_SizeOfSocketDynType      socketIdx = 0u;
+  TcpIp_TcpRstHandlingIterType   tcpRstHandlingIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  CANOE_WRITE_STRING_1("TcpIp_Tcp_VAddrResTimeout: function called, AddrType = %d", DestAddrPtr->sa_family);
 
-  /* #50 Init user timeout values */
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-  TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, TcpIp_GetUserTimeoutDefCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX));
-  TcpIp_SetUtoAdvOfSocketTcpUtoDyn(SocketTcpIdx, 0);
-  TcpIp_SetUtoRemoteOfSocketTcpUtoDyn(SocketTcpIdx, 0);
-# endif
+  /* #10 Check the socket state of all sockets */
+  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
+  {
+    socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
 
-  /* #60 Init selective ACK variables */
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-  TcpIp_SetSackOptActiveOfSocketTcpDyn(SocketTcpIdx, FALSE);
-  TcpIp_SetTcpOooChangeCounterOfSocketTcpOooDyn(SocketTcpIdx, 0);
-# endif
+    if (   (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        && (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN))
+    {
+      /* #20 Check the addr to find out if the socket is affected by the address resolution timeout, then stop the retry
+         mechanism on the socket and indicate an error to the user. */
+      if (TcpIp_VSockIpAddrIsEqual(DestAddrPtr, TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)) == TRUE)
+      {
+        /* addr request timeout for this socket occurred */
 
-  /* #70 Init congestion control variables. */
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-  /* Congestion control according to RFC 5681 and RFC 6582 */
-  /* congestion window (CWND) will be set when socket is opened, because it depends on IP version. */
-  TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
-  TcpIp_SetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
-  TcpIp_SetDupAckCntOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
-  TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
-  TcpIp_SetRecoverOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetIssOfSocketTcpDyn(SocketTcpIdx));
-  TcpIp_SetFastRetransmitPendingOfSocketTcpCongCtrlDyn(SocketTcpIdx, FALSE);
-# endif
+        CANOE_WRITE_STRING_1("TcpIp_Tcp_VAddrResTimeout: Addr match on socket %d", socketIdx);
 
-  TcpIp_SetSendLastHsAckOfSocketTcpDyn(SocketTcpIdx, FALSE);
+        /* issue a RESET to the user and close TCP socket */
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(socketTcpIdx, TCPIP_TCP_STATE_RESET);
+      }
+    }
+  }
 
-  TcpIp_SetEventIndicationPendingOfSocketTcpDyn(SocketTcpIdx, 0);
-  TcpIp_SetRstReceivedOfSocketTcpDyn(SocketTcpIdx, FALSE);
+  /* #30 Remove elements from the reset queue if they are affected by the address resolution timeout. */
+  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+  for (tcpRstHandlingIdx = 0; tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandlingDyn(); tcpRstHandlingIdx++)
+  {
+    if (0u < TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx))
+    {
+      TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
 
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-  TcpIp_SetUseTlsOfSocketTcpDyn(SocketTcpIdx, FALSE);
-# endif
+      for(rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
+        rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
+        rstTxQueueBufferIdx++)
+      {
+        TCPIP_P2V(TcpIp_SockAddrBaseType) remSockAddrPtr = &TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx)->RemSock;
 
-  TcpIp_SetMslOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetMslOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+        if (TcpIp_VSockIpAddrIsEqual(DestAddrPtr, remSockAddrPtr) == TRUE)
+        {
+          /* Remove entry from the reset queue. */
+          remSockAddrPtr->sa_family = IPBASE_AF_UNSPEC;
+          TcpIp_DecRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx);
+        }
+      }
+    }
+  }
+  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
 
-  /* Init Dup ACK counter */
-  TcpIp_SetDupAckCountOfSocketTcpDyn(SocketTcpIdx, 0u);
 }
 
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VInitTimeStampCalculation
+ *  TcpIp_Tcp_VFreeFirstRetrQueueEle
  *********************************************************************************************************************/
- /*!
-  * Internal comment removed.
+/*!
+ * Internal comment removed.
  *
  *
-  */
-  /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitTimeStampCalculation(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+ *
+ */
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFreeFirstRetrQueueEle(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  /* element that shall be removed / moved to free-list */
+  TcpIp_SizeOfTcpRetryQElementType sockOldFirstTcpRetryQElementIdx     = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+  /*@ assert sockOldFirstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                    /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+  TcpIp_SizeOfTcpRetryQElementType globNewTcpRetryQElementIdx  = sockOldFirstTcpRetryQElementIdx;
+
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Remove element from the socket's RetrQueue */
+  if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 1u)
   {
-    /* #10 Init timestamp values */
-    TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));  /* set to RTOMin (instead of 3s like in RFC 2988 or 1s in RFC 6298) */
-    TcpIp_SetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));  /* set to RTOMin (instead of 3s like in RFC 2988 or 1s in RFC 6298) */
+    /* there is at least one element left in the socket's RetrQueue */
+    TcpIp_SizeOfTcpRetryQElementType sockNewFirstTcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(sockOldFirstTcpRetryQElementIdx)->EleNext;
+    /*@ assert sockNewFirstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                  /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
 
-    TcpIp_SetRetransmitTimeoutOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx));
-    TcpIp_SetRtoReloadValueOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx));
+    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, sockNewFirstTcpRetryQElementIdx);
+    TcpIp_GetAddrTcpRetryQElement(sockNewFirstTcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    TcpIp_DecRetryQFillNumOfSocketTcpDyn(SocketTcpIdx);
   }
-# endif /* TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON */
+  else
+  {
+    /* the socket's RetrQueue will be empty afterwards */
+
+    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
+    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn( SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
+    TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, 0);
+  }
+
+  TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
+
+  /* #20 Append the element to the free-list */
+  if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
+  {
+    TcpIp_SizeOfTcpRetryQElementType globOldLastFreeTcpRetryQElementIdx = TcpIp_Tcp_LastFreeRetrQueueEle;
+    /*@ assert globOldLastFreeTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                               /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+
+    /* there are some (at least one) elements in the free-list */
+
+    /* link last element of the free-list with the (old) first element of the socket's RetrQueue */
+    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->ElePrev = globOldLastFreeTcpRetryQElementIdx;
+    TcpIp_GetAddrTcpRetryQElement(globOldLastFreeTcpRetryQElementIdx)->EleNext = globNewTcpRetryQElementIdx;
+
+    /* mark the element of the socket's RetrQueue that shall be removed as the global last element of the free elements list */
+    TcpIp_Tcp_LastFreeRetrQueueEle = globNewTcpRetryQElementIdx;
+    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->EleNext = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+  }
+  else
+  {
+    /* the free-list is empty, so fill in the first element */
+
+    /* set neighbor element indices to invalid */
+    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->EleNext = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+
+    /* mark the element as the global last and first element of the free elements list */
+    TcpIp_Tcp_FirstFreeRetrQueueEle = globNewTcpRetryQElementIdx;
+    TcpIp_Tcp_LastFreeRetrQueueEle  = globNewTcpRetryQElementIdx;
+  }
+  TcpIp_Tcp_NumFreeRetryQEle++;  /* inc free elements counter */
+
+  TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+}
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VDelTxQueue
+ *  TcpIp_Tcp_VFreeAckedReqAndRetrElements
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10242,75 +11963,111 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VInitTimeStampCalculation(
  *
  *
  *
+ *
+ *
+ *
+ *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VDelTxQueue(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFreeAckedReqAndRetrElements(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32 SegAckNo)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfTcpRetryQElementType firstTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+  boolean checkIfFirstSegInQueueIsAcked = TRUE;
+  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if a buffer is assigned to the socket */
-  if (firstTcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+  /* #10 Repeat removing first segment from TX Retry Queue if queue is not empty or a not fully ACKed segment has been found before. */
+  while (checkIfFirstSegInQueueIsAcked == TRUE)
   {
-    /* The TxRetrQueue is not empty. The complete list shall be deleted in one block, so the first element already has
-    the previous element index marked as invalid as well as the next element index of the last list element is marked
-    as invalid. */
-    TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx        = firstTcpRetryQElementIdx;
-    TcpIp_SizeOfTcpRetryQElementType locLastTcpRetryQElementIdx = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    TcpIp_SizeOfTcpRetryQElementType eleNum        = 1u;
+    uint32 acknowledgedPayloadBytes = 0;
 
-    /* #20 Count the number of elements in the tx retry queue of this socket */
-    while (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+    /* #20 Enter critical section to protect retry queue access. */
+    TCPIP_VENTER_CRITICAL_SECTION();
+
+    /* #30 Check first segment in retry queue or abort operation if queue is empty. */
+    if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 0u)
     {
-      tcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext;
-      eleNum++;
-    }
-    locLastTcpRetryQElementIdx = tcpRetryQElementIdx;
-    /*@ assert locLastTcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV; */                                       /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+      TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr = TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx));
 
-    TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
+      /* #40 Calculate sequence number of the following segment. */
+      uint32 nextSegSeqNo = TxRetrQueueElePtr->SeqNo + TxRetrQueueElePtr->SizeTotByte;
 
-    /* #30 Append the sockets retry queue elements to the global free elements list. */
-    if (TcpIp_Tcp_LastFreeRetrQueueEle < TcpIp_GetSizeOfTcpRetryQElement())
-    {
-      /* free elements list is not emptry */
-      /* link last element of the free elements list with the first element of the socket's RetrQueue */
-      TcpIp_GetAddrTcpRetryQElement(TcpIp_Tcp_LastFreeRetrQueueEle)->EleNext = firstTcpRetryQElementIdx;
-      TcpIp_GetAddrTcpRetryQElement(firstTcpRetryQElementIdx)->ElePrev = TcpIp_Tcp_LastFreeRetrQueueEle;
+      if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_SYN) != 0u)
+      {
+        /* SYN flag counts as one byte. */
+        nextSegSeqNo++;
+      }
+
+      if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
+      {
+        /* FIN flag counts as one byte. */
+        nextSegSeqNo++;
+      }
+
+      /* #50 Check if segment is completely acknowledged. */
+      if (TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(SegAckNo, nextSegSeqNo))
+      {
+        /* #60 Remove acknowledged length from TX request element for this socket and store acknowledged payload length for call to TxConfirmation. */
+        acknowledgedPayloadBytes = TxRetrQueueElePtr->SizeTotByte;
+
+        if (acknowledgedPayloadBytes > 0u)
+        {
+          /* Remove acknowledged length from TX request element for this socket. */
+          TCPIP_ASSERT(TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) >= acknowledgedPayloadBytes);
+          TcpIp_SetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx,
+            (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) - (TcpIp_SizeOfTcpTxBufferType)acknowledgedPayloadBytes));  /* cast OK: acknowledged len is never bigger than the buffer */
+          TCPIP_ASSERT(TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx) >= acknowledgedPayloadBytes);
+          TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx,
+            (TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx) - (TcpIp_SizeOfTcpTxBufferType)acknowledgedPayloadBytes));  /* cast OK: acknowledged len is never bigger than the buffer */
+          {
+            TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+            /*@ assert tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); */                                        /* VCA_TCPIP_VALID_BUFFERIDX_LOCAL */
+            TcpIp_SizeOfTcpTxBufferType currentIndex = TcpIp_GetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx);
+
+            currentIndex = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx, currentIndex,
+              (TcpIp_SizeOfTcpTxBufferType)acknowledgedPayloadBytes);
+
+            TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx, currentIndex);
+          }
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+          /* Release the references to user buffers whose data has been acknowledged completely. */
+          TcpIp_Tcp_VTxDataRefRelease(SocketTcpIdx, FALSE);
+# endif
+        }
+
+        TcpIp_Tcp_VFreeFirstRetrQueueEle(SocketTcpIdx);
+      }
+      else
+      {
+        /* #70 ELSE: Stop searching for further segments. If this segment is not ACKed others with higher sequence numbers will not be ACKed as well. */
+        checkIfFirstSegInQueueIsAcked = FALSE;
+      }
     }
     else
     {
-      /* Take the whole socket's list and use it as the new free elements list. */
-      TcpIp_Tcp_FirstFreeRetrQueueEle = firstTcpRetryQElementIdx;
+      /* Tx Retry Queue is empty. All segments are acknowledged. Stop searching for further segments. */
+      checkIfFirstSegInQueueIsAcked = FALSE;
     }
 
-    /* mark the last element of the socket's RetrQueue as the global last element of the free elements list */
-    TcpIp_GetAddrTcpRetryQElement(locLastTcpRetryQElementIdx)->EleNext = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    TcpIp_Tcp_LastFreeRetrQueueEle = locLastTcpRetryQElementIdx;
-
-    /* in-/decrease number of (global) free element counters */
-    TcpIp_Tcp_NumFreeRetryQEle += eleNum;
-    TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, 0);
-
-    TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+    /* #80 Leave critical section because upper layer is called next. */
+    TCPIP_VLEAVE_CRITICAL_SECTION();
 
-    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
-    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn( SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
-  }
-  else
-  {
-    /* no queue elements available -> do nothing */
+    /* #90 Call TxConfirmation of upper layer if segment contained acknowledged payload bytes. */
+    if (acknowledgedPayloadBytes > 0u)
+    {
+      TcpIp_VSockTxConfirmation(socketIdx, acknowledgedPayloadBytes);
+    }
   }
 
-  /* #40 Delete data from the tx buffer if available */
-  TcpIp_Tcp_VClearTxBuffer(SocketTcpIdx);
+/* (end) remove segments from tx (retransmission) queue */
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions
+ *  TcpIp_Tcp_VQueueRemReqData
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10318,157 +12075,75 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VDelTxQueue(
  *
  *
  *
- *
- *
- *
- *
  */
-/* PRQA S 6030, 6050, 6080 1 */ /* MD_MSR_STCYC, MD_MSR_STCAL, MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockLocAddrPtr,
-  TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr)
+/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VQueueRemReqData(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType retVal      = E_OK;
-  uint8          byteIdx     = 0;
-  boolean        endOptFound = FALSE;
-  uint8          hdrOptLen   = SegmentDescriptorPtr->HdrLen - (uint8)TCPIP_TCP_HDR_LEN_BYTE;
-  TCPIP_P2C(uint8)  hdrOptPtr = &(SegmentDescriptorPtr->HdrPtr)[TCPIP_TCP_HDR_LEN_BYTE];
-
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Go through header bytes to identify the contained options */
-  while (   (byteIdx < hdrOptLen)
-         && (endOptFound == FALSE)
-         && (retVal == E_OK))
+  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+  /* #10 Check if there are free elements in the retry queue. */
+  if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
   {
-    uint8          optKind = hdrOptPtr[byteIdx /* + TCPIP_TCP_OPT_OFS_KIND */];
-    uint8          optLen    = 0u;
-    Std_ReturnType optStatus = E_NOT_OK;  /* determines if the option could be processed (could be evaluated, or unknown option is syntactically valid) */
+    /* Add (part of) request to TxReqArray */ /* size of data not yet queued in the TxRetrQueue */
+     TcpIp_SizeOfTcpTxBufferType remaniningSize = TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) - TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx);
 
-    /* #20 Handle END and NOP option. */
-    if (optKind <= TCPIP_TCP_OPT_ID_NOP)
+    /* #20 Append new fully filled segments into the retry queue (if possible). */
+
+    /* inc TxLen, or fill retry queue elements */
+    while (   (TcpIp_Tcp_NumFreeRetryQEle > 0u)                                                                         /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+           && (remaniningSize >= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)))
     {
-      /* END or NOP */
-      if (optKind == TCPIP_TCP_OPT_ID_NOP)
-      {
-        /* option 'No-Operation'
-        -> skip this byte */
-      }
-      else  /* TCPIP_TCP_OPT_ID_END */
-      {
-        /* option 'End of Option List'
-        -> stop evaluation of options */
-        endOptFound = TRUE;
-      }
+      /* add max size segment, and send */
+      remaniningSize                -= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
+      TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));
 
-      optLen = 1;
-      optStatus = E_OK;
+      (void)TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
     }
-    else
+
+    /* #30 Plan partially filled segment that will only be appended to the retry queue if nagle allows it. */
+
+    if ((TcpIp_Tcp_NumFreeRetryQEle > 0u) && (remaniningSize > 0u))
     {
-      /* #30 Check if the remaining options length is at least 2 bytes */
-      if ((uint8)(hdrOptLen - byteIdx) >= 2u)  /* value '0' is already excluded by the while-loop */
+      if (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == 0u)
       {
-        optLen = hdrOptPtr[byteIdx + TCPIP_TCP_OPT_OFS_LENGTH];
+        /* new RetrQueue element is needed */
 
-        /* #40 Check if the option fits into the overall options length */
-        if ((byteIdx + optLen) <= hdrOptLen)
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
+        /* set nagle algorithm timeout */
+        if (TcpIp_IsEnabledOfSocketTcpNagleDyn(SocketTcpIdx) == TRUE)
         {
-          /* #50 Handle the various TCP options */
-          switch (optKind)
-          {
-          case TCPIP_TCP_OPT_ID_MAX_SEG_SIZE:
-            {
-              /* option 'Maximum Segment Size', option length is 4 byte */
-              optStatus = TcpIp_Tcp_VHandleTcpOptions_MaxSegSize(SocketTcpIdx, &hdrOptPtr[byteIdx], optLen);
-              break;
-            }
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-          case TCPIP_TCP_OPT_ID_SACK_PERMIT:
-            {
-              /* option 'SACK Permitted', option length is 2 byte */
-              optStatus = TcpIp_Tcp_VHandleTcpOptions_SackPermit(SocketTcpIdx, optLen);
-              break;
-            }
-          case TCPIP_TCP_OPT_ID_SACK:
-            {
-              /* option 'SACK', option length is 2 + n*8 byte */
-              optStatus = TcpIp_Tcp_VHandleTcpOptions_Sack(SocketTcpIdx, &hdrOptPtr[byteIdx], optLen);
-              break;
-            }
-# endif
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-          case TCPIP_TCP_OPT_ID_TIMESTAMP:
-            {
-              /* option 'Timestamp', option length is 10 byte */
-              optStatus = TcpIp_Tcp_VHandleTcpOptions_Timestamp(SocketTcpIdx, SegmentDescriptorPtr, &hdrOptPtr[byteIdx], optLen);
-              break;
-            }
-# endif /* (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) */
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
-          case TCPIP_TCP_OPT_ID_USER_TIMEOUT:
-            {
-              /* option 'User Timeout' */
-              optStatus = TcpIp_Tcp_VHandleTcpOptions_UserTimeout(SocketTcpIdx, &hdrOptPtr[byteIdx], optLen);
-              break;
-            }
-# endif /* (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) */
-          default:
-            {
-              /* unknown option */
-              optStatus = TcpIp_Tcp_VHandleTcpOptions_Default(byteIdx, optLen, hdrOptLen);
-              break;
-            }
-          }  /* switch */
+          TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
+          TcpIp_SetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx, TcpIp_GetNagleTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX));
         }
         else
+# endif
         {
-          /* Error, according to optLen this option exceeds the overall options length. */
-          optStatus = E_NOT_OK;
+          /* send new element even though it is not full */
+          TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, remaniningSize);
+
+          if (TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx) == E_OK)
+          {
+            remaniningSize = 0;
+          }
         }
       }
       else
       {
-        /* Error, only 1 byte of remaining options length while at least 2 bytes are needed for a valid option. */
-        optLen = 0;
-        optStatus = E_NOT_OK;
+        /* do nothing, this data will be part of a message that will be sent later */
       }
-    }
-
-    /* #60 Close the connection if reading the option resulted in an error, or advance the read position */
-    if (optStatus == E_OK)
-    {
-      /* advance the read position to the start of the next option */
-      byteIdx += optLen;
-    }
-    else
-    {
-      /* erroneous option */
-      TCPIP_DUMMY_STATEMENT_CONST(optLen);                                                                              /* PRQA S 3112, 2983 */ /* MD_MSR_DummyStmt */
-      /* -> drop message and send RST */
-      TcpIp_Tcp_VHandleTcpOptions_ResetConnection(SocketTcpIdx, RxSockRemAddrPtr, RxSockLocAddrPtr, SegmentDescriptorPtr);
+      /* add remaining size segment */
+      TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, remaniningSize);
 
-      retVal = E_NOT_OK;
+      TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, TRUE);
     }
-  }  /* while */
-
-  /* #70 Reserve a part of the tx length for options that are sent during an active communication. */
-# if ((TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) || (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON))
-  if (retVal == E_OK)
-  {
-    /* timestamp option and SACK option both have to be negotiated during the handshake within the same message */
-    TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen(SocketTcpIdx);
   }
-# endif
-
-  return retVal;
+  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_MaxSegSize
+ *  TcpIp_Tcp_VDropEndEleInRetrQueue
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10476,86 +12151,110 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions(
  *
  *
  *
+ *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_MaxSegSize(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(uint8) OptPtr,
-  uint8 OptLen)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VDropEndEleInRetrQueue(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx,
+  uint8 NumDropEle)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType optStatus = E_OK;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* option 'Maximum Segment Size', option length is 4 byte */
-
-  /* #10 Check if the received option length matches the expected length */
-  if (OptLen == TCPIP_TCP_OPT_LEN_MAX_SEG_SIZE)
+  /* #10 Check that elements shall be dropped */
+  if (NumDropEle == 0u)
   {
-    /* #20 Check if the option is received only in the correct connection state */
-    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_SOCK_STATE_SYNRCVD)
+    /* No element shall be dropped, so just return. */
+  }
+  else
+  {
+    /* last element of the socket's retry queue before removing some elements of this queue */
+    TcpIp_SizeOfTcpRetryQElementType oldLastTcpRetryQElementIdx  = TcpIp_GetSizeOfTcpRetryQElement();
+    /* first element of the socket's retry queue that shall be removed */
+    TcpIp_SizeOfTcpRetryQElementType firstRemTcpRetryQElementIdx = TcpIp_GetSizeOfTcpRetryQElement();
+    TcpIp_SizeOfTcpRetryQElementType newTcpRetryQElementIdx  = TcpIp_GetSizeOfTcpRetryQElement();
+    TcpIp_SizeOfTcpTxBufferType      remLen                  = 0u;
+    uint8                            lastElementFlags        = 0u;
+
+    TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+
+    /* TcpIp_Tcp_VDropEndEleInRetrQueue is always invoked with NumDropEle <= TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) */
+    TCPIP_ASSERT(NumDropEle <= TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx));
+
+    oldLastTcpRetryQElementIdx  = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
+    firstRemTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
+    newTcpRetryQElementIdx  = TcpIp_GetAddrTcpRetryQElement(oldLastTcpRetryQElementIdx)->ElePrev;
+    remLen                  = TcpIp_GetAddrTcpRetryQElement(oldLastTcpRetryQElementIdx)->SizeTotByte;
+    lastElementFlags        = TcpIp_GetAddrTcpRetryQElement(oldLastTcpRetryQElementIdx)->Flags;
+
+    /* #20 Remove elements from the sockets retry queue */
     {
-      uint16 maxLen = TCPIP_GET_UINT16(OptPtr, TCPIP_TCP_OPT_OFS_VALUE);
+      uint8 numElementsRemoved = 1;
+
+      /* Iterate backwards through the socket's retry queue to find the first element that shall be removed. */
+      while (numElementsRemoved < NumDropEle)
+      {
+        /* get index of next removed element */
+        firstRemTcpRetryQElementIdx = newTcpRetryQElementIdx;
+        remLen += TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->SizeTotByte;
+        /* Set the new last queue index. Index finally is 'invalid' index when all element are removed from the socket's queue. */
+        newTcpRetryQElementIdx  = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->ElePrev;
+        numElementsRemoved++;
+      }
+      /*@ assert firstRemTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                    /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+      /*@ assert newTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                         /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
 
-      /* #30 Set largest possible segment size and reduce it if necessary. */
-      TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX));
+      /* Set index of socket's last element, set next index of the new last element to 'invalid' and reduce retry queue fill num. */
+      TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx, newTcpRetryQElementIdx);
+      if (NumDropEle < TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx))
       {
-# if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                     /* COV_MSR_UNSUPPORTED */
-        TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-        if(TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)->sa_family == IPBASE_AF_INET6)
-        {
-          /* Fixed IPv6 header requires 20 bytes more than already considered IPv4 header. So TCP MSS has to be reduced by 20 bytes. */
-          TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx,
-            (TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)
-              - (TcpIp_TxMaxSegLenByteOfSocketTcpDynType)(TCPIP_IPV6_HDR_LEN_BYTE - TCPIP_IPV4_HDR_LEN_BYTE)));
-        }
-#  if (TCPIP_SUPPORT_IPSEC == STD_ON)
-        else
-#  endif
-# endif
-# if (TCPIP_SUPPORT_IPSEC == STD_ON)
-        {
-          /* If IPsec is enabled, always decrement IPsec AH header bytes from Tx MSS */
-          TcpIp_SubTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, TCPIP_IPSEC_HDR_LEN_MAX);
-        }
-# endif
-      }
+        TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->EleNext  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
 
-      if (maxLen < TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx))
+        TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) - NumDropEle));
+      }
+      else
       {
-        /* Received MSS is smaller than largest possible segment size the ECU can send.
-        * -> Use received MSS value.
-        */
-        TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, maxLen);
+        TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, 0);
       }
+    }
 
-      /* Init SockMtuSize with received MaxSegLen */
-      TcpIp_SetTxMssAgreedOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));
 
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-      /* resize cwnd */
-      TcpIp_SetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(maxLen));
-      TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, ((uint32) maxLen * TcpIp_GetCwndSegNumLimitOfSocketTcpCongCtrlDyn(SocketTcpIdx)));
-# endif
+    /* #30 Append removed elements to the global list of free elements, or use the removed elements as the new global free elements list if there have not been free elements before. */
+    if (TcpIp_Tcp_NumFreeRetryQEle == 0u)
+    {
+      /* FreeList has been empty */
+      TcpIp_Tcp_FirstFreeRetrQueueEle    = firstRemTcpRetryQElementIdx;
+
+      /* Set predecessor of the first queue element to 'invalid'. */
+      TcpIp_GetAddrTcpRetryQElement(firstRemTcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
     }
     else
     {
-      /* this option may not be received or evaluated in this state -> ignore it */
+      /* Link the first element of the queue part that shall be appended with the old last element of the free list. */
+      /*@ assert TcpIp_Tcp_LastFreeRetrQueueEle < TcpIp_GetSizeOfTcpRetryQElement(); */                                 /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+      TcpIp_GetAddrTcpRetryQElement(TcpIp_Tcp_LastFreeRetrQueueEle)->EleNext = firstRemTcpRetryQElementIdx;
+      TcpIp_GetAddrTcpRetryQElement(firstRemTcpRetryQElementIdx       )->ElePrev = TcpIp_Tcp_LastFreeRetrQueueEle;
     }
-  }
-  else
-  {
-    /* erroneous option */
-    optStatus = E_NOT_OK;
-  }
 
-  return optStatus;
+    /* Set successor of the last queue element to 'invalid', and increase the number of free elements. */
+    TcpIp_Tcp_LastFreeRetrQueueEle     = oldLastTcpRetryQElementIdx;
+    TcpIp_Tcp_NumFreeRetryQEle        += NumDropEle;
+
+    /* #40 Call function to un-queue the removed len 'remLen' */
+    /* Set the FIN flag for later transmission if the flag was set in the last queue element that has been dropped. */
+    if((lastElementFlags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
+    {
+      /* trigger FIN */
+      TcpIp_DecTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
+      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN | TCPIP_TCP_CODE_BIT_ACK));
+    }
+    TcpIp_Tcp_VUnqueueDataInTxReq(SocketTcpIdx, remLen);
+
+    TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
+  }
 }
 
 
-# if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_SackPermit
+ *  TcpIp_Tcp_VUnqueueDataInTxReq
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10563,112 +12262,42 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_MaxSegS
  *
  *
  *
+ *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_SackPermit(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint8 OptLen)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUnqueueDataInTxReq(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx,
+  TcpIp_SizeOfTcpTxBufferType UnqueueLen)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType optStatus = E_OK;
+  TcpIp_SizeOfTcpTxBufferType lengthToBeUnqueued = 0u;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if the received option length matches the expected length and is received only in the correct connection state */
-  if (   (OptLen == TCPIP_TCP_OPT_LEN_SACK_PERMIT)                                                                      /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_SOCK_STATE_SYNRCVD))
+  /* #10 Limit the amount of data that shall be un-queued to the currently queued length. */
+  if (UnqueueLen > TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx))
   {
-    /* received the permission to use the SACK option */
-    /* #20 Activate the usage of the SACK option. */
-    TcpIp_SetSackOptActiveOfSocketTcpDyn(SocketTcpIdx, TRUE);
-
-    /* #30 Trigger sending of 'SACK PERMIT' option for passive open */
-    if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_LISTEN)
-    {
-      TcpIp_SetTxOneTimeOptsOfSocketTcpDyn(   SocketTcpIdx, (TcpIp_GetTxOneTimeOptsOfSocketTcpDyn(SocketTcpIdx) | (TcpIp_TxOneTimeOptsOfSocketTcpDynType)TCPIP_TCP_OPT_FLAG_SACK_PERMIT));
-      TcpIp_SetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxOneTimeOptsLenOfSocketTcpDyn(SocketTcpIdx) + (TCPIP_TCP_OPT_LEN_SACK_PERMIT + 2u)));  /* option + 2x NOP */
-    }
+    lengthToBeUnqueued = TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx);
   }
   else
   {
-    /* erroneous option or received in the wrong TCP socket state */
-    optStatus = E_NOT_OK;
+    lengthToBeUnqueued = UnqueueLen;
   }
 
-  return optStatus;
-}
-
-
-/**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_Sack
- *********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Sack(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(uint8) OptPtr,
-  uint8 OptLen)
-{
-  /* option 'SACK', option length is 2 + n*8 byte */
-  Std_ReturnType optStatus = E_OK;
-  uint8          remOptLen = (uint8)(OptLen - TCPIP_TCP_OPT_LEN_SACK);
-
-  /* #10 Check if the received option length matches the expected length and is received only in the correct connection state */
-  if (   ((remOptLen % TCPIP_TCP_SACK_ELEMENT_LEN) == 0u)  /* remOptLen is a multiple of 8 bytes */                     /* PRQA S 3415 6 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) >= TCPIP_TCP_SOCK_STATE_ESTABLISHED))
+  /* #20 Check that the length to remove is not 0. */
+  if (lengthToBeUnqueued > 0u)
   {
-    /* (OptLen - 2) is a multiple of 8 (=TCPIP_TCP_SACK_ELEMENT_LEN), so the option has a valid length. */
-    uint8 sackEleNum = (uint8)(remOptLen / TCPIP_TCP_SACK_ELEMENT_LEN);  /* Number of received sequence number pairs,
-                                                                    an empty sack option is also handled to be valid. */
-
-    CANOE_WRITE_STRING_1("TcpIp_Tcp_VHandleTcpOptions: Received SACK option with %d elements", sackEleNum);
-
-    /* #20 Mark elements in TxRetrQueue as selective acknowledged (sACKed) */
-    if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 0u)
-    {
-      uint16 seqNrPairOfs = TCPIP_TCP_OPT_OFS_VALUE;
-
-      while (sackEleNum > 0u)
-      {
-        uint32                           leftEdge  = TCPIP_GET_UINT32(OptPtr, seqNrPairOfs);
-        uint32                           rightEdge = TCPIP_GET_UINT32(OptPtr, seqNrPairOfs + TCPIP_TCP_SEQU_NUM_LEN);
-        TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx;
-
-        for (tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-             tcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement();
-             tcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext)
-        {
-          /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-          if (   TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(  TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SeqNo, leftEdge)
-              && TCPIP_TCP_SEQ1_SMALLER_OR_EQUAL_SEQ2((TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SeqNo + TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SizeTotByte), rightEdge))
-          {
-            /* element is in the sequence number range of this SACK element -> mark as 'sacked' */
-            TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SackFlag = 1;
-          }
-        }
+    /* #30 Move lengthToBeUnqueued from TxReqQueuedLen to TxTotNotQueuedLen. */
+    TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(   SocketTcpIdx, (TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx)    - lengthToBeUnqueued));
+    TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + lengthToBeUnqueued));
+    TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, FALSE);
 
-        sackEleNum--;
-        seqNrPairOfs += TCPIP_TCP_SACK_ELEMENT_LEN;
-      }
-    }
-  }
-  else
-  {
-    /* erroneous option */
-    optStatus = E_NOT_OK;
+    /* #40 Set next send sequence number. */
+    TcpIp_SetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx) - lengthToBeUnqueued));
   }
-
-  return optStatus;
 }
-# endif
 
 
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_Timestamp
+ *  TcpIp_Tcp_VMainStateHandling
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10679,89 +12308,80 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Sack(
  *
  *
  */
-/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Timestamp(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr,
-  TCPIP_P2C(uint8) OptPtr,
-  uint8 OptLen)
+/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType optStatus = E_OK;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if the received option length matches the expected length and is received only in the correct connection state */
-  if (OptLen == TCPIP_TCP_OPT_LEN_TIMESTAMP)
-  {
-    /* #20 Read received timestamp value */
-    uint32 tsVal = TCPIP_GET_UINT32(OptPtr, TCPIP_TCP_OPT_OFS_VALUE);
-
-    if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_LISTEN)                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        || (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNSENT))
-    {
-      /* #30 Activate the usage of the timestamp option and take over the timestamp */
-      TcpIp_SetTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx, TRUE);
+  /* #10 Handle received RST */
+  TcpIp_Tcp_VMainStateHandling_Reset(SocketTcpIdx);
 
-      TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx, tsVal);
-    }
+  /* #20 Check if a state change is triggered. */
+  if (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_INVALID)
+  {
+    TcpIp_SockStateOfSocketTcpDynType copyOfSockState = TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx);
 
-    if (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)
+    /* #30 Proceed the state handling dependent on the requested state. */
+    switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
     {
-      if (SegmentDescriptorPtr->SegSeq == TcpIp_GetRcvNxtOfSocketTcpDyn(SocketTcpIdx))
-      {
-        /* only take over the timestamp from the most recent segment that advanced the window */
-        TcpIp_SetTimestampReceivedOfSocketTcpTsOptDyn(SocketTcpIdx, tsVal);
-      }
-
-      /* #40 Read received timestamp echo reply */
-      /* This is the timestamp that was earlier sent by this ECU -> evaluate RTT */
-      if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)                            /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-          && (TCPIP_TCP_SEQ1_SMALLER_SEQ2(TcpIp_GetSndUnaOfSocketTcpDyn(SocketTcpIdx), SegmentDescriptorPtr->SegAck)))
-      {
-        uint32                      tsEcr = TCPIP_GET_UINT32(OptPtr, TCPIP_TCP_OPT_OFS_VALUE + 4u);
-        uint32                      elementRtt;
-        TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx;
-
-        elementRtt = TcpIp_Tcp_GlobalTimestamp - tsEcr;
-
-        if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_SYNRCVD)
-        {
-          TcpIp_Tcp_VUpdateRttVars(SocketTcpIdx, elementRtt);
-        }
-
-        /* #50 Search for corresponding element in the TxRetrQueue. If element was already retransmitted, discard this timestamp echo reply. */
-        for (tcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-             tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-             tcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext)
+    case TCPIP_TCP_SOCK_STATE_SYNSENT:
+    case TCPIP_TCP_SOCK_STATE_SYNRCVD:
+    /* case TCPIP_TCP_SOCK_STATE_ESTABLISHED: STORYC-6890 This state is not reachable since Next Socket state is always INVALID for state Established */
+    case TCPIP_TCP_SOCK_STATE_LASTACK:
+    case TCPIP_TCP_SOCK_STATE_FINWAIT1:
+    case TCPIP_TCP_SOCK_STATE_CLOSING:
+      {
+        /* #40 Trigger sending if something to send is available */
+        if (TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx) == E_OK)
         {
-          if (tsEcr == TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TimeStamp)
+          TCPIP_VENTER_CRITICAL_SECTION();  /* lock interrupts */
+          /* Check if SockState has changed. This would mean that this function has been interrupted and the state has
+          been changed in the interrupting context. */
+          if (copyOfSockState == TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
           {
-            /* the element was not yet retransmitted, so the tsEcr may be used for the RRTM */
-            CANOE_WRITE_STRING_3("TcpIp_Tcp_VHandleTcpOptions: RetrQueue element found with matching Timestamp %d, acknowledged data size is %d, current segment RTT is %d)", tsEcr, (SegmentDescriptorPtr->SegAck - TcpIp_GetSndUnaOfSocketTcpDyn(SocketTcpIdx)), elementRtt);
-
-            /* use elementRtt for connection RTT calculation */
-            TcpIp_Tcp_VUpdateRttVars(SocketTcpIdx, elementRtt);
-
-            break;  /* don't search for further elements, there is no benefit in finding more matching elements */
+            /* #50 Message transmission succeeded, so switch to the next socket state. */
+            /* The SockState is already set correctly, only reset the SockStateNext to indicate that no further action is needed. */
+            TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
+          }
+          else
+          {
+            /* This function was interrupted. Don't overwrite the SockState that was set in the interrupting context. */
           }
+          TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
         }
+        break;
       }
+    case TCPIP_TCP_SOCK_STATE_TIMEWAIT:
+    {
+      TcpIp_Tcp_VMainStateHandling_Timewait(SocketTcpIdx);
+      break;
     }
+    case TCPIP_TCP_SOCK_STATE_CLOSEWAIT:
+    {
+      if (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) == 0u)
+      {
+        /* The ACK that was triggered when receiving the FIN is sent, so StateNext can be reset */
+        TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
+      }
+      break;
+    }
+    default:
+      {
+        /* TCPIP_TCP_SOCK_STATE_INVALID,
+           TCPIP_TCP_SOCK_STATE_LISTEN,
+           TCPIP_TCP_SOCK_STATE_FINWAIT2,
+           TCPIP_TCP_SOCK_STATE_CLOSED:
+           -> do nothing */
+      }
+      break;
+    }  /* switch */
   }
-  else
-  {
-    /* erroneous option */
-    optStatus = E_NOT_OK;
-  }
-
-  return optStatus;
 }
-# endif /* (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) */
 
 
-# if (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON)
+
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_UserTimeout
+ *  TcpIp_Tcp_VMainStateHandling_Reset
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10769,215 +12389,238 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Timesta
  *
  *
  *
+ *
+ *
  */
-/* PRQA S 6080 1 */ /* MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_UserTimeout(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(uint8) OptPtr,
-  uint8 OptLen)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling_Reset(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  /* option 'User Timeout' */
-  Std_ReturnType optStatus = E_OK;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if the received option length matches the expected length. */
-  if (OptLen == TCPIP_TCP_OPT_LEN_USER_TIMEOUT)
+  /* #10 Handle received RST */
+  if (TcpIp_IsRstReceivedOfSocketTcpDyn(SocketTcpIdx) == TRUE)
   {
-    /* #20 Check if changeing the user timeout value is possible */
-    if (   (TcpIp_IsUtoEnabledOfSocketTcpUtoDyn(SocketTcpIdx)    == TRUE)                                               /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        && (TcpIp_IsUtoChangeableOfSocketTcpUtoDyn(SocketTcpIdx) == TRUE))
+    /* #20 Proceed depended on the socket state */
+    switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
     {
-      uint32 timeoutRecCycles;
-      uint16 optVal = TCPIP_GET_UINT16(OptPtr, TCPIP_TCP_OPT_OFS_VALUE);
-
-      TcpIp_SetUtoRemoteOfSocketTcpUtoDyn(SocketTcpIdx, optVal);
-
-      /* #30 Determine the new user timeout value and set the Uto */
-      if ((optVal & TCPIP_TCP_OPT_USER_TIMEOUT_FLAG_GRANULARITY_MINUTES) == 0u)
+    case TCPIP_TCP_SOCK_STATE_SYNRCVD:
       {
-        /* granularity is seconds (= 1000ms) */
-        timeoutRecCycles = (((uint32) optVal) * 1000u) / TCPIP_MAIN_FCT_PERIOD_MSEC;
+        /* #30 Close the socket */
+        /* This state can only be achieved by passively opened connection. Simultaneous Opening is not supported.
+           That's why SYNRCVD state can never be achieved in case of actively opened connection  */
+        /* connection was reset by peer */
+        /* delete/clear this TCB (user has to call Sock_Connect() again later): */
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+        break;
       }
-      else
+    case TCPIP_TCP_SOCK_STATE_ESTABLISHED:
+    case TCPIP_TCP_SOCK_STATE_FINWAIT1:
+    case TCPIP_TCP_SOCK_STATE_FINWAIT2:
+    case TCPIP_TCP_SOCK_STATE_CLOSEWAIT:
       {
-        /* granularity is minutes (= 60000ms) */
-        timeoutRecCycles = (((uint32) optVal & TCPIP_TCP_OPT_USER_TIMEOUT_VALUE_MASK) * 60000u) / TCPIP_MAIN_FCT_PERIOD_MSEC;
-      }
+        /* #40 Close the socket */
+        /* If the RST bit is set then, any outstanding RECEIVEs and SEND should receive 'reset'
+        responses. All segment queues should be flushed. Users should also receive an
+        unsolicited general 'connection reset' signal. Enter the CLOSED state, delete the TCB,
+        and return. */
+        /* cancel all send and receive calls
+        -> nothing to be done for AUTOSAR API */
 
-      if (timeoutRecCycles > 0u)
-      {
-        if (timeoutRecCycles < TcpIp_GetUserTimeoutMinCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX))
-        {
-          TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, TcpIp_GetUserTimeoutMinCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX));
-        }
-        else if (timeoutRecCycles > TcpIp_GetUserTimeoutMaxCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX))
-        {
-          TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, TcpIp_GetUserTimeoutMaxCyclesOfTcpConfig(TCPIP_TCPCONFIG_IDX));
-        }
-        else
-        {
-          TcpIp_SetUtoOfSocketTcpUtoDyn(SocketTcpIdx, timeoutRecCycles);
-        }
+        /* remove all elements from tx-queue and rx-queue */
+        /* enter CLOSED state, delete/clear TCB */
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+
+        TcpIp_SetLastSockError(TCPIP_SOCK_ERR_10054);  /* 'Connection reset by peer' */
+        break;
       }
-      else
+    default:
       {
-        /* reserved for future usage -> ignore this option */
+        /* TCPIP_TCP_SOCK_STATE_CLOSING, TCPIP_TCP_SOCK_STATE_LASTACK, TCPIP_TCP_SOCK_STATE_TIMEWAIT */
+        /* #50 Close the socket */
+        /* enter CLOSED state, delete/clear TCB */
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
+        break;
       }
     }
   }
-  else
-  {
-    /* erroneous option */
-    optStatus = E_NOT_OK;
-  }
-
-  return optStatus;
 }
-# endif /* (TCPIP_SUPPORT_TCP_USER_TIMEOUT_OPTION == STD_ON) */
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_Default
+ *  TcpIp_Tcp_VMainStateHandling_Timewait
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ *
+ *
+ *
+ *
  */
-TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_Default(
-  uint8 ByteIdx,
-  uint8 OptLen,
-  uint8 AllOptionsLen)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling_Timewait(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  Std_ReturnType optStatus = E_OK;
-  uint8 remLen = (uint8)(AllOptionsLen - ByteIdx);
-
   /* ----- Implementation ----------------------------------------------- */
-
-  /* #10 Check if the general option format is ok, then ignore the option, otherwise indicate an error. */
-  if ((remLen >= OptLen) && (OptLen >= 2u))
+  /* #10 State handling dependent on the next socket state */
+  if (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_TIMEWAIT)
   {
-    /* unknown options will be ignored */
+    /* #20 Trigger sending of final ACK if next socket state is TIMEWAIT */
+    if (TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx) == E_OK)
+    {
+      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_CLOSED);
+
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+      TcpIp_Tcp_VKeepAliveReset(SocketTcpIdx);
+# endif
+    }
   }
-  else
+
+  if (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)
   {
-    /* error in option */
-    optStatus = E_NOT_OK;
-  }
+    /* #30 If the next socket state is CLOSED, decrease Timeout timer (MSL) or finally close the socket */
+    if (   (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) == 0u)                                                   /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+        && (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) == 0u))  /* wait for the last ACK to be sent / removed from tx queue */
+    {
+      /* #40 Decrease Timeout timer (MSL) */
+      if (TcpIp_GetMslTimeoutOfSocketTcpDyn(SocketTcpIdx) > 0u)
+      {
+        TcpIp_DecMslTimeoutOfSocketTcpDyn(SocketTcpIdx);
+      }
+      else /* (Tcp_MslTimeout == 0), timeout expired */
+      {
+        /* #50 Close the socket because the timeout has expired */
 
-  return optStatus;
+        /* switch to state CLOSED, delete/clear TCB element */
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
+      }
+    }
+  }
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_ResetConnection
+ *  TcpIp_Tcp_VMainRxDataForwarding
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_ResetConnection(
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainRxDataForwarding(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockRemAddrPtr,
-  TCPIP_P2C(TcpIp_SockAddrBaseType) RxSockLocAddrPtr,
-  TCPIP_P2C(TcpIp_Tcp_SegmentDescriptorType) SegmentDescriptorPtr)
+  uint16 MaxLenToForward)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-  TcpIp_SizeOfLocalAddrType ipAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
-  /*@ assert ipAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                                 /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
+  TcpIp_SizeOfTcpRxBufferDescType tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  uint16 remainingLengthAtEndOfBuffer = 0u;
+  /* pointer to the start of the received data in the rx buffer */
+  TCPIP_P2V(uint8) locBufPtr          = NULL_PTR;
+
+  /* ----- Implementation ----------------------------------------------- */
+  TCPIP_ASSERT(tcpRxBufferDescIdx                                  <  TcpIp_GetSizeOfTcpRxBufferDesc());
+  TCPIP_ASSERT(MaxLenToForward                                     <= TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx));
+  TCPIP_ASSERT(TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx) <  TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx));
+
+  /* Caching of 'MaxLenToForward' is required because 'RxBufferRemIndLenOfSocketTcpDyn' may be updated before the second
+  critical section below. */
+  /* #10 Get the start position of the data that shall be forwarded. */
+
+  TCPIP_VENTER_CRITICAL_SECTION();  /* lock interrupts */
+
+  remainingLengthAtEndOfBuffer = (uint16)(TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx) - TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx));
+  locBufPtr = TcpIp_GetAddrTcpRxBuffer(
+    TcpIp_GetTcpRxBufferStartIdxOfTcpRxBufferDesc(tcpRxBufferDescIdx) +
+    TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx));
+
+  /* #20 Forward the data to the socket owner. */
+  if (remainingLengthAtEndOfBuffer >= MaxLenToForward)
+  {
+    /* Data is in a linear buffer. */
+    /* indicate bytes 0..((TCPIP_TCP_MAX_WINDOW_SIZE - Tcp_RxBufferWritePos[SocketTcpIdx]) - 1) */
+
+    TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
+
+    TcpIp_Tcp_UpRxIndication(SocketTcpIdx, locBufPtr, MaxLenToForward);
+  }
+  else
+  {
+    /* data buffer includes wrap around */
+    /* indicate data with taking care of buffer wrap-around (two blocks) */
 
-  /* ----- Implementation ----------------------------------------------- */
-  /* An erroneous option has been received -> send RST and close connection */
+    /* pointer to the start of the rx buffer in case the received data causes a buffer wrap around */
+    TCPIP_P2V(uint8) locBufSecondPtr = TcpIp_GetAddrTcpRxBuffer(TcpIp_GetTcpRxBufferStartIdxOfTcpRxBufferDesc(tcpRxBufferDescIdx));
 
-  /* #10 Trigger sending a RST. */
-  TcpIp_Tcp_VSendReset(SocketTcpIdx, ipAddrIdx,
-    RxSockRemAddrPtr, RxSockLocAddrPtr, SegmentDescriptorPtr->SegAck, 0u, 0u);
+    TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
 
-  /* #20 Close the socket. */
-  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)
+    /* indicate bytes 0..((TCPIP_TCP_MAX_WINDOW_SIZE - TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx)) - 1) */
+    TcpIp_Tcp_UpRxIndication(SocketTcpIdx, locBufPtr, remainingLengthAtEndOfBuffer);
+
+    /* indicate remaining bytes */
+    TcpIp_Tcp_UpRxIndication(SocketTcpIdx, locBufSecondPtr, MaxLenToForward - remainingLengthAtEndOfBuffer);
+  }
+
+  TCPIP_VENTER_CRITICAL_SECTION();  /* lock interrupts */
+
+  /* #30 Increase the buffer start position, taking care of the wraparound. Check if socket was not reset in the meantime. */
+  if (TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) < TcpIp_GetSizeOfTcpRxBufferDesc())
   {
-    /* enter CLOSED state, delete/clear TCB */
-    TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+    TcpIp_SetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx, (TcpIp_SizeOfTcpRxBufferType)TcpIp_AddWithWrapAround32(
+      TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx), MaxLenToForward,
+      TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx)));
+
+    TcpIp_SetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx) - MaxLenToForward));
   }
 
+  TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
 }
 
-# if ((TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) || (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON))
+# if (TCPIP_TCP_RX_BURST == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen
+ *  TcpIp_Tcp_VRxBurstNoteSocket
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen(
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VRxBurstNoteSocket(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  /* timestamp option and SACK option both have to be negotiated during the handshake within the same message */
-
-  uint8 blockedOptLen = 0;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if we are in the a connection state bigger than SynRcvd */
-  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_SOCK_STATE_SYNRCVD)
+  if (   (TcpIp_Tcp_RxBurstActive == TRUE)
+      && (TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx) > 0u))
   {
-    /* #20 Add the needed length per option */
-#  if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
-    if (TcpIp_IsTimestampOptActiveOfSocketTcpTsOptDyn(SocketTcpIdx) == TRUE)
-    {
-      blockedOptLen = (TCPIP_TCP_OPT_LEN_TIMESTAMP + 2u);  /* including 2* NOP */
-    }
-#  endif
-#  if (TCPIP_SUPPORT_TCP_SELECTIVE_ACK == STD_ON)
-    if (TcpIp_IsSackOptActiveOfSocketTcpDyn(SocketTcpIdx) == TRUE)
-    {
-      blockedOptLen = TCPIP_TCP_HDR_OPT_LEN_MAX_BYTE;  /* maximum TCP option length */ /* overwrite len set for timestamp option */
-    }
-#  endif
+    boolean     isNoted = FALSE;
+    uint8_least burstSocketIdx;
 
-    if (blockedOptLen > 0u)
+    /* #10 Check if the socket is already noted. Consecutive segments usually belong to the same connection, so the
+     *     search starts at the socket noted last. */
+    for (burstSocketIdx = TcpIp_Tcp_RxBurstSocketNum; burstSocketIdx > 0u; burstSocketIdx--)
     {
-      /* #30 Set the new maximum segment length */
-      TcpIp_SetTxOptLenOfSocketTcpDyn(SocketTcpIdx, blockedOptLen);
-
-#  if (TCPIP_SUPPORT_IPV6 == STD_ON)                                                                                    /* COV_MSR_UNSUPPORTED */
-      if (TcpIp_GetAddrRemSockOfSocketDyn(TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx))->sa_family == IPBASE_AF_INET6)
-      {
-        /* If IPv6 is enabled, also consider the extra length of IPv6 header */
-        blockedOptLen += (TCPIP_IPV6_HDR_LEN_BYTE - TCPIP_IPV4_HDR_LEN_BYTE);
-      }
-#  endif
-#  if (TCPIP_SUPPORT_IPV6 == STD_ON) && (TCPIP_SUPPORT_IPSEC == STD_ON)                                                 /* COV_TCPIP_IPV6_SUPPORT_ALWAYS_OFF */
-      else
-#  endif
-#  if (TCPIP_SUPPORT_IPSEC == STD_ON)
+      if (TcpIp_Tcp_RxBurstSocket[burstSocketIdx - 1u] == SocketTcpIdx)
       {
-        /* If IPsec is enabled, also consider the IPsec header length in following calculation */
-        blockedOptLen += TCPIP_IPSEC_HDR_LEN_MAX;
+        isNoted = TRUE;
+        break;
       }
-#  endif
+    }
 
-      if ((blockedOptLen + TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)) > TcpIp_GetTxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX))
-      {
-        TcpIp_SetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxMssOfTcpConfig(TCPIP_TCPCONFIG_IDX) - blockedOptLen));
-      }
+    /* #20 Note the socket if it is not noted yet and there is space left. */
+    if (   (isNoted == FALSE)
+        && (TcpIp_Tcp_RxBurstSocketNum < TCPIP_TCP_RX_BURST_SOCK_NUM))
+    {
+      TcpIp_Tcp_RxBurstSocket[TcpIp_Tcp_RxBurstSocketNum] = SocketTcpIdx;
+      TcpIp_Tcp_RxBurstSocketNum++;
     }
   }
 }
 # endif
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VAddrResTimeout
+ *  TcpIp_Tcp_VMainIdleTimeoutHandling
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -10986,147 +12629,117 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VHandleTcpOptions_SetBlockedOptLen(
  *
  *
  *
+ *
+ *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-FUNC(void, TCPIP_CODE) TcpIp_Tcp_VAddrResTimeout(
-  TCPIP_P2C(TcpIp_SockAddrBaseType) DestAddrPtr)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainIdleTimeoutHandling(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfSocketTcpDynType   socketTcpIdx;
-  TcpIp_SizeOfSocketDynType      socketIdx = 0u;
-  TcpIp_TcpRstHandlingIterType   tcpRstHandlingIdx;
-
   /* ----- Implementation ----------------------------------------------- */
-  CANOE_WRITE_STRING_1("TcpIp_Tcp_VAddrResTimeout: function called, AddrType = %d", DestAddrPtr->sa_family);
-
-  /* #10 Check the socket state of all sockets */
-  for (socketTcpIdx = 0; socketTcpIdx < TcpIp_GetSizeOfSocketTcpDyn(); socketTcpIdx++)
+# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
+  /* #10 Check if TCP Keep-Alive is enabled for the socket. */
+  if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_ESTABLISHED)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+      && (TcpIp_IsEnabledOfSocketTcpKeepAliveDyn(SocketTcpIdx) == TRUE))
   {
-    socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(socketTcpIdx);
+    /* Keep-alive is enabled for this connection. */
+    uint32 keepAliveIdleTimeMax;
 
-    if (   (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_CLOSED)                              /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        && (TcpIp_GetSockStateOfSocketTcpDyn(socketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN))
+    /* #20 Check if timeout for first keep-alive segment or consecutive keep-alive segment has to be applied. */
+    if (TcpIp_GetProbesOfSocketTcpKeepAliveDyn(SocketTcpIdx) == 0u)
     {
-      /* #20 Check the addr to find out if the socket is affected by the address resolution timeout, then stop the retry
-         mechanism on the socket and indicate an error to the user. */
-      if (TcpIp_VSockIpAddrIsEqual(DestAddrPtr, TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)) == TRUE)
-      {
-        /* addr request timeout for this socket occurred */
-
-        CANOE_WRITE_STRING_1("TcpIp_Tcp_VAddrResTimeout: Addr match on socket %d", socketIdx);
-
-        /* issue a RESET to the user and close TCP socket */
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(socketTcpIdx, TCPIP_TCP_STATE_RESET);
-      }
+      /* No keep-alive probes sent so far. Wait for keep-alive timeout. */
+      keepAliveIdleTimeMax = TcpIp_GetTimeoutOfSocketTcpKeepAliveDyn(SocketTcpIdx);
     }
-  }
-
-  /* #30 Remove elements from the reset queue if they are affected by the address resolution timeout. */
-  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-  for (tcpRstHandlingIdx = 0; tcpRstHandlingIdx < TcpIp_GetSizeOfTcpRstHandlingDyn(); tcpRstHandlingIdx++)
-  {
-    if (0u < TcpIp_GetRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx))
+    else
     {
-      TcpIp_RstTxQueueBufferIterType rstTxQueueBufferIdx;
+      /* Keep-Alive timeout already expired and at least one probe has been sent. Wait for next probe interval. */
+      keepAliveIdleTimeMax = TcpIp_GetProbeIntervalOfSocketTcpKeepAliveDyn(SocketTcpIdx);
+    }
 
-      for(rstTxQueueBufferIdx = TcpIp_GetRstTxQueueBufferStartIdxOfTcpRstHandling(tcpRstHandlingIdx);
-        rstTxQueueBufferIdx < TcpIp_GetRstTxQueueBufferEndIdxOfTcpRstHandling(tcpRstHandlingIdx);
-        rstTxQueueBufferIdx++)
+    /* #30 Increment idle time counter for the socket if timeout has not expired yet. */
+    if (TcpIp_GetIdleTimeOfSocketTcpKeepAliveDyn(SocketTcpIdx) < keepAliveIdleTimeMax)
+    {
+      /* Timeout has not expired yet. */
+      TcpIp_IncIdleTimeOfSocketTcpKeepAliveDyn(SocketTcpIdx);
+    }
+    /* #40 ELSE: Send keep-alive segment and reset idle time or close connection if configured number of keep-alive segments have been sent. */
+    else
+    {
+      if (TcpIp_GetProbesOfSocketTcpKeepAliveDyn(SocketTcpIdx) < TcpIp_GetProbesMaxOfSocketTcpKeepAliveDyn(SocketTcpIdx))
       {
-        TCPIP_P2V(TcpIp_SockAddrBaseType) remSockAddrPtr = &TcpIp_GetAddrRstTxQueueBuffer(rstTxQueueBufferIdx)->RemSock;
-
-        if (TcpIp_VSockIpAddrIsEqual(DestAddrPtr, remSockAddrPtr) == TRUE)
+        if (TcpIp_Tcp_VTransmitKeepAliveProbe(SocketTcpIdx) == E_OK)
         {
-          /* Remove entry from the reset queue. */
-          remSockAddrPtr->sa_family = IPBASE_AF_UNSPEC;
-          TcpIp_DecRstTxQueueBufferFillMaxIdxOfTcpRstHandlingDyn(tcpRstHandlingIdx);
+          /* Reset idle time and wait for next timeout. */
+          TcpIp_SetIdleTimeOfSocketTcpKeepAliveDyn(SocketTcpIdx, 0);
+          TcpIp_IncProbesOfSocketTcpKeepAliveDyn(SocketTcpIdx);
         }
       }
-    }
-  }
-  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
-
-}
-
-
-/**********************************************************************************************************************
- *  TcpIp_Tcp_VFreeFirstRetrQueueEle
- *********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFreeFirstRetrQueueEle(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
-{
-  /* ----- Local Variables ---------------------------------------------- */
-  /* element that shall be removed / moved to free-list */
-  TcpIp_SizeOfTcpRetryQElementType sockOldFirstTcpRetryQElementIdx     = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-  /*@ assert sockOldFirstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                    /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-  TcpIp_SizeOfTcpRetryQElementType globNewTcpRetryQElementIdx  = sockOldFirstTcpRetryQElementIdx;
+      else
+      {
+        /* Maximum number of keep-alive probes have been sent and were not answered. Close connection. */
 
-  /* ----- Implementation ----------------------------------------------- */
-  /* #10 Remove element from the socket's RetrQueue */
-  if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 1u)
-  {
-    /* there is at least one element left in the socket's RetrQueue */
-    TcpIp_SizeOfTcpRetryQElementType sockNewFirstTcpRetryQElementIdx = TcpIp_GetAddrTcpRetryQElement(sockOldFirstTcpRetryQElementIdx)->EleNext;
-    /*@ assert sockNewFirstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                  /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+        TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+        TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
+        /*@ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                         /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
 
-    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, sockNewFirstTcpRetryQElementIdx);
-    TcpIp_GetAddrTcpRetryQElement(sockNewFirstTcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    TcpIp_DecRetryQFillNumOfSocketTcpDyn(SocketTcpIdx);
-  }
-  else
-  {
-    /* the socket's RetrQueue will be empty afterwards */
+        /* timeout expired -> close / reset connection */
+        /* sending a reset is an extension, there is no need for that according to the RFC */
+        TcpIp_Tcp_VSendReset(SocketTcpIdx, txIpAddrIdx,
+          (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)), (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
+          TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u);  /* seqNo, ackNo */
 
-    TcpIp_SetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
-    TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn( SocketTcpIdx, TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV);
-    TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, 0);
+        /* flush all queues, signal the user 'error: connection aborted due to idle timeout' in
+        general and for any outstanding calls, delete the TCB, enter the CLOSED state and
+        return. */
+        /* delete/clear TCB element */
+        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+      }
+    }
   }
+# endif
 
-  TCPIP_VENTER_MC_ONLY_CRITICAL_SECTION();  /* lock cross core interrupts */
+  /* -------------------------------------------------------------------------------------------- */
+  /* Handle Tcp_IdleTimeoutShort[] --------------------------------------------------------- */
 
-  /* #20 Append the element to the free-list */
-  if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
+  /* #50 Check if idle timeout for congestion window reset and zero window probe has been reached. */
+  if (TcpIp_GetIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx) > 0u)
   {
-    TcpIp_SizeOfTcpRetryQElementType globOldLastFreeTcpRetryQElementIdx = TcpIp_Tcp_LastFreeRetrQueueEle;
-    /*@ assert globOldLastFreeTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                               /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-
-    /* there are some (at least one) elements in the free-list */
+    TcpIp_DecIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx);
+    if (TcpIp_GetIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx) == 0u)
+    {
+      /* timeout has expired */
 
-    /* link last element of the free-list with the (old) first element of the socket's RetrQueue */
-    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->ElePrev = globOldLastFreeTcpRetryQElementIdx;
-    TcpIp_GetAddrTcpRetryQElement(globOldLastFreeTcpRetryQElementIdx)->EleNext = globNewTcpRetryQElementIdx;
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
+      {
+        /* reset the congestion window because the connection has been idle for too long */
+        /* cwnd = RW = min(IW,cwnd) */
+        uint32 iw = ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx) * TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)));
 
-    /* mark the element of the socket's RetrQueue that shall be removed as the global last element of the free elements list */
-    TcpIp_Tcp_LastFreeRetrQueueEle = globNewTcpRetryQElementIdx;
-    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->EleNext = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-  }
-  else
-  {
-    /* the free-list is empty, so fill in the first element */
+        if (iw < TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx))
+        {
+          TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, iw);
+        }
 
-    /* set neighbor element indices to invalid */
-    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    TcpIp_GetAddrTcpRetryQElement(globNewTcpRetryQElementIdx)->EleNext = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
+      }
+# endif
 
-    /* mark the element as the global last and first element of the free elements list */
-    TcpIp_Tcp_FirstFreeRetrQueueEle = globNewTcpRetryQElementIdx;
-    TcpIp_Tcp_LastFreeRetrQueueEle  = globNewTcpRetryQElementIdx;
+      /* Check if the socket has elements in its retry queue */
+      if (TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+      {
+        /* handle Zero Window Probing or splitting of the first segment */
+        TcpIp_Tcp_VSplitFirstRetrQueueEle(SocketTcpIdx);
+      }
+    }
   }
-  TcpIp_Tcp_NumFreeRetryQEle++;  /* inc free elements counter */
 
-  TCPIP_VLEAVE_MC_ONLY_CRITICAL_SECTION();
+  /* #60 Handle FINWAIT-2 timeout */
+  TcpIp_Tcp_VFinWait2TimeoutHandling(SocketTcpIdx);
 }
 
-
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VFreeAckedReqAndRetrElements
+ *  TcpIp_Tcp_VFinWait2TimeoutHandling
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11136,106 +12749,135 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFreeFirstRetrQueueEle(
  *
  *
  *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinWait2TimeoutHandling(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Check if socket is in FINWAIT-2 state and whether FINWAIT-2 timeout has expired */
+  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_FINWAIT2)
+  {
+    /* #20 Check if FINWAIT-2 timeout timer is running */
+    if (TcpIp_GetFinWait2TimeoutOfSocketTcpDyn(SocketTcpIdx) > 0u)
+    {
+      /* #30 Update the FINWAIT-2 timeout */
+      TcpIp_DecFinWait2TimeoutOfSocketTcpDyn(SocketTcpIdx);
+
+      /* #40 Check If timeout has expired now */
+      if (TcpIp_GetFinWait2TimeoutOfSocketTcpDyn(SocketTcpIdx) == 0u)
+      {
+        /* #50 FINWAIT-2 timeout expired and no FIN was received from remote peer. Abort connection. */
+        TcpIp_Tcp_Abort(SocketTcpIdx);
+      }
+    }
+  }
+} /* TcpIp_Tcp_VFinWait2TimeoutHandling() */
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VSplitFirstRetrQueueEle
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
  *
  *
  *
  *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFreeAckedReqAndRetrElements(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint32 SegAckNo)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSplitFirstRetrQueueEle(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  boolean checkIfFirstSegInQueueIsAcked = TRUE;
-  TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+  TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) firstQueueElePtr = TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx));
+  uint32 segLen  = firstQueueElePtr->SizeTotByte;
+  uint16 winSize = TcpIp_GetSndWndOfSocketTcpDyn(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Repeat removing first segment from TX Retry Queue if queue is not empty or a not fully ACKed segment has been found before. */
-  while (checkIfFirstSegInQueueIsAcked == TRUE)
+  /* #10 Split the first segment. The length of the first segment is never '0' in this situation. */
+  if ((segLen > winSize) && (segLen != 1u))
   {
-    uint32 acknowledgedPayloadBytes = 0;
-
-    /* #20 Enter critical section to protect retry queue access. */
-    TCPIP_VENTER_CRITICAL_SECTION();
+    TcpIp_SizeOfTcpRetryQElementType newTcpRetryQElementIdx;
+    uint16 sizePartOne;
 
-    /* #30 Check first segment in retry queue or abort operation if queue is empty. */
-    if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 0u)
+    /* #20 Determine the size of the new first segment */
+    if (winSize == 0u)
     {
-      TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) TxRetrQueueElePtr = TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx));
+      /* split 1 byte from the first segment */
+      sizePartOne = 1;
+    }
+    else  /* (seglen > windowsize) */
+    {
+      /* The segment length of the first queue element is bigger than the current window size. */
+      /* split a window-sized segment from the first queue element */
+      sizePartOne = winSize;
+    }
 
-      /* #40 Calculate sequence number of the following segment. */
-      uint32 nextSegSeqNo = TxRetrQueueElePtr->SeqNo + TxRetrQueueElePtr->SizeTotByte;
+    TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
 
-      if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_SYN) != 0u)
+    /* #30 check if a free retry queue element for the split segment is available, otherwise release the last retry
+           queue element of this socket and re-use it for the split segment. */
+    if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
+    {
+      /* use one free element */
+      newTcpRetryQElementIdx = TcpIp_Tcp_FirstFreeRetrQueueEle;
+      TcpIp_Tcp_NumFreeRetryQEle--;
+      if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
       {
-        /* SYN flag counts as one byte. */
-        nextSegSeqNo++;
+        /* there has been more than one element in the free-list */
+        TcpIp_Tcp_FirstFreeRetrQueueEle = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->EleNext;
+      /*@ assert TcpIp_Tcp_FirstFreeRetrQueueEle < TcpIp_GetSizeOfTcpRetryQElement(); */                                /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+        TcpIp_GetAddrTcpRetryQElement(TcpIp_Tcp_FirstFreeRetrQueueEle)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
       }
-
-      if ((TxRetrQueueElePtr->Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
+      else
       {
-        /* FIN flag counts as one byte. */
-        nextSegSeqNo++;
+        TcpIp_Tcp_FirstFreeRetrQueueEle = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        TcpIp_Tcp_LastFreeRetrQueueEle  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
       }
-
-      /* #50 Check if segment is completely acknowledged. */
-      if (TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(SegAckNo, nextSegSeqNo))
+    }
+    else
+    {
+      /* one element of the retry queue has to be freed if possible */
+      /* handling similar to PathMtu */
+      if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 1u)
       {
-        /* #60 Remove acknowledged length from TX request element for this socket and store acknowledged payload length for call to TxConfirmation. */
-        acknowledgedPayloadBytes = TxRetrQueueElePtr->SizeTotByte;
-
-        if (acknowledgedPayloadBytes > 0u)
-        {
-          /* Remove acknowledged length from TX request element for this socket. */
-          TCPIP_ASSERT(TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) >= acknowledgedPayloadBytes);
-          TcpIp_SetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx,
-            (TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) - (TcpIp_SizeOfTcpTxBufferType)acknowledgedPayloadBytes));  /* cast OK: acknowledged len is never bigger than the buffer */
-          TCPIP_ASSERT(TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx) >= acknowledgedPayloadBytes);
-          TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx,
-            (TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx) - (TcpIp_SizeOfTcpTxBufferType)acknowledgedPayloadBytes));  /* cast OK: acknowledged len is never bigger than the buffer */
-          {
-            TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-            /*@ assert tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc(); */                                        /* VCA_TCPIP_VALID_BUFFERIDX_LOCAL */
-            TcpIp_SizeOfTcpTxBufferType currentIndex = TcpIp_GetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx);
-
-            currentIndex = TcpIp_IncTxBufIdx(tcpTxBufferDescIdx, currentIndex,
-              (TcpIp_SizeOfTcpTxBufferType)acknowledgedPayloadBytes);
-
-            TcpIp_SetTxReqDataBufStartIdxOfSocketTcpDyn(SocketTcpIdx, currentIndex);
-          }
-        }
+        /* there is more than one element in the connections retry queue -> drop the last element, and than split the first element in two parts */
+        /* drop last retry queue element */
+        TcpIp_Tcp_VDropEndEleInRetrQueue(SocketTcpIdx, 1u);
+        /* use the one free element */
+        newTcpRetryQElementIdx = TcpIp_Tcp_FirstFreeRetrQueueEle;
+        TcpIp_Tcp_NumFreeRetryQEle = 0;   /* size was '1', so size - 1 = 0 */
+        TcpIp_Tcp_FirstFreeRetrQueueEle = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        TcpIp_Tcp_LastFreeRetrQueueEle  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
 
-        TcpIp_Tcp_VFreeFirstRetrQueueEle(SocketTcpIdx);
+        /* splitting the segment / queue element is done in the next step */
       }
       else
       {
-        /* #70 ELSE: Stop searching for further segments. If this segment is not ACKed others with higher sequence numbers will not be ACKed as well. */
-        checkIfFirstSegInQueueIsAcked = FALSE;
+        /* there is only one single element in the connections retry queue, and there is no spare one available
+        -> reduce the size of the (first and only) queue element */
+        newTcpRetryQElementIdx = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
       }
     }
-    else
-    {
-      /* Tx Retry Queue is empty. All segments are acknowledged. Stop searching for further segments. */
-      checkIfFirstSegInQueueIsAcked = FALSE;
-    }
 
-    /* #80 Leave critical section because upper layer is called next. */
-    TCPIP_VLEAVE_CRITICAL_SECTION();
+    /* #40 Split the first element (content) into two parts */
+    TcpIp_Tcp_VSplitFirstRetrQueueEle_Split(SocketTcpIdx, newTcpRetryQElementIdx, sizePartOne);
 
-    /* #90 Call TxConfirmation of upper layer if segment contained acknowledged payload bytes. */
-    if (acknowledgedPayloadBytes > 0u)
-    {
-      TcpIp_VSockTxConfirmation(socketIdx, acknowledgedPayloadBytes);
-    }
+    TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
+  }
+  else
+  {
+    /* a) segment is smaller (or equal) than the window size, this should be handled by the normal retransmission mechanism
+     * b) segment already has size '1', so no splitting possible. Segment will be sent in normal tx handling
+     * -> do nothing
+     */
   }
-
-/* (end) remove segments from tx (retransmission) queue */
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VQueueRemReqData
+ *  TcpIp_Tcp_VSplitFirstRetrQueueEle_Split
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11244,74 +12886,109 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFreeAckedReqAndRetrElements(
  *
  *
  */
-/* PRQA S 6050, 6080 1 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VQueueRemReqData(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSplitFirstRetrQueueEle_Split(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  TcpIp_SizeOfTcpRetryQElementType NewTcpRetryQElementIdx,
+  uint16 SizePartOne)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-  /* #10 Check if there are free elements in the retry queue. */
-  if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
+  if (NewTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement())
   {
-    /* Add (part of) request to TxReqArray */ /* size of data not yet queued in the TxRetrQueue */
-     TcpIp_SizeOfTcpTxBufferType remaniningSize = TcpIp_GetTxReqDataLenByteOfSocketTcpDyn(SocketTcpIdx) - TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx);
+    /* #10 Append the new element to the first element */
+    TcpIp_SizeOfTcpRetryQElementType firstTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+    /*@ assert firstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                         /* VCA_TCPIP_FILLED_RETRY_QUEUE_FIRST_ELEMENT */
+
+    TcpIp_Tcp_TxRetrQueueType *newRetryQElementPtr   = TcpIp_GetAddrTcpRetryQElement(NewTcpRetryQElementIdx);
+    TcpIp_Tcp_TxRetrQueueType *firstRetryQElementPtr = TcpIp_GetAddrTcpRetryQElement(firstTcpRetryQElementIdx);
+    TcpIp_SizeOfTcpRetryQElementType secondTcpRetryQElementIdx = firstRetryQElementPtr->EleNext;
+
+    /* Consider buffer wraparound when incrementing firstRetryQElementPtr->DataBufStartIdx by SizePartOne. */
+    uint32 newDataBufStartIdx = 0u;
+
+    /* The return value can be ignored here since the indices must be correct. */
+    (void)TcpIp_GetIncrementedRingBufferIndex(
+      firstRetryQElementPtr->DataBufStartIdx,
+      SizePartOne,
+      TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx),
+      TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx),
+      &newDataBufStartIdx);
+    newRetryQElementPtr->DataBufStartIdx = (TcpIp_SizeOfTcpTxBufferType)newDataBufStartIdx;
+
+    newRetryQElementPtr->SeqNo              = firstRetryQElementPtr->SeqNo           + SizePartOne;
+    newRetryQElementPtr->SizeTotByte        = firstRetryQElementPtr->SizeTotByte     - SizePartOne;
+    firstRetryQElementPtr->SizeTotByte      = SizePartOne;
+    newRetryQElementPtr->EleNext            = secondTcpRetryQElementIdx;
+    newRetryQElementPtr->ElePrev            = firstTcpRetryQElementIdx;
+
+    if (secondTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement())
+    {
+      TcpIp_GetAddrTcpRetryQElement(secondTcpRetryQElementIdx)->ElePrev = NewTcpRetryQElementIdx;
+    }
+    else
+    {
+      TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx, NewTcpRetryQElementIdx);
+    }
+
+    firstRetryQElementPtr->EleNext          = NewTcpRetryQElementIdx;
+    if ((firstRetryQElementPtr->Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
+    {
+      newRetryQElementPtr->Flags            = TCPIP_TCP_CODE_BIT_ACK | TCPIP_TCP_CODE_BIT_PSH | TCPIP_TCP_CODE_BIT_FIN;
+      firstRetryQElementPtr->Flags          = (uint8)(firstRetryQElementPtr->Flags - (uint8)TCPIP_TCP_CODE_BIT_FIN);
+    }
+    else
+    {
+      newRetryQElementPtr->Flags            = TCPIP_TCP_CODE_BIT_ACK | TCPIP_TCP_CODE_BIT_PSH;
+    }
+    newRetryQElementPtr->SocketTcpIdx       = firstRetryQElementPtr->SocketTcpIdx;
+    newRetryQElementPtr->TimeStamp          = firstRetryQElementPtr->TimeStamp;
+    newRetryQElementPtr->UserTimeoutTs      = firstRetryQElementPtr->UserTimeoutTs;
+    newRetryQElementPtr->TransmitCounter    = 0;  /* reset the transmit counter for both parts */
+    firstRetryQElementPtr->TransmitCounter  = 0;  /* reset the transmit counter for both parts */
+    newRetryQElementPtr->OneTimeOptions     = 0;  /* one-time options will stay with the first segment */
+    newRetryQElementPtr->OneTimeOptionsLen  = 0;
+    newRetryQElementPtr->SackFlag           = 0;  /* reset the SACK-flag for both parts */
+    firstRetryQElementPtr->SackFlag         = 0;  /* reset the SACK-flag for both parts */
+
+    TcpIp_IncRetryQFillNumOfSocketTcpDyn(SocketTcpIdx);
+  }
+  else
+  {
+    /* #20 No new retry queue element available. So reduce the size of the first (and only) element of the socket's retry queue,
+    and un-queue the removed length from the socket's txRequest. */
+    TcpIp_SizeOfTcpRetryQElementType firstTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+    /*@ assert firstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                         /* VCA_TCPIP_FILLED_RETRY_QUEUE_FIRST_ELEMENT */
 
-    /* #20 Append new fully filled segments into the retry queue (if possible). */
+    TcpIp_Tcp_TxRetrQueueType  *elePtr  = TcpIp_GetAddrTcpRetryQElement(firstTcpRetryQElementIdx);
+    uint8 elementFlags                  = elePtr->Flags;
+    TcpIp_SizeOfTcpTxBufferType oldSize = elePtr->SizeTotByte;
+    TcpIp_SizeOfTcpTxBufferType newSize = SizePartOne;
 
-    /* inc TxLen, or fill retry queue elements */
-    while (   (TcpIp_Tcp_NumFreeRetryQEle > 0u)                                                                         /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-           && (remaniningSize >= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)))
+    /* Set the FIN flag for later transmission if the flag was set in the current queue element that is shortened. */
+    if((elementFlags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
     {
-      /* add max size segment, and send */
-      remaniningSize                -= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
-      TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));
-
-      (void)TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
+      /* trigger FIN */
+      TcpIp_DecTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
+      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN | TCPIP_TCP_CODE_BIT_ACK));
     }
+    TcpIp_Tcp_VUnqueueDataInTxReq(SocketTcpIdx, (oldSize - newSize));
 
-    /* #30 Plan partially filled segment that will only be appended to the retry queue if nagle allows it. */
-
-    if ((TcpIp_Tcp_NumFreeRetryQEle > 0u) && (remaniningSize > 0u))
+    elePtr->SizeTotByte        = newSize;
+    if ((elementFlags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
     {
-      if (TcpIp_GetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx) == 0u)
-      {
-        /* new RetrQueue element is needed */
-
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
-        /* set nagle algorithm timeout */
-        if (TcpIp_IsEnabledOfSocketTcpNagleDyn(SocketTcpIdx) == TRUE)
-        {
-          TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
-          TcpIp_SetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx, TcpIp_GetNagleTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX));
-        }
-        else
-# endif
-        {
-          /* send new element even though it is not full */
-          TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, remaniningSize);
-
-          if (TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx) == E_OK)
-          {
-            remaniningSize = 0;
-          }
-        }
-      }
-      else
-      {
-        /* do nothing, this data will be part of a message that will be sent later */
-      }
-      /* add remaining size segment */
-      TcpIp_SetTxLenByteTxOfSocketTcpDyn(SocketTcpIdx, remaniningSize);
-
-      TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, TRUE);
+      elePtr->Flags            = elementFlags - (uint8)TCPIP_TCP_CODE_BIT_FIN;
     }
+    elePtr->TransmitCounter    = 0;  /* reset the transmit counter for both parts */
+    elePtr->SackFlag           = 0;  /* reset the SACK-flag for both parts */
   }
-  TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VDropEndEleInRetrQueue
+ *  TcpIp_Tcp_VMainTxDataHandling
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11320,109 +12997,88 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VQueueRemReqData(
  *
  *
  *
+ *
  */
 /* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VDropEndEleInRetrQueue(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx,
-  uint8 NumDropEle)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainTxDataHandling(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  boolean continueTx = TRUE;
+
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check that elements shall be dropped */
-  if (NumDropEle == 0u)
-  {
-    /* No element shall be dropped, so just return. */
-  }
-  else
+  /* #10 Trigger sending function, eventually this called function will send data onto the bus */
+  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)                                    /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
   {
-    /* last element of the socket's retry queue before removing some elements of this queue */
-    TcpIp_SizeOfTcpRetryQElementType oldLastTcpRetryQElementIdx  = TcpIp_GetSizeOfTcpRetryQElement();
-    /* first element of the socket's retry queue that shall be removed */
-    TcpIp_SizeOfTcpRetryQElementType firstRemTcpRetryQElementIdx = TcpIp_GetSizeOfTcpRetryQElement();
-    TcpIp_SizeOfTcpRetryQElementType newTcpRetryQElementIdx  = TcpIp_GetSizeOfTcpRetryQElement();
-    TcpIp_SizeOfTcpTxBufferType      remLen                  = 0u;
-    uint8                            lastElementFlags        = 0u;
 
-    TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
+    /* #20 Trigger sending last ACK of the TCP handshake. */
+    if (TcpIp_IsSendLastHsAckOfSocketTcpDyn(SocketTcpIdx) == TRUE)
+    {
+      /* Send last ACK of the TCP handshake. */
+      if (TcpIp_Tcp_VTransmitSegment(SocketTcpIdx, TCPIP_TCP_CODE_BIT_ACK, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u, 0u) == E_OK)
+      {
+        TcpIp_SizeOfSocketDynType  socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
+        TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
+        /* Reset ACK flag that was already set in the TcpIp_Tcp_VRxIndicationStateSynSent_Fourth(). */
 
-    /* TcpIp_Tcp_VDropEndEleInRetrQueue is always invoked with NumDropEle <= TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) */
-    TCPIP_ASSERT(NumDropEle <= TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx));
+        /*@ assert socketIdx < TcpIp_GetSizeOfSocketDyn(); */                                                           /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
+        /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                        /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
 
-    oldLastTcpRetryQElementIdx  = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
-    firstRemTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx);
-    newTcpRetryQElementIdx  = TcpIp_GetAddrTcpRetryQElement(oldLastTcpRetryQElementIdx)->ElePrev;
-    remLen                  = TcpIp_GetAddrTcpRetryQElement(oldLastTcpRetryQElementIdx)->SizeTotByte;
-    lastElementFlags        = TcpIp_GetAddrTcpRetryQElement(oldLastTcpRetryQElementIdx)->Flags;
+        TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & ~TCPIP_TCP_CODE_BIT_ACK));
 
-    /* #20 Remove elements from the sockets retry queue */
-    {
-      uint8 numElementsRemoved = 1;
+        /* Reset flag that is used to detect the last ACK of the handshake. */
+        TcpIp_SetSendLastHsAckOfSocketTcpDyn(SocketTcpIdx, FALSE);
 
-      /* Iterate backwards through the socket's retry queue to find the first element that shall be removed. */
-      while (numElementsRemoved < NumDropEle)
+        TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
+# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
+        TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONNECTED,
+          TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx));
+# else
+        TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONNECTED, FALSE);
+# endif
+      }
+      else
       {
-        /* get index of next removed element */
-        firstRemTcpRetryQElementIdx = newTcpRetryQElementIdx;
-        remLen += TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->SizeTotByte;
-        /* Set the new last queue index. Index finally is 'invalid' index when all element are removed from the socket's queue. */
-        newTcpRetryQElementIdx  = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->ElePrev;
-        numElementsRemoved++;
+        /* Stop transmission because TcpIp_Tcp_VTransmitSegment() failed. Retry in next main function cycle. */
+        continueTx = FALSE;
       }
-      /*@ assert firstRemTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                    /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-      /*@ assert newTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                         /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
+    }
 
-      /* Set index of socket's last element, set next index of the new last element to 'invalid' and reduce retry queue fill num. */
-      TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx, newTcpRetryQElementIdx);
-      if (NumDropEle < TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx))
+    if (continueTx == TRUE)
+    {
+      /* #30 Trigger queuing data into TxRetrQueue if available */
+      if (TcpIp_IsTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx) == FALSE)
       {
-        TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->EleNext  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        /* Queue as much remaining data as possible */
+        TcpIp_Tcp_VQueueRemReqData(SocketTcpIdx);
+      }
 
-        TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) - NumDropEle));
+    /* #40 Trigger nagle algorithm handling or trigger creation of a new segment. */
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
+      if (TcpIp_IsEnabledOfSocketTcpNagleDyn(SocketTcpIdx) == TRUE)
+      {
+        TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnabled(SocketTcpIdx);
       }
       else
+# endif
       {
-        TcpIp_SetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx, 0);
+        /* prepare packet for sending */
+        /* The return value can be ignored since if finalizing the segment fails here it will be retried in the next call
+        of the MainFunction. */
+        (void) TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
       }
-    }
-
-
-    /* #30 Append removed elements to the global list of free elements, or use the removed elements as the new global free elements list if there have not been free elements before. */
-    if (TcpIp_Tcp_NumFreeRetryQEle == 0u)
-    {
-      /* FreeList has been empty */
-      TcpIp_Tcp_FirstFreeRetrQueueEle    = firstRemTcpRetryQElementIdx;
-
-      /* Set predecessor of the first queue element to 'invalid'. */
-      TcpIp_GetAddrTcpRetryQElement(firstRemTcpRetryQElementIdx)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-    }
-    else
-    {
-      /* Link the first element of the queue part that shall be appended with the old last element of the free list. */
-      /*@ assert TcpIp_Tcp_LastFreeRetrQueueEle < TcpIp_GetSizeOfTcpRetryQElement(); */                                 /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-      TcpIp_GetAddrTcpRetryQElement(TcpIp_Tcp_LastFreeRetrQueueEle)->EleNext = firstRemTcpRetryQElementIdx;
-      TcpIp_GetAddrTcpRetryQElement(firstRemTcpRetryQElementIdx       )->ElePrev = TcpIp_Tcp_LastFreeRetrQueueEle;
-    }
-
-    /* Set successor of the last queue element to 'invalid', and increase the number of free elements. */
-    TcpIp_Tcp_LastFreeRetrQueueEle     = oldLastTcpRetryQElementIdx;
-    TcpIp_Tcp_NumFreeRetryQEle        += NumDropEle;
 
-    /* #40 Call function to un-queue the removed len 'remLen' */
-    /* Set the FIN flag for later transmission if the flag was set in the last queue element that has been dropped. */
-    if((lastElementFlags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
-    {
-      /* trigger FIN */
-      TcpIp_DecTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
-      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN | TCPIP_TCP_CODE_BIT_ACK));
+      /* #50 Trigger sending the packet to the bus */
+      /* The return value can be ignored since if transmitting the segment fails here it will be retried in the next call
+      of the MainFunction. */
+      (void) TcpIp_Tcp_VTransmit(SocketTcpIdx);
     }
-    TcpIp_Tcp_VUnqueueDataInTxReq(SocketTcpIdx, remLen);
-
-    TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
   }
 }
 
-
+# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUnqueueDataInTxReq
+ *  TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnabled
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11431,41 +13087,50 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VDropEndEleInRetrQueue(
  *
  *
  *
+ *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUnqueueDataInTxReq(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx,
-  TcpIp_SizeOfTcpTxBufferType UnqueueLen)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnabled(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
-  /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfTcpTxBufferType lengthToBeUnqueued = 0u;
-
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Limit the amount of data that shall be un-queued to the currently queued length. */
-  if (UnqueueLen > TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx))
+  /* #10 Check if the nagle timeout is configured to be not 0. */
+  if (TcpIp_GetNagleTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX) > 0u)
   {
-    lengthToBeUnqueued = TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx);
+    TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
+    /* #20 Decrease the nagle timeout */
+    if (TcpIp_GetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx) > 0u)
+    {
+      TcpIp_DecTimeoutOfSocketTcpNagleDyn(SocketTcpIdx);
+    }
   }
-  else
+
+  /* #30 Finalize a not completely filled segment if all sent data is acknowledged or the timeout has expired. */
+  if (TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(TcpIp_GetSndUnaOfSocketTcpDyn(SocketTcpIdx), TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx)))
   {
-    lengthToBeUnqueued = UnqueueLen;
+    /* #40 Build a new TCP segment (even if not completely filled) only if all data has been ACKed so far. */
+    /* The return value can be ignored since if finalizing the segment fails here it will be retried in the next call
+    of the MainFunction. */
+    (void) TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
   }
-
-  /* #20 Check that the length to remove is not 0. */
-  if (lengthToBeUnqueued > 0u)
+  else
   {
-    /* #30 Move lengthToBeUnqueued from TxReqQueuedLen to TxTotNotQueuedLen. */
-    TcpIp_SetTxReqQueuedLenOfSocketTcpDyn(   SocketTcpIdx, (TcpIp_GetTxReqQueuedLenOfSocketTcpDyn(SocketTcpIdx)    - lengthToBeUnqueued));
-    TcpIp_SetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxTotNotQueuedLenOfSocketTcpDyn(SocketTcpIdx) + lengthToBeUnqueued));
-    TcpIp_SetTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx, FALSE);
-
-    /* #40 Set next send sequence number. */
-    TcpIp_SetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx) - lengthToBeUnqueued));
+     /* #50 Build a new TCP segment if the nagle timeout has expired. */
+    if (TcpIp_GetNagleTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX) > 0u)
+    {
+      if (TcpIp_GetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx) == 0u)
+      {
+        /* The return value can be ignored since if finalizing the segment fails here it will be retried in the next
+        call of the MainFunction. */
+        (void) TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
+      }
+    }
   }
 }
+# endif
 
-
+# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainStateHandling
+ *  TcpIp_Tcp_VUpdateRttVars
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11476,145 +13141,144 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUnqueueDataInTxReq(
  *
  *
  */
-/* PRQA S 6050 1 */ /* MD_TcpIp_STCAL_CslAccess */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateRttVars(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       ElementRtt)
 {
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Handle received RST */
-  TcpIp_Tcp_VMainStateHandling_Reset(SocketTcpIdx);
+  CANOE_WRITE_STRING("TcpIp_Tcp_VUpdateRttVars: -------------------------------------------------");
+  CANOE_WRITE_STRING_2("TcpIp_Tcp_VUpdateRttVars: TCP connection %d, new ElementRtt is %d)", SocketTcpIdx, ElementRtt);
+  CANOE_WRITE_STRING_4("TcpIp_Tcp_VUpdateRttVars old: TcpIp_Tcp_Rto is %d, TcpIp_Tcp_RtoValid is %d, TcpIp_Tcp_SRtt is %dms, TcpIp_Tcp_RttVar is %d)", TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx));
 
-  /* #20 Check if a state change is triggered. */
-  if (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_INVALID)
+# if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+  /* Pass the sample to the delay-based congestion control. */
+  TcpIp_Tcp_VCongCtrlExtRttSample(SocketTcpIdx, ElementRtt);
+# endif
+
+  /* #10 Calculate RTTVar and SRTT according to RFC 2988 */
+  /* use variable names according to the RFC */
+
+  /* #20 Check the state of the retransmission timing */
+  if (TcpIp_GetRtoStateOfSocketTcpTsOptDyn(SocketTcpIdx) == TCPIP_TCP_RTO_STATE_ACTIVE)
   {
-    TcpIp_SockStateOfSocketTcpDynType copyOfSockState = TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx);
+    /* normal operation */
+    /*
+      RTTVAR = (1 - beta) * RTTVAR + beta * |SRTT - R'|
+      SRTT   = (1 - alpha) * SRTT + alpha * R'
+      The above SHOULD be computed using alpha=1/8 and beta=1/4
 
-    /* #30 Proceed the state handling dependent on the requested state. */
-    switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
+      After the computation, a host MUST update
+      RTO = SRTT + max (G, K*RTTVAR)
+
+      Whenever RTO is computed, if it is less than 1 second then the RTO SHOULD be rounded up to 1 s.
+    */
+    uint32 diffSrttR = 0u;
+
+    /* #30 Calculate RTTVar, SRTT and RTO for normal operation */
+    if (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) > ElementRtt)
     {
-    case TCPIP_TCP_SOCK_STATE_SYNSENT:
-    case TCPIP_TCP_SOCK_STATE_SYNRCVD:
-    /* case TCPIP_TCP_SOCK_STATE_ESTABLISHED: STORYC-6890 This state is not reachable since Next Socket state is always INVALID for state Established */
-    case TCPIP_TCP_SOCK_STATE_LASTACK:
-    case TCPIP_TCP_SOCK_STATE_FINWAIT1:
-    case TCPIP_TCP_SOCK_STATE_CLOSING:
-      {
-        /* #40 Trigger sending if something to send is available */
-        if (TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx) == E_OK)
-        {
-          TCPIP_VENTER_CRITICAL_SECTION();  /* lock interrupts */
-          /* Check if SockState has changed. This would mean that this function has been interrupted and the state has
-          been changed in the interrupting context. */
-          if (copyOfSockState == TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
-          {
-            /* #50 Message transmission succeeded, so switch to the next socket state. */
-            /* The SockState is already set correctly, only reset the SockStateNext to indicate that no further action is needed. */
-            TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
-          }
-          else
-          {
-            /* This function was interrupted. Don't overwrite the SockState that was set in the interrupting context. */
-          }
-          TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
-        }
-        break;
-      }
-    case TCPIP_TCP_SOCK_STATE_TIMEWAIT:
+      diffSrttR = TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) - ElementRtt;
+    }
+    else
     {
-      TcpIp_Tcp_VMainStateHandling_Timewait(SocketTcpIdx);
-      break;
+      diffSrttR = ElementRtt - TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx);
     }
-    case TCPIP_TCP_SOCK_STATE_CLOSEWAIT:
+    TcpIp_SetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx, (((3u * TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx)) + diffSrttR)  / 4u));
+    TcpIp_SetSRttOfSocketTcpTsOptDyn(  SocketTcpIdx, (((7u * TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx))   + ElementRtt) / 8u));
     {
-      if (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) == 0u)
+
+      /* RTO = SRTT + max (G, K*RTTVAR)    where K = 4 */
+      uint32 x1 = 1u;  /* clock granularity */
+      uint32 x2 = TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx) * 4u;  /* K * RTTVAR    where K = 4 */
+      if (x1 > x2)
       {
-        /* The ACK that was triggered when receiving the FIN is sent, so StateNext can be reset */
-        TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
+        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x1));
+      }
+      else
+      {
+        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x2));
       }
-      break;
     }
-    default:
+  }
+  else
+  {
+    /* (TcpIp_GetRtoStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_RTO_STATE_FIRST_CALC_PROCEEDED) */
+    /* This is the very first calculation of the round-trip time dependent variables for this connection */
+    uint32 x1 = 1; /* clock granularity */
+    uint32 x2 = 0u;
+
+    /* #40 Calculate RTTVar, SRTT and RTO for operation start */
+    TcpIp_SetSRttOfSocketTcpTsOptDyn(SocketTcpIdx, ElementRtt);
+    TcpIp_SetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx, (ElementRtt / 2u));  /* R/2 */
+    {
+      /* RTO = SRTT + max (G, K*RTTVAR)    where K = 4 */
+      x2 = TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx) * 4u;  /* K * RTTVAR    where K = 4 */
+      if (x1 > x2)
       {
-        /* TCPIP_TCP_SOCK_STATE_INVALID,
-           TCPIP_TCP_SOCK_STATE_LISTEN,
-           TCPIP_TCP_SOCK_STATE_FINWAIT2,
-           TCPIP_TCP_SOCK_STATE_CLOSED:
-           -> do nothing */
+        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x1));
       }
-      break;
-    }  /* switch */
+      else
+      {
+        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x2));
+      }
+    }
+
+    TcpIp_SetRtoStateOfSocketTcpTsOptDyn(SocketTcpIdx, TCPIP_TCP_RTO_STATE_ACTIVE);  /* go to next state */
   }
-}
 
+  /* #50 Set the valid state for the retransmission timeout */
+  if (TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx) < TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx))
+  {
+    TcpIp_SetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));
+  }
+  else
+  {
+    TcpIp_SetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx));
+  }
+  CANOE_WRITE_STRING_4("TcpIp_Tcp_VUpdateRttVars new: TcpIp_Tcp_Rto is %d, TcpIp_Tcp_RtoValid is %d, TcpIp_Tcp_SRtt is %dms, TcpIp_Tcp_RttVar is %d)", TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx));
+
+}
+# endif /* (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) */
 
 
+# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainStateHandling_Reset
+ *  TcpIp_Tcp_VIncAckSumN
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling_Reset(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VIncAckSumN(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       IncSize)
 {
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Handle received RST */
-  if (TcpIp_IsRstReceivedOfSocketTcpDyn(SocketTcpIdx) == TRUE)
+  /* #10 Increase the AckSum */
+  TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx) + IncSize));
+
+  if (TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx) == 0u)
   {
-    /* #20 Proceed depended on the socket state */
-    switch (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx))
+    /* #20 If the AckSum timeout has expired, set a new value for the timeout dependent on the SRTT. */
+    if (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) == 0u)
     {
-    case TCPIP_TCP_SOCK_STATE_SYNRCVD:
-      {
-        /* #30 Close the socket */
-        /* This state can only be achieved by passively opened connection. Simultaneous Opening is not supported.
-           That's why SYNRCVD state can never be achieved in case of actively opened connection  */
-        /* connection was reset by peer */
-        /* delete/clear this TCB (user has to call Sock_Connect() again later): */
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
-        break;
-      }
-    case TCPIP_TCP_SOCK_STATE_ESTABLISHED:
-    case TCPIP_TCP_SOCK_STATE_FINWAIT1:
-    case TCPIP_TCP_SOCK_STATE_FINWAIT2:
-    case TCPIP_TCP_SOCK_STATE_CLOSEWAIT:
-      {
-        /* #40 Close the socket */
-        /* If the RST bit is set then, any outstanding RECEIVEs and SEND should receive 'reset'
-        responses. All segment queues should be flushed. Users should also receive an
-        unsolicited general 'connection reset' signal. Enter the CLOSED state, delete the TCB,
-        and return. */
-        /* cancel all send and receive calls
-        -> nothing to be done for AUTOSAR API */
-
-        /* remove all elements from tx-queue and rx-queue */
-        /* enter CLOSED state, delete/clear TCB */
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
-
-        TcpIp_SetLastSockError(TCPIP_SOCK_ERR_10054);  /* 'Connection reset by peer' */
-        break;
-      }
-    default:
-      {
-        /* TCPIP_TCP_SOCK_STATE_CLOSING, TCPIP_TCP_SOCK_STATE_LASTACK, TCPIP_TCP_SOCK_STATE_TIMEWAIT */
-        /* #50 Close the socket */
-        /* enter CLOSED state, delete/clear TCB */
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
-        break;
-      }
+      TcpIp_SetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx, 1);
+    }
+    else
+    {
+      TcpIp_SetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx));
     }
   }
+  CANOE_WRITE_STRING_3("TcpIp_Tcp_VIncAckSumN: SocketTcpIdx %d: current AckSumTimeout is %d, TcpIp_Tcp_SRtt is %d", SocketTcpIdx, TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx), TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx));
+  CANOE_WRITE_STRING_4("TcpIp_Tcp_VIncAckSumN: SocketTcpIdx %d: function called with IncSize %d, new AckSum is %d, current AckSumTimeout is %d", SocketTcpIdx, IncSize, TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx), TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx));
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainStateHandling_Timewait
+ *  TcpIp_Tcp_VIncCwnd
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11622,133 +13286,144 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling_Reset(
  *
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainStateHandling_Timewait(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VIncCwnd(
+  TcpIp_SocketTcpDynIterType SocketTcpIdx,
+  uint32                     IncSize)
 {
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 State handling dependent on the next socket state */
-  if (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_TIMEWAIT)
+  CANOE_WRITE_STRING_3("TcpIp_Tcp_VIncCwnd: SocketTcpIdx %d: function called with IncSize %d, current cwnd is %d", SocketTcpIdx, IncSize, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));
+  /* #10 Increase the congestion window */
+  /* cwnd += min(N, SMSS) */
+  if (IncSize > TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx))
   {
-    /* #20 Trigger sending of final ACK if next socket state is TIMEWAIT */
-    if (TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx) == E_OK)
-    {
-      TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_CLOSED);
-
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-      TcpIp_Tcp_VKeepAliveReset(SocketTcpIdx);
-# endif
-    }
+    TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) + TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)));
+  }
+  else
+  {
+    TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) + IncSize));
   }
 
-  if (TcpIp_GetSockStateNextOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_CLOSED)
+  /* #20 Limit upper bound of congestion window */
+  if(TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) > TCPIP_TCP_CONG_CTRL_CWND_MAX)
   {
-    /* #30 If the next socket state is CLOSED, decrease Timeout timer (MSL) or finally close the socket */
-    if (   (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) == 0u)                                                   /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-        && (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) == 0u))  /* wait for the last ACK to be sent / removed from tx queue */
-    {
-      /* #40 Decrease Timeout timer (MSL) */
-      if (TcpIp_GetMslTimeoutOfSocketTcpDyn(SocketTcpIdx) > 0u)
-      {
-        TcpIp_DecMslTimeoutOfSocketTcpDyn(SocketTcpIdx);
-      }
-      else /* (Tcp_MslTimeout == 0), timeout expired */
-      {
-        /* #50 Close the socket because the timeout has expired */
+    TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_CWND_MAX);
+  }
 
-        /* switch to state CLOSED, delete/clear TCB element */
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_CLOSED);
-      }
-    }
+  /* #30 Update the congestion control mode */
+  if (TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) <= TcpIp_GetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx))
+  {
+    TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
+  }
+  else
+  {
+    TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE);
   }
+  CANOE_WRITE_STRING_3("TcpIp_Tcp_VIncCwnd: SocketTcpIdx %d: TcpIp_Tcp_Cwnd is now %d, TcpIp_Tcp_CongestionControlMode is now %d", SocketTcpIdx, TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx), TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx));
 }
 
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainRxDataForwarding
+ *  TcpIp_Tcp_VSetSsthreshEqu4
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainRxDataForwarding(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint16 MaxLenToForward)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSetSsthreshEqu4(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfTcpRxBufferDescType tcpRxBufferDescIdx = TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
-  uint16 remainingLengthAtEndOfBuffer = 0u;
-  /* pointer to the start of the received data in the rx buffer */
-  TCPIP_P2V(uint8) locBufPtr          = NULL_PTR;
+  /* ssthresh = max[flightSize / 2, 2*SMSS] */
+  uint32 flightSize = 0u;  /* flightSize is the amount of outstanding data in the network */
+  /* sender maximum segment size */
+  uint32 smss = TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  TCPIP_ASSERT(tcpRxBufferDescIdx                                  <  TcpIp_GetSizeOfTcpRxBufferDesc());
-  TCPIP_ASSERT(MaxLenToForward                                     <= TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx));
-  TCPIP_ASSERT(TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx) <  TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx));
-
-  /* Caching of 'MaxLenToForward' is required because 'RxBufferRemIndLenOfSocketTcpDyn' may be updated before the second
-  critical section below. */
-  /* #10 Get the start position of the data that shall be forwarded. */
-
-  TCPIP_VENTER_CRITICAL_SECTION();  /* lock interrupts */
-
-  remainingLengthAtEndOfBuffer = (uint16)(TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx) - TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx));
-  locBufPtr = TcpIp_GetAddrTcpRxBuffer(
-    TcpIp_GetTcpRxBufferStartIdxOfTcpRxBufferDesc(tcpRxBufferDescIdx) +
-    TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx));
+  /* #10 Calculate the current flight size (size of all segments currently sent but not acked). */
+  flightSize = TcpIp_Tcp_VCalcFlightSize(SocketTcpIdx);
 
-  /* #20 Forward the data to the socket owner. */
-  if (remainingLengthAtEndOfBuffer >= MaxLenToForward)
+  /* #20 Update slow start threshold. */
+#  if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+  if (TcpIp_Tcp_VCongCtrlExtOnLoss(SocketTcpIdx, flightSize) == TRUE)
   {
-    /* Data is in a linear buffer. */
-    /* indicate bytes 0..((TCPIP_TCP_MAX_WINDOW_SIZE - Tcp_RxBufferWritePos[SocketTcpIdx]) - 1) */
-
-    TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
-
-    TcpIp_Tcp_UpRxIndication(SocketTcpIdx, locBufPtr, MaxLenToForward);
+    /* ssthresh set according to CUBIC. */
+  }
+  else
+#  endif
+  if ((flightSize / 2u) > (smss * 2u))
+  {
+    TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, (flightSize / 2u));
   }
   else
   {
-    /* data buffer includes wrap around */
-    /* indicate data with taking care of buffer wrap-around (two blocks) */
-
-    /* pointer to the start of the rx buffer in case the received data causes a buffer wrap around */
-    TCPIP_P2V(uint8) locBufSecondPtr = TcpIp_GetAddrTcpRxBuffer(TcpIp_GetTcpRxBufferStartIdxOfTcpRxBufferDesc(tcpRxBufferDescIdx));
+    TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, (smss * 2u));
+  }
+  CANOE_WRITE_STRING_2("TcpIp_Tcp_VSetSsthreshEqu4: SocketTcpIdx %d: TcpIp_Tcp_Ssthresh is now %d", SocketTcpIdx, TcpIp_GetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx));
+}
 
-    TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
 
-    /* indicate bytes 0..((TCPIP_TCP_MAX_WINDOW_SIZE - TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx)) - 1) */
-    TcpIp_Tcp_UpRxIndication(SocketTcpIdx, locBufPtr, remainingLengthAtEndOfBuffer);
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCalcFlightSize
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(uint32, TCPIP_CODE) TcpIp_Tcp_VCalcFlightSize(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  /* flightSize is the amount of outstanding data in the network */
+  uint32                           flightSize = 0u;
+  TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx     = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
 
-    /* indicate remaining bytes */
-    TcpIp_Tcp_UpRxIndication(SocketTcpIdx, locBufSecondPtr, MaxLenToForward - remainingLengthAtEndOfBuffer);
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Calculate the current fligth size (size of all segments currently sent but not acked). */
+  /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+  while (   (tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+         && (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TransmitCounter > 0u))
+  {
+    flightSize += TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SizeTotByte;
+    tcpRetryQElementIdx      = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext;
   }
 
-  TCPIP_VENTER_CRITICAL_SECTION();  /* lock interrupts */
+  return flightSize;
+}
 
-  /* #30 Increase the buffer start position, taking care of the wraparound. Check if socket was not reset in the meantime. */
-  if (TcpIp_GetTcpRxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx) < TcpIp_GetSizeOfTcpRxBufferDesc())
-  {
-    TcpIp_SetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx, (TcpIp_SizeOfTcpRxBufferType)TcpIp_AddWithWrapAround32(
-      TcpIp_GetRxBufferIndPosOfSocketTcpDyn(SocketTcpIdx), MaxLenToForward,
-      TcpIp_GetTcpRxBufferLengthOfTcpRxBufferDesc(tcpRxBufferDescIdx)));
+#  if (TCPIP_TCP_CONG_CTRL_EXT == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtGetIdx
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+TCPIP_LOCAL FUNC(uint8, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtGetIdx(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+{
+  /* ----- Local Variables ---------------------------------------------- */
+  uint8 ctxIdx;
 
-    TcpIp_SetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetRxBufferRemIndLenOfSocketTcpDyn(SocketTcpIdx) - MaxLenToForward));
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Search the context that is assigned to the socket. */
+  for (ctxIdx = 0u; ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM; ctxIdx++)
+  {
+    if (TcpIp_Tcp_CongCtrlExt[ctxIdx].SocketTcpIdx == SocketTcpIdx)
+    {
+      break;
+    }
   }
 
-  TCPIP_VLEAVE_CRITICAL_SECTION();  /* unlock interrupts */
+  return ctxIdx;
 }
 
-
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainIdleTimeoutHandling
+ *  TcpIp_Tcp_VCongCtrlExtAssign
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11756,153 +13431,150 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainRxDataForwarding(
  *
  *
  *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainIdleTimeoutHandling(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtAssign(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint8                        Algorithm,
+  boolean                      PacingEnabled)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType retVal = E_OK;
+  uint8          ctxIdx;
+
   /* ----- Implementation ----------------------------------------------- */
-# if (TCPIP_SUPPORT_TCP_KEEP_ALIVE == STD_ON)
-  /* #10 Check if TCP Keep-Alive is enabled for the socket. */
-  if (   (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_ESTABLISHED)                           /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-      && (TcpIp_IsEnabledOfSocketTcpKeepAliveDyn(SocketTcpIdx) == TRUE))
-  {
-    /* Keep-alive is enabled for this connection. */
-    uint32 keepAliveIdleTimeMax;
+  TCPIP_VENTER_CRITICAL_SECTION();
 
-    /* #20 Check if timeout for first keep-alive segment or consecutive keep-alive segment has to be applied. */
-    if (TcpIp_GetProbesOfSocketTcpKeepAliveDyn(SocketTcpIdx) == 0u)
-    {
-      /* No keep-alive probes sent so far. Wait for keep-alive timeout. */
-      keepAliveIdleTimeMax = TcpIp_GetTimeoutOfSocketTcpKeepAliveDyn(SocketTcpIdx);
-    }
-    else
-    {
-      /* Keep-Alive timeout already expired and at least one probe has been sent. Wait for next probe interval. */
-      keepAliveIdleTimeMax = TcpIp_GetProbeIntervalOfSocketTcpKeepAliveDyn(SocketTcpIdx);
-    }
+  ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
-    /* #30 Increment idle time counter for the socket if timeout has not expired yet. */
-    if (TcpIp_GetIdleTimeOfSocketTcpKeepAliveDyn(SocketTcpIdx) < keepAliveIdleTimeMax)
+  /* #10 Release the context of the socket if the default settings are requested. */
+  if ((Algorithm == TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO) && (PacingEnabled == FALSE))
+  {
+    if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
     {
-      /* Timeout has not expired yet. */
-      TcpIp_IncIdleTimeOfSocketTcpKeepAliveDyn(SocketTcpIdx);
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].SocketTcpIdx = TcpIp_GetSizeOfSocketTcpDyn();
     }
-    /* #40 ELSE: Send keep-alive segment and reset idle time or close connection if configured number of keep-alive segments have been sent. */
-    else
+  }
+  else
+  {
+    /* #20 Otherwise assign an unused context to the socket, if the socket has none yet. */
+    if (ctxIdx == TCPIP_TCP_CONG_CTRL_EXT_IDX_INV)
     {
-      if (TcpIp_GetProbesOfSocketTcpKeepAliveDyn(SocketTcpIdx) < TcpIp_GetProbesMaxOfSocketTcpKeepAliveDyn(SocketTcpIdx))
+      ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(TcpIp_GetSizeOfSocketTcpDyn());
+
+      if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
       {
-        if (TcpIp_Tcp_VTransmitKeepAliveProbe(SocketTcpIdx) == E_OK)
-        {
-          /* Reset idle time and wait for next timeout. */
-          TcpIp_SetIdleTimeOfSocketTcpKeepAliveDyn(SocketTcpIdx, 0);
-          TcpIp_IncProbesOfSocketTcpKeepAliveDyn(SocketTcpIdx);
-        }
+        TcpIp_Tcp_CongCtrlExt[ctxIdx].SocketTcpIdx = SocketTcpIdx;
+        TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm    = TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO;
+        TcpIp_Tcp_VCongCtrlExtReset(&TcpIp_Tcp_CongCtrlExt[ctxIdx]);
       }
       else
       {
-        /* Maximum number of keep-alive probes have been sent and were not answered. Close connection. */
-
-        TcpIp_SizeOfSocketDynType socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-        TcpIp_LocalAddrIterType txIpAddrIdx = TcpIp_GetTxIpAddrIdxOfSocketDyn(socketIdx);
-        /*@ assert txIpAddrIdx < TcpIp_GetSizeOfLocalAddr(); */                                                         /* VCA_TCPIP_TX_IPADDR_IDX_OF_OPEN_TCP_SOCKET */
-
-        /* timeout expired -> close / reset connection */
-        /* sending a reset is an extension, there is no need for that according to the RFC */
-        TcpIp_Tcp_VSendReset(SocketTcpIdx, txIpAddrIdx,
-          (TcpIp_GetAddrRemSockOfSocketDyn(socketIdx)), (TcpIp_GetAddrLocSockOfSocketDyn(socketIdx)),
-          TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u);  /* seqNo, ackNo */
-
-        /* flush all queues, signal the user 'error: connection aborted due to idle timeout' in
-        general and for any outstanding calls, delete the TCB, enter the CLOSED state and
-        return. */
-        /* delete/clear TCB element */
-        TcpIp_Tcp_VCloseSocketAndReleaseResources(SocketTcpIdx, TCPIP_TCP_STATE_RESET);
+        retVal = E_NOT_OK;
       }
     }
-  }
-# endif
 
-  /* -------------------------------------------------------------------------------------------- */
-  /* Handle Tcp_IdleTimeoutShort[] --------------------------------------------------------- */
-
-  /* #50 Check if idle timeout for congestion window reset and zero window probe has been reached. */
-  if (TcpIp_GetIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx) > 0u)
-  {
-    TcpIp_DecIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx);
-    if (TcpIp_GetIdleTimeoutShortOfSocketTcpDyn(SocketTcpIdx) == 0u)
+    /* #30 Apply the settings and reset the algorithm state if the algorithm changes. */
+    if (retVal == E_OK)
     {
-      /* timeout has expired */
-
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
-      {
-        /* reset the congestion window because the connection has been idle for too long */
-        /* cwnd = RW = min(IW,cwnd) */
-        uint32 iw = ((uint32) TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx) * TCPIP_TCP_DEFAULT_SEGMENT_LIMIT(TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)));
-
-        if (iw < TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx))
-        {
-          TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, iw);
-        }
-
-        TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
-      }
-# endif
-
-      /* Check if the socket has elements in its retry queue */
-      if (TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx) < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
+      if (TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm != Algorithm)
       {
-        /* handle Zero Window Probing or splitting of the first segment */
-        TcpIp_Tcp_VSplitFirstRetrQueueEle(SocketTcpIdx);
+        TcpIp_Tcp_VCongCtrlExtReset(&TcpIp_Tcp_CongCtrlExt[ctxIdx]);
       }
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm     = Algorithm;
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].PacingEnabled = PacingEnabled;
     }
   }
 
-  /* #60 Handle FINWAIT-2 timeout */
-  TcpIp_Tcp_VFinWait2TimeoutHandling(SocketTcpIdx);
+  TCPIP_VLEAVE_CRITICAL_SECTION();
+
+  return retVal;
 }
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VFinWait2TimeoutHandling
+ *  TcpIp_Tcp_VCongCtrlExtReset
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ */
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtReset(
+  TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) CtxPtr)
+{
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Reset the state of all algorithms. */
+  CtxPtr->WMax         = 0u;
+  CtxPtr->EpochStart   = 0u;
+  CtxPtr->K            = 0u;
+  CtxPtr->WEst         = 0u;
+  CtxPtr->BaseRtt      = TCPIP_TCP_CONG_CTRL_EXT_RTT_INV;
+  CtxPtr->RoundMinRtt  = TCPIP_TCP_CONG_CTRL_EXT_RTT_INV;
+  CtxPtr->RoundTimeout = 0u;
+  CtxPtr->PacingCredit = 0;
+  CtxPtr->EpochActive  = FALSE;
+  CtxPtr->AppLimited   = FALSE;
+}
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_VCongCtrlExtSetParameter
+ *********************************************************************************************************************/
+/*!
+ * Internal comment removed.
  *
  *
  *
  *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinWait2TimeoutHandling(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtSetParameter(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint8                        OptName,
+  TCPIP_P2C(uint8)             OptValPtr)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  Std_ReturnType retVal        = E_NOT_OK;
+  uint8          ctxIdx        = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
+  uint8          algorithm     = TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO;
+  boolean        pacingEnabled = FALSE;
+
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if socket is in FINWAIT-2 state and whether FINWAIT-2 timeout has expired */
-  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_SOCK_STATE_FINWAIT2)
+  /* #10 Start with the current settings of the socket. */
+  if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
   {
-    /* #20 Check if FINWAIT-2 timeout timer is running */
-    if (TcpIp_GetFinWait2TimeoutOfSocketTcpDyn(SocketTcpIdx) > 0u)
-    {
-      /* #30 Update the FINWAIT-2 timeout */
-      TcpIp_DecFinWait2TimeoutOfSocketTcpDyn(SocketTcpIdx);
+    algorithm     = TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm;
+    pacingEnabled = TcpIp_Tcp_CongCtrlExt[ctxIdx].PacingEnabled;
+  }
 
-      /* #40 Check If timeout has expired now */
-      if (TcpIp_GetFinWait2TimeoutOfSocketTcpDyn(SocketTcpIdx) == 0u)
-      {
-        /* #50 FINWAIT-2 timeout expired and no FIN was received from remote peer. Abort connection. */
-        TcpIp_Tcp_Abort(SocketTcpIdx);
-      }
+  /* #20 Check and apply the new value of the algorithm or the pacing mode. */
+  if (OptName == TCPIP_PARAMID_V_TCP_CONG_CTRL_ALGORITHM)
+  {
+    /* The delay-based algorithm relies on the RTT samples taken from the TCP timestamp option. */
+    if (   (*OptValPtr == TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO)
+        || (*OptValPtr == TCPIP_TCP_CONG_CTRL_ALGORITHM_CUBIC)
+#   if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
+        || (*OptValPtr == TCPIP_TCP_CONG_CTRL_ALGORITHM_DELAY)
+#   endif
+       )
+    {
+      algorithm = *OptValPtr;
+      retVal    = E_OK;
     }
   }
-} /* TcpIp_Tcp_VFinWait2TimeoutHandling() */
+  else
+  {
+    pacingEnabled = (boolean)(*OptValPtr != 0u);
+    retVal        = E_OK;
+  }
+
+  if (retVal == E_OK)
+  {
+    retVal = TcpIp_Tcp_VCongCtrlExtAssign(SocketTcpIdx, algorithm, pacingEnabled);
+  }
+
+  return retVal;
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSplitFirstRetrQueueEle
+ *  TcpIp_Tcp_VCongCtrlExtMain
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -11912,100 +13584,98 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VFinWait2TimeoutHandling(
  *
  *
  *
+ *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSplitFirstRetrQueueEle(
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtMain(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TCPIP_P2C(TcpIp_Tcp_TxRetrQueueType) firstQueueElePtr = TcpIp_GetAddrTcpRetryQElement(TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx));
-  uint32 segLen  = firstQueueElePtr->SizeTotByte;
-  uint16 winSize = TcpIp_GetSndWndOfSocketTcpDyn(SocketTcpIdx);
+  boolean retVal = FALSE;
+  uint8   ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Split the first segment. The length of the first segment is never '0' in this situation. */
-  if ((segLen > winSize) && (segLen != 1u))
+  if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
   {
-    TcpIp_SizeOfTcpRetryQElementType newTcpRetryQElementIdx;
-    uint16 sizePartOne;
+    TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) ctxPtr = &TcpIp_Tcp_CongCtrlExt[ctxIdx];
+    uint32 srtt = TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx);
+    uint8  mode = TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx);
 
-    /* #20 Determine the size of the new first segment */
-    if (winSize == 0u)
-    {
-      /* split 1 byte from the first segment */
-      sizePartOne = 1;
-    }
-    else  /* (seglen > windowsize) */
+    if (srtt == 0u)
     {
-      /* The segment length of the first queue element is bigger than the current window size. */
-      /* split a window-sized segment from the first queue element */
-      sizePartOne = winSize;
+      srtt = 1u;
     }
 
-    TCPIP_VENTER_MC_ALWAYS_CRITICAL_SECTION();  /* lock cross core interrupts */
-
-    /* #30 check if a free retry queue element for the split segment is available, otherwise release the last retry
-           queue element of this socket and re-use it for the split segment. */
-    if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
+    /* #10 Refill the pacing budget of this MainFunction cycle: cwnd per SRTT, scaled by the pacing gain, but at least
+     *     one segment so that a large SRTT does not stall the transmission. */
+    if (ctxPtr->PacingEnabled == TRUE)
     {
-      /* use one free element */
-      newTcpRetryQElementIdx = TcpIp_Tcp_FirstFreeRetrQueueEle;
-      TcpIp_Tcp_NumFreeRetryQEle--;
-      if (TcpIp_Tcp_NumFreeRetryQEle > 0u)
+      uint32 gain = (mode == TCPIP_TCP_CONG_CTRL_MODE_SLOW_START) ? TCPIP_TCP_PACING_GAIN_SS_PERCENT : TCPIP_TCP_PACING_GAIN_CA_PERCENT;
+      uint32 rate = (uint32)(((uint64)TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) * gain) / (100u * (uint64)srtt));
+
+      if (rate > TCPIP_TCP_CONG_CTRL_CWND_MAX)
       {
-        /* there has been more than one element in the free-list */
-        TcpIp_Tcp_FirstFreeRetrQueueEle = TcpIp_GetAddrTcpRetryQElement(newTcpRetryQElementIdx)->EleNext;
-      /*@ assert TcpIp_Tcp_FirstFreeRetrQueueEle < TcpIp_GetSizeOfTcpRetryQElement(); */                                /* VCA_TCPIP_PWA_POINTER_DERIVED_FROM_VALID_RETRYQELE_IDX */
-        TcpIp_GetAddrTcpRetryQElement(TcpIp_Tcp_FirstFreeRetrQueueEle)->ElePrev = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        rate = TCPIP_TCP_CONG_CTRL_CWND_MAX;
       }
-      else
+      if (rate < TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx))
       {
-        TcpIp_Tcp_FirstFreeRetrQueueEle = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-        TcpIp_Tcp_LastFreeRetrQueueEle  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        rate = TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
+      }
+      /* Unused budget is not accumulated beyond one cycle to avoid bursts. */
+      ctxPtr->PacingCredit += (sint32)rate;
+      if (ctxPtr->PacingCredit > (sint32)rate)
+      {
+        ctxPtr->PacingCredit = (sint32)rate;
       }
     }
-    else
+
+    /* #20 CUBIC: cwnd grows on the ACK path (see TcpIp_Tcp_VCongCtrlExtOnAck()). The epoch is frozen while the socket
+     *     is application limited, so W_cubic does not run ahead of the window that was actually used
+     *     (RFC 8312 section 5.8). */
+    if (ctxPtr->Algorithm == TCPIP_TCP_CONG_CTRL_ALGORITHM_CUBIC)
     {
-      /* one element of the retry queue has to be freed if possible */
-      /* handling similar to PathMtu */
-      if (TcpIp_GetRetryQFillNumOfSocketTcpDyn(SocketTcpIdx) > 1u)
-      {
-        /* there is more than one element in the connections retry queue -> drop the last element, and than split the first element in two parts */
-        /* drop last retry queue element */
-        TcpIp_Tcp_VDropEndEleInRetrQueue(SocketTcpIdx, 1u);
-        /* use the one free element */
-        newTcpRetryQElementIdx = TcpIp_Tcp_FirstFreeRetrQueueEle;
-        TcpIp_Tcp_NumFreeRetryQEle = 0;   /* size was '1', so size - 1 = 0 */
-        TcpIp_Tcp_FirstFreeRetrQueueEle = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
-        TcpIp_Tcp_LastFreeRetrQueueEle  = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+      retVal = TRUE;
 
-        /* splitting the segment / queue element is done in the next step */
-      }
-      else
+      if (   (mode == TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE)
+          && (ctxPtr->EpochActive == TRUE)
+          && (ctxPtr->AppLimited == TRUE))
       {
-        /* there is only one single element in the connections retry queue, and there is no spare one available
-        -> reduce the size of the (first and only) queue element */
-        newTcpRetryQElementIdx = TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV;
+        ctxPtr->EpochStart++;
       }
     }
+    /* #30 Delay-based: update cwnd once per round trip time as soon as RTT samples are available. Without samples (no
+     *     timestamp option negotiated) the socket falls back to Reno. */
+    else if (   (ctxPtr->Algorithm == TCPIP_TCP_CONG_CTRL_ALGORITHM_DELAY)
+             && (ctxPtr->BaseRtt != TCPIP_TCP_CONG_CTRL_EXT_RTT_INV))
+    {
+      retVal = TRUE;
 
-    /* #40 Split the first element (content) into two parts */
-    TcpIp_Tcp_VSplitFirstRetrQueueEle_Split(SocketTcpIdx, newTcpRetryQElementIdx, sizePartOne);
+      if (   (mode == TCPIP_TCP_CONG_CTRL_MODE_SLOW_START)
+          || (mode == TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE))
+      {
+        if (ctxPtr->RoundTimeout > 0u)
+        {
+          ctxPtr->RoundTimeout--;
+        }
 
-    TCPIP_VLEAVE_MC_ALWAYS_CRITICAL_SECTION();
-  }
-  else
-  {
-    /* a) segment is smaller (or equal) than the window size, this should be handled by the normal retransmission mechanism
-     * b) segment already has size '1', so no splitting possible. Segment will be sent in normal tx handling
-     * -> do nothing
-     */
+        if (ctxPtr->RoundTimeout == 0u)
+        {
+          ctxPtr->RoundTimeout = srtt;
+          TcpIp_Tcp_VCongCtrlExtDelayUpdate(SocketTcpIdx, ctxPtr);
+          ctxPtr->RoundMinRtt = TCPIP_TCP_CONG_CTRL_EXT_RTT_INV;
+        }
+      }
+    }
+    else
+    {
+      /* Reno with pacing, or delay-based without RTT samples. */
+    }
   }
-}
 
+  return retVal;
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSplitFirstRetrQueueEle_Split
+ *  TcpIp_Tcp_VCongCtrlExtOnAck
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -12014,199 +13684,82 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSplitFirstRetrQueueEle(
  *
  *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSplitFirstRetrQueueEle_Split(
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtOnAck(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  TcpIp_SizeOfTcpRetryQElementType NewTcpRetryQElementIdx,
-  uint16 SizePartOne)
+  uint32                       AckedBytes)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  TcpIp_SizeOfTcpTxBufferDescType tcpTxBufferDescIdx = TcpIp_GetTcpTxBufferDescIdxOfSocketTcpDyn(SocketTcpIdx);
+  boolean retVal = FALSE;
+  uint8   ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  if (NewTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement())
+  if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
   {
-    /* #10 Append the new element to the first element */
-    TcpIp_SizeOfTcpRetryQElementType firstTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-    /*@ assert firstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                         /* VCA_TCPIP_FILLED_RETRY_QUEUE_FIRST_ELEMENT */
-
-    TcpIp_Tcp_TxRetrQueueType *newRetryQElementPtr   = TcpIp_GetAddrTcpRetryQElement(NewTcpRetryQElementIdx);
-    TcpIp_Tcp_TxRetrQueueType *firstRetryQElementPtr = TcpIp_GetAddrTcpRetryQElement(firstTcpRetryQElementIdx);
-    TcpIp_SizeOfTcpRetryQElementType secondTcpRetryQElementIdx = firstRetryQElementPtr->EleNext;
-
-    /* Consider buffer wraparound when incrementing firstRetryQElementPtr->DataBufStartIdx by SizePartOne. */
-    uint32 newDataBufStartIdx = 0u;
+    TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) ctxPtr = &TcpIp_Tcp_CongCtrlExt[ctxIdx];
 
-    /* The return value can be ignored here since the indices must be correct. */
-    (void)TcpIp_GetIncrementedRingBufferIndex(
-      firstRetryQElementPtr->DataBufStartIdx,
-      SizePartOne,
-      TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx),
-      TcpIp_GetTcpTxBufferEndIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx),
-      &newDataBufStartIdx);
-    newRetryQElementPtr->DataBufStartIdx = (TcpIp_SizeOfTcpTxBufferType)newDataBufStartIdx;
+    /* #10 CUBIC: Do not grow cwnd while the socket is application limited. */
+    if (ctxPtr->Algorithm == TCPIP_TCP_CONG_CTRL_ALGORITHM_CUBIC)
+    {
+      retVal = TRUE;
 
-    newRetryQElementPtr->SeqNo              = firstRetryQElementPtr->SeqNo           + SizePartOne;
-    newRetryQElementPtr->SizeTotByte        = firstRetryQElementPtr->SizeTotByte     - SizePartOne;
-    firstRetryQElementPtr->SizeTotByte      = SizePartOne;
-    newRetryQElementPtr->EleNext            = secondTcpRetryQElementIdx;
-    newRetryQElementPtr->ElePrev            = firstTcpRetryQElementIdx;
+      if (ctxPtr->AppLimited == TRUE)
+      {
+        TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
+      }
+      /* #20 Otherwise sum up the acknowledged bytes and update cwnd as soon as one segment has been acknowledged. */
+      else
+      {
+        TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx) + AckedBytes));
 
-    if (secondTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement())
-    {
-      TcpIp_GetAddrTcpRetryQElement(secondTcpRetryQElementIdx)->ElePrev = NewTcpRetryQElementIdx;
-    }
-    else
-    {
-      TcpIp_SetTcpRetryQElementLastIdxOfSocketTcpDyn(SocketTcpIdx, NewTcpRetryQElementIdx);
+        if (TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx) >= TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx))
+        {
+          TcpIp_Tcp_VCongCtrlExtCubicUpdate(SocketTcpIdx, ctxPtr);
+        }
+      }
     }
-
-    firstRetryQElementPtr->EleNext          = NewTcpRetryQElementIdx;
-    if ((firstRetryQElementPtr->Flags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
+    /* #30 Delay-based: cwnd is updated once per round trip time in TcpIp_Tcp_VCongCtrlExtMain(). */
+    else if (   (ctxPtr->Algorithm == TCPIP_TCP_CONG_CTRL_ALGORITHM_DELAY)
+             && (ctxPtr->BaseRtt != TCPIP_TCP_CONG_CTRL_EXT_RTT_INV))
     {
-      newRetryQElementPtr->Flags            = TCPIP_TCP_CODE_BIT_ACK | TCPIP_TCP_CODE_BIT_PSH | TCPIP_TCP_CODE_BIT_FIN;
-      firstRetryQElementPtr->Flags          = (uint8)(firstRetryQElementPtr->Flags - (uint8)TCPIP_TCP_CODE_BIT_FIN);
+      retVal = TRUE;
     }
     else
     {
-      newRetryQElementPtr->Flags            = TCPIP_TCP_CODE_BIT_ACK | TCPIP_TCP_CODE_BIT_PSH;
+      /* Reno with pacing, or delay-based without RTT samples. */
     }
-    newRetryQElementPtr->SocketTcpIdx       = firstRetryQElementPtr->SocketTcpIdx;
-    newRetryQElementPtr->TimeStamp          = firstRetryQElementPtr->TimeStamp;
-    newRetryQElementPtr->UserTimeoutTs      = firstRetryQElementPtr->UserTimeoutTs;
-    newRetryQElementPtr->TransmitCounter    = 0;  /* reset the transmit counter for both parts */
-    firstRetryQElementPtr->TransmitCounter  = 0;  /* reset the transmit counter for both parts */
-    newRetryQElementPtr->OneTimeOptions     = 0;  /* one-time options will stay with the first segment */
-    newRetryQElementPtr->OneTimeOptionsLen  = 0;
-    newRetryQElementPtr->SackFlag           = 0;  /* reset the SACK-flag for both parts */
-    firstRetryQElementPtr->SackFlag         = 0;  /* reset the SACK-flag for both parts */
-
-    TcpIp_IncRetryQFillNumOfSocketTcpDyn(SocketTcpIdx);
   }
-  else
-  {
-    /* #20 No new retry queue element available. So reduce the size of the first (and only) element of the socket's retry queue,
-    and un-queue the removed length from the socket's txRequest. */
-    TcpIp_SizeOfTcpRetryQElementType firstTcpRetryQElementIdx = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
-    /*@ assert firstTcpRetryQElementIdx < TcpIp_GetSizeOfTcpRetryQElement(); */                                         /* VCA_TCPIP_FILLED_RETRY_QUEUE_FIRST_ELEMENT */
 
-    TcpIp_Tcp_TxRetrQueueType  *elePtr  = TcpIp_GetAddrTcpRetryQElement(firstTcpRetryQElementIdx);
-    uint8 elementFlags                  = elePtr->Flags;
-    TcpIp_SizeOfTcpTxBufferType oldSize = elePtr->SizeTotByte;
-    TcpIp_SizeOfTcpTxBufferType newSize = SizePartOne;
-
-    /* Set the FIN flag for later transmission if the flag was set in the current queue element that is shortened. */
-    if((elementFlags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
-    {
-      /* trigger FIN */
-      TcpIp_DecTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx);
-      TcpIp_Tcp_VSendFlags(SocketTcpIdx, (TCPIP_TCP_CODE_BIT_FIN | TCPIP_TCP_CODE_BIT_ACK));
-    }
-    TcpIp_Tcp_VUnqueueDataInTxReq(SocketTcpIdx, (oldSize - newSize));
-
-    elePtr->SizeTotByte        = newSize;
-    if ((elementFlags & TCPIP_TCP_CODE_BIT_FIN) != 0u)
-    {
-      elePtr->Flags            = elementFlags - (uint8)TCPIP_TCP_CODE_BIT_FIN;
-    }
-    elePtr->TransmitCounter    = 0;  /* reset the transmit counter for both parts */
-    elePtr->SackFlag           = 0;  /* reset the SACK-flag for both parts */
-  }
+  return retVal;
 }
 
-
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainTxDataHandling
+ *  TcpIp_Tcp_VCongCtrlExtUpdateAppLimited
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainTxDataHandling(
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtUpdateAppLimited(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  boolean continueTx = TRUE;
+  uint8 ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Trigger sending function, eventually this called function will send data onto the bus */
-  if (TcpIp_GetSockStateOfSocketTcpDyn(SocketTcpIdx) != TCPIP_TCP_SOCK_STATE_LISTEN)                                    /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
+  /* #10 The socket is application limited if another full segment would still fit into cwnd. */
+  if (   (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
+      && (TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm != TCPIP_TCP_CONG_CTRL_ALGORITHM_RENO))
   {
+    uint32 flightSize = TcpIp_Tcp_VCalcFlightSize(SocketTcpIdx);
 
-    /* #20 Trigger sending last ACK of the TCP handshake. */
-    if (TcpIp_IsSendLastHsAckOfSocketTcpDyn(SocketTcpIdx) == TRUE)
-    {
-      /* Send last ACK of the TCP handshake. */
-      if (TcpIp_Tcp_VTransmitSegment(SocketTcpIdx, TCPIP_TCP_CODE_BIT_ACK, TcpIp_GetSndNxtOfSocketTcpDyn(SocketTcpIdx), 0u, 0u, 0u) == E_OK)
-      {
-        TcpIp_SizeOfSocketDynType  socketIdx = TCPIP_TCP_IDX_TO_SOCKET_IDX(SocketTcpIdx);
-        TcpIp_SizeOfSocketOwnerConfigType socketOwnerConfigIdx = TcpIp_GetSocketOwnerConfigIdxOfSocketDyn(socketIdx);
-        /* Reset ACK flag that was already set in the TcpIp_Tcp_VRxIndicationStateSynSent_Fourth(). */
-
-        /*@ assert socketIdx < TcpIp_GetSizeOfSocketDyn(); */                                                           /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
-        /*@ assert socketOwnerConfigIdx < TcpIp_GetSizeOfSocketOwnerConfig(); */                                        /* VCA_TCPIP_SOCKETOWNERCONFIG_IDX */
-
-        TcpIp_SetTxFlagsOfSocketTcpDyn(SocketTcpIdx, (TcpIp_GetTxFlagsOfSocketTcpDyn(SocketTcpIdx) & ~TCPIP_TCP_CODE_BIT_ACK));
-
-        /* Reset flag that is used to detect the last ACK of the handshake. */
-        TcpIp_SetSendLastHsAckOfSocketTcpDyn(SocketTcpIdx, FALSE);
-
-        TcpIp_SetSockStateNextOfSocketTcpDyn(SocketTcpIdx, TCPIP_TCP_SOCK_STATE_INVALID);
-# if (TCPIP_SUPPORT_ASRTLS == STD_ON)                                                                                   /* COV_MSR_UNSUPPORTED */
-        TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONNECTED,
-          TcpIp_IsUseTlsOfSocketTcpDyn(SocketTcpIdx));
-# else
-        TcpIp_VSockTcpStateChg(socketIdx, socketOwnerConfigIdx, TCPIP_TCP_STATE_CONNECTED, FALSE);
-# endif
-      }
-      else
-      {
-        /* Stop transmission because TcpIp_Tcp_VTransmitSegment() failed. Retry in next main function cycle. */
-        continueTx = FALSE;
-      }
-    }
-
-    if (continueTx == TRUE)
-    {
-      /* #30 Trigger queuing data into TxRetrQueue if available */
-      if (TcpIp_IsTxReqFullyQueuedOfSocketTcpDyn(SocketTcpIdx) == FALSE)
-      {
-        /* Queue as much remaining data as possible */
-        TcpIp_Tcp_VQueueRemReqData(SocketTcpIdx);
-      }
-
-    /* #40 Trigger nagle algorithm handling or trigger creation of a new segment. */
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
-      if (TcpIp_IsEnabledOfSocketTcpNagleDyn(SocketTcpIdx) == TRUE)
-      {
-        TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnabled(SocketTcpIdx);
-      }
-      else
-# endif
-      {
-        /* prepare packet for sending */
-        /* The return value can be ignored since if finalizing the segment fails here it will be retried in the next call
-        of the MainFunction. */
-        (void) TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
-      }
-
-      /* #50 Trigger sending the packet to the bus */
-      /* The return value can be ignored since if transmitting the segment fails here it will be retried in the next call
-      of the MainFunction. */
-      (void) TcpIp_Tcp_VTransmit(SocketTcpIdx);
-    }
+    TcpIp_Tcp_CongCtrlExt[ctxIdx].AppLimited =
+      (boolean)((flightSize + TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)) <= TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx));
   }
 }
 
-# if (TCPIP_SUPPORT_TCP_NAGLE_TIMEOUT == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnabled
+ *  TcpIp_Tcp_VCongCtrlExtCubicUpdate
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -12215,50 +13768,104 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainTxDataHandling(
  *
  *
  *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnabled(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtCubicUpdate(
+  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) CtxPtr)
 {
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 smss     = TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
+  uint32 cwnd     = TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx);
+  uint32 ackedSum = TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx);
+  uint32 target   = 0u;
+  uint32 tMs;
+  uint32 distMs;
+  uint64 delta;
+
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Check if the nagle timeout is configured to be not 0. */
-  if (TcpIp_GetNagleTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX) > 0u)
+  /* #10 Start a new epoch at the first ACK in congestion avoidance after a window reduction.
+   *     K is the time [ms] the window needs to grow back to WMax: K = cbrt((WMax - cwnd) / (C * SMSS)). */
+  if (CtxPtr->EpochActive == FALSE)
   {
-    TCPIP_ASSERT(TcpIp_HasSocketTcpNagleDyn() == TRUE);
-    /* #20 Decrease the nagle timeout */
-    if (TcpIp_GetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx) > 0u)
+    CtxPtr->EpochActive = TRUE;
+    CtxPtr->EpochStart  = TcpIp_Tcp_GlobalTimestamp;
+    CtxPtr->WEst        = cwnd;
+
+    if (CtxPtr->WMax > cwnd)
     {
-      TcpIp_DecTimeoutOfSocketTcpNagleDyn(SocketTcpIdx);
+      CtxPtr->K = TcpIp_Tcp_VCubeRoot((((uint64)CtxPtr->WMax - cwnd) * TCPIP_TCP_CUBIC_INV_C_MS3) / smss);
+    }
+    else
+    {
+      CtxPtr->WMax = cwnd;
+      CtxPtr->K    = 0u;
     }
   }
 
-  /* #30 Finalize a not completely filled segment if all sent data is acknowledged or the timeout has expired. */
-  if (TCPIP_TCP_SEQ1_BIGGER_OR_EQUAL_SEQ2(TcpIp_GetSndUnaOfSocketTcpDyn(SocketTcpIdx), TcpIp_GetTxNextSendSeqNoOfSocketTcpDyn(SocketTcpIdx)))
+  /* #20 Calculate the target window one RTT ahead: W(t) = C * (t - K)^3 + WMax (RFC 8312 section 4.1). */
+  tMs = ((TcpIp_Tcp_GlobalTimestamp - CtxPtr->EpochStart) + TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx)) * TCPIP_MAIN_FCT_PERIOD_MSEC;
+  distMs = (tMs >= CtxPtr->K) ? (tMs - CtxPtr->K) : (CtxPtr->K - tMs);
+  if (distMs > TCPIP_TCP_CUBIC_DIST_MAX_MS)
   {
-    /* #40 Build a new TCP segment (even if not completely filled) only if all data has been ACKed so far. */
-    /* The return value can be ignored since if finalizing the segment fails here it will be retried in the next call
-    of the MainFunction. */
-    (void) TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
+    distMs = TCPIP_TCP_CUBIC_DIST_MAX_MS;
+  }
+  /* C * d^3 with C = 0.4 segments/s^3 and d in ms: d^3 * 4 / 10^10 */
+  delta = (((((uint64)distMs * distMs * distMs) / 1000u) * 4u) * smss) / 10000000u;
+
+  if (tMs >= CtxPtr->K)
+  {
+    target = (delta > ((uint64)TCPIP_TCP_CONG_CTRL_CWND_MAX - CtxPtr->WMax)) ? TCPIP_TCP_CONG_CTRL_CWND_MAX : (CtxPtr->WMax + (uint32)delta);
+  }
+  else if (delta < CtxPtr->WMax)
+  {
+    target = CtxPtr->WMax - (uint32)delta;
   }
   else
   {
-     /* #50 Build a new TCP segment if the nagle timeout has expired. */
-    if (TcpIp_GetNagleTimeoutOfTcpConfig(TCPIP_TCPCONFIG_IDX) > 0u)
+    /* target stays 0, the TCP-friendly window applies. */
+  }
+
+  /* The target is limited to 1.5 * cwnd (RFC 8312 section 4.3). */
+  if (target > (cwnd + (cwnd / 2u)))
+  {
+    target = cwnd + (cwnd / 2u);
+  }
+
+  /* #30 Advance the window of standard TCP by alpha segments per cwnd acknowledged (RFC 8312 section 4.2). */
+  CtxPtr->WEst += (uint32)(((uint64)smss * TCPIP_TCP_CUBIC_FRIENDLY_INC_1024 * ackedSum) / (1024u * (uint64)cwnd));
+  if (CtxPtr->WEst > TCPIP_TCP_CONG_CTRL_CWND_MAX)
+  {
+    CtxPtr->WEst = TCPIP_TCP_CONG_CTRL_CWND_MAX;
+  }
+
+  /* #40 Do not grow slower than standard TCP would (TCP-friendly region). Otherwise increase cwnd by
+   *     (target - cwnd) / cwnd per acknowledged byte (RFC 8312 sections 4.3 and 4.4). */
+  if (CtxPtr->WEst > target)
+  {
+    if (CtxPtr->WEst > cwnd)
     {
-      if (TcpIp_GetTimeoutOfSocketTcpNagleDyn(SocketTcpIdx) == 0u)
-      {
-        /* The return value can be ignored since if finalizing the segment fails here it will be retried in the next
-        call of the MainFunction. */
-        (void) TcpIp_Tcp_VFinalizeTxSegment(SocketTcpIdx);
-      }
+      cwnd = CtxPtr->WEst;
     }
   }
+  else if (target > cwnd)
+  {
+    uint64 inc = ((uint64)(target - cwnd) * ackedSum) / cwnd;
+
+    cwnd = (inc < (uint64)(target - cwnd)) ? (cwnd + (uint32)inc) : target;
+  }
+  else
+  {
+    /* cwnd is kept. */
+  }
+  TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, cwnd);
+
+  /* #50 The acknowledged bytes are consumed. */
+  TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, 0);
+  CANOE_WRITE_STRING_3("TcpIp_Tcp_VCongCtrlExtCubicUpdate: SocketTcpIdx %d: target is %d, TcpIp_Tcp_Cwnd is now %d", SocketTcpIdx, target, cwnd);
 }
-# endif
 
-# if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VUpdateRttVars
+ *  TcpIp_Tcp_VCongCtrlExtDelayUpdate
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -12266,108 +13873,60 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VMainTxDataHandling_TxIfNagleEnable
  *
  *
  *
- *
- *
  */
-/* PRQA S 6050 1 */ /* MD_MSR_STCAL */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateRttVars(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint32                       ElementRtt)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtDelayUpdate(
+  TcpIp_SizeOfSocketTcpDynType         SocketTcpIdx,
+  TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) CtxPtr)
 {
-  /* ----- Implementation ----------------------------------------------- */
-  CANOE_WRITE_STRING("TcpIp_Tcp_VUpdateRttVars: -------------------------------------------------");
-  CANOE_WRITE_STRING_2("TcpIp_Tcp_VUpdateRttVars: TCP connection %d, new ElementRtt is %d)", SocketTcpIdx, ElementRtt);
-  CANOE_WRITE_STRING_4("TcpIp_Tcp_VUpdateRttVars old: TcpIp_Tcp_Rto is %d, TcpIp_Tcp_RtoValid is %d, TcpIp_Tcp_SRtt is %dms, TcpIp_Tcp_RttVar is %d)", TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx));
-
-  /* #10 Calculate RTTVar and SRTT according to RFC 2988 */
-  /* use variable names according to the RFC */
+  /* ----- Local Variables ---------------------------------------------- */
+  uint32 smss = TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
+  uint32 cwnd = TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx);
 
-  /* #20 Check the state of the retransmission timing */
-  if (TcpIp_GetRtoStateOfSocketTcpTsOptDyn(SocketTcpIdx) == TCPIP_TCP_RTO_STATE_ACTIVE)
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Skip rounds without RTT sample. */
+  if (CtxPtr->RoundMinRtt != TCPIP_TCP_CONG_CTRL_EXT_RTT_INV)
   {
-    /* normal operation */
-    /*
-      RTTVAR = (1 - beta) * RTTVAR + beta * |SRTT - R'|
-      SRTT   = (1 - alpha) * SRTT + alpha * R'
-      The above SHOULD be computed using alpha=1/8 and beta=1/4
-
-      After the computation, a host MUST update
-      RTO = SRTT + max (G, K*RTTVAR)
-
-      Whenever RTO is computed, if it is less than 1 second then the RTO SHOULD be rounded up to 1 s.
-    */
-    uint32 diffSrttR = 0u;
+    /* RTT samples have a granularity of one MainFunction cycle and may be 0. */
+    uint32 rtt  = CtxPtr->RoundMinRtt + 1u;
+    uint32 base = CtxPtr->BaseRtt + 1u;
+    /* diff = (expected rate - actual rate) * base RTT = amount of own data queued in the network */
+    uint32 diff = (uint32)(((uint64)cwnd * (rtt - base)) / rtt);
 
-    /* #30 Calculate RTTVar, SRTT and RTO for normal operation */
-    if (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) > ElementRtt)
-    {
-      diffSrttR = TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) - ElementRtt;
-    }
-    else
-    {
-      diffSrttR = ElementRtt - TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx);
-    }
-    TcpIp_SetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx, (((3u * TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx)) + diffSrttR)  / 4u));
-    TcpIp_SetSRttOfSocketTcpTsOptDyn(  SocketTcpIdx, (((7u * TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx))   + ElementRtt) / 8u));
+    /* #20 In slow start switch to congestion avoidance as soon as data starts to queue up. */
+    if (TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx) == TCPIP_TCP_CONG_CTRL_MODE_SLOW_START)
     {
-
-      /* RTO = SRTT + max (G, K*RTTVAR)    where K = 4 */
-      uint32 x1 = 1u;  /* clock granularity */
-      uint32 x2 = TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx) * 4u;  /* K * RTTVAR    where K = 4 */
-      if (x1 > x2)
+      if (diff > (TCPIP_TCP_DELAY_GAMMA_SEG * smss))
       {
-        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x1));
-      }
-      else
-      {
-        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x2));
+        TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, cwnd);
+        TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE);
       }
     }
-  }
-  else
-  {
-    /* (TcpIp_GetRtoStateOfSocketTcpDyn(SocketTcpIdx) == TCPIP_TCP_RTO_STATE_FIRST_CALC_PROCEEDED) */
-    /* This is the very first calculation of the round-trip time dependent variables for this connection */
-    uint32 x1 = 1; /* clock granularity */
-    uint32 x2 = 0u;
-
-    /* #40 Calculate RTTVar, SRTT and RTO for operation start */
-    TcpIp_SetSRttOfSocketTcpTsOptDyn(SocketTcpIdx, ElementRtt);
-    TcpIp_SetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx, (ElementRtt / 2u));  /* R/2 */
+    /* #30 In congestion avoidance keep the queued data between alpha and beta segments. */
+    else if (diff < (TCPIP_TCP_DELAY_ALPHA_SEG * smss))
     {
-      /* RTO = SRTT + max (G, K*RTTVAR)    where K = 4 */
-      x2 = TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx) * 4u;  /* K * RTTVAR    where K = 4 */
-      if (x1 > x2)
+      if (   ((cwnd + smss) <= TCPIP_TCP_CONG_CTRL_CWND_MAX)
+          && (CtxPtr->AppLimited == FALSE))
       {
-        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x1));
+        TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, (cwnd + smss));
       }
-      else
+    }
+    else if (diff > (TCPIP_TCP_DELAY_BETA_SEG * smss))
+    {
+      if (cwnd >= (3u * smss))
       {
-        TcpIp_SetRtoOfSocketTcpTsOptDyn(SocketTcpIdx, (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) + x2));
+        TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, (cwnd - smss));
       }
     }
-
-    TcpIp_SetRtoStateOfSocketTcpTsOptDyn(SocketTcpIdx, TCPIP_TCP_RTO_STATE_ACTIVE);  /* go to next state */
-  }
-
-  /* #50 Set the valid state for the retransmission timeout */
-  if (TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx) < TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx))
-  {
-    TcpIp_SetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRetransmitTimeoutDefaultOfSocketTcpDyn(SocketTcpIdx));
-  }
-  else
-  {
-    TcpIp_SetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx, TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx));
+    else
+    {
+      /* cwnd is kept. */
+    }
+    CANOE_WRITE_STRING_3("TcpIp_Tcp_VCongCtrlExtDelayUpdate: SocketTcpIdx %d: diff is %d, TcpIp_Tcp_Cwnd is now %d", SocketTcpIdx, diff, TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx));
   }
-  CANOE_WRITE_STRING_4("TcpIp_Tcp_VUpdateRttVars new: TcpIp_Tcp_Rto is %d, TcpIp_Tcp_RtoValid is %d, TcpIp_Tcp_SRtt is %dms, TcpIp_Tcp_RttVar is %d)", TcpIp_GetRtoOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRtoValidOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx), TcpIp_GetRttVarOfSocketTcpTsOptDyn(SocketTcpIdx));
-
 }
-# endif /* (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON) */
 
-
-# if (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VIncAckSumN
+ *  TcpIp_Tcp_VCongCtrlExtOnLoss
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -12375,140 +13934,145 @@ TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VUpdateRttVars(
  *
  *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VIncAckSumN(
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtOnLoss(
   TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
-  uint32                       IncSize)
+  uint32                       FlightSize)
 {
-  /* ----- Implementation ----------------------------------------------- */
-  /* #10 Increase the AckSum */
-  TcpIp_SetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx) + IncSize));
+  /* ----- Local Variables ---------------------------------------------- */
+  boolean retVal = FALSE;
+  uint8   ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
-  if (TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx) == 0u)
+  /* ----- Implementation ----------------------------------------------- */
+  if (   (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
+      && (TcpIp_Tcp_CongCtrlExt[ctxIdx].Algorithm == TCPIP_TCP_CONG_CTRL_ALGORITHM_CUBIC))
   {
-    /* #20 If the AckSum timeout has expired, set a new value for the timeout dependent on the SRTT. */
-    if (TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx) == 0u)
+    TCPIP_P2V(TcpIp_Tcp_CongCtrlExtType) ctxPtr = &TcpIp_Tcp_CongCtrlExt[ctxIdx];
+    uint32 smss     = TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
+    uint32 ssthresh = (uint32)(((uint64)FlightSize * TCPIP_TCP_CUBIC_BETA_1024) / 1024u);
+
+    /* #10 Remember the window at the loss. If the window did not grow back to the previous maximum, another flow
+     *     competes for the bandwidth and the maximum is reduced further (fast convergence, RFC 8312 section 4.6). */
+    if (FlightSize < ctxPtr->WMax)
     {
-      TcpIp_SetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx, 1);
+      ctxPtr->WMax = (uint32)(((uint64)FlightSize * (1024u + TCPIP_TCP_CUBIC_BETA_1024)) / 2048u);
     }
     else
     {
-      TcpIp_SetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx, TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx));
+      ctxPtr->WMax = FlightSize;
+    }
+    ctxPtr->EpochActive = FALSE;
+
+    /* #20 Reduce ssthresh by the factor beta (RFC 8312 section 4.5). */
+    if (ssthresh < (smss * 2u))
+    {
+      ssthresh = smss * 2u;
     }
+    TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, ssthresh);
+    retVal = TRUE;
   }
-  CANOE_WRITE_STRING_3("TcpIp_Tcp_VIncAckSumN: SocketTcpIdx %d: current AckSumTimeout is %d, TcpIp_Tcp_SRtt is %d", SocketTcpIdx, TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx), TcpIp_GetSRttOfSocketTcpTsOptDyn(SocketTcpIdx));
-  CANOE_WRITE_STRING_4("TcpIp_Tcp_VIncAckSumN: SocketTcpIdx %d: function called with IncSize %d, new AckSum is %d, current AckSumTimeout is %d", SocketTcpIdx, IncSize, TcpIp_GetAckSumNOfSocketTcpCongCtrlDyn(SocketTcpIdx), TcpIp_GetAckSumTimeoutOfSocketTcpCongCtrlDyn(SocketTcpIdx));
-}
 
+  return retVal;
+}
 
+#   if (TCPIP_SUPPORT_TCP_TIMESTAMP_OPTION == STD_ON)
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VIncCwnd
+ *  TcpIp_Tcp_VCongCtrlExtRttSample
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VIncCwnd(
-  TcpIp_SocketTcpDynIterType SocketTcpIdx,
-  uint32                     IncSize)
+TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VCongCtrlExtRttSample(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       ElementRtt)
 {
-  /* ----- Implementation ----------------------------------------------- */
-  CANOE_WRITE_STRING_3("TcpIp_Tcp_VIncCwnd: SocketTcpIdx %d: function called with IncSize %d, current cwnd is %d", SocketTcpIdx, IncSize, TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx));
-  /* #10 Increase the congestion window */
-  /* cwnd += min(N, SMSS) */
-  if (IncSize > TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx))
-  {
-    TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) + TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx)));
-  }
-  else
-  {
-    TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, (TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) + IncSize));
-  }
-
-  /* #20 Limit upper bound of congestion window */
-  if(TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) > TCPIP_TCP_CONG_CTRL_CWND_MAX)
-  {
-    TcpIp_SetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_CWND_MAX);
-  }
+  /* ----- Local Variables ---------------------------------------------- */
+  uint8 ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
-  /* #30 Update the congestion control mode */
-  if (TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx) <= TcpIp_GetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx))
-  {
-    TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_SLOW_START);
-  }
-  else
+  /* ----- Implementation ----------------------------------------------- */
+  /* #10 Track the minimum RTT of the connection and of the current round. */
+  if (ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM)
   {
-    TcpIp_SetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx, TCPIP_TCP_CONG_CTRL_MODE_CONGESTION_AVOIDANCE);
+    if (ElementRtt < TcpIp_Tcp_CongCtrlExt[ctxIdx].BaseRtt)
+    {
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].BaseRtt = ElementRtt;
+    }
+    if (ElementRtt < TcpIp_Tcp_CongCtrlExt[ctxIdx].RoundMinRtt)
+    {
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].RoundMinRtt = ElementRtt;
+    }
   }
-  CANOE_WRITE_STRING_3("TcpIp_Tcp_VIncCwnd: SocketTcpIdx %d: TcpIp_Tcp_Cwnd is now %d, TcpIp_Tcp_CongestionControlMode is now %d", SocketTcpIdx, TcpIp_GetCwndOfSocketTcpCongCtrlDyn(SocketTcpIdx), TcpIp_GetCongestionControlModeOfSocketTcpCongCtrlDyn(SocketTcpIdx));
 }
-
+#   endif
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VSetSsthreshEqu4
+ *  TcpIp_Tcp_VPacingConsume
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
  */
-TCPIP_LOCAL FUNC(void, TCPIP_CODE) TcpIp_Tcp_VSetSsthreshEqu4(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(boolean, TCPIP_CODE) TcpIp_Tcp_VPacingConsume(
+  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx,
+  uint32                       SegLen)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  /* ssthresh = max[flightSize / 2, 2*SMSS] */
-  uint32 flightSize = 0u;  /* flightSize is the amount of outstanding data in the network */
-  /* sender maximum segment size */
-  uint32 smss = TcpIp_GetTxMaxSegLenByteOfSocketTcpDyn(SocketTcpIdx);
+  boolean retVal = TRUE;
+  uint8   ctxIdx = TcpIp_Tcp_VCongCtrlExtGetIdx(SocketTcpIdx);
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Calculate the current flight size (size of all segments currently sent but not acked). */
-  flightSize = TcpIp_Tcp_VCalcFlightSize(SocketTcpIdx);
-
-  /* #20 Update slow start threshold. */
-  if ((flightSize / 2u) > (smss * 2u))
-  {
-    TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, (flightSize / 2u));
-  }
-  else
+  /* #10 Consume the pacing budget of the socket, if pacing is enabled. */
+  if ((ctxIdx < TCPIP_TCP_CONG_CTRL_EXT_SOCK_NUM) && (TcpIp_Tcp_CongCtrlExt[ctxIdx].PacingEnabled == TRUE))
   {
-    TcpIp_SetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx, (smss * 2u));
+    if (TcpIp_Tcp_CongCtrlExt[ctxIdx].PacingCredit > 0)
+    {
+      TcpIp_Tcp_CongCtrlExt[ctxIdx].PacingCredit -= (sint32)SegLen;
+    }
+    else
+    {
+      retVal = FALSE;
+    }
   }
-  CANOE_WRITE_STRING_2("TcpIp_Tcp_VSetSsthreshEqu4: SocketTcpIdx %d: TcpIp_Tcp_Ssthresh is now %d", SocketTcpIdx, TcpIp_GetSsthreshOfSocketTcpCongCtrlDyn(SocketTcpIdx));
-}
 
+  return retVal;
+}
 
 /**********************************************************************************************************************
- *  TcpIp_Tcp_VCalcFlightSize
+ *  TcpIp_Tcp_VCubeRoot
  *********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  */
-TCPIP_LOCAL FUNC(uint32, TCPIP_CODE) TcpIp_Tcp_VCalcFlightSize(
-  TcpIp_SizeOfSocketTcpDynType SocketTcpIdx)
+TCPIP_LOCAL FUNC(uint32, TCPIP_CODE) TcpIp_Tcp_VCubeRoot(
+  uint64 Value)
 {
   /* ----- Local Variables ---------------------------------------------- */
-  /* flightSize is the amount of outstanding data in the network */
-  uint32                           flightSize = 0u;
-  TcpIp_SizeOfTcpRetryQElementType tcpRetryQElementIdx     = TcpIp_GetTcpRetryQElementFirstIdxOfSocketTcpDyn(SocketTcpIdx);
+  uint64 remainder = Value;
+  uint64 root      = 0u;
+  sint8  shift;
 
   /* ----- Implementation ----------------------------------------------- */
-  /* #10 Calculate the current fligth size (size of all segments currently sent but not acked). */
-  /* PRQA S 3415 2 */ /* MD_TCPIP_Rule13.5_3415_CslReadOnly */
-  while (   (tcpRetryQElementIdx < TCPIP_TCP_RETRY_QUEUE_ELE_IDX_INV)
-         && (TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->TransmitCounter > 0u))
+  /* #10 Calculate the root bit by bit, starting with the most significant group of three bits. */
+  for (shift = 63; shift >= 0; shift -= 3)
   {
-    flightSize += TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->SizeTotByte;
-    tcpRetryQElementIdx      = TcpIp_GetAddrTcpRetryQElement(tcpRetryQElementIdx)->EleNext;
+    uint64 b;
+
+    root <<= 1;
+    b = (3u * root * (root + 1u)) + 1u;
+    if ((remainder >> (uint8)shift) >= b)
+    {
+      remainder -= (b << (uint8)shift);
+      root++;
+    }
   }
 
-  return flightSize;
+  return (uint32)root;
 }
+#  endif /* (TCPIP_TCP_CONG_CTRL_EXT == STD_ON) */
 # endif /* (TCPIP_SUPPORT_TCP_CONGESTION_CONTROL == STD_ON) */
 
 
@@ -12818,6 +14382,9 @@ FUNC(void, TCPIP_CODE) TcpIp_Tcp_VClearTxBuffer(
   /* #20 Clear the buffer if a buffer is assigned */
   if (tcpTxBufferDescIdx < TcpIp_GetSizeOfTcpTxBufferDesc())
   {
+# if (TCPIP_TCP_ZERO_COPY_TX == STD_ON)
+    TcpIp_Tcp_VTxDataRefRelease((TcpIp_SizeOfSocketTcpDynType)SocketTcpIdx, TRUE);
+# endif
     TcpIp_SetFillLevelOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, 0);
     TcpIp_SetTcpTxBufferWriteIdxOfTcpTxBufferDescDyn(tcpTxBufferDescIdx, TcpIp_GetTcpTxBufferStartIdxOfTcpTxBufferDesc(tcpTxBufferDescIdx));
   }
@@ -13431,6 +14998,12 @@ All TcpIp-internal callers guarantee the validity of index parameters
     increased in TcpIp_Tcp_VRxIndicationStateOthers_Seventh_InsertNewOooElement() and
     _Seventh_CreateFirstOooElement() and decremented in _Seventh_ReceiveBufferedData() and
     _Seventh_CheckCombination().
+    The list is ordered by sequence number and terminated by the invalid index TcpIp_GetSizeOfTcpOooQElement(),
+    so the last element of the list never links into the list of free elements.
+    If SACK is enabled, the elements are additionally linked from the most recently changed element
+    (TcpOooQElementLastChangedIdxOfSocketTcpOooDyn) to the oldest one via OlderEleIdx. This linkage is updated
+    incrementally whenever an element is created, extended or removed, and it is used as start point for the search
+    of the matching element, because consecutive segments following a lost segment extend the same element.
     When the pre-buffered segments are handled according to this concept, the segments can be
     accessed via pointers derived from stored start indices and lengths.
 
@@ -43,6 +43,7 @@
 # if (TCPIP_SUPPORT_TCP == STD_ON)
 #  include "TcpIp_Priv_Types.h"
 #  include "TcpIp_Lcfg.h"
+#  include "IpBase_Types.h"
 
 /**********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
@@ -206,6 +207,29 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitInternal(
   uint32                    Length,
   boolean                   ForceRetrieve);
 
+/**********************************************************************************************************************
+ *  TcpIp_TcpTransmitPBufInternal()
+ *********************************************************************************************************************/
+/*! \brief         Requests the transmission of referenced data to a remote node using TCP.
+ *  \details       This function is called by TcpIp_TcpTransmitPBuf (parameter checks are done there).
+ *                 The data is not copied but referenced until it is acknowledged by the peer.
+ *  \param[in]     SocketIdx           Index of a TCP socket.
+ *                                     \spec requires SocketIdx < TcpIp_GetSizeOfSocketDyn(); \endspec
+ *  \param[in]     PbufPtr             Pointer to a chain of buffer segments containing PbufPtr[0].totLen bytes.
+ *                                     CONSTRAINT: 0 < PbufPtr[0].totLen <= 0xFFFF
+ *  \return        E_OK                The request has been accepted
+ *  \return        E_NOT_OK            The request has not been accepted, e.g. because the chain contains an empty
+ *                                     segment or a segment with a different total length.
+ *  \pre           SocketIdx references a TCP socket in state ESTABLISHED that does not use TLS.
+ *  \context       TASK
+ *  \reentrant     TRUE for different socket indexs.
+ *  \synchronous   TRUE
+ *  \config        TCPIP_TCP_ZERO_COPY_TX
+ *********************************************************************************************************************/
+FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_TcpTransmitPBufInternal(
+  TcpIp_SizeOfSocketDynType  SocketIdx,
+  TCPIP_P2C(IpBase_PbufType) PbufPtr);
+
 /**********************************************************************************************************************
  *  TcpIp_Tcp_GetSockIsConnected()
  *********************************************************************************************************************/
@@ -402,6 +426,32 @@ FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tcp_GetAvailableTxBufferSize(
   TcpIp_SocketDynIterType SocketIdx,
   TCPIP_P2V(uint32)   AvailableTxBufferSizePtr);
 
+#  if (TCPIP_TCP_RX_BURST == STD_ON)
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_RxBurstBegin
+ *********************************************************************************************************************/
+/*! \brief          Starts an rx burst.
+ *  \details        Sockets that receive data in order during the burst are noted for forwarding at its end.
+ *  \pre            -
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_RxBurstBegin(void);
+
+/**********************************************************************************************************************
+ *  TcpIp_Tcp_RxBurstEnd
+ *********************************************************************************************************************/
+/*! \brief          Ends an rx burst and forwards the received data of the noted sockets to their socket owners.
+ *  \details        -
+ *  \pre            Must not interrupt TcpIp_Tcp_MainFunctionRx() or be interrupted by it.
+ *  \context        TASK
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *********************************************************************************************************************/
+FUNC(void, TCPIP_CODE) TcpIp_Tcp_RxBurstEnd(void);
+#  endif
+
 #  define TCPIP_STOP_SEC_CODE
 #  include "TcpIp_MemMap.h"                                                                                             /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
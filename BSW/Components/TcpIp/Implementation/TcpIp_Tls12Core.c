@@ -1102,8 +1102,13 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE) TcpIp_Tls12CoreRl_TxCipherEncryptAe
     /* #20 Start Aes128 Cbc streaming of content data and copy into TCP buffer */
     if (TcpIp_Tls12CoreRl_TxCipherEncryptAes128CbcContentData(TlsConIdx, TcpSeg1, TcpSeg2) == E_OK)
     {
-      /* #30 Encrypt the Mac and padding, copy into TCP buffer, and stop Aes128 Cbc streaming */
-      if (TcpIp_Tls12CoreRl_EncryptAes128CbcMacAndPadding(TlsConIdx, &copiedLen) == E_OK)
+      /* #30 Encrypt the Mac and padding, copy into TCP buffer, and stop Aes128 Cbc streaming.
+       *     Behind the TCP buffer wraparound the Mac and padding are encrypted directly into the TCP buffer. */
+      if (TcpSeg1->AvailLen == 0u)
+      {
+        retVal = TcpIp_Tls12CoreRl_EncryptAes128CbcMacAndPaddingInt(TlsConIdx, TcpSeg2);
+      }
+      else if (TcpIp_Tls12CoreRl_EncryptAes128CbcMacAndPadding(TlsConIdx, &copiedLen) == E_OK)
       {
         /* Mac and padding is available in temp buffer */
         TCPIP_P2C(uint8) tmpBuffPtr = TcpIp_GetAddrTlsTemporaryHmacBuffer(TcpIp_GetTlsTemporaryHmacBufferStartIdxOfTlsConnection(TlsConIdx)
@@ -1235,15 +1240,32 @@ TCPIP_LOCAL FUNC(Std_ReturnType, TCPIP_CODE)  TcpIp_Tls12CoreRl_TxCipherGenAndCo
   /* ----- Implementation ----------------------------------------------- */
   TCPIP_ASSERT((TcpSeg1->Size + TcpSeg2->Size) >= TCPIP_TLS_AES128_IV_LEN);
 
-  TcpIp_SegmentInit(&tmpAesIvSeg, &tmpAesIv[0], TCPIP_TLS_AES128_IV_LEN);
+  /* The first TCP buffer segment is never empty here (wraparound case of the streaming mode). */
+  if (TcpSeg1->AvailLen >= TCPIP_TLS_AES128_IV_LEN)
+  {
+    /* #10 The Iv fits into the first TCP buffer segment: Generate it directly into the TcpIp buffer and set the CSM
+     *     Key */
+    TcpIp_SegmentInit(&tmpAesIvSeg, TcpSeg1->AvailPtr, TCPIP_TLS_AES128_IV_LEN);
 
-  /* #10 Generate Aes Iv and set it to the CSM Key, and copy into the TcpIp buffer */
-  if (TcpIp_Tls12CoreCrypto_GenerateAesIv(TlsConIdx, &tmpAesIvSeg) == E_OK)
+    if (TcpIp_Tls12CoreCrypto_GenerateAesIv(TlsConIdx, &tmpAesIvSeg) == E_OK)
+    {
+      TcpIp_SegmentCommit(TcpSeg1, TCPIP_TLS_AES128_IV_LEN);
+
+      retVal = E_OK;
+    }
+  }
+  else
   {
-    /* Copy the generated Iv into TcpIpBuffer, considering TcpIp buffer wraparound */
-    TcpIp_SegmentMultiTargetMemCpy(TcpSeg1, TcpSeg2, &tmpAesIv[0], TCPIP_TLS_AES128_IV_LEN);
+    TcpIp_SegmentInit(&tmpAesIvSeg, &tmpAesIv[0], TCPIP_TLS_AES128_IV_LEN);
 
-    retVal = E_OK;
+    /* #20 Otherwise generate Aes Iv and set it to the CSM Key, and copy into the TcpIp buffer */
+    if (TcpIp_Tls12CoreCrypto_GenerateAesIv(TlsConIdx, &tmpAesIvSeg) == E_OK)
+    {
+      /* Copy the generated Iv into TcpIpBuffer, considering TcpIp buffer wraparound */
+      TcpIp_SegmentMultiTargetMemCpy(TcpSeg1, TcpSeg2, &tmpAesIv[0], TCPIP_TLS_AES128_IV_LEN);
+
+      retVal = E_OK;
+    }
   }
 
   return retVal;